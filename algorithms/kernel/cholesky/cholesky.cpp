@@ -47,6 +47,7 @@
 
 #include "cholesky_types.h"
 #include "serialization_utils.h"
+#include "daal_strings.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -61,7 +62,7 @@ namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_CHOLESKY_RESULT_ID);
 
-Input::Input() : daal::algorithms::Input(lastInputId + 1) {}
+Input::Input() : daal::algorithms::Input(lastBatchedInputId + 1) {}
 
 /**
  * Returns input NumericTable of the Cholesky algorithm
@@ -83,6 +84,26 @@ void Input::set(InputId id, const NumericTablePtr &ptr)
     Argument::set(id, ptr);
 }
 
+/**
+ * Returns input tensor of the Cholesky algorithm
+ * \param[in] id    Identifier of the input tensor
+ * \return          %Input tensor that corresponds to the given identifier
+ */
+TensorPtr Input::get(BatchedInputId id) const
+{
+    return staticPointerCast<Tensor, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets input tensor for the Cholesky algorithm
+ * \param[in] id    Identifier of the input object
+ * \param[in] ptr   Pointer to the object
+ */
+void Input::set(BatchedInputId id, const TensorPtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
 /**
  * Checks parameters of the Cholesky algorithm
  * \param[in] par     %Parameter of algorithm
@@ -90,6 +111,26 @@ void Input::set(InputId id, const NumericTablePtr &ptr)
  */
 Status Input::check(const daal::algorithms::Parameter *par, int method) const
 {
+    if(method == batchedDense)
+    {
+        TensorPtr inTensor = get(matrices);
+        DAAL_CHECK_EX(inTensor.get(), ErrorNullTensor, ArgumentName, matricesStr());
+        DAAL_CHECK_EX(inTensor->getNumberOfDimensions() == 3, ErrorIncorrectNumberOfDimensionsInTensor, ArgumentName, matricesStr());
+
+        const Collection<size_t> &dims = inTensor->getDimensions();
+        DAAL_CHECK_EX(dims[0] > 0 && dims[1] > 0 && dims[1] == dims[2], ErrorIncorrectSizeOfDimensionInTensor, ArgumentName, matricesStr());
+
+        TensorPtr rhsTensor = get(rightHandSides);
+        if(rhsTensor)
+        {
+            DAAL_CHECK_EX(rhsTensor->getNumberOfDimensions() == 3, ErrorIncorrectNumberOfDimensionsInTensor, ArgumentName, rightHandSidesStr());
+            const Collection<size_t> &rhsDims = rhsTensor->getDimensions();
+            DAAL_CHECK_EX(rhsDims[0] == dims[0] && rhsDims[1] > 0 && rhsDims[2] == dims[1], ErrorIncorrectSizeOfDimensionInTensor,
+                ArgumentName, rightHandSidesStr());
+        }
+        return Status();
+    }
+
     NumericTablePtr inTable = get(data);
 
     DAAL_CHECK(inTable.get(), ErrorNullInputNumericTable);
@@ -109,7 +150,7 @@ Status Input::check(const daal::algorithms::Parameter *par, int method) const
     return Status();
 }
 
-Result::Result() : daal::algorithms::Result(lastResultId + 1) {}
+Result::Result() : daal::algorithms::Result(lastBatchedResultId + 1) {}
 
  /**
  * Returns result of the Cholesky algorithm
@@ -131,6 +172,26 @@ void Result::set(ResultId id, const NumericTablePtr &ptr)
     Argument::set(id, ptr);
 }
 
+/**
+ * Returns result tensor of the Cholesky algorithm
+ * \param[in] id   Identifier of the result
+ * \return         Final result that corresponds to the given identifier
+ */
+TensorPtr Result::get(BatchedResultId id) const
+{
+    return staticPointerCast<Tensor, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the result tensor of the Cholesky algorithm
+ * \param[in] id    Identifier of the result
+ * \param[in] ptr   Pointer to the result
+ */
+void Result::set(BatchedResultId id, const TensorPtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
 /**
  * Checks the result of the Cholesky algorithm
  * \param[in] input   %Input of algorithm
@@ -139,6 +200,22 @@ void Result::set(ResultId id, const NumericTablePtr &ptr)
  */
 Status Result::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const
 {
+    if(method == batchedDense)
+    {
+        const Input *algInput = static_cast<const Input *>(input);
+        const Collection<size_t> &dims = algInput->get(matrices)->getDimensions();
+
+        Status s;
+        DAAL_CHECK_STATUS(s, checkTensor(get(choleskyFactors).get(), choleskyFactorsStr(), &dims));
+
+        TensorPtr rhsTensor = algInput->get(rightHandSides);
+        if(rhsTensor)
+        {
+            DAAL_CHECK_STATUS(s, checkTensor(get(solutions).get(), solutionsStr(), &rhsTensor->getDimensions()));
+        }
+        return s;
+    }
+
     NumericTablePtr resTable = get(choleskyFactor);
 
     DAAL_CHECK(resTable.get(), ErrorNullInputNumericTable);
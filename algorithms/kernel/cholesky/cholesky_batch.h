@@ -68,8 +68,19 @@ template <typename algFPType>
 DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, const int method)
 {
     Input *algInput = static_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
-    size_t nFeatures = algInput->get(data)->getNumberOfColumns();
     services::Status status;
+    if(method == batchedDense)
+    {
+        set(choleskyFactors, HomogenTensor<algFPType>::create(algInput->get(matrices)->getDimensions(), Tensor::doAllocate, &status));
+        DAAL_CHECK_STATUS_VAR(status);
+
+        TensorPtr rhsTensor = algInput->get(rightHandSides);
+        if(rhsTensor)
+            set(solutions, HomogenTensor<algFPType>::create(rhsTensor->getDimensions(), Tensor::doAllocate, &status));
+        return status;
+    }
+
+    size_t nFeatures = algInput->get(data)->getNumberOfColumns();
     set(choleskyFactor, HomogenNumericTable<algFPType>::create(nFeatures, nFeatures, NumericTable::doAllocate, &status));
     return status;
 }
@@ -0,0 +1,114 @@
+/* file: cholesky_batched_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of Cholesky decomposition for a batch of small matrices
+//--
+*/
+
+#include "service_tensor.h"
+#include "service_batched_cholesky.h"
+
+using namespace daal::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace cholesky
+{
+namespace internal
+{
+
+template<typename algorithmFPType, CpuType cpu>
+Status CholeskyKernel<algorithmFPType, batchedDense, cpu>::compute(const Tensor *a, const Tensor *b, Tensor *l, Tensor *x)
+{
+    const size_t nMatrices = a->getDimensionSize(0);
+    const size_t dim       = a->getDimensionSize(1);
+    const size_t nRhs      = b ? b->getDimensionSize(1) : 0;
+
+    ReadSubtensor<algorithmFPType, cpu> aBlock(const_cast<Tensor *>(a));
+    DAAL_CHECK_BLOCK_STATUS(aBlock);
+    const algorithmFPType *pA = aBlock.get();
+
+    WriteOnlySubtensor<algorithmFPType, cpu> lBlock(l);
+    DAAL_CHECK_BLOCK_STATUS(lBlock);
+    algorithmFPType *pL = lBlock.get();
+
+    /* Lower triangles of the input matrices are copied to the result, upper triangles of the factors are zeroed */
+    daal::threader_for(nMatrices, nMatrices, [ = ](size_t iMatrix)
+    {
+        const algorithmFPType *ai = pA + iMatrix * dim * dim;
+        algorithmFPType *li = pL + iMatrix * dim * dim;
+        for(size_t i = 0; i < dim; i++)
+        {
+            for(size_t j = 0; j <= i; j++)
+            {
+                li[i * dim + j] = ai[i * dim + j];
+            }
+            for(size_t j = i + 1; j < dim; j++)
+            {
+                li[i * dim + j] = 0;
+            }
+        }
+    });
+
+    ReadSubtensor<algorithmFPType, cpu> bBlock(const_cast<Tensor *>(b));
+    WriteOnlySubtensor<algorithmFPType, cpu> xBlock(b ? x : nullptr);
+    algorithmFPType *pX = nullptr;
+    if(b)
+    {
+        DAAL_CHECK_BLOCK_STATUS(bBlock);
+        DAAL_CHECK_BLOCK_STATUS(xBlock);
+        pX = xBlock.get();
+        const size_t rhsSize = nMatrices * nRhs * dim * sizeof(algorithmFPType);
+        daal_memcpy_s(pX, rhsSize, bBlock.get(), rhsSize);
+    }
+
+    return algorithms::internal::SmallCholesky<algorithmFPType, cpu>::computeBatch(nMatrices, dim, pL, nRhs, pX);
+}
+
+} // namespace daal::internal
+} // namespace daal::cholesky
+}
+} // namespace daal
@@ -83,6 +83,17 @@ private:
                                    DAAL_INT dim) const;
 };
 
+/**
+ *  \brief Kernel for Cholesky decomposition of a batch of small matrices
+ *  and solution of the corresponding linear systems
+ */
+template<typename algorithmFPType, CpuType cpu>
+class CholeskyKernel<algorithmFPType, batchedDense, cpu> : public Kernel
+{
+public:
+    services::Status compute(const Tensor *a, const Tensor *b, Tensor *l, Tensor *x);
+};
+
 } // namespace daal::internal
 }
 }
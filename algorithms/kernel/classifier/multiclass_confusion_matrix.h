@@ -73,12 +73,53 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *inp
     services::Status st;
     const Parameter *classifierParam = static_cast<const Parameter *>(parameter);
     size_t nClasses = classifierParam->nClasses;
-    set(confusionMatrix, data_management::HomogenNumericTable<algorithmFPType>::create(nClasses, nClasses, data_management::NumericTableIface::doAllocate, &st));
+    /* The counts are stored in double precision for any algorithmFPType, float represents integers exactly only up to 2^24 */
+    set(confusionMatrix, data_management::HomogenNumericTable<double>::create(nClasses, nClasses, data_management::NumericTableIface::doAllocate, &st));
 
     set(multiClassMetrics, data_management::HomogenNumericTable<algorithmFPType>::create(8, 1, data_management::NumericTableIface::doAllocate, &st));
     return st;
 }
 
+/**
+ * Allocates memory for storing the computed quality metric from the partial result
+ * \param[in] partialResult Pointer to the partial result structure
+ * \param[in] parameter     Pointer to the parameter structure
+ * \param[in] method        Computation method of the algorithm
+ */
+template<typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method)
+{
+    return allocate<algorithmFPType>(static_cast<const daal::algorithms::Input *>(NULL), parameter, method);
+}
+
+/**
+ * Allocates memory for storing partial results of the multi-class confusion matrix algorithm
+ * \param[in] input     Pointer to the input structure
+ * \param[in] parameter Pointer to the parameter structure
+ * \param[in] method    Computation method of the algorithm
+ */
+template<typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    services::Status st;
+    const Parameter *classifierParam = static_cast<const Parameter *>(parameter);
+    size_t nClasses = classifierParam->nClasses;
+    set(partialConfusionMatrix, data_management::HomogenNumericTable<double>::create(nClasses, nClasses, data_management::NumericTableIface::doAllocate, &st));
+    return st;
+}
+
+/**
+ * Initializes partial results of the multi-class confusion matrix algorithm with zeros
+ * \param[in] input     Pointer to the input structure
+ * \param[in] parameter Pointer to the parameter structure
+ * \param[in] method    Computation method of the algorithm
+ */
+template<typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::initialize(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    return get(partialConfusionMatrix)->assign(0.0);
+}
+
 } // namespace multiclass_confusion_matrix
 } // namespace quality_metric
 } // namespace classifier
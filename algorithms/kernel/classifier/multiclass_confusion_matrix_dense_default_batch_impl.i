@@ -50,6 +50,8 @@
 
 #include "service_memory.h"
 #include "service_numeric_table.h"
+#include "service_error_handling.h"
+#include "threading.h"
 
 using namespace daal::internal;
 using namespace daal::services;
@@ -68,6 +70,9 @@ namespace multiclass_confusion_matrix
 namespace internal
 {
 
+/* Number of label rows processed by one thread at once */
+const size_t nRowsInBlock = 4096;
+
 template<Method method, typename algorithmFPType, CpuType cpu>
 Status MultiClassConfusionMatrixKernel<method, algorithmFPType, cpu>::compute(const NumericTable *predictedLabelsTable,
                                                                               const NumericTable *groundTruthLabelsTable,
@@ -75,70 +80,189 @@ Status MultiClassConfusionMatrixKernel<method, algorithmFPType, cpu>::compute(co
                                                                               NumericTable *accuracyMeasuresTable,
                                                                               const multiclass_confusion_matrix::Parameter *parameter)
 {
-    const algorithmFPType zero = 0.0;
+    const size_t nClasses = parameter->nClasses;
+    TArrayCalloc<double, cpu> aCounts(nClasses * nClasses);
+    DAAL_CHECK_MALLOC(aCounts.get());
 
-    const size_t nVectors = predictedLabelsTable->getNumberOfRows();
+    Status s;
+    DAAL_CHECK_STATUS(s, accumulate(predictedLabelsTable, groundTruthLabelsTable, nClasses, aCounts.get()));
+    return finalize(aCounts.get(), nClasses, confusionMatrixTable, accuracyMeasuresTable, parameter);
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+Status MultiClassConfusionMatrixKernel<method, algorithmFPType, cpu>::computePartial(const NumericTable *predictedLabelsTable,
+                                                                                     const NumericTable *groundTruthLabelsTable,
+                                                                                     NumericTable *partialConfusionMatrixTable,
+                                                                                     const multiclass_confusion_matrix::Parameter *parameter)
+{
+    const size_t nClasses = parameter->nClasses;
+    WriteRows<double, cpu> mtPartial(partialConfusionMatrixTable, 0, nClasses);
+    DAAL_CHECK_BLOCK_STATUS(mtPartial);
 
-    /* Get input data */
-    ReadColumns<algorithmFPType, cpu> mtPredictedLabels(*const_cast<NumericTable*>(predictedLabelsTable), 0, 0, nVectors);
-    DAAL_CHECK_BLOCK_STATUS(mtPredictedLabels);
-    ReadColumns<algorithmFPType, cpu> mtGroundTruthLabels(*const_cast<NumericTable*>(groundTruthLabelsTable), 0, 0, nVectors);
-    DAAL_CHECK_BLOCK_STATUS(mtGroundTruthLabels);
+    return accumulate(predictedLabelsTable, groundTruthLabelsTable, nClasses, mtPartial.get());
+}
 
-    /* Get memory to write the results */
+template<Method method, typename algorithmFPType, CpuType cpu>
+Status MultiClassConfusionMatrixKernel<method, algorithmFPType, cpu>::merge(DataCollection *partialResultsCollection,
+                                                                            NumericTable *partialConfusionMatrixTable,
+                                                                            const multiclass_confusion_matrix::Parameter *parameter)
+{
     const size_t nClasses = parameter->nClasses;
-    WriteOnlyRows<int, cpu> mtConfusionMatrix(confusionMatrixTable, 0, nClasses);
+    const size_t nElements = nClasses * nClasses;
+    WriteRows<double, cpu> mtPartial(partialConfusionMatrixTable, 0, nClasses);
+    DAAL_CHECK_BLOCK_STATUS(mtPartial);
+    double *counts = mtPartial.get();
+
+    const size_t nBlocks = partialResultsCollection->size();
+    for (size_t j = 0; j < nBlocks; j++)
+    {
+        PartialResultPtr partialResult = PartialResult::cast((*partialResultsCollection)[j]);
+        ReadRows<double, cpu> mtLocal(partialResult->get(partialConfusionMatrix).get(), 0, nClasses);
+        DAAL_CHECK_BLOCK_STATUS(mtLocal);
+        const double *localCounts = mtLocal.get();
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < nElements; i++)
+        {
+            counts[i] += localCounts[i];
+        }
+    }
+    return Status();
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+Status MultiClassConfusionMatrixKernel<method, algorithmFPType, cpu>::finalizeCompute(const NumericTable *partialConfusionMatrixTable,
+                                                                                      NumericTable *confusionMatrixTable,
+                                                                                      NumericTable *accuracyMeasuresTable,
+                                                                                      const multiclass_confusion_matrix::Parameter *parameter)
+{
+    const size_t nClasses = parameter->nClasses;
+    ReadRows<double, cpu> mtPartial(*const_cast<NumericTable *>(partialConfusionMatrixTable), 0, nClasses);
+    DAAL_CHECK_BLOCK_STATUS(mtPartial);
+
+    return finalize(mtPartial.get(), nClasses, confusionMatrixTable, accuracyMeasuresTable, parameter);
+}
+
+/**
+ *  \brief Adds the numbers of (ground truth, predicted) label pairs to counts.
+ *         Blocks of rows are processed in parallel, each thread updates its own copy of the counts
+ *         and the copies are summed at the end, so the threads never write to shared memory
+ */
+template<Method method, typename algorithmFPType, CpuType cpu>
+Status MultiClassConfusionMatrixKernel<method, algorithmFPType, cpu>::accumulate(const NumericTable *predictedLabelsTable,
+                                                                                 const NumericTable *groundTruthLabelsTable,
+                                                                                 size_t nClasses, double *counts)
+{
+    const size_t nVectors = predictedLabelsTable->getNumberOfRows();
+    const size_t nElements = nClasses * nClasses;
+    const size_t nBlocks = nVectors / nRowsInBlock + !!(nVectors % nRowsInBlock);
+
+    NumericTable &predictedTable = *const_cast<NumericTable *>(predictedLabelsTable);
+    NumericTable &groundTruthTable = *const_cast<NumericTable *>(groundTruthLabelsTable);
+
+    daal::tls<double *> tlsCounts([ = ]()
+    {
+        return service_scalable_calloc<double, cpu>(nElements);
+    });
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [ =, &tlsCounts, &predictedTable, &groundTruthTable, &safeStat ](size_t iBlock)
+    {
+        const size_t startRow = iBlock * nRowsInBlock;
+        const size_t nRows = (iBlock == nBlocks - 1) ? nVectors - startRow : nRowsInBlock;
+
+        double *localCounts = tlsCounts.local();
+        DAAL_CHECK_MALLOC_THR(localCounts);
+
+        ReadColumns<algorithmFPType, cpu> mtPredictedLabels(predictedTable, 0, startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(mtPredictedLabels);
+        ReadColumns<algorithmFPType, cpu> mtGroundTruthLabels(groundTruthTable, 0, startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(mtGroundTruthLabels);
+
+        const algorithmFPType *predictedLabelsData = mtPredictedLabels.get();
+        const algorithmFPType *groundTruthLabelsData = mtGroundTruthLabels.get();
+        const algorithmFPType fpNClasses = (algorithmFPType)nClasses;
+
+        for (size_t i = 0; i < nRows; i++)
+        {
+            DAAL_CHECK_THR(predictedLabelsData[i] >= 0 && predictedLabelsData[i] < fpNClasses, ErrorIncorrectClassLabels)
+            DAAL_CHECK_THR(groundTruthLabelsData[i] >= 0 && groundTruthLabelsData[i] < fpNClasses, ErrorIncorrectClassLabels)
+
+            const size_t predictedLabel   = (size_t)predictedLabelsData[i];
+            const size_t groundTruthLabel = (size_t)groundTruthLabelsData[i];
+
+            localCounts[groundTruthLabel * nClasses + predictedLabel] += 1.0;
+        }
+    });
+
+    tlsCounts.reduce([ = ](double *localCounts)
+    {
+        if (!localCounts) { return; }
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < nElements; i++)
+        {
+            counts[i] += localCounts[i];
+        }
+        service_scalable_free<double, cpu>(localCounts);
+    });
+    return safeStat.detach();
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+Status MultiClassConfusionMatrixKernel<method, algorithmFPType, cpu>::finalize(const double *counts, size_t nClasses,
+                                                                               NumericTable *confusionMatrixTable,
+                                                                               NumericTable *accuracyMeasuresTable,
+                                                                               const multiclass_confusion_matrix::Parameter *parameter)
+{
+    const algorithmFPType zero = 0.0;
+
+    /* Get memory to write the results. The counts are written in double precision whatever algorithmFPType is:
+       the counts above 2^24 are not exact in float and the int conversion overflows above 2^31 - 1 */
+    WriteOnlyRows<double, cpu> mtConfusionMatrix(confusionMatrixTable, 0, nClasses);
     DAAL_CHECK_BLOCK_STATUS(mtConfusionMatrix);
     WriteOnlyRows<algorithmFPType, cpu> mtAccuracyMeasures(accuracyMeasuresTable, 0, 1);
     DAAL_CHECK_BLOCK_STATUS(mtAccuracyMeasures);
 
-    const algorithmFPType *predictedLabelsData = mtPredictedLabels.get();
-    const algorithmFPType *groundTruthLabelsData = mtGroundTruthLabels.get();
-    int *confusionMatrixData = mtConfusionMatrix.get();
+    double *confusionMatrixData = mtConfusionMatrix.get();
     algorithmFPType *accuracyMeasuresData = mtAccuracyMeasures.get();
 
+    double nVectors = 0.0;
+    for (size_t i = 0; i < nClasses * nClasses; i++)
+    {
+        confusionMatrixData[i] = counts[i];
+        nVectors += counts[i];
+    }
+
     const algorithmFPType invNVectors = 1.0 / algorithmFPType(nVectors);
     const algorithmFPType invNClasses = 1.0 / algorithmFPType(nClasses);
     algorithmFPType beta = parameter->beta;
     algorithmFPType beta2 = beta * beta;
 
-    service_memset<int, cpu>(confusionMatrixData, 0, nClasses * nClasses);
-
-    /* Compute confusion matrix for multi-class classifier */
-    for (size_t i = 0; i < nVectors; i++)
-    {
-        DAAL_CHECK(predictedLabelsData[i] >= 0 && predictedLabelsData[i] < nClasses, ErrorIncorrectClassLabels)
-        DAAL_CHECK(groundTruthLabelsData[i] >= 0 && groundTruthLabelsData[i] < nClasses, ErrorIncorrectClassLabels)
-
-        size_t predictedLabel   = (size_t)predictedLabelsData[i];
-        size_t groundTruthLabel = (size_t)groundTruthLabelsData[i];
-
-        confusionMatrixData[groundTruthLabel * nClasses + predictedLabel]++;
-    }
-
-    TArray<algorithmFPType, cpu> aTp(nClasses);
-    TArray<algorithmFPType, cpu> aFp(nClasses);
-    TArray<algorithmFPType, cpu> aTn(nClasses);
-    TArray<algorithmFPType, cpu> aFn(nClasses);
+    /* Numbers of true and false positives and negatives are counts as well, so they are kept in double precision */
+    TArray<double, cpu> aTp(nClasses);
+    TArray<double, cpu> aFp(nClasses);
+    TArray<double, cpu> aTn(nClasses);
+    TArray<double, cpu> aFn(nClasses);
 
-    algorithmFPType* tp = aTp.get();
-    algorithmFPType* fp = aFp.get();
-    algorithmFPType* tn = aTn.get();
-    algorithmFPType* fn = aFn.get();
+    double* tp = aTp.get();
+    double* fp = aFp.get();
+    double* tn = aTn.get();
+    double* fn = aFn.get();
     DAAL_CHECK(tp && fp && tn && fn, ErrorMemoryAllocationFailed);
 
-    algorithmFPType fpNVectors(nVectors);
     for (size_t i = 0; i < nClasses; i++)
     {
-        tp[i] = confusionMatrixData[i*nClasses + i];
+        tp[i] = counts[i*nClasses + i];
         fp[i] = -tp[i];
         fn[i] = -tp[i];
         for (size_t j = 0; j < nClasses; j++)
         {
-            fn[i] += confusionMatrixData[i*nClasses + j];
-            fp[i] += confusionMatrixData[j*nClasses + i];
+            fn[i] += counts[i*nClasses + j];
+            fp[i] += counts[j*nClasses + i];
         }
-        tn[i] = fpNVectors - tp[i] - fp[i] - fn[i];
+        tn[i] = nVectors - tp[i] - fp[i] - fn[i];
     }
 
     service_memset<algorithmFPType, cpu>(accuracyMeasuresData, zero, 8);
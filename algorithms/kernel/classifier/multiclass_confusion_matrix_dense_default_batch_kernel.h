@@ -51,6 +51,7 @@
 #include "multiclass_confusion_matrix_types.h"
 #include "kernel.h"
 #include "numeric_table.h"
+#include "data_collection.h"
 
 using namespace daal::data_management;
 
@@ -76,6 +77,25 @@ public:
     services::Status compute(const NumericTable *predictedLabels, const NumericTable *groundTruthLabels,
                              NumericTable *confusionMatrix, NumericTable *accuracyMeasures,
                              const multiclass_confusion_matrix::Parameter *parameter);
+
+    /** Adds the counts of the block of labels to the partial confusion matrix (online and step1Local) */
+    services::Status computePartial(const NumericTable *predictedLabels, const NumericTable *groundTruthLabels,
+                                    NumericTable *partialConfusionMatrix, const multiclass_confusion_matrix::Parameter *parameter);
+
+    /** Sums the partial confusion matrices computed on local nodes (step2Master) */
+    services::Status merge(DataCollection *partialResults, NumericTable *partialConfusionMatrix,
+                           const multiclass_confusion_matrix::Parameter *parameter);
+
+    /** Computes the confusion matrix and the quality metrics from the partial confusion matrix */
+    services::Status finalizeCompute(const NumericTable *partialConfusionMatrix, NumericTable *confusionMatrix,
+                                     NumericTable *accuracyMeasures, const multiclass_confusion_matrix::Parameter *parameter);
+
+protected:
+    services::Status accumulate(const NumericTable *predictedLabels, const NumericTable *groundTruthLabels,
+                                size_t nClasses, double *counts);
+
+    services::Status finalize(const double *counts, size_t nClasses, NumericTable *confusionMatrix,
+                              NumericTable *accuracyMeasures, const multiclass_confusion_matrix::Parameter *parameter);
 };
 
 }
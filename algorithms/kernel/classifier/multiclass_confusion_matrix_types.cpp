@@ -67,6 +67,7 @@ namespace interface1
 {
 
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_CLASSIFIER_MULTICLASS_CONFUSION_MATRIX_RESULT_ID);
+__DAAL_REGISTER_SERIALIZATION_CLASS(PartialResult, SERIALIZATION_CLASSIFIER_MULTICLASS_CONFUSION_MATRIX_PARTIAL_RESULT_ID);
 Parameter::Parameter(size_t nClasses, double beta) : nClasses(nClasses), beta(beta) {}
 
 Status Parameter::check() const
@@ -161,6 +162,126 @@ Status Result::check(const daal::algorithms::Input *input, const daal::algorithm
     return checkNumericTable(multiClassMetricsTable.get(), multiClassMetricsStr(), unexpectedLayouts, 0, 8, 1);
 }
 
+/**
+ * Checks the correctness of the Result object computed from the partial result
+ * \param[in] partialResult Pointer to the partial result structure
+ * \param[in] parameter     Pointer to the structure of the algorithm parameters
+ * \param[in] method        Computation method
+ */
+Status Result::check(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, int method) const
+{
+    return check(static_cast<const daal::algorithms::Input *>(NULL), parameter, method);
+}
+
+
+PartialResult::PartialResult() : daal::algorithms::PartialResult(lastPartialResultId + 1) {}
+
+/**
+ * Returns the partial result of the multi-class confusion matrix algorithm
+ * \param[in] id    Identifier of the partial result, \ref PartialResultId
+ * \return          Partial result that corresponds to the given identifier
+ */
+NumericTablePtr PartialResult::get(PartialResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the partial result of the multi-class confusion matrix algorithm
+ * \param[in] id    Identifier of the partial result, \ref PartialResultId
+ * \param[in] value Pointer to the partial result
+ */
+void PartialResult::set(PartialResultId id, const NumericTablePtr &value)
+{
+    Argument::set(id, value);
+}
+
+/**
+ * Checks the correctness of the PartialResult object
+ * \param[in] input     Pointer to the input structure
+ * \param[in] parameter Pointer to the structure of the algorithm parameters
+ * \param[in] method    Computation method
+ */
+Status PartialResult::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const
+{
+    return check(parameter, method);
+}
+
+/**
+ * Checks the correctness of the PartialResult object
+ * \param[in] parameter Pointer to the structure of the algorithm parameters
+ * \param[in] method    Computation method
+ */
+Status PartialResult::check(const daal::algorithms::Parameter *parameter, int method) const
+{
+    const Parameter *algParameter = static_cast<const Parameter *>(parameter);
+    const size_t nClasses = algParameter->nClasses;
+    const int unexpectedLayouts = (int)packed_mask;
+
+    return checkNumericTable(get(partialConfusionMatrix).get(), partialConfusionMatrixStr(), unexpectedLayouts, 0, nClasses, nClasses);
+}
+
+
+DistributedInput<step2Master>::DistributedInput() : daal::algorithms::Input(lastMasterInputId + 1)
+{
+    Argument::set(partialResults, DataCollectionPtr(new DataCollection()));
+}
+
+/**
+ * Adds a partial result to the collection of input objects of the algorithm on the master node
+ * \param[in] id            Identifier of the input object, \ref MasterInputId
+ * \param[in] partialResult Partial result computed on a local node
+ */
+void DistributedInput<step2Master>::add(MasterInputId id, const PartialResultPtr &partialResult)
+{
+    DataCollectionPtr collection = get(id);
+    if(!collection) { return; }
+    collection->push_back(staticPointerCast<SerializationIface, PartialResult>(partialResult));
+}
+
+/**
+ * Sets the input object of the algorithm on the master node
+ * \param[in] id    Identifier of the input object, \ref MasterInputId
+ * \param[in] ptr   Pointer to the collection of partial results
+ */
+void DistributedInput<step2Master>::set(MasterInputId id, const DataCollectionPtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Returns the collection of input objects of the algorithm on the master node
+ * \param[in] id    Identifier of the input object, \ref MasterInputId
+ * \return          Collection of partial results
+ */
+DataCollectionPtr DistributedInput<step2Master>::get(MasterInputId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Checks the correctness of the input objects on the master node
+ * \param[in] parameter Pointer to the structure of the algorithm parameters
+ * \param[in] method    Computation method
+ */
+Status DistributedInput<step2Master>::check(const daal::algorithms::Parameter *parameter, int method) const
+{
+    Status s;
+    DataCollectionPtr collection = get(partialResults);
+    DAAL_CHECK_EX(collection, ErrorNullInputDataCollection, ArgumentName, partialResultsStr());
+
+    const size_t nBlocks = collection->size();
+    DAAL_CHECK_EX(nBlocks > 0, ErrorIncorrectNumberOfInputNumericTables, ArgumentName, partialResultsStr());
+
+    for(size_t j = 0; j < nBlocks; j++)
+    {
+        PartialResultPtr partialResult = PartialResult::cast((*collection)[j]);
+        DAAL_CHECK_EX(partialResult, ErrorIncorrectElementInPartialResultCollection, ArgumentName, partialResultsStr());
+        DAAL_CHECK_STATUS(s, partialResult->check(parameter, method));
+    }
+    return s;
+}
+
 } // namespace interface1
 } // multiclass_confusion_matrix
 } // namespace quality_metric
@@ -61,6 +61,9 @@ namespace correlation_distance
 namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_CORRELATION_DISTANCE_RESULT_ID);
+
+Parameter::Parameter(size_t k) : k(k) {}
+
 Input::Input() : daal::algorithms::Input(lastInputId + 1) {}
 
 /**
@@ -90,7 +93,23 @@ void Input::set(InputId id, const data_management::NumericTablePtr &ptr)
 */
 services::Status Input::check(const daal::algorithms::Parameter *par, int method) const
 {
-    return data_management::checkNumericTable(get(data).get(), dataStr());
+    services::Status s;
+    DAAL_CHECK_STATUS(s, data_management::checkNumericTable(get(data).get(), dataStr()));
+
+    const size_t nFeatures = get(data)->getNumberOfColumns();
+    size_t nCandidates = get(data)->getNumberOfRows() - 1;
+    if(get(secondData))
+    {
+        DAAL_CHECK_STATUS(s, data_management::checkNumericTable(get(secondData).get(), secondDataStr(), 0, 0, nFeatures));
+        nCandidates = get(secondData)->getNumberOfRows();
+    }
+
+    const Parameter *parameter = static_cast<const Parameter *>(par);
+    if(parameter)
+    {
+        DAAL_CHECK_EX(parameter->k <= nCandidates, services::ErrorIncorrectParameter, services::ParameterName, kStr());
+    }
+    return s;
 }
 
 Result::Result() : daal::algorithms::Result(lastResultId + 1) {}
@@ -130,6 +149,23 @@ services::Status Result::check(const daal::algorithms::Input *input, const daal:
                             (int)data_management::NumericTableIface::upperPackedTriangularMatrix |
                             (int)data_management::NumericTableIface::lowerPackedTriangularMatrix;
 
+    const Parameter *parameter = static_cast<const Parameter *>(par);
+    if(parameter && parameter->k > 0)
+    {
+        services::Status s;
+        DAAL_CHECK_STATUS(s, data_management::checkNumericTable(get(nearestIndices).get(), nearestIndicesStr(), data_management::packed_mask, 0,
+                                                               parameter->k, nVectors));
+        return data_management::checkNumericTable(get(nearestDistances).get(), nearestDistancesStr(), data_management::packed_mask, 0,
+                                                  parameter->k, nVectors);
+    }
+
+    data_management::NumericTablePtr secondTable = algInput->get(secondData);
+    if(secondTable)
+    {
+        return data_management::checkNumericTable(get(correlationDistance).get(), correlationDistanceStr(), data_management::packed_mask, 0,
+                                                  secondTable->getNumberOfRows(), nVectors);
+    }
+
     return data_management::checkNumericTable(get(correlationDistance).get(), correlationDistanceStr(), unexpectedLayouts, 0, nVectors, nVectors);
 }
 
@@ -83,10 +83,8 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     size_t na = input->size();
     size_t nr = result->size();
 
-    NumericTable *a0 = static_cast<NumericTable *>(input->get(data).get());
-    NumericTable **a = &a0;
-    NumericTable *r0 = static_cast<NumericTable *>(result->get(correlationDistance).get());
-    NumericTable **r = &r0;
+    NumericTable *a[] = { input->get(data).get(), input->get(secondData).get() };
+    NumericTable *r[] = { result->get(correlationDistance).get(), result->get(nearestIndices).get(), result->get(nearestDistances).get() };
     daal::algorithms::Parameter *par = _par;
     daal::services::Environment::env &env = *_env;
 
@@ -51,6 +51,7 @@
 #include "threading.h"
 #include "service_error_handling.h"
 #include "service_numeric_table.h"
+#include "service_cross_distance.h"
 
 static const int blockSizeDefault = 128;
 #include "cordistance_full_impl.i"
@@ -79,7 +80,20 @@ services::Status DistanceKernel<algorithmFPType, method, cpu>::compute(const siz
         const daal::algorithms::Parameter *par)
 {
     NumericTable *xTable = const_cast<NumericTable *>( a[0] );  /* Input data */
+    NumericTable *yTable = const_cast<NumericTable *>( a[1] );  /* Optional second input data */
     NumericTable *rTable = const_cast<NumericTable *>( r[0] );  /* Result */
+    const Parameter *parameter = static_cast<const Parameter *>(par);
+
+    /* correlation distance is the cosine distance between the rows centered by their means */
+    if(parameter && parameter->k > 0)
+    {
+        return daal::algorithms::internal::crossDistanceTopK<algorithmFPType, cpu>(xTable, yTable, true, parameter->k, r[1], r[2]);
+    }
+    if(yTable)
+    {
+        return daal::algorithms::internal::crossDistanceFull<algorithmFPType, cpu>(xTable, yTable, true, rTable);
+    }
+
     const NumericTableIface::StorageLayout rLayout = r[0]->getDataLayout();
 
     if(isFull<algorithmFPType, cpu>(rLayout))
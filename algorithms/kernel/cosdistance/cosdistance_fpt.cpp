@@ -65,11 +65,32 @@ template <typename algorithmFPType>
 DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, const int method)
 {
     Input *algInput = static_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
+    const Parameter *parameter = static_cast<const Parameter *>(par);
     size_t dim = algInput->get(data)->getNumberOfRows();
+
+    services::Status s;
+    if(parameter && parameter->k > 0)
+    {
+        Argument::set(nearestIndices, data_management::HomogenNumericTable<int>::create(parameter->k, dim,
+                      data_management::NumericTable::doAllocate, &s));
+        DAAL_CHECK_STATUS_VAR(s);
+        Argument::set(nearestDistances, data_management::HomogenNumericTable<algorithmFPType>::create(parameter->k, dim,
+                      data_management::NumericTable::doAllocate, &s));
+        return s;
+    }
+
+    data_management::NumericTablePtr secondTable = algInput->get(secondData);
+    if(secondTable)
+    {
+        Argument::set(cosineDistance, data_management::HomogenNumericTable<algorithmFPType>::create(secondTable->getNumberOfRows(), dim,
+                      data_management::NumericTable::doAllocate, &s));
+        return s;
+    }
+
     Argument::set(cosineDistance, data_management::SerializationIfacePtr(
                       new data_management::PackedSymmetricMatrix<data_management::NumericTableIface::lowerPackedSymmetricMatrix, algorithmFPType>(
                           dim, data_management::NumericTable::doAllocate)));
-    return services::Status();
+    return s;
 }
 
 template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, const int method);
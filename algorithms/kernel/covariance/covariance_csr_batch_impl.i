@@ -71,17 +71,17 @@ services::Status CovarianceCSRBatchKernel<algorithmFPType, method, cpu>::compute
 
     const size_t nFeatures = dataTable->getNumberOfColumns();
     const size_t nVectors  = dataTable->getNumberOfRows();
-    CSRNumericTableIface *csrDataTable = dynamic_cast<CSRNumericTableIface* >(dataTable);
 
-    DEFINE_TABLE_BLOCK_EX ( ReadRowsCSR,   dataBlock,         csrDataTable, 0, nVectors );
-    DEFINE_TABLE_BLOCK    ( WriteOnlyRows, sumBlock,          meanTable                 );
-    DEFINE_TABLE_BLOCK    ( WriteOnlyRows, crossProductBlock, covTable                  );
+    /* Cross-products are accumulated row by row, so CSC data is read in the CSR layout */
+    DEFINE_TABLE_BLOCK_EX ( ReadRowsSparse, dataBlock,         dataTable  );
+    DEFINE_TABLE_BLOCK    ( WriteOnlyRows,  sumBlock,          meanTable  );
+    DEFINE_TABLE_BLOCK    ( WriteOnlyRows,  crossProductBlock, covTable   );
 
     algorithmFPType *sums         = sumBlock.get();
     algorithmFPType *crossProduct = crossProductBlock.get();
     algorithmFPType *data         = const_cast<algorithmFPType*>(dataBlock.values());
-    size_t          *colIndices   = dataBlock.cols();
-    size_t          *rowOffsets   = dataBlock.rows();
+    size_t          *colIndices   = const_cast<size_t *>(dataBlock.indices());
+    size_t          *rowOffsets   = const_cast<size_t *>(dataBlock.offsets());
 
     services::Status status;
 
@@ -151,19 +151,19 @@ services::Status CovarianceCSROnlineKernel<algorithmFPType, method, cpu>::comput
 {
     const size_t nFeatures = dataTable->getNumberOfColumns();
     const size_t nVectors  = dataTable->getNumberOfRows();
-    CSRNumericTableIface *csrDataTable = dynamic_cast<CSRNumericTableIface* >(dataTable);
 
-    DEFINE_TABLE_BLOCK_EX ( ReadRowsCSR, dataBlock,          csrDataTable,      0, nVectors );
-    DEFINE_TABLE_BLOCK    ( WriteRows,   sumBlock,           sumTable                       );
-    DEFINE_TABLE_BLOCK    ( WriteRows,   crossProductBlock,  crossProductTable              );
-    DEFINE_TABLE_BLOCK    ( WriteRows,   nObservationsBlock, nObservationsTable             );
+    /* Cross-products are accumulated row by row, so CSC data is read in the CSR layout */
+    DEFINE_TABLE_BLOCK_EX ( ReadRowsSparse, dataBlock,          dataTable                   );
+    DEFINE_TABLE_BLOCK    ( WriteRows,      sumBlock,           sumTable                    );
+    DEFINE_TABLE_BLOCK    ( WriteRows,      crossProductBlock,  crossProductTable           );
+    DEFINE_TABLE_BLOCK    ( WriteRows,      nObservationsBlock, nObservationsTable          );
 
     algorithmFPType *sums          = sumBlock.get();
     algorithmFPType *crossProduct  = crossProductBlock.get();
     algorithmFPType *nObservations = nObservationsBlock.get();
     algorithmFPType *data          = const_cast<algorithmFPType*>(dataBlock.values());
-    size_t          *colIndices    = dataBlock.cols();
-    size_t          *rowOffsets    = dataBlock.rows();
+    size_t          *colIndices    = const_cast<size_t *>(dataBlock.indices());
+    size_t          *rowOffsets    = const_cast<size_t *>(dataBlock.offsets());
 
     TArrayCalloc<algorithmFPType, cpu> partialCrossProductArray(nFeatures * nFeatures);
     DAAL_CHECK_MALLOC(partialCrossProductArray.get());
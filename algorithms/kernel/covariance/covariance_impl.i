@@ -56,6 +56,7 @@
 #include "service_spblas.h"
 #include "service_stat.h"
 #include "service_numeric_table.h"
+#include "service_sparse_utils.h"
 #include "service_error_handling.h"
 #include "threading.h"
 
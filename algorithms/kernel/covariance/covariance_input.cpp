@@ -109,7 +109,7 @@ services::Status Input::check(const daal::algorithms::Parameter *parameter, int
 
     if (method == fastCSR || method == singlePassCSR || method == sumCSR)
     {
-        expectedLayouts = (int)NumericTableIface::csrArray;
+        expectedLayouts = (int)NumericTableIface::csrArray | (int)NumericTableIface::cscArray | (int)NumericTableIface::bsrArray;
     }
 
     s |= checkNumericTable(get(data).get(), dataStr(), 0, expectedLayouts);
@@ -0,0 +1,82 @@
+/* file: elastic_net_model.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the class defining the elastic net regression model
+//--
+*/
+
+#include "elastic_net_model_impl.h"
+#include "serialization_utils.h"
+#include "daal_strings.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace elastic_net
+{
+using namespace daal::data_management;
+using namespace daal::services;
+__DAAL_REGISTER_SERIALIZATION_CLASS2(Model, internal::ModelImpl, SERIALIZATION_ELASTIC_NET_MODEL_ID);
+
+namespace interface1
+{
+
+TrainParameter::TrainParameter() : Parameter(),
+    penaltyL1(0.1), penaltyL2(0.0), nPenalties(1), nIterations(1000), accuracyThreshold(1.0e-7), screeningFlag(true)
+{}
+
+services::Status TrainParameter::check() const
+{
+    DAAL_CHECK_EX(penaltyL1 >= 0, ErrorIncorrectParameter, ArgumentName, penaltyL1Str());
+    DAAL_CHECK_EX(penaltyL2 >= 0, ErrorIncorrectParameter, ArgumentName, penaltyL2Str());
+    DAAL_CHECK_EX(nPenalties > 0, ErrorIncorrectParameter, ArgumentName, nPenaltiesStr());
+    DAAL_CHECK_EX(nIterations > 0, ErrorIncorrectParameter, ArgumentName, nIterationsStr());
+    DAAL_CHECK_EX(accuracyThreshold >= 0, ErrorIncorrectParameter, ArgumentName, accuracyThresholdStr());
+    return services::Status();
+}
+
+} // namespace interface1
+} // namespace elastic_net
+} // namespace algorithms
+} // namespace daal
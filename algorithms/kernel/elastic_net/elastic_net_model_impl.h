@@ -0,0 +1,154 @@
+/* file: elastic_net_model_impl.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the class that implements the elastic net regression model
+//--
+*/
+
+#ifndef __ELASTIC_NET_MODEL_IMPL_H__
+#define __ELASTIC_NET_MODEL_IMPL_H__
+
+#include "algorithms/elastic_net/elastic_net_model.h"
+#include "linear_model_model_impl.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace elastic_net
+{
+namespace internal
+{
+using namespace daal::data_management;
+using namespace daal::services;
+
+/**
+ * \brief Class that connects the interface and implementation of the elastic net regression model
+ */
+class ModelImpl : public elastic_net::Model,
+                  public linear_model::internal::ModelInternal
+{
+public:
+    typedef linear_model::internal::ModelInternal ImplType;
+
+    /**
+     * Constructs the elastic net regression model
+     * \param[in] featnum Number of features in the training data set
+     * \param[in] nrhs    Number of responses in the training data
+     * \param[in] par     Parameters of elastic net regression model-based training
+     * \param[in] dummy   Dummy variable for the templated constructor
+     */
+    template <typename modelFPType>
+    ModelImpl(size_t featnum, size_t nrhs, const elastic_net::Parameter &par, modelFPType dummy) :
+        ImplType(featnum, nrhs, par, dummy)
+    {}
+
+    ModelImpl() {}
+
+    virtual ~ModelImpl() {}
+
+    /**
+     * Initializes the elastic net regression model
+     */
+    Status initialize() DAAL_C11_OVERRIDE { return ImplType::initialize(); }
+
+    /**
+     * Returns the number of regression coefficients
+     * \return Number of regression coefficients
+     */
+    size_t getNumberOfBetas() const DAAL_C11_OVERRIDE  { return ImplType::getNumberOfBetas(); }
+
+    /**
+     * Returns the number of responses in the training data set
+     * \return Number of responses in the training data set
+     */
+    size_t getNumberOfResponses() const DAAL_C11_OVERRIDE  { return ImplType::getNumberOfResponses(); }
+
+    /**
+     * Returns true if the regression model contains the intercept term, and false otherwise
+     * \return True if the regression model contains the intercept term, and false otherwise
+     */
+    bool getInterceptFlag() const DAAL_C11_OVERRIDE { return ImplType::getInterceptFlag(); }
+
+    /**
+     * Returns the number of features in the training data set
+     * \return Number of features in the training data set
+     */
+    size_t getNumberOfFeatures() const DAAL_C11_OVERRIDE { return ImplType::getNumberOfFeatures(); }
+
+    /**
+     * Returns the numeric table that contains regression coefficients
+     * \return Table that contains regression coefficients
+     */
+    data_management::NumericTablePtr getBeta() DAAL_C11_OVERRIDE { return ImplType::getBeta(); }
+
+    /**
+     * Stores the regression coefficients in the compressed sparse row format
+     * \param[in] zeroThreshold  Coefficients with the absolute value not greater than zeroThreshold are dropped
+     * \return Status of computations
+     */
+    services::Status compactBeta(double zeroThreshold = 0.0) DAAL_C11_OVERRIDE { return ImplType::compactBeta(zeroThreshold); }
+
+protected:
+
+    services::Status serializeImpl(InputDataArchive  *arch) DAAL_C11_OVERRIDE
+    {
+        ImplType::serialImpl<InputDataArchive, false>(arch);
+
+        return services::Status();
+    }
+
+    services::Status deserializeImpl(const OutputDataArchive *arch) DAAL_C11_OVERRIDE
+    {
+        ImplType::serialImpl<const OutputDataArchive, true>(arch);
+
+        return services::Status();
+    }
+};
+
+} // namespace internal
+} // namespace elastic_net
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,135 @@
+/* file: elastic_net_train_dense_default_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the coordinate descent method for elastic net regression training
+//--
+*/
+
+#ifndef __ELASTIC_NET_TRAIN_DENSE_DEFAULT_IMPL_I__
+#define __ELASTIC_NET_TRAIN_DENSE_DEFAULT_IMPL_I__
+
+#include "elastic_net_train_kernel.h"
+#include "coordinate_descent_task.h"
+#include "service_numeric_table.h"
+#include "service_math.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace elastic_net
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::internal;
+
+/**
+ *  Computes the coefficients for each dependent variable along the geometric sequence of
+ *  nPenalties L1 regularization coefficients from the smallest value that gives zero coefficients
+ *  down to penaltyL1. Each point is warm started from the previous one
+ */
+template <typename algorithmFPType, CpuType cpu>
+Status BatchKernel<algorithmFPType, training::defaultDense, cpu>::compute(NumericTable &x, NumericTable &y, NumericTable &beta,
+                                                                           const TrainParameter &par) const
+{
+    typedef optimization_solver::coordinate_descent::internal::CoordinateDescentTask<algorithmFPType, cpu> TaskType;
+
+    const size_t nBetas = beta.getNumberOfColumns();
+    const size_t nResponses = beta.getNumberOfRows();
+
+    TaskType task(&x, &y, par.interceptFlag);
+    Status s;
+    DAAL_CHECK_STATUS(s, task.init());
+
+    WriteOnlyRows<algorithmFPType, cpu> betaRows(beta, 0, nResponses);
+    DAAL_CHECK_BLOCK_STATUS(betaRows);
+
+    const algorithmFPType penaltyL1 = (algorithmFPType)par.penaltyL1;
+    const algorithmFPType penaltyL2 = (algorithmFPType)par.penaltyL2;
+    const algorithmFPType accuracy  = (algorithmFPType)par.accuracyThreshold;
+    const algorithmFPType minRatio  = (algorithmFPType)1.0e-4;
+
+    for(size_t k = 0; k < nResponses; k++)
+    {
+        algorithmFPType *theta = betaRows.get() + k * nBetas;
+        for(size_t j = 0; j < nBetas; j++)
+        {
+            theta[j] = 0;
+        }
+
+        const algorithmFPType maxPenaltyL1 = task.maxPenaltyL1(k);
+        size_t nPenalties = par.nPenalties;
+        if(penaltyL1 >= maxPenaltyL1)
+        {
+            nPenalties = 1;
+        }
+
+        /* The path is cut at minRatio * maxPenaltyL1 when penaltyL1 is smaller than that */
+        const algorithmFPType lowPenaltyL1 = (penaltyL1 > minRatio * maxPenaltyL1 ? penaltyL1 : minRatio * maxPenaltyL1);
+        const algorithmFPType ratio = lowPenaltyL1 / maxPenaltyL1;
+
+        algorithmFPType previousPenaltyL1 = maxPenaltyL1;
+        for(size_t i = 1; i <= nPenalties; i++)
+        {
+            const algorithmFPType currentPenaltyL1 = (i < nPenalties ?
+                maxPenaltyL1 * daal::internal::Math<algorithmFPType, cpu>::sPowx(ratio, (algorithmFPType)i / (algorithmFPType)(nPenalties - 1)) :
+                penaltyL1);
+
+            size_t nIterations = 0;
+            DAAL_CHECK_STATUS(s, task.solve(k, theta, currentPenaltyL1, penaltyL2, previousPenaltyL1, par.screeningFlag,
+                                            i > 1, par.nIterations, accuracy, nIterations));
+            previousPenaltyL1 = currentPenaltyL1;
+        }
+    }
+    return s;
+}
+
+} // namespace internal
+} // namespace training
+} // namespace elastic_net
+} // namespace algorithms
+} // namespace daal
+
+#endif
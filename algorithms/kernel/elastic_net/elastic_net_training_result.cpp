@@ -0,0 +1,115 @@
+/* file: elastic_net_training_result.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of elastic net regression algorithm classes.
+//--
+*/
+
+#include "algorithms/elastic_net/elastic_net_training_types.h"
+#include "serialization_utils.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace elastic_net
+{
+namespace training
+{
+namespace interface1
+{
+
+__DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_ELASTIC_NET_TRAINING_RESULT_ID);
+Result::Result() : linear_model::training::Result(lastResultId + 1) {}
+
+/**
+ * Returns the result of elastic net regression model-based training
+ * \param[in] id    Identifier of the result
+ * \return          Result that corresponds to the given identifier
+ */
+daal::algorithms::elastic_net::ModelPtr Result::get(ResultId id) const
+{
+    return elastic_net::Model::cast(linear_model::training::Result::get(linear_model::training::ResultId(id)));
+}
+
+/**
+ * Sets the result of elastic net regression model-based training
+ * \param[in] id      Identifier of the result
+ * \param[in] value   Result
+ */
+void Result::set(ResultId id, const daal::algorithms::elastic_net::ModelPtr & value)
+{
+    linear_model::training::Result::set(linear_model::training::ResultId(id), value);
+}
+
+/**
+ * Checks the result of elastic net regression model-based training
+ * \param[in] input   %Input object for the algorithm
+ * \param[in] par     %Parameter of the algorithm
+ * \param[in] method  Computation method
+ *
+ * \return Status of computations
+ */
+services::Status Result::check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, int method) const
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, linear_model::training::Result::check(input, par, method));
+
+    const Input *in = static_cast<const Input *>(input);
+
+    size_t nBeta = in->getNumberOfFeatures() + 1;
+    size_t nResponses = in->getNumberOfDependentVariables();
+
+    const elastic_net::ModelPtr model = get(training::model);
+
+    return linear_model::checkModel(model.get(), *par, nBeta, nResponses);
+}
+
+} // namespace interface1
+} // namespace training
+} // namespace elastic_net
+} // namespace algorithms
+} // namespace daal
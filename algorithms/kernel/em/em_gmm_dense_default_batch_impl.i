@@ -54,6 +54,7 @@
 #include "em_gmm_dense_default_batch_task.h"
 #include "threading.h"
 #include "service_error_handling.h"
+#include "service_batched_cholesky.h"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -692,7 +693,7 @@ Status GmmModelFull<algorithmFPType, cpu>::computeSigmaInverse(size_t iteration)
         {
             sigmaTmpBuff[i] = pSigma[i];
         }
-        lapack::xxpotrf(&uplo, &nFeaturesLong, pInvSigma, &lda, &info);
+        info = algorithms::internal::SmallCholesky<algorithmFPType, cpu>::factorize(nFeatures, pInvSigma);
         if (info != 0)
         {
             if(info < 0)
@@ -712,7 +713,7 @@ Status GmmModelFull<algorithmFPType, cpu>::computeSigmaInverse(size_t iteration)
                 return;
             }
 
-            lapack::xxpotrf(&uplo, &nFeaturesLong, pInvSigma, &lda, &info);
+            info = algorithms::internal::SmallCholesky<algorithmFPType, cpu>::factorize(nFeatures, pInvSigma);
             if(info != 0)
             {
                 ErrorPtr e;
@@ -79,6 +79,10 @@ services::Status Parameter::check() const
     {
         return services::Status(services::Error::create(services::ErrorIncorrectParameter, services::ParameterName, preferenceThresholdStr()));
     }
+    if(linearSolver == conjugateGradient && nCGIterations == 0)
+    {
+        return services::Status(services::Error::create(services::ErrorIncorrectParameter, services::ParameterName, nCGIterationsStr()));
+    }
     return services::Status();
 }
 
@@ -92,6 +92,14 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     daal::services::Environment::env &env = *_env;
 
     NumericTable *ratingsTable = static_cast<NumericTable *>(result->get(prediction).get());
+    if(method == topItems)
+    {
+        NumericTable *knownRatingsTable = input->get(knownRatings).get();
+        NumericTable *topItemsTable = result->get(recommendedItems).get();
+        __DAAL_CALL_KERNEL(env, internal::ImplicitALSPredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType),
+                           computeTopItems, usersFactorsTable, itemsFactorsTable, NULL, knownRatingsTable,
+                           ratingsTable, topItemsTable, par);
+    }
     __DAAL_CALL_KERNEL(env, internal::ImplicitALSPredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType),
                        compute, usersFactorsTable, itemsFactorsTable, ratingsTable, par);
 }
@@ -131,6 +139,15 @@ services::Status DistributedContainer<step1Local, algorithmFPType, method, cpu>:
 
     NumericTable *ratingsTable = static_cast<NumericTable *>(result->get(prediction).get());
 
+    if(method == topItems)
+    {
+        NumericTablePtr itemsIndicesTable = itemsFactors->getIndices();
+        NumericTable *knownRatingsTable = input->get(knownRatings).get();
+        NumericTable *topItemsTable = result->get(recommendedItems).get();
+        __DAAL_CALL_KERNEL(env, internal::ImplicitALSPredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType),
+                           computeTopItems, usersFactorsTable.get(), itemsFactorsTable.get(), itemsIndicesTable.get(),
+                           knownRatingsTable, ratingsTable, topItemsTable, par);
+    }
     __DAAL_CALL_KERNEL(env, internal::ImplicitALSPredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType),
                        compute, usersFactorsTable.get(), itemsFactorsTable.get(), ratingsTable, par);
 }
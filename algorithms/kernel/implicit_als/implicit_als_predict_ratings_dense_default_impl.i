@@ -51,6 +51,8 @@
 #include "implicit_als_predict_ratings_dense_default_kernel.h"
 #include "service_numeric_table.h"
 #include "service_blas.h"
+#include "service_error_handling.h"
+#include "threading.h"
 
 using namespace daal::data_management;
 using namespace daal::internal;
@@ -101,6 +103,250 @@ services::Status ImplicitALSPredictKernel<algorithmFPType, cpu>::compute(
     return services::Status();
 }
 
+/* Number of users whose ratings are computed with one call to GEMM */
+const size_t topItemsUsersBlockSize = 64;
+/* Number of items whose ratings are computed with one call to GEMM */
+const size_t topItemsItemsTileSize = 256;
+
+/**
+ *  \brief Buffers of a thread that computes the top rated items for a block of users.
+ *         Keeps a min-heap of the best items found so far for every user of the block
+ */
+template <typename algorithmFPType, CpuType cpu>
+struct TopItemsTls
+{
+    TopItemsTls(size_t nTopItems) :
+        scores(topItemsUsersBlockSize * topItemsItemsTileSize),
+        heapScores(topItemsUsersBlockSize * nTopItems),
+        heapItems(topItemsUsersBlockSize * nTopItems),
+        heapSizes(topItemsUsersBlockSize),
+        excluded(topItemsItemsTileSize) {}
+
+    bool isValid() const
+    {
+        return scores.get() && heapScores.get() && heapItems.get() && heapSizes.get() && excluded.get();
+    }
+
+    TArray<algorithmFPType, cpu> scores;
+    TArray<algorithmFPType, cpu> heapScores;
+    TArray<int, cpu> heapItems;
+    TArray<size_t, cpu> heapSizes;
+    TArrayCalloc<char, cpu> excluded;
+};
+
+/* Replaces the root of the min-heap with the new item and restores the heap property */
+template <typename algorithmFPType>
+void siftDownTopItem(algorithmFPType *scores, int *items, size_t size, algorithmFPType score, int item)
+{
+    size_t i = 0;
+    for(size_t child = 1; child < size; child = 2 * i + 1)
+    {
+        if(child + 1 < size && scores[child + 1] < scores[child]) { child++; }
+        if(!(scores[child] < score)) { break; }
+        scores[i] = scores[child];
+        items[i]  = items[child];
+        i = child;
+    }
+    scores[i] = score;
+    items[i]  = item;
+}
+
+/* Adds the item to the min-heap of capacity nTopItems if its score is among the nTopItems best ones */
+template <typename algorithmFPType>
+void pushTopItem(algorithmFPType *scores, int *items, size_t &size, size_t nTopItems, algorithmFPType score, int item)
+{
+    if(size == nTopItems)
+    {
+        if(score > scores[0])
+        {
+            siftDownTopItem(scores, items, size, score, item);
+        }
+        return;
+    }
+
+    size_t i = size++;
+    while(i > 0)
+    {
+        const size_t parent = (i - 1) / 2;
+        if(!(score < scores[parent])) { break; }
+        scores[i] = scores[parent];
+        items[i]  = items[parent];
+        i = parent;
+    }
+    scores[i] = score;
+    items[i]  = item;
+}
+
+/* Writes the content of the min-heap in the descending order of scores. Unused positions are filled with -1 */
+template <typename algorithmFPType>
+void popTopItems(algorithmFPType *scores, int *items, size_t size, size_t nTopItems,
+                 algorithmFPType *outScores, int *outItems)
+{
+    for(size_t k = size; k < nTopItems; k++)
+    {
+        outScores[k] = algorithmFPType(0);
+        outItems[k]  = -1;
+    }
+    for(size_t k = size; k > 0; k--)
+    {
+        outScores[k - 1] = scores[0];
+        outItems[k - 1]  = items[0];
+        siftDownTopItem(scores, items, k - 1, scores[k - 1], items[k - 1]);
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status ImplicitALSPredictKernel<algorithmFPType, cpu>::computeTopItems(
+            const NumericTable *usersFactorsTable, const NumericTable *itemsFactorsTable,
+            const NumericTable *itemsIndicesTable, const NumericTable *knownRatingsTable,
+            NumericTable *scoresTable, NumericTable *topItemsTable, const Parameter *parameter)
+{
+    const size_t nUsers = usersFactorsTable->getNumberOfRows();
+    const size_t nItems = itemsFactorsTable->getNumberOfRows();
+    const size_t nFactors = parameter->nFactors;
+    const size_t nTopItems = parameter->nTopItems;
+
+    ReadRows<algorithmFPType, cpu> mtUsersFactors(*const_cast<NumericTable*>(usersFactorsTable), 0, nUsers);
+    DAAL_CHECK_BLOCK_STATUS(mtUsersFactors);
+    ReadRows<algorithmFPType, cpu> mtItemsFactors(*const_cast<NumericTable*>(itemsFactorsTable), 0, nItems);
+    DAAL_CHECK_BLOCK_STATUS(mtItemsFactors);
+    const algorithmFPType *usersFactors = mtUsersFactors.get();
+    const algorithmFPType *itemsFactors = mtItemsFactors.get();
+
+    /* In the distributed processing mode the recommendations are reported with the global indices of the items */
+    ReadRows<int, cpu> mtItemsIndices;
+    const int *itemsIndices = nullptr;
+    if(itemsIndicesTable)
+    {
+        mtItemsIndices.set(const_cast<NumericTable*>(itemsIndicesTable), 0, nItems);
+        DAAL_CHECK_BLOCK_STATUS(mtItemsIndices);
+        itemsIndices = mtItemsIndices.get();
+    }
+
+    ReadRowsCSR<algorithmFPType, cpu> mtKnownRatings;
+    const size_t *knownCols = nullptr;
+    const size_t *knownRows = nullptr;
+    TArray<int, cpu> globalToLocal;
+    size_t nGlobalItems = nItems;
+    if(knownRatingsTable)
+    {
+        mtKnownRatings.set(dynamic_cast<CSRNumericTableIface*>(const_cast<NumericTable*>(knownRatingsTable)), 0, nUsers);
+        DAAL_CHECK_BLOCK_STATUS(mtKnownRatings);
+        knownCols = mtKnownRatings.cols();
+        knownRows = mtKnownRatings.rows();
+
+        if(itemsIndices)
+        {
+            /* Map the global indices of the items to the rows of the items factors */
+            nGlobalItems = 0;
+            for(size_t i = 0; i < nItems; i++)
+            {
+                if(itemsIndices[i] >= 0 && (size_t)itemsIndices[i] >= nGlobalItems) { nGlobalItems = itemsIndices[i] + 1; }
+            }
+            DAAL_CHECK_MALLOC(globalToLocal.reset(nGlobalItems));
+            for(size_t i = 0; i < nGlobalItems; i++) { globalToLocal[i] = -1; }
+            for(size_t i = 0; i < nItems; i++)
+            {
+                if(itemsIndices[i] >= 0) { globalToLocal[itemsIndices[i]] = (int)i; }
+            }
+        }
+    }
+    const int *localItems = globalToLocal.get();
+
+    daal::tls<TopItemsTls<algorithmFPType, cpu> *> tls([=]()
+    {
+        auto ptr = new TopItemsTls<algorithmFPType, cpu>(nTopItems);
+        if(ptr && !ptr->isValid())
+        {
+            delete ptr;
+            ptr = nullptr;
+        }
+        return ptr;
+    });
+
+    SafeStatus safeStat;
+    const size_t nUsersBlocks = nUsers / topItemsUsersBlockSize + !!(nUsers % topItemsUsersBlockSize);
+    daal::threader_for(nUsersBlocks, nUsersBlocks, [&](size_t iBlock)
+    {
+        TopItemsTls<algorithmFPType, cpu> *local = tls.local();
+        DAAL_CHECK_THR(local, services::ErrorMemoryAllocationFailed);
+
+        const size_t userStart = iBlock * topItemsUsersBlockSize;
+        const size_t nUsersInBlock = (userStart + topItemsUsersBlockSize > nUsers) ? nUsers - userStart : topItemsUsersBlockSize;
+
+        algorithmFPType *scores = local->scores.get();
+        algorithmFPType *heapScores = local->heapScores.get();
+        int *heapItems = local->heapItems.get();
+        size_t *heapSizes = local->heapSizes.get();
+        char *excluded = local->excluded.get();
+        for(size_t u = 0; u < nUsersInBlock; u++) { heapSizes[u] = 0; }
+
+        /* GEMM parameters */
+        const char trans   = 'T';
+        const char notrans = 'N';
+        const algorithmFPType one(1.0);
+        const algorithmFPType zero(0.0);
+        DAAL_INT nUsersGemm = (DAAL_INT)nUsersInBlock;
+        DAAL_INT nFactorsGemm = (DAAL_INT)nFactors;
+
+        for(size_t itemStart = 0; itemStart < nItems; itemStart += topItemsItemsTileSize)
+        {
+            const size_t nItemsInTile = (itemStart + topItemsItemsTileSize > nItems) ? nItems - itemStart : topItemsItemsTileSize;
+            DAAL_INT nItemsGemm = (DAAL_INT)nItemsInTile;
+
+            Blas<algorithmFPType, cpu>::xxgemm(&trans, &notrans, &nItemsGemm, &nUsersGemm, &nFactorsGemm,
+                               &one, itemsFactors + itemStart * nFactors, &nFactorsGemm, usersFactors + userStart * nFactors, &nFactorsGemm,
+                               &zero, scores, &nItemsGemm);
+
+            for(size_t u = 0; u < nUsersInBlock; u++)
+            {
+                const algorithmFPType *userScores = scores + u * nItemsInTile;
+                size_t knownStart = 0;
+                size_t knownEnd = 0;
+                if(knownCols)
+                {
+                    knownStart = knownRows[userStart + u]     - knownRows[0];
+                    knownEnd   = knownRows[userStart + u + 1] - knownRows[0];
+                }
+
+                for(size_t j = knownStart; j < knownEnd; j++)
+                {
+                    const size_t globalItem = knownCols[j] - 1;
+                    if(globalItem >= nGlobalItems) { continue; }
+                    const int localItem = localItems ? localItems[globalItem] : (int)globalItem;
+                    if(localItem >= (int)itemStart && localItem < (int)(itemStart + nItemsInTile)) { excluded[localItem - itemStart] = 1; }
+                }
+
+                algorithmFPType *userHeapScores = heapScores + u * nTopItems;
+                int *userHeapItems = heapItems + u * nTopItems;
+                for(size_t i = 0; i < nItemsInTile; i++)
+                {
+                    if(excluded[i]) { excluded[i] = 0; continue; }
+                    const int item = itemsIndices ? itemsIndices[itemStart + i] : (int)(itemStart + i);
+                    pushTopItem(userHeapScores, userHeapItems, heapSizes[u], nTopItems, userScores[i], item);
+                }
+            }
+        }
+
+        WriteOnlyRows<algorithmFPType, cpu> mtScores(*scoresTable, userStart, nUsersInBlock);
+        DAAL_CHECK_BLOCK_STATUS_THR(mtScores);
+        WriteOnlyRows<int, cpu> mtTopItems(*topItemsTable, userStart, nUsersInBlock);
+        DAAL_CHECK_BLOCK_STATUS_THR(mtTopItems);
+
+        for(size_t u = 0; u < nUsersInBlock; u++)
+        {
+            popTopItems(heapScores + u * nTopItems, heapItems + u * nTopItems, heapSizes[u], nTopItems,
+                        mtScores.get() + u * nTopItems, mtTopItems.get() + u * nTopItems);
+        }
+    });
+
+    tls.reduce([](TopItemsTls<algorithmFPType, cpu> *local)
+    {
+        delete local;
+    });
+    return safeStat.detach();
+}
+
 }
 }
 }
@@ -78,6 +78,21 @@ public:
 
     services::Status compute(const NumericTable *usersFactorsTable, const NumericTable *itemsFactorsTable,
                 NumericTable *ratingsTable, const Parameter *parameter);
+
+    /**
+     *  \brief Finds the items with the highest predicted ratings for every user
+     *
+     *  \param[in]  usersFactorsTable   Factors of the users
+     *  \param[in]  itemsFactorsTable   Factors of the items
+     *  \param[in]  itemsIndicesTable   Global indices of the items, or NULL if the items are indexed by their rows
+     *  \param[in]  knownRatingsTable   Ratings in the CSR format with items to exclude from the recommendations, or NULL
+     *  \param[out] scoresTable         Predicted ratings of the recommended items, in descending order
+     *  \param[out] topItemsTable       Indices of the recommended items
+     *  \param[in]  parameter           Parameters of the algorithm
+     */
+    services::Status computeTopItems(const NumericTable *usersFactorsTable, const NumericTable *itemsFactorsTable,
+                const NumericTable *itemsIndicesTable, const NumericTable *knownRatingsTable,
+                NumericTable *scoresTable, NumericTable *topItemsTable, const Parameter *parameter);
 };
 
 }
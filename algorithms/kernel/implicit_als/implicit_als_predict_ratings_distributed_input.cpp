@@ -64,7 +64,7 @@ namespace ratings
 namespace interface1
 {
 
-DistributedInput<step1Local>::DistributedInput() : InputIface(2) {}
+DistributedInput<step1Local>::DistributedInput() : InputIface(lastNumericTableInputId + 1) {}
 
 /**
  * Returns an input object for the rating prediction stage of the implicit ALS algorithm
@@ -86,6 +86,26 @@ void DistributedInput<step1Local>::set(PartialModelInputId id, const PartialMode
     Argument::set(id, ptr);
 }
 
+/**
+ * Returns an input numeric table for the rating prediction stage of the implicit ALS algorithm
+ * \param[in] id    Identifier of the input numeric table
+ * \return          Input numeric table that corresponds to the given identifier
+ */
+NumericTablePtr DistributedInput<step1Local>::get(NumericTableInputId id) const
+{
+    return services::staticPointerCast<NumericTable, data_management::SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets an input numeric table for the rating prediction stage of the implicit ALS algorithm
+ * \param[in] id    Identifier of the input numeric table
+ * \param[in] ptr   Pointer to the new input numeric table
+ */
+void DistributedInput<step1Local>::set(NumericTableInputId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
 /**
  * Returns the number of rows in the input numeric table
  * \return Number of rows in the input numeric table
@@ -146,7 +166,16 @@ services::Status DistributedInput<step1Local>::check(const daal::algorithms::Par
 
     DAAL_CHECK_STATUS(s, checkNumericTable(itemsModel->getFactors().get(), itemsFactorsStr(), unexpectedLayouts, 0, nFactors));
     const size_t nRowsItemsModel = itemsModel->getFactors()->getNumberOfRows();
-    return checkNumericTable(itemsModel->getIndices().get(), itemsIndicesStr(), unexpectedLayoutsIndices, 0, 1, nRowsItemsModel);
+    DAAL_CHECK_STATUS(s, checkNumericTable(itemsModel->getIndices().get(), itemsIndicesStr(), unexpectedLayoutsIndices, 0, 1, nRowsItemsModel));
+
+    /* Columns of the known ratings are the global indices of the items */
+    NumericTablePtr knownRatingsTable = get(knownRatings);
+    if(method == topItems && knownRatingsTable)
+    {
+        const int csrLayout = (int)NumericTableIface::csrArray;
+        DAAL_CHECK_STATUS(s, checkNumericTable(knownRatingsTable.get(), knownRatingsStr(), 0, csrLayout, 0, nRowsUsersModel));
+    }
+    return s;
 }
 
 }// namespace interface1
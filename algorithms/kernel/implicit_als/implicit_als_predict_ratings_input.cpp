@@ -63,7 +63,7 @@ namespace ratings
 {
 namespace interface1
 {
-Input::Input() : InputIface(lastModelInputId + 1) {}
+Input::Input() : InputIface(lastNumericTableInputId + 1) {}
 
 /**
  * Returns an input Model object for the rating prediction stage of the implicit ALS algorithm
@@ -85,6 +85,26 @@ void Input::set(ModelInputId id, const ModelPtr &ptr)
     Argument::set(id, ptr);
 }
 
+/**
+ * Returns an input numeric table for the rating prediction stage of the implicit ALS algorithm
+ * \param[in] id    Identifier of the input numeric table
+ * \return          Input numeric table that corresponds to the given identifier
+ */
+NumericTablePtr Input::get(NumericTableInputId id) const
+{
+    return services::staticPointerCast<NumericTable, data_management::SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets an input numeric table for the rating prediction stage of the implicit ALS algorithm
+ * \param[in] id    Identifier of the input numeric table
+ * \param[in] ptr   Pointer to the input numeric table
+ */
+void Input::set(NumericTableInputId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
 /**
  * Returns the number of rows in the input numeric table
  * \return Number of rows in the input numeric table
@@ -129,6 +149,15 @@ services::Status Input::check(const daal::algorithms::Parameter *parameter, int
     const int unexpectedLayouts = (int)packed_mask;
     services::Status s = checkNumericTable(trainedModel->getUsersFactors().get(), usersFactorsStr(), unexpectedLayouts, 0, nFactors);
     s |= checkNumericTable(trainedModel->getItemsFactors().get(), itemsFactorsStr(), unexpectedLayouts, 0, nFactors);
+    if(!s || method != topItems)
+        return s;
+
+    NumericTablePtr knownRatingsTable = get(knownRatings);
+    if(knownRatingsTable)
+    {
+        const int csrLayout = (int)NumericTableIface::csrArray;
+        s |= checkNumericTable(knownRatingsTable.get(), knownRatingsStr(), 0, csrLayout, getNumberOfItems(), getNumberOfUsers());
+    }
     return s;
 }
 
@@ -98,14 +98,8 @@ void PartialResult::set(PartialResultId id, const ResultPtr &ptr)
 services::Status PartialResult::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const
 {
     ResultPtr result = get(finalResult);
-    const InputIface *algInput = static_cast<const InputIface *>(input);
-
-    const size_t nUsers = algInput->getNumberOfUsers();
-    const size_t nItems = algInput->getNumberOfItems();
-
-    const int unexpectedLayouts = (int)packed_mask;
     if(result)
-        return checkNumericTable(result->get(prediction).get(), predictionStr(), unexpectedLayouts, 0, nItems, nUsers);
+        return result->check(input, parameter, method);
     return services::Status();
 }
 }// namespace interface1
@@ -100,7 +100,13 @@ services::Status Result::check(const daal::algorithms::Input *input, const daal:
     const size_t nItems = algInput->getNumberOfItems();
 
     const int unexpectedLayouts = (int)packed_mask;
-    return checkNumericTable(get(prediction).get(), predictionStr(), unexpectedLayouts, 0, nItems, nUsers);
+    if(method != topItems)
+        return checkNumericTable(get(prediction).get(), predictionStr(), unexpectedLayouts, 0, nItems, nUsers);
+
+    const size_t nTopItems = static_cast<const Parameter *>(parameter)->nTopItems;
+    services::Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(prediction).get(), predictionStr(), unexpectedLayouts, 0, nTopItems, nUsers));
+    return checkNumericTable(get(recommendedItems).get(), recommendedItemsStr(), unexpectedLayouts, 0, nTopItems, nUsers);
 }
 
 }// namespace interface1
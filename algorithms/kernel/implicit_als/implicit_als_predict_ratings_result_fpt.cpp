@@ -77,7 +77,16 @@ DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input *input, const
     size_t nUsers = algInput->getNumberOfUsers();
     size_t nItems = algInput->getNumberOfItems();
     Status st;
-    set(prediction, HomogenNumericTable<algorithmFPType>::create(nItems, nUsers, NumericTableIface::doAllocate, &st));
+    if(method != topItems)
+    {
+        set(prediction, HomogenNumericTable<algorithmFPType>::create(nItems, nUsers, NumericTableIface::doAllocate, &st));
+        return st;
+    }
+
+    const size_t nTopItems = algParameter->nTopItems;
+    set(prediction, HomogenNumericTable<algorithmFPType>::create(nTopItems, nUsers, NumericTableIface::doAllocate, &st));
+    DAAL_CHECK_STATUS_VAR(st);
+    set(recommendedItems, HomogenNumericTable<int>::create(nTopItems, nUsers, NumericTableIface::doAllocate, &st));
     return st;
 }
 
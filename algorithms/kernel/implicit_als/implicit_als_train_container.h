@@ -250,6 +250,7 @@ services::Status DistributedContainer<step4Local, algorithmFPType, method, cpu>:
     KeyValueDataCollection *models = static_cast<KeyValueDataCollection *>(input->get(partialModels).get());
     NumericTable *dataTable = static_cast<NumericTable *>(input->get(partialData).get());
     NumericTable *cpTable = static_cast<NumericTable *>(input->get(inputOfStep4FromStep2).get());
+    NumericTable *initialFactorsTable = input->get(partialFactors).get();
 
     PartialModel *partialModel = static_cast<PartialModel *>(partialResult->get(outputOfStep4ForStep1).get());
 
@@ -257,7 +258,7 @@ services::Status DistributedContainer<step4Local, algorithmFPType, method, cpu>:
     daal::services::Environment::env &env = *_env;
 
     services::Status s = __DAAL_CALL_KERNEL_STATUS(env, internal::ImplicitALSTrainDistrStep4Kernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),
-                                                   compute, models, dataTable, cpTable, partialModel, par);
+                                                   compute, models, dataTable, cpTable, initialFactorsTable, partialModel, par);
 
     models->clear();
     return s;
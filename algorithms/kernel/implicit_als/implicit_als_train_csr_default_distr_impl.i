@@ -208,14 +208,17 @@ struct AlsTls
 {
     DAAL_NEW_DELETE();
     AlsTls(size_t nBlocks, const Parameter& parameter) :
-        _nBlocks(nBlocks), _prm(parameter), _lhs(parameter.nFactors * parameter.nFactors){}
-    bool isValid() const { return _lhs.get(); }
+        _nBlocks(nBlocks), _prm(parameter),
+        _lhs(parameter.linearSolver == conjugateGradient ? 0 : parameter.nFactors * parameter.nFactors),
+        _cg(parameter.nFactors) {}
+    bool isValid() const { return (_prm.linearSolver == conjugateGradient ? _cg.isValid() : _lhs.get() != nullptr); }
 
     Status run(NumericTable& dstFactors, ReadRowsCSR<algorithmFPType, cpu>& mtData,
         size_t i, const algorithmFPType *xtx,
         NumericTable** aSrcFactors,
         const size_t *nColFactorsRows,
-        const int **indices);
+        const int **indices,
+        const algorithmFPType *initialFactors);
 
 protected:
     Status formSystem(ReadRowsCSR<algorithmFPType, cpu>& mtData,
@@ -223,9 +226,19 @@ protected:
         const size_t *nColFactorsRows,
         const int **indices);
 
+    Status formOperator(ReadRowsCSR<algorithmFPType, cpu>& mtData,
+        size_t i, NumericTable** aSrcFactors,
+        const size_t *nColFactorsRows,
+        const int **indices);
+
+    Status findFactors(int colIndex, NumericTable** aSrcFactors,
+        const size_t *nColFactorsRows,
+        const int **indices);
+
 protected:
     WriteOnlyRows<algorithmFPType, cpu> _mtDstFactors;
     TArray<algorithmFPType, cpu> _lhs;
+    ImplicitALSConjugateGradient<algorithmFPType, cpu> _cg;
     ReadRows<algorithmFPType, cpu> _mtSrcFactors;
     const Parameter& _prm;
     size_t _nBlocks;
@@ -234,11 +247,28 @@ protected:
 template <typename algorithmFPType, CpuType cpu>
 Status AlsTls<algorithmFPType, cpu>::run(NumericTable& dstFactors, ReadRowsCSR<algorithmFPType, cpu>& mtData,
     size_t i, const algorithmFPType *xtx,
-    NumericTable** aSrcFactors, const size_t *nColFactorsRows, const int **indices)
+    NumericTable** aSrcFactors, const size_t *nColFactorsRows, const int **indices,
+    const algorithmFPType *initialFactors)
 {
     _mtDstFactors.set(dstFactors, i, 1);
     DAAL_CHECK_BLOCK_STATUS(_mtDstFactors);
     algorithmFPType *rhs = _mtDstFactors.get();
+
+    if(_prm.linearSolver == conjugateGradient)
+    {
+        Status s = formOperator(mtData, i, aSrcFactors, nColFactorsRows, indices);
+        if(!s)
+            return s;
+        if(initialFactors)
+        {
+            daal::services::daal_memcpy_s(rhs, _prm.nFactors * sizeof(algorithmFPType),
+                initialFactors + i * _prm.nFactors, _prm.nFactors * sizeof(algorithmFPType));
+        }
+        const algorithmFPType gamma = algorithmFPType(_prm.lambda) * (mtData.rows()[i + 1] - mtData.rows()[i]);
+        _cg.solve(xtx, gamma, rhs, _prm.nCGIterations, initialFactors != nullptr);
+        return s;
+    }
+
     service_memset<algorithmFPType, cpu>(rhs, 0.0, _prm.nFactors);
     daal::services::daal_memcpy_s(_lhs.get(), _prm.nFactors * _prm.nFactors * sizeof(algorithmFPType),
         xtx, _prm.nFactors * _prm.nFactors * sizeof(algorithmFPType));
@@ -254,8 +284,8 @@ Status AlsTls<algorithmFPType, cpu>::run(NumericTable& dstFactors, ReadRowsCSR<a
 template <typename algorithmFPType, CpuType cpu>
 Status ImplicitALSTrainDistrStep4Kernel<algorithmFPType, fastCSR, cpu>::compute(
                  data_management::KeyValueDataCollection *srcPartialModels, data_management::NumericTable *dataTable,
-                 data_management::NumericTable *cpTable, implicit_als::PartialModel *dstPartialModel,
-                 const Parameter *parameter)
+                 data_management::NumericTable *cpTable, data_management::NumericTable *initialFactorsTable,
+                 implicit_als::PartialModel *dstPartialModel, const Parameter *parameter)
 {
     const size_t nBlocks = srcPartialModels->size();
     TArray<size_t, cpu> nFactorsRows(nBlocks);
@@ -290,15 +320,36 @@ Status ImplicitALSTrainDistrStep4Kernel<algorithmFPType, fastCSR, cpu>::compute(
         return ptr;
     });
 
-    ReadRows<algorithmFPType, cpu> mtXTX(cpTable, 0, parameter->nFactors);
+    const size_t nFactors = parameter->nFactors;
+    ReadRows<algorithmFPType, cpu> mtXTX(cpTable, 0, nFactors);
     DAAL_CHECK_BLOCK_STATUS(mtXTX);
     const algorithmFPType *xtx = mtXTX.get();
 
+    /* The conjugate gradient method multiplies by the full cross product */
+    TArray<algorithmFPType, cpu> xtxFull;
+    if(parameter->linearSolver == conjugateGradient)
+    {
+        xtxFull.reset(nFactors * nFactors);
+        DAAL_CHECK_MALLOC(xtxFull.get());
+        daal::services::daal_memcpy_s(xtxFull.get(), nFactors * nFactors * sizeof(algorithmFPType),
+            xtx, nFactors * nFactors * sizeof(algorithmFPType));
+        ImplicitALSTrainKernelCommon<algorithmFPType, cpu>::symmetrize(nFactors, xtxFull.get());
+        xtx = xtxFull.get();
+    }
+
     const size_t nRows = dataTable->getNumberOfRows();
     const CSRNumericTableIface* csrIface = dynamic_cast<const CSRNumericTableIface *>(dataTable);
     ReadRowsCSR<algorithmFPType, cpu> mtData(*const_cast<CSRNumericTableIface *>(csrIface), 0, nRows);
     DAAL_CHECK_BLOCK_STATUS(mtData);
 
+    ReadRows<algorithmFPType, cpu> mtInitialFactors(initialFactorsTable);
+    const algorithmFPType *initialFactors = nullptr;
+    if(initialFactorsTable && parameter->linearSolver == conjugateGradient)
+    {
+        initialFactors = mtInitialFactors.next(0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(mtInitialFactors);
+    }
+
     NumericTablePtr pDstFactors = dstPartialModel->getFactors();
     SafeStatus safeStat;
     daal::threader_for(nRows, nRows, [ & ](size_t i)
@@ -306,7 +357,7 @@ Status ImplicitALSTrainDistrStep4Kernel<algorithmFPType, fastCSR, cpu>::compute(
         AlsTls<algorithmFPType, cpu> *alsTlsLocal = alsTls.local();
         DAAL_CHECK_THR(alsTlsLocal, ErrorMemoryAllocationFailed);
         safeStat |= alsTlsLocal->run(*pDstFactors, mtData, i, xtx,
-            aSrcFactors.get(), nFactorsRows.get(), indices.get());
+            aSrcFactors.get(), nFactorsRows.get(), indices.get(), initialFactors);
     } );
 
     alsTls.reduce([ = ](AlsTls<algorithmFPType, cpu> *alsTlsLocal)
@@ -316,6 +367,48 @@ Status ImplicitALSTrainDistrStep4Kernel<algorithmFPType, fastCSR, cpu>::compute(
     return safeStat.detach();
 }
 
+/* Sets _mtSrcFactors to the factors with the given index from the partial models */
+template <typename algorithmFPType, CpuType cpu>
+Status AlsTls<algorithmFPType, cpu>::findFactors(int colIndex, NumericTable** aSrcFactors,
+    const size_t *nColFactorsRows,
+    const int **indices)
+{
+    int blockIndex = -1;
+    /* find block that contains needed index */
+    for (size_t block = 0; block < _nBlocks; block++)
+    {
+        if (indices[block] && indices[block][0] <= colIndex && colIndex <= indices[block][nColFactorsRows[block] - 1])
+        {
+            blockIndex = block;
+            break;
+        }
+    }
+    if (blockIndex == -1)
+        return Status(ErrorALSInconsistentSparseDataBlocks);
+
+    const int *blockIndices = indices[blockIndex];
+    /* find index in the block using binary search */
+    size_t hiIndex = nColFactorsRows[blockIndex] - 1;
+    size_t loIndex = 0;
+    size_t meIndex = ((loIndex + hiIndex) >> 1);
+    while (colIndex != blockIndices[meIndex])
+    {
+        if (colIndex < blockIndices[meIndex])
+            hiIndex = meIndex - 1;
+        else if (colIndex > blockIndices[meIndex])
+            loIndex = meIndex + 1;
+        meIndex = ((loIndex + hiIndex) >> 1);
+        if (loIndex >= hiIndex)
+            break;
+    }
+    if (colIndex != blockIndices[meIndex])
+        return Status(ErrorALSInconsistentSparseDataBlocks);
+
+    _mtSrcFactors.set(*aSrcFactors[blockIndex], meIndex, 1);
+    DAAL_CHECK_BLOCK_STATUS(_mtSrcFactors);
+    return Status();
+}
+
 template <typename algorithmFPType, CpuType cpu>
 Status AlsTls<algorithmFPType, cpu>::formSystem(
     ReadRowsCSR<algorithmFPType, cpu>& mtData,
@@ -335,41 +428,11 @@ Status AlsTls<algorithmFPType, cpu>::formSystem(
         algorithmFPType c = c1 + 1.0;
         int colIndex = (int)mtData.cols()[j] - 1;
 
-        int blockIndex = -1;
-        /* find block that contains needed index */
-        for (size_t block = 0; block < _nBlocks; block++)
-        {
-            if (indices[block] && indices[block][0] <= colIndex && colIndex <= indices[block][nColFactorsRows[block] - 1])
-            {
-                blockIndex = block;
-                break;
-            }
-        }
-        if (blockIndex == -1)
-            return Status(ErrorALSInconsistentSparseDataBlocks);
-
-        const int *blockIndices = indices[blockIndex];
-        /* find index in the block using binary search */
-        size_t hiIndex = nColFactorsRows[blockIndex] - 1;
-        size_t loIndex = 0;
-        size_t meIndex = ((loIndex + hiIndex) >> 1);
-        while (colIndex != blockIndices[meIndex])
-        {
-            if (colIndex < blockIndices[meIndex])
-                hiIndex = meIndex - 1;
-            else if (colIndex > blockIndices[meIndex])
-                loIndex = meIndex + 1;
-            meIndex = ((loIndex + hiIndex) >> 1);
-            if (loIndex >= hiIndex)
-                break;
-        }
-        if (colIndex != blockIndices[meIndex])
-            return Status(ErrorALSInconsistentSparseDataBlocks);
-
-        _mtSrcFactors.set(*aSrcFactors[blockIndex], meIndex, 1);
-        DAAL_CHECK_BLOCK_STATUS(_mtSrcFactors);
+        Status s = findFactors(colIndex, aSrcFactors, nColFactorsRows, indices);
+        if (!s)
+            return s;
         ImplicitALSTrainKernelBase<algorithmFPType, cpu>::updateSystem(_prm.nFactors, _mtSrcFactors.get(), &c1, &c, lhs, rhs);
-        }
+    }
 
     /* Add regularization term */
     const algorithmFPType gamma = algorithmFPType(_prm.lambda) * (endIdx - startIdx);
@@ -380,6 +443,26 @@ Status AlsTls<algorithmFPType, cpu>::formSystem(
     return Status();
 }
 
+template <typename algorithmFPType, CpuType cpu>
+Status AlsTls<algorithmFPType, cpu>::formOperator(
+    ReadRowsCSR<algorithmFPType, cpu>& mtData,
+    size_t i, NumericTable** aSrcFactors,
+    const size_t *nColFactorsRows,
+    const int **indices)
+{
+    const size_t startIdx = mtData.rows()[i] - 1;
+    const size_t endIdx = mtData.rows()[i + 1] - 1;
+
+    Status s = _cg.reset(endIdx - startIdx);
+    for (size_t j = startIdx; s && j < endIdx; j++)
+    {
+        s = findFactors((int)mtData.cols()[j] - 1, aSrcFactors, nColFactorsRows, indices);
+        if (s)
+            _cg.add(_mtSrcFactors.get(), algorithmFPType(_prm.alpha) * mtData.values()[j]);
+    }
+    return s;
+}
+
 }
 }
 }
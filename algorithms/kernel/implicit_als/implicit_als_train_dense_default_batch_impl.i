@@ -52,6 +52,7 @@
 #include "service_blas.h"
 #include "service_lapack.h"
 #include "service_error_handling.h"
+#include "service_batched_cholesky.h"
 
 namespace daal
 {
@@ -100,19 +101,146 @@ void ImplicitALSTrainKernelBase<algorithmFPType, cpu>::updateSystem(
 template <typename algorithmFPType, CpuType cpu>
 bool ImplicitALSTrainKernelBase<algorithmFPType, cpu>::solve(size_t nCols, algorithmFPType *a, algorithmFPType *b)
 {
-    /* POTRF parameters */
-    char uplo = 'U';
-    DAAL_INT iOne = 1;
-    DAAL_INT info = 0;
+    /* Perform L*L' decomposition of A and solve L*L' * x = b */
+    return (algorithms::internal::SmallCholesky<algorithmFPType, cpu>::factorizeAndSolve(nCols, 1, a, b) == 0);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void ImplicitALSTrainKernelCommon<algorithmFPType, cpu>::symmetrize(size_t nFactors, algorithmFPType *xtx)
+{
+    for (size_t i = 0; i < nFactors; i++)
+    {
+        for (size_t j = 0; j < i; j++)
+        {
+            xtx[j * nFactors + i] = xtx[i * nFactors + j];
+        }
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status ImplicitALSConjugateGradient<algorithmFPType, cpu>::reset(size_t nKnown)
+{
+    if (nKnown > _capacity)
+    {
+        size_t capacity = 2 * _capacity;
+        if (capacity < nKnown) { capacity = nKnown; }
+        _knownFactors.reset(capacity * _nFactors);
+        _coefficients.reset(capacity);
+        DAAL_CHECK_MALLOC(_knownFactors.get() && _coefficients.get());
+        _capacity = capacity;
+    }
+    _nKnown = 0;
+    algorithmFPType *b = _buffer.get();
+    for (size_t k = 0; k < _nFactors; k++)
+    {
+        b[k] = 0;
+    }
+    return Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void ImplicitALSConjugateGradient<algorithmFPType, cpu>::add(const algorithmFPType *y, algorithmFPType c1)
+{
+    algorithmFPType *knownFactors = _knownFactors.get() + _nKnown * _nFactors;
+    algorithmFPType *b = _buffer.get();
+    const algorithmFPType c = c1 + 1.0;
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t k = 0; k < _nFactors; k++)
+    {
+        knownFactors[k] = y[k];
+        b[k] += c * y[k];
+    }
+    _coefficients[_nKnown++] = c1;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void ImplicitALSConjugateGradient<algorithmFPType, cpu>::applyOperator(const algorithmFPType *xtx, algorithmFPType gamma,
+    const algorithmFPType *v, algorithmFPType *result) const
+{
+    const size_t nFactors = _nFactors;
+    for (size_t k = 0; k < nFactors; k++)
+    {
+        const algorithmFPType *xtxRow = xtx + k * nFactors;
+        algorithmFPType sum = gamma * v[k];
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t l = 0; l < nFactors; l++)
+        {
+            sum += xtxRow[l] * v[l];
+        }
+        result[k] = sum;
+    }
+    for (size_t j = 0; j < _nKnown; j++)
+    {
+        const algorithmFPType *y = _knownFactors.get() + j * nFactors;
+        algorithmFPType dot = 0;
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            dot += y[k] * v[k];
+        }
+        dot *= _coefficients[j];
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            result[k] += dot * y[k];
+        }
+    }
+}
 
-    /* Perform L*L' decomposition of A */
-    Lapack<algorithmFPType, cpu>::xxpotrf(&uplo, (DAAL_INT *)&nCols, a, (DAAL_INT *)&nCols, &info);
-    if(info != 0)
-        return false;
+template <typename algorithmFPType, CpuType cpu>
+void ImplicitALSConjugateGradient<algorithmFPType, cpu>::solve(const algorithmFPType *xtx, algorithmFPType gamma,
+    algorithmFPType *x, size_t nIterations, bool warmStart)
+{
+    const size_t nFactors = _nFactors;
+    const algorithmFPType *b = _buffer.get();
+    algorithmFPType *r = _buffer.get() + nFactors;
+    algorithmFPType *p = r + nFactors;
+    algorithmFPType *q = p + nFactors;
+
+    if (!warmStart)
+    {
+        for (size_t k = 0; k < nFactors; k++) { x[k] = 0; }
+    }
 
-    /* Solve L*L' * x = b */
-    Lapack<algorithmFPType, cpu>::xxpotrs(&uplo, (DAAL_INT *)&nCols, &iOne, a, (DAAL_INT *)&nCols, b, (DAAL_INT *)&nCols, &info);
-    return (info == 0);
+    /* r = b - A x, p = r */
+    applyOperator(xtx, gamma, x, q);
+    algorithmFPType rr = 0;
+    for (size_t k = 0; k < nFactors; k++)
+    {
+        r[k] = b[k] - q[k];
+        p[k] = r[k];
+        rr += r[k] * r[k];
+    }
+
+    for (size_t it = 0; it < nIterations && rr > 0; it++)
+    {
+        applyOperator(xtx, gamma, p, q);
+        algorithmFPType pq = 0;
+        for (size_t k = 0; k < nFactors; k++) { pq += p[k] * q[k]; }
+        if (!(pq > 0)) { break; }
+
+        const algorithmFPType step = rr / pq;
+        algorithmFPType rrNew = 0;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            x[k] += step * p[k];
+            r[k] -= step * q[k];
+            rrNew += r[k] * r[k];
+        }
+
+        const algorithmFPType beta = rrNew / rr;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            p[k] = r[k] + beta * p[k];
+        }
+        rr = rrNew;
+    }
 }
 
 static inline void getSizes( size_t  nRows,
@@ -175,6 +303,124 @@ Status ImplicitALSTrainKernelBase<algorithmFPType, cpu>::computeFactors(
     return safeStat.detach();
 }
 
+template <typename algorithmFPType, CpuType cpu>
+Status ImplicitALSTrainKernelBase<algorithmFPType, cpu>::computeFactorsCG(
+    size_t nRows, size_t nCols, const algorithmFPType *data, const size_t *colIndices, const size_t *rowOffsets,
+    size_t nFactors, algorithmFPType *colFactors, algorithmFPType *rowFactors,
+    algorithmFPType alpha, algorithmFPType lambda, algorithmFPType *xtx, size_t nIterations, bool warmStart)
+{
+    this->symmetrize(nFactors, xtx);
+
+    daal::tls<ImplicitALSConjugateGradient<algorithmFPType, cpu> *> cgTls([=]()
+    {
+        auto ptr = new ImplicitALSConjugateGradient<algorithmFPType, cpu>(nFactors);
+        if(ptr && !ptr->isValid())
+        {
+            delete ptr;
+            ptr = nullptr;
+        }
+        return ptr;
+    });
+
+    SafeStatus safeStat;
+    size_t nBlocks, blockSize, tailSize;
+
+    getSizes( nRows, nCols, nBlocks, blockSize, tailSize );
+
+    daal::threader_for(nBlocks, nBlocks, [ & ]( size_t i )
+    {
+        ImplicitALSConjugateGradient<algorithmFPType, cpu> *cg = cgTls.local();
+        DAAL_CHECK_THR(cg, ErrorMemoryAllocationFailed);
+
+        const size_t curBlockSize = ( i < tailSize ) ? blockSize + 1 : blockSize;
+        const size_t offset = ( i < tailSize ) ? i * blockSize + i : i * blockSize + tailSize;
+
+        for( size_t j = 0; j < curBlockSize; j++ )
+        {
+            algorithmFPType gamma = 0;
+            Status s = formOperator(offset + j, nCols, data, colIndices, rowOffsets, colFactors, alpha, lambda, *cg, gamma);
+            if (!s)
+            {
+                safeStat |= s;
+                return;
+            }
+            cg->solve(xtx, gamma, rowFactors + (offset + j) * nFactors, nIterations, warmStart);
+        }
+    });
+
+    cgTls.reduce([](ImplicitALSConjugateGradient<algorithmFPType, cpu> *cg)
+    {
+        delete cg;
+    });
+    return safeStat.detach();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status ImplicitALSTrainKernelBase<algorithmFPType, cpu>::computeFactors(
+    size_t nRows, size_t nCols, const algorithmFPType *data, const size_t *colIndices, const size_t *rowOffsets,
+    size_t nFactors, algorithmFPType *colFactors, algorithmFPType *rowFactors,
+    algorithmFPType *xtx, daal::tls<algorithmFPType *>& lhs, const Parameter *parameter, bool warmStart)
+{
+    const algorithmFPType alpha(parameter->alpha);
+    const algorithmFPType lambda(parameter->lambda);
+    if (parameter->linearSolver == conjugateGradient)
+    {
+        return computeFactorsCG(nRows, nCols, data, colIndices, rowOffsets, nFactors, colFactors, rowFactors,
+                                alpha, lambda, xtx, parameter->nCGIterations, warmStart);
+    }
+    return computeFactors(nRows, nCols, data, colIndices, rowOffsets, nFactors, colFactors, rowFactors,
+                          alpha, lambda, xtx, lhs);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status ImplicitALSTrainKernel<algorithmFPType, fastCSR, cpu>::formOperator(
+    size_t i, size_t nCols, const algorithmFPType *data, const size_t *colIndices, const size_t *rowOffsets,
+    algorithmFPType *colFactors, algorithmFPType alpha, algorithmFPType lambda,
+    ImplicitALSConjugateGradient<algorithmFPType, cpu> &cg, algorithmFPType &gamma)
+{
+    const size_t nFactors = cg.nFactors();
+    const size_t startIdx = rowOffsets[i]   - 1;
+    const size_t endIdx   = rowOffsets[i + 1] - 1;
+    Status s = cg.reset(endIdx - startIdx);
+    if (!s)
+        return s;
+
+    for (size_t j = startIdx; j < endIdx; j++)
+    {
+        cg.add(colFactors + (colIndices[j] - 1) * nFactors, alpha * data[j]);
+    }
+    gamma = lambda * (endIdx - startIdx);
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status ImplicitALSTrainKernel<algorithmFPType, defaultDense, cpu>::formOperator(
+    size_t i, size_t nCols, const algorithmFPType *data, const size_t *colIndices, const size_t *rowOffsets,
+    algorithmFPType *colFactors, algorithmFPType alpha, algorithmFPType lambda,
+    ImplicitALSConjugateGradient<algorithmFPType, cpu> &cg, algorithmFPType &gamma)
+{
+    const size_t nFactors = cg.nFactors();
+    const algorithmFPType *row = data + i * nCols;
+    size_t nKnown = 0;
+    for (size_t j = 0; j < nCols; j++)
+    {
+        nKnown += (row[j] > 0.0);
+    }
+    Status s = cg.reset(nKnown);
+    if (!s)
+        return s;
+
+    for (size_t j = 0; j < nCols; j++)
+    {
+        if (row[j] > 0.0)
+        {
+            cg.add(colFactors + j * nFactors, alpha * row[j]);
+        }
+    }
+    gamma = lambda * (algorithmFPType)(nKnown + 1);
+    return s;
+}
+
 template <typename algorithmFPType, CpuType cpu>
 void ImplicitALSTrainKernel<algorithmFPType, fastCSR, cpu>::computeCostFunction(
     size_t nUsers, size_t nItems, size_t nFactors, algorithmFPType *data, size_t *colIndices, size_t *rowOffsets,
@@ -365,14 +611,14 @@ services::Status ImplicitALSTrainBatchKernel<algorithmFPType, fastCSR, cpu>::com
         this->computeXtX(&nItems, &nFactors, &beta, itemsFactors, &nFactors, xtx, &nFactors);
 
         s = this->computeFactors(nUsers, nItems, data, colIndices, rowOffsets, nFactors, itemsFactors, usersFactors,
-                             alpha, lambda, xtx, lhs);
+                             xtx, lhs, parameter, i > 0);
         if(!s)
             break;
 
         this->computeXtX(&nUsers, &nFactors, &beta, usersFactors, &nFactors, xtx, &nFactors);
 
         s = this->computeFactors(nItems, nUsers, tdata, rowIndices, colOffsets, nFactors, usersFactors, itemsFactors,
-                             alpha, lambda, xtx, lhs);
+                             xtx, lhs, parameter, true);
         if(!s)
             break;
 
@@ -428,14 +674,14 @@ services::Status ImplicitALSTrainBatchKernel<algorithmFPType, defaultDense, cpu>
         this->computeXtX(&nItems, &nFactors, &beta, itemsFactors, &nFactors, xtx, &nFactors);
 
         s = this->computeFactors(nUsers, nItems, data, NULL, NULL, nFactors, itemsFactors, usersFactors,
-                             alpha, lambda, xtx, lhs);
+                             xtx, lhs, parameter, i > 0);
         if(!s)
             break;
 
         this->computeXtX(&nUsers, &nFactors, &beta, usersFactors, &nFactors, xtx, &nFactors);
 
         s = this->computeFactors(nItems, nUsers, tdata, NULL, NULL, nFactors, usersFactors, itemsFactors,
-                             alpha, lambda, xtx, lhs);
+                             xtx, lhs, parameter, true);
         if(!s)
             break;
 
@@ -600,6 +600,12 @@ services::Status DistributedInput<step4Local>::check(const daal::algorithms::Par
     int unexpectedLayoutsCSR = (int)packed_mask;
     s |= checkNumericTable(get(inputOfStep4FromStep2).get(), crossProductStr(), unexpectedLayoutsPacked, 0, nFactors, nFactors);
     if(!s) return s;
+    if (get(partialFactors))
+    {
+        s |= checkNumericTable(get(partialFactors).get(), partialFactorsStr(), unexpectedLayoutsPacked, 0, nFactors,
+                               dataTable->getNumberOfRows());
+        if(!s) return s;
+    }
     /* Check input data collection */
     KeyValueDataCollectionPtr collection = get(partialModels);
     DAAL_CHECK(collection, ErrorNullInputDataCollection);
@@ -75,9 +75,50 @@ struct ImplicitALSTrainTaskBase;
 template <typename algorithmFPType, Method method, CpuType cpu>
 struct ImplicitALSTrainTask;
 
+/**
+ *  Solves the system of normal equations for a row of factors
+ *  (Y^T Y + gamma I + sum_j c1_j y_j y_j^T) x = sum_j (1 + c1_j) y_j
+ *  with the conjugate gradient method without forming its matrix. y_j are the factors of the known ratings of the row
+ */
+template <typename algorithmFPType, CpuType cpu>
+class ImplicitALSConjugateGradient
+{
+public:
+    DAAL_NEW_DELETE();
+    ImplicitALSConjugateGradient(size_t nFactors) :
+        _nFactors(nFactors), _nKnown(0), _capacity(0), _buffer(4 * nFactors) {}
+
+    bool isValid() const { return _buffer.get(); }
+
+    size_t nFactors() const { return _nFactors; }
+
+    /* Starts the new system with the storage for nKnown known ratings */
+    services::Status reset(size_t nKnown);
+
+    /* Adds the factors y of the known rating with the confidence 1 + c1 */
+    void add(const algorithmFPType *y, algorithmFPType c1);
+
+    /* Runs nIterations of the conjugate gradient method starting from x; x is set to zero if warmStart is false */
+    void solve(const algorithmFPType *xtx, algorithmFPType gamma, algorithmFPType *x, size_t nIterations, bool warmStart);
+
+protected:
+    void applyOperator(const algorithmFPType *xtx, algorithmFPType gamma, const algorithmFPType *v, algorithmFPType *result) const;
+
+    size_t _nFactors;
+    size_t _nKnown;
+    size_t _capacity;
+    daal::internal::TArray<algorithmFPType, cpu> _buffer;       /* Right hand side, residual, direction, product */
+    daal::internal::TArray<algorithmFPType, cpu> _knownFactors;
+    daal::internal::TArray<algorithmFPType, cpu> _coefficients;
+};
+
 template <typename algorithmFPType, CpuType cpu>
 class ImplicitALSTrainKernelCommon : public daal::algorithms::Kernel
 {
+public:
+    /* Copies the upper triangle of the cross product computed by computeXtX() to the lower one */
+    static void symmetrize(size_t nFactors, algorithmFPType *xtx);
+
 protected:
     void computeXtX(size_t *nRows, size_t *nCols, algorithmFPType *beta, algorithmFPType *x, size_t *ldx,
                 algorithmFPType *xtx, size_t *ldxtx);
@@ -102,6 +143,20 @@ protected:
                 size_t nFactors, algorithmFPType *colFactors, algorithmFPType *rowFactors,
         algorithmFPType alpha, algorithmFPType lambda, algorithmFPType *xtx, daal::tls<algorithmFPType *>& lhs);
 
+    services::Status computeFactorsCG(size_t nRows, size_t nCols, const algorithmFPType *data,
+        const size_t *colIndices, const size_t *rowOffsets,
+                size_t nFactors, algorithmFPType *colFactors, algorithmFPType *rowFactors,
+        algorithmFPType alpha, algorithmFPType lambda, algorithmFPType *xtx, size_t nIterations, bool warmStart);
+
+    services::Status computeFactors(size_t nRows, size_t nCols, const algorithmFPType *data,
+        const size_t *colIndices, const size_t *rowOffsets,
+                size_t nFactors, algorithmFPType *colFactors, algorithmFPType *rowFactors,
+        algorithmFPType *xtx, daal::tls<algorithmFPType *>& lhs, const Parameter *parameter, bool warmStart);
+
+    virtual services::Status formOperator(size_t i, size_t nCols, const algorithmFPType *data, const size_t *colIndices, const size_t *rowOffsets,
+                algorithmFPType *colFactors, algorithmFPType alpha, algorithmFPType lambda,
+                ImplicitALSConjugateGradient<algorithmFPType, cpu> &cg, algorithmFPType &gamma) = 0;
+
     virtual void formSystem(size_t i, size_t nCols, const algorithmFPType *data, const size_t *colIndices, const size_t *rowOffsets,
                 size_t nFactors, algorithmFPType *colFactors,
                 algorithmFPType alpha, algorithmFPType *lhs, algorithmFPType *rhs, algorithmFPType lambda) = 0;
@@ -119,6 +174,10 @@ template <typename algorithmFPType, CpuType cpu>
 class ImplicitALSTrainKernel<algorithmFPType, fastCSR, cpu> : public ImplicitALSTrainKernelBase<algorithmFPType, cpu>
 {
 protected:
+    virtual services::Status formOperator(size_t i, size_t nCols, const algorithmFPType *data, const size_t *colIndices, const size_t *rowOffsets,
+                algorithmFPType *colFactors, algorithmFPType alpha, algorithmFPType lambda,
+                ImplicitALSConjugateGradient<algorithmFPType, cpu> &cg, algorithmFPType &gamma) DAAL_C11_OVERRIDE;
+
     virtual void formSystem(size_t i, size_t nCols, const algorithmFPType *data, const size_t *colIndices, const size_t *rowOffsets,
                 size_t nFactors, algorithmFPType *colFactors,
         algorithmFPType alpha, algorithmFPType *lhs, algorithmFPType *rhs, algorithmFPType lambda) DAAL_C11_OVERRIDE;
@@ -132,6 +191,10 @@ template <typename algorithmFPType, CpuType cpu>
 class ImplicitALSTrainKernel<algorithmFPType, defaultDense, cpu> : public ImplicitALSTrainKernelBase<algorithmFPType, cpu>
 {
 protected:
+    virtual services::Status formOperator(size_t i, size_t nCols, const algorithmFPType *data, const size_t *colIndices, const size_t *rowOffsets,
+                algorithmFPType *colFactors, algorithmFPType alpha, algorithmFPType lambda,
+                ImplicitALSConjugateGradient<algorithmFPType, cpu> &cg, algorithmFPType &gamma) DAAL_C11_OVERRIDE;
+
     virtual void formSystem(size_t i, size_t nCols, const algorithmFPType *data, const size_t *colIndices, const size_t *rowOffsets,
                 size_t nFactors, algorithmFPType *colFactors,
         algorithmFPType alpha, algorithmFPType *lhs, algorithmFPType *rhs, algorithmFPType lambda) DAAL_C11_OVERRIDE;
@@ -252,8 +315,8 @@ class ImplicitALSTrainDistrStep4Kernel : public ImplicitALSTrainKernel<algorithm
 {
 public:
     services::Status compute(data_management::KeyValueDataCollection *models, data_management::NumericTable *dataTable,
-                data_management::NumericTable *cpTable, implicit_als::PartialModel *partialModel,
-                const Parameter *parameter);
+                data_management::NumericTable *cpTable, data_management::NumericTable *initialFactors,
+                implicit_als::PartialModel *partialModel, const Parameter *parameter);
 };
 
 template <typename algorithmFPType, CpuType cpu>
@@ -261,8 +324,8 @@ class ImplicitALSTrainDistrStep4Kernel<algorithmFPType, fastCSR, cpu> : public I
 {
 public:
     services::Status compute(data_management::KeyValueDataCollection *models, data_management::NumericTable *dataTable,
-                data_management::NumericTable *cpTable, implicit_als::PartialModel *partialModel,
-                const Parameter *parameter);
+                data_management::NumericTable *cpTable, data_management::NumericTable *initialFactors,
+                implicit_als::PartialModel *partialModel, const Parameter *parameter);
 };
 
 }
@@ -91,7 +91,8 @@ void Input::set(InputId id, const NumericTablePtr &ptr)
 Status Input::checkCSR() const
 {
     Status s;
-    const int csrLayout = (int)NumericTableIface::csrArray;
+    /* Kernels read single rows, so only the tables that provide rows in the CSR layout are accepted */
+    const int csrLayout = (int)NumericTableIface::csrArray | (int)NumericTableIface::bsrArray;
 
     DAAL_CHECK_STATUS(s, checkNumericTable(get(X).get(), XStr(), 0, csrLayout));
 
@@ -48,6 +48,7 @@
 #include "linear_model_model_impl.h"
 #include "algorithms/linear_model/linear_model_model.h"
 #include "service_numeric_table.h"
+#include "data_management/data/csr_numeric_table.h"
 #include "daal_strings.h"
 
 namespace daal
@@ -97,6 +98,64 @@ bool ModelInternal::getInterceptFlag() const { return _interceptFlag; }
 
 NumericTablePtr ModelInternal::getBeta() { return _beta; }
 
+Status ModelInternal::compactBeta(double zeroThreshold)
+{
+    DAAL_CHECK_EX(zeroThreshold >= 0, ErrorIncorrectParameter, ArgumentName, zeroThresholdStr());
+    if(dynamic_cast<CSRNumericTableIface *>(_beta.get()))
+        return Status();
+
+    if((*_beta->getDictionarySharedPtr())[0].indexType == data_feature_utils::DAAL_FLOAT32)
+        return compactBetaImpl<float>((float)zeroThreshold);
+    return compactBetaImpl<double>(zeroThreshold);
+}
+
+template<typename modelFPType>
+Status ModelInternal::compactBetaImpl(modelFPType zeroThreshold)
+{
+    const size_t nRows = _beta->getNumberOfRows();
+    const size_t nCols = _beta->getNumberOfColumns();
+    daal::internal::ReadRows<modelFPType, sse2> betaRows(*_beta, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(betaRows);
+    const modelFPType *beta = betaRows.get();
+
+    size_t nNonZero = 0;
+    for(size_t i = 0; i < nCols * nRows; i++)
+    {
+        nNonZero += (beta[i] > zeroThreshold || beta[i] < -zeroThreshold);
+    }
+
+    Status s;
+    CSRNumericTablePtr compactBeta = CSRNumericTable::create<modelFPType>(NULL, NULL, NULL, nCols, nRows, CSRNumericTable::oneBased, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    DAAL_CHECK_STATUS(s, compactBeta->allocateDataMemory(nNonZero ? nNonZero : 1));
+
+    modelFPType *values = nullptr;
+    size_t *colIndices = nullptr;
+    size_t *rowOffsets = nullptr;
+    DAAL_CHECK_STATUS(s, compactBeta->getArrays<modelFPType>(&values, &colIndices, &rowOffsets));
+
+    size_t nnz = 0;
+    rowOffsets[0] = 1;
+    for(size_t i = 0; i < nRows; i++)
+    {
+        for(size_t j = 0; j < nCols; j++)
+        {
+            const modelFPType value = beta[i * nCols + j];
+            if(value > zeroThreshold || value < -zeroThreshold)
+            {
+                values[nnz] = value;
+                colIndices[nnz] = j + 1;
+                nnz++;
+            }
+        }
+        rowOffsets[i + 1] = nnz + 1;
+    }
+
+    betaRows.release();
+    _beta = compactBeta;
+    return s;
+}
+
 Status ModelInternal::setToZero(NumericTable &table)
 {
     const size_t nRows = table.getNumberOfRows();
@@ -123,7 +182,9 @@ Status checkModel(linear_model::Model* model, const daal::algorithms::Parameter
     const Parameter &parameter = static_cast<const Parameter &>(par);
     DAAL_CHECK_EX(model->getInterceptFlag() == parameter.interceptFlag, ErrorIncorrectParameter, ParameterName, interceptFlagStr());
 
-    return checkNumericTable(model->getBeta().get(), betaStr(), 0, 0, nBeta, nResponses);
+    /* The training updates the coefficients in place, the model compacted with compactBeta() cannot be trained */
+    const int unexpectedLayouts = (int)NumericTableIface::csrArray;
+    return checkNumericTable(model->getBeta().get(), betaStr(), unexpectedLayouts, 0, nBeta, nResponses);
 }
 }
 }
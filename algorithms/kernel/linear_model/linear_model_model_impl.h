@@ -128,6 +128,13 @@ public:
      */
     data_management::NumericTablePtr getBeta();
 
+    /**
+     * Stores the regression coefficients in the compressed sparse row format
+     * \param[in] zeroThreshold  Coefficients with the absolute value not greater than zeroThreshold are dropped
+     * \return Status of computations
+     */
+    services::Status compactBeta(double zeroThreshold);
+
 protected:
     bool _interceptFlag;     /* Flag. True if the ridge regression model contains the intercept term;
                                 false otherwise. */
@@ -135,6 +142,9 @@ protected:
 
     services::Status setToZero(data_management::NumericTable &table);
 
+    template<typename modelFPType>
+    services::Status compactBetaImpl(modelFPType zeroThreshold);
+
     template<typename Archive, bool onDeserialize>
     services::Status serialImpl(Archive *arch)
     {
@@ -210,6 +220,13 @@ public:
      * \return Table that contains regression coefficients
      */
     data_management::NumericTablePtr getBeta() DAAL_C11_OVERRIDE { return ImplType::getBeta(); }
+
+    /**
+     * Stores the regression coefficients in the compressed sparse row format
+     * \param[in] zeroThreshold  Coefficients with the absolute value not greater than zeroThreshold are dropped
+     * \return Status of computations
+     */
+    services::Status compactBeta(double zeroThreshold = 0.0) DAAL_C11_OVERRIDE { return ImplType::compactBeta(zeroThreshold); }
 };
 
 }
@@ -115,6 +115,94 @@ void PredictKernel<algorithmFPType, defaultDense, cpu>::computeBlockOfResponses(
 } /* void PredictKernel<algorithmFPType, defaultDense, cpu>::computeBlockOfResponses */
 
 
+/**
+ *  \brief Function that computes linear regression prediction results
+ *         for a block of input data rows in the CSR layout
+ *
+ *  \param numRows[in]          Number of input data rows
+ *  \param values[in]           Non-zero values of the block of input data rows
+ *  \param colIndices[in]       One-based column indices of the non-zero values
+ *  \param rowOffsets[in]       One-based offsets of the rows in the arrays of values and column indices
+ *  \param numBetas[in]         Number of regression coefficients
+ *  \param beta[in]             Regression coefficients
+ *  \param numResponses[in]     Number of responses to calculate for each input data row
+ *  \param responseBlock[out]   Resulting block of responses
+ *  \param findBeta0[in]        Flag. True if regression coefficient contain intercept term;
+ *                              false - otherwise.
+ */
+template<typename algorithmFPType, CpuType cpu>
+void PredictKernel<algorithmFPType, defaultDense, cpu>::computeBlockOfResponsesCSR(
+    size_t numRows, const algorithmFPType *values, const size_t *colIndices, const size_t *rowOffsets,
+    size_t numBetas, const algorithmFPType *beta, size_t numResponses, algorithmFPType *responseBlock, bool findBeta0)
+{
+    /* One-based column index j of the data is the index of the coefficient of feature j - 1 */
+    for (size_t i = 0; i < numRows; i++)
+    {
+        algorithmFPType *response = responseBlock + i * numResponses;
+        for (size_t k = 0; k < numResponses; k++)
+        {
+            response[k] = (findBeta0 ? beta[k * numBetas] : (algorithmFPType)0);
+        }
+        for (size_t jj = rowOffsets[i] - rowOffsets[0]; jj < rowOffsets[i + 1] - rowOffsets[0]; jj++)
+        {
+            const algorithmFPType value = values[jj];
+            const algorithmFPType *betaColumn = beta + colIndices[jj];
+            for (size_t k = 0; k < numResponses; k++)
+            {
+                response[k] += value * betaColumn[k * numBetas];
+            }
+        }
+    }
+} /* void PredictKernel<algorithmFPType, defaultDense, cpu>::computeBlockOfResponsesCSR */
+
+/**
+ *  \brief Function that computes linear regression prediction results
+ *         for a block of input data rows with the regression coefficients in the CSR layout
+ *
+ *  \param numFeatures[in]      Number of features in input data row
+ *  \param numRows[in]          Number of input data rows
+ *  \param dataBlock[in]        Block of input data rows
+ *  \param betaValues[in]       Non-zero regression coefficients
+ *  \param betaColIndices[in]   One-based indices of the non-zero regression coefficients
+ *  \param betaRowOffsets[in]   One-based offsets of the responses in the arrays of coefficients and indices
+ *  \param numResponses[in]     Number of responses to calculate for each input data row
+ *  \param responseBlock[out]   Resulting block of responses
+ *  \param findBeta0[in]        Flag. True if regression coefficient contain intercept term;
+ *                              false - otherwise.
+ */
+template<typename algorithmFPType, CpuType cpu>
+void PredictKernel<algorithmFPType, defaultDense, cpu>::computeBlockOfResponsesSparseBeta(
+    size_t numFeatures, size_t numRows, const algorithmFPType *dataBlock,
+    const algorithmFPType *betaValues, const size_t *betaColIndices, const size_t *betaRowOffsets,
+    size_t numResponses, algorithmFPType *responseBlock, bool findBeta0)
+{
+    for (size_t k = 0; k < numResponses; k++)
+    {
+        size_t jjStart = betaRowOffsets[k] - betaRowOffsets[0];
+        const size_t jjEnd = betaRowOffsets[k + 1] - betaRowOffsets[0];
+
+        /* One-based index 1 is the intercept term, index j > 1 is the coefficient of feature j - 2 */
+        algorithmFPType beta0 = 0;
+        if (jjStart < jjEnd && betaColIndices[jjStart] == 1)
+        {
+            beta0 = (findBeta0 ? betaValues[jjStart] : (algorithmFPType)0);
+            jjStart++;
+        }
+
+        for (size_t i = 0; i < numRows; i++)
+        {
+            const algorithmFPType *x = dataBlock + i * numFeatures;
+            algorithmFPType sum = beta0;
+            for (size_t jj = jjStart; jj < jjEnd; jj++)
+            {
+                sum += betaValues[jj] * x[betaColIndices[jj] - 2];
+            }
+            responseBlock[i * numResponses + k] = sum;
+        }
+    }
+} /* void PredictKernel<algorithmFPType, defaultDense, cpu>::computeBlockOfResponsesSparseBeta */
+
+
 template<typename algorithmFPType, CpuType cpu>
 services::Status PredictKernel<algorithmFPType, defaultDense, cpu>::compute(
     const NumericTable *a, const linear_model::Model *m, NumericTable *r)
@@ -123,18 +211,58 @@ services::Status PredictKernel<algorithmFPType, defaultDense, cpu>::compute(
 
     /* Get numeric tables with input data */
     NumericTable *dataTable = const_cast<NumericTable *>(a);
+    CSRNumericTableIface *csrDataTable = dynamic_cast<CSRNumericTableIface *>(dataTable);
 
     /* Get numeric table to store results */
     DAAL_INT numVectors  = dataTable->getNumberOfRows();
 
     /* Get linear regression coefficients */
     NumericTable *betaTable = model->getBeta().get();
+    CSRNumericTableIface *csrBetaTable = dynamic_cast<CSRNumericTableIface *>(betaTable);
     DAAL_INT numResponses = betaTable->getNumberOfRows();
+    const size_t nBetas = betaTable->getNumberOfColumns();
+    const bool findBeta0 = model->getInterceptFlag();
 
-    /* Retrieve data associated with coefficients */
-    ReadRows<algorithmFPType, cpu> betaRows(betaTable, 0, numResponses);
-    DAAL_CHECK_BLOCK_STATUS(betaRows)
-    const algorithmFPType *beta = betaRows.get();
+    /* Retrieve data associated with coefficients. The coefficients stored in the CSR layout are used
+       as is for the dense input data and are expanded for the input data in the CSR layout */
+    ReadRowsCSR<algorithmFPType, cpu> betaRowsCSR;
+    ReadRows<algorithmFPType, cpu> betaRows(csrBetaTable ? nullptr : betaTable);
+    const algorithmFPType *betaValues = nullptr;
+    const size_t *betaColIndices = nullptr;
+    const size_t *betaRowOffsets = nullptr;
+    TArray<algorithmFPType, cpu> betaDense;
+    const algorithmFPType *beta = nullptr;
+    if (csrBetaTable)
+    {
+        betaRowsCSR.set(csrBetaTable, 0, numResponses);
+        DAAL_CHECK_BLOCK_STATUS(betaRowsCSR)
+        betaValues     = betaRowsCSR.values();
+        betaColIndices = betaRowsCSR.cols();
+        betaRowOffsets = betaRowsCSR.rows();
+        if (csrDataTable)
+        {
+            betaDense.reset(numResponses * nBetas);
+            DAAL_CHECK_MALLOC(betaDense.get());
+            algorithmFPType *betaArray = betaDense.get();
+            for (size_t k = 0; k < numResponses; k++)
+            {
+                for (size_t j = 0; j < nBetas; j++)
+                {
+                    betaArray[k * nBetas + j] = 0;
+                }
+                for (size_t jj = betaRowOffsets[k] - betaRowOffsets[0]; jj < betaRowOffsets[k + 1] - betaRowOffsets[0]; jj++)
+                {
+                    betaArray[k * nBetas + betaColIndices[jj] - 1] = betaValues[jj];
+                }
+            }
+            beta = betaArray;
+        }
+    }
+    else
+    {
+        beta = betaRows.next(0, numResponses);
+        DAAL_CHECK_BLOCK_STATUS(betaRows)
+    }
 
     size_t numRowsInBlock = _numRowsInBlock;
     if (numRowsInBlock < 1) { numRowsInBlock = 1; }
@@ -154,9 +282,33 @@ services::Status PredictKernel<algorithmFPType, defaultDense, cpu>::compute(
         DAAL_INT numRows = endRow - startRow;
 
         DAAL_INT numFeatures = dataTable->getNumberOfColumns();
-        DAAL_INT nAllBetas   = betaTable->getNumberOfColumns();
+        DAAL_INT nAllBetas   = nBetas;
 
         Status s;
+        WriteOnlyRows<algorithmFPType, cpu> responseRows(r, startRow, endRow - startRow);
+        s = responseRows.status();
+        if (!s)
+        {
+            safeStat |= s;
+            return;
+        }
+        algorithmFPType *responseBlock = responseRows.get();
+
+        if (csrDataTable)
+        {
+            /* Retrieve sparse data block, the cost is proportional to the number of non-zero values */
+            ReadRowsCSR<algorithmFPType, cpu> dataRows(csrDataTable, startRow, endRow - startRow);
+            s = dataRows.status();
+            if (!s)
+            {
+                safeStat |= s;
+                return;
+            }
+            computeBlockOfResponsesCSR(numRows, dataRows.values(), dataRows.cols(), dataRows.rows(),
+                                       nBetas, beta, numResponses, responseBlock, findBeta0);
+            return;
+        }
+
         /* Retrieve data blocks associated with input and resulting tables */
         ReadRows<algorithmFPType, cpu> dataRows(dataTable, startRow, endRow - startRow);
         s = dataRows.status();
@@ -167,19 +319,18 @@ services::Status PredictKernel<algorithmFPType, defaultDense, cpu>::compute(
         }
         const algorithmFPType *dataBlock = dataRows.get();
 
-        WriteOnlyRows<algorithmFPType, cpu> responseRows(r, startRow, endRow - startRow);
-        s = responseRows.status();
-        if (!s)
+        if (csrBetaTable)
         {
-            safeStat |= s;
+            computeBlockOfResponsesSparseBeta(numFeatures, numRows, dataBlock, betaValues, betaColIndices,
+                                              betaRowOffsets, numResponses, responseBlock, findBeta0);
             return;
         }
-        algorithmFPType *responseBlock = responseRows.get();
+
         DAAL_INT*  pnumResponses = (DAAL_INT*)&numResponses;
 
         /* Calculate predictions */
         computeBlockOfResponses(&numFeatures, &numRows, dataBlock, &nAllBetas,
-                                beta, pnumResponses, responseBlock, model->getInterceptFlag());
+                                beta, pnumResponses, responseBlock, findBeta0);
     } ); /* daal::threader_for */
 
     return safeStat.detach();
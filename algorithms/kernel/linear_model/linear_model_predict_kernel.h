@@ -93,6 +93,15 @@ protected:
                                  DAAL_INT *numBetas, const algorithmFpType *beta,
                                  DAAL_INT *numResponses, algorithmFpType *responseBlock, bool findBeta0);
 
+    void computeBlockOfResponsesCSR(size_t numRows, const algorithmFpType *values, const size_t *colIndices,
+                                    const size_t *rowOffsets, size_t numBetas, const algorithmFpType *beta,
+                                    size_t numResponses, algorithmFpType *responseBlock, bool findBeta0);
+
+    void computeBlockOfResponsesSparseBeta(size_t numFeatures, size_t numRows, const algorithmFpType *dataBlock,
+                                           const algorithmFpType *betaValues, const size_t *betaColIndices,
+                                           const size_t *betaRowOffsets, size_t numResponses,
+                                           algorithmFpType *responseBlock, bool findBeta0);
+
     static const size_t _numRowsInBlock = 256;
 };
 
@@ -47,6 +47,7 @@
 
 #include "linear_model_train_normeq_kernel.h"
 #include "service_lapack.h"
+#include "service_batched_cholesky.h"
 
 namespace daal
 {
@@ -171,6 +172,15 @@ Status FinalizeKernel<algorithmFPType, cpu>::solveSystem(DAAL_INT p, algorithmFP
                                                          DAAL_INT ny, algorithmFPType *b,
                                                          const ErrorID &internalError)
 {
+    if ((size_t)p <= algorithms::internal::smallCholeskyMaxDim)
+    {
+        /* Small systems are solved sequentially by the register-blocked kernel */
+        typedef algorithms::internal::SmallCholesky<algorithmFPType, cpu> SmallCholeskyType;
+        DAAL_CHECK(SmallCholeskyType::factorize(p, a) == 0, ErrorNormEqSystemSolutionFailed);
+        DAAL_CHECK(SmallCholeskyType::solve(p, ny, a, b) == 0, internalError);
+        return Status();
+    }
+
     char up = 'U';
     DAAL_INT info;
 
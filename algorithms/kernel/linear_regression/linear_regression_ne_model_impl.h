@@ -186,6 +186,13 @@ public:
      */
     data_management::NumericTablePtr getBeta() DAAL_C11_OVERRIDE { return ImplType::getBeta(); }
 
+    /**
+     * Stores the regression coefficients in the compressed sparse row format
+     * \param[in] zeroThreshold  Coefficients with the absolute value not greater than zeroThreshold are dropped
+     * \return Status of computations
+     */
+    services::Status compactBeta(double zeroThreshold = 0.0) DAAL_C11_OVERRIDE { return ImplType::compactBeta(zeroThreshold); }
+
 protected:
 
     services::Status serializeImpl(InputDataArchive  *arch) DAAL_C11_OVERRIDE
@@ -77,6 +77,11 @@ services::Status LowOrderMomentsBatchKernel<algorithmFPType, method, cpu>::compu
         return estimates_batch_all::compute_estimates<algorithmFPType, cpu>(dataTable, result);
         }
 
+    if (method == fastCSR || method == singlePassCSR || method == sumCSR)
+    {
+        return computeSparse(dataTable, result);
+    }
+
         bool isOnline = false;
         LowOrderMomentsBatchTask<algorithmFPType, cpu> task(dataTable, result);
         if (method == sumDense || method == sumCSR)
@@ -134,6 +139,58 @@ services::Status LowOrderMomentsBatchKernel<algorithmFPType, method, cpu>::compu
     return s;
 }
 
+/* Moments of sparse data are computed on its columns, so the data set is not converted into dense rows */
+template<typename algorithmFPType, Method method, CpuType cpu>
+services::Status LowOrderMomentsBatchKernel<algorithmFPType, method, cpu>::computeSparse( NumericTable *dataTable,
+                                                                                          Result *result )
+{
+    const size_t nFeatures = dataTable->getNumberOfColumns();
+    const size_t nVectors  = dataTable->getNumberOfRows();
+
+    WriteOnlyRows<algorithmFPType, cpu> resultRows[lastResultId + 1];
+    algorithmFPType *resultArray[lastResultId + 1];
+    for (size_t i = 0; i < lastResultId + 1; i++)
+    {
+        resultArray[i] = resultRows[i].set(result->get((ResultId)i).get(), 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(resultRows[i]);
+    }
+
+    Status s;
+    if (method == sumCSR)
+    {
+        DAAL_CHECK_STATUS(s, (retrievePrecomputedStatsIfPossible<algorithmFPType, cpu>(nFeatures, nVectors, dataTable,
+            resultArray[(int)sum], resultArray[(int)mean])));
+    }
+
+    DAAL_CHECK_STATUS(s, (computeSparseMoments<algorithmFPType, method, cpu>(dataTable,
+                                                                             resultArray[(int)sum],
+                                                                             resultArray[(int)mean],
+                                                                             resultArray[(int)secondOrderRawMoment],
+                                                                             resultArray[(int)variance],
+                                                                             resultArray[(int)minimum],
+                                                                             resultArray[(int)maximum],
+                                                                             resultArray[(int)sumSquares])));
+
+    daal::internal::Math<algorithmFPType,cpu>::vSqrt( nFeatures,
+                                                      resultArray[(int)variance],
+                                                      resultArray[(int)standardDeviation] );
+
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        resultArray[(int)variation][i] = resultArray[(int)standardDeviation][i] / resultArray[(int)mean][i];
+    }
+
+    computeSumOfSquaredDiffsFromMean<algorithmFPType, cpu>( nFeatures,
+                                                            nVectors,
+                                                            0,
+                                                            resultArray[(int)variance],
+                                                            resultArray[(int)sum],
+                                                            resultArray[(int)sum],
+                                                            resultArray[(int)sumSquaresCentered],
+                                                            false );
+    return s;
+}
+
 }
 }
 }
@@ -50,6 +50,7 @@
 
 #include "low_order_moments_kernel.h"
 #include "service_numeric_table.h"
+#include "service_sparse_utils.h"
 #include "service_error_handling.h"
 
 #include "service_stat.h"
@@ -418,6 +419,85 @@ Status retrievePrecomputedStatsIfPossible( size_t nFeatures,
     return Status();
 }
 
+/****************************************************************************************************************************/
+/* Computes the moments of the sparse data set feature by feature on its columns in the CSC layout.
+   Zeros that are not stored contribute to the minimum, the maximum and the centered sum of squares analytically.
+   For sumCSR method sums and means are expected to be precomputed */
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status computeSparseMoments( NumericTable *dataTable,
+                             algorithmFPType *sums,
+                             algorithmFPType *mean,
+                             algorithmFPType *raw2Mom,
+                             algorithmFPType *variance,
+                             algorithmFPType *min,
+                             algorithmFPType *max,
+                             algorithmFPType *sumSq )
+{
+    const size_t nFeatures = dataTable->getNumberOfColumns();
+    const size_t nVectors  = dataTable->getNumberOfRows();
+
+    ReadColumnsSparse<algorithmFPType, cpu> dataColumns(dataTable);
+    DAAL_CHECK_BLOCK_STATUS(dataColumns);
+    const algorithmFPType *values = dataColumns.values();
+    const size_t *colOffsets = dataColumns.offsets();
+
+    const algorithmFPType zero = 0.0;
+    const algorithmFPType invNVectors   = 1.0 / (algorithmFPType)nVectors;
+    const algorithmFPType invNVectorsM1 = 1.0 / (algorithmFPType)(nVectors - 1);
+
+    const size_t blockSize = 256;
+    const size_t nBlocks = (nFeatures + blockSize - 1) / blockSize;
+
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        const size_t jEnd = (iBlock + 1 == nBlocks ? nFeatures : (iBlock + 1) * blockSize);
+        for (size_t j = iBlock * blockSize; j < jEnd; j++)
+        {
+            const size_t kStart = colOffsets[j] - 1;
+            const size_t kEnd   = colOffsets[j + 1] - 1;
+            const algorithmFPType nZeros = (algorithmFPType)(nVectors - (kEnd - kStart));
+
+            algorithmFPType sumValue = zero;
+            algorithmFPType sumSqValue = zero;
+            algorithmFPType minValue = (kStart < kEnd ? values[kStart] : zero);
+            algorithmFPType maxValue = minValue;
+            for (size_t k = kStart; k < kEnd; k++)
+            {
+                sumValue   += values[k];
+                sumSqValue += values[k] * values[k];
+                if (values[k] < minValue) { minValue = values[k]; }
+                if (values[k] > maxValue) { maxValue = values[k]; }
+            }
+            if (nZeros > zero)
+            {
+                if (minValue > zero) { minValue = zero; }
+                if (maxValue < zero) { maxValue = zero; }
+            }
+
+            if (method != sumCSR)
+            {
+                sums[j] = sumValue;
+                mean[j] = sumValue * invNVectors;
+            }
+
+            const algorithmFPType meanValue = mean[j];
+            algorithmFPType sumSqCen = nZeros * meanValue * meanValue;
+            for (size_t k = kStart; k < kEnd; k++)
+            {
+                sumSqCen += (values[k] - meanValue) * (values[k] - meanValue);
+            }
+
+            min[j]      = minValue;
+            max[j]      = maxValue;
+            sumSq[j]    = sumSqValue;
+            raw2Mom[j]  = sumSqValue * invNVectors;
+            variance[j] = sumSqCen * invNVectorsM1;
+        }
+    } );
+
+    return Status();
+}
+
 
 /****************************************************************************************************************************/
 template<typename algorithmFPType, Method method, CpuType cpu>
@@ -106,7 +106,7 @@ services::Status Input::check(const daal::algorithms::Parameter *parameter, int
     int unexpectedLayouts = 0;
     if(method == fastCSR || method == singlePassCSR || method == sumCSR)
     {
-        int expectedLayout = (int)NumericTableIface::csrArray;
+        int expectedLayout = (int)NumericTableIface::csrArray | (int)NumericTableIface::cscArray | (int)NumericTableIface::bsrArray;
         DAAL_CHECK_STATUS(s, checkNumericTable(dataTable.get(), dataStr(), 0, expectedLayout));
     }
     else
@@ -69,6 +69,9 @@ class LowOrderMomentsBatchKernel : public daal::algorithms::Kernel
 {
 public:
     services::Status compute(NumericTable *dataTable, Result *result, const Parameter *parameter);
+
+private:
+    services::Status computeSparse(NumericTable *dataTable, Result *result);
 };
 
 template<typename algorithmFPType, low_order_moments::Method method, CpuType cpu>
@@ -83,6 +86,9 @@ public:
             NumericTable *meanTable, NumericTable *raw2MomTable, NumericTable *varianceTable,
             NumericTable *stDevTable, NumericTable *variationTable,
             const Parameter *parameter);
+
+private:
+    services::Status computeSparse(NumericTable *dataTable, PartialResult *partialResult, bool isOnline);
 };
 
 template<typename algorithmFPType, low_order_moments::Method method, CpuType cpu>
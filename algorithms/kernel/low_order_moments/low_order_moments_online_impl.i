@@ -79,6 +79,11 @@ services::Status LowOrderMomentsOnlineKernel<algorithmFPType, method, cpu>::comp
         return estimates_online_all::compute_estimates<algorithmFPType, method, cpu>(dataTable, partialResult, isOnline);
         }
 
+    if (method == fastCSR || method == singlePassCSR || method == sumCSR)
+    {
+        return computeSparse(dataTable, partialResult, isOnline);
+    }
+
     LowOrderMomentsOnlineTask<algorithmFPType, cpu> task(dataTable);
     Status s;
     DAAL_CHECK_STATUS(s, task.init(partialResult, isOnline));
@@ -117,6 +122,72 @@ services::Status LowOrderMomentsOnlineKernel<algorithmFPType, method, cpu>::comp
     return s;
 }
 
+/* Moments of sparse data are computed on its columns, so the data block is not converted into dense rows */
+template<typename algorithmFPType, Method method, CpuType cpu>
+services::Status LowOrderMomentsOnlineKernel<algorithmFPType, method, cpu>::computeSparse(
+            NumericTable *dataTable, PartialResult *partialResult, bool isOnline)
+{
+    const size_t nFeatures = dataTable->getNumberOfColumns();
+    const size_t nVectors  = dataTable->getNumberOfRows();
+
+    WriteRows<algorithmFPType, cpu> partialRows[lastPartialResultId + 1];
+    algorithmFPType *resultArray[lastPartialResultId + 1];
+    for (size_t i = 0; i < lastPartialResultId + 1; i++)
+    {
+        resultArray[i] = partialRows[i].set(partialResult->get((PartialResultId)i).get(), 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(partialRows[i]);
+    }
+
+    if (!isOnline)
+    {
+        resultArray[(int)nObservations][0] = 0.0;
+    }
+
+    /* Moments of the block: sums, means, second order raw moments, variances, minimums, maximums, sums of squares,
+       and the partial sums before the update */
+    TArray<algorithmFPType, cpu> blockMomentsArray(8 * nFeatures);
+    DAAL_CHECK_MALLOC(blockMomentsArray.get());
+    algorithmFPType *sums     = blockMomentsArray.get();
+    algorithmFPType *mean     = sums     + nFeatures;
+    algorithmFPType *raw2Mom  = mean     + nFeatures;
+    algorithmFPType *variance = raw2Mom  + nFeatures;
+    algorithmFPType *min      = variance + nFeatures;
+    algorithmFPType *max      = min      + nFeatures;
+    algorithmFPType *sumSq    = max      + nFeatures;
+    algorithmFPType *prevSums = sumSq    + nFeatures;
+
+    Status s;
+    if (method == sumCSR)
+    {
+        DAAL_CHECK_STATUS(s, (retrievePrecomputedStatsIfPossible<algorithmFPType, cpu>(nFeatures, nVectors, dataTable, sums, mean)));
+    }
+
+    DAAL_CHECK_STATUS(s, (computeSparseMoments<algorithmFPType, method, cpu>(dataTable, sums, mean, raw2Mom, variance, min, max, sumSq)));
+
+    algorithmFPType *partialSums  = resultArray[(int)partialSum];
+    algorithmFPType *partialMin   = resultArray[(int)partialMinimum];
+    algorithmFPType *partialMax   = resultArray[(int)partialMaximum];
+    algorithmFPType *partialSumSq = resultArray[(int)partialSumSquares];
+
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        prevSums[i]    = (isOnline ? partialSums[i] : 0.0);
+        partialSums[i] = prevSums[i] + sums[i];
+        partialSumSq[i] = (isOnline ? partialSumSq[i] + sumSq[i] : sumSq[i]);
+        if (!isOnline || min[i] < partialMin[i]) { partialMin[i] = min[i]; }
+        if (!isOnline || max[i] > partialMax[i]) { partialMax[i] = max[i]; }
+    }
+
+    computeSumOfSquaredDiffsFromMean<algorithmFPType, cpu>(nFeatures, nVectors,
+        (size_t)(resultArray[(int)nObservations][0]),
+        variance, partialSums, prevSums,
+        resultArray[(int)partialSumSquaresCentered], isOnline);
+
+    resultArray[(int)nObservations][0] += (algorithmFPType)nVectors;
+
+    return s;
+}
+
 template<typename algorithmFPType, Method method, CpuType cpu>
 services::Status LowOrderMomentsOnlineKernel<algorithmFPType, method, cpu>::finalizeCompute(
             NumericTable *nObservationsTable,
@@ -0,0 +1,178 @@
+/* file: naivebayes_aux_table_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Computation of logarithms of probabilities of multinomial naive Bayes
+//  shared by the training and the prediction stages
+//--
+*/
+
+#ifndef __NAIVEBAYES_AUX_TABLE_IMPL_I__
+#define __NAIVEBAYES_AUX_TABLE_IMPL_I__
+
+#include "multinomial_naive_bayes_model.h"
+#include "service_math.h"
+#include "service_numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multinomial_naive_bayes
+{
+namespace internal
+{
+
+using namespace daal::internal;
+
+/**
+ *  \brief Computes logarithms of priors, logarithms of the conditional probabilities and their sums
+ *         from the class sizes and the per-class sums of the features
+ *
+ *  \param[in]  nbPar       Parameters of the algorithm
+ *  \param[in]  p           Number of features
+ *  \param[in]  n_c         Class sizes, array of size nClasses
+ *  \param[in]  n_ci        Per-class sums of the features, array of size nClasses x p
+ *  \param[out] log_p       Logarithms of priors, array of size nClasses
+ *  \param[out] log_theta   Logarithms of the conditional probabilities, array of size nClasses x p
+ *  \param[out] aux_table   Sums of log_p and log_theta, array of size nClasses x p
+ */
+template<typename algorithmFPType, CpuType cpu>
+services::Status computeLogProbabilities( const Parameter *nbPar, size_t p, const algorithmFPType *n_c, const algorithmFPType *n_ci,
+                                          algorithmFPType *log_p, algorithmFPType *log_theta, algorithmFPType *aux_table )
+{
+    size_t c = nbPar->nClasses;
+
+    if ( !nbPar->priorClassEstimates.get() )
+    {
+        algorithmFPType log_p_const = -daal::internal::Math<algorithmFPType, cpu>::sLog( (algorithmFPType)c );
+
+        for ( size_t j = 0; j < c; j++ )
+        {
+            log_p[j] = log_p_const;
+        }
+    }
+    else
+    {
+        ReadRows<algorithmFPType, cpu> rrPriorClassEstimates( *nbPar->priorClassEstimates, 0, c );
+        DAAL_CHECK_BLOCK_STATUS(rrPriorClassEstimates);
+        const algorithmFPType *pe = rrPriorClassEstimates.get();
+
+        daal::internal::Math<algorithmFPType, cpu>::vLog(c, pe, log_p);
+    }
+
+    if ( !nbPar->alpha.get() )
+    {
+        algorithmFPType alpha_i = 1;
+        algorithmFPType alpha   = p * alpha_i;
+
+        for ( size_t j = 0; j < c; j++ )
+        {
+            algorithmFPType denominator = (algorithmFPType)1.0 / (n_c [ j ] + alpha);
+
+          PRAGMA_VECTOR_ALWAYS
+            for ( size_t i = 0 ; i < p; i++ )
+            {
+                log_theta[ j * p + i ] = (n_ci[ j * p + i ] + alpha_i) * denominator;
+            }
+            daal::internal::Math<algorithmFPType, cpu>::vLog(p, log_theta + j * p, log_theta + j * p);
+        }
+    }
+    else
+    {
+        ReadRows<algorithmFPType, cpu> rrAlphaI( *nbPar->alpha, 0, 1 );
+        DAAL_CHECK_BLOCK_STATUS(rrAlphaI);
+        const algorithmFPType *alpha_i = rrAlphaI.get();
+
+        algorithmFPType alpha = 0;
+        for ( size_t i = 0 ; i < p; i++ )
+        {
+            alpha += alpha_i[i];
+        }
+
+        for ( size_t j = 0; j < c; j++ )
+        {
+            algorithmFPType denominator = (algorithmFPType)1.0 / (n_c [ j ] + alpha);
+
+          PRAGMA_VECTOR_ALWAYS
+            for ( size_t i = 0 ; i < p; i++ )
+            {
+                log_theta[ j * p + i ] = (n_ci[ j * p + i ] + alpha_i[i]) * denominator;
+            }
+            daal::internal::Math<algorithmFPType, cpu>::vLog(p, log_theta + j * p, log_theta + j * p);
+        }
+    }
+
+    for ( size_t j = 0; j < c; j++ )
+    {
+        for ( size_t i = 0 ; i < p; i++ )
+        {
+            aux_table[ j * p + i ] = log_theta[ j * p + i ] + log_p[j];
+        }
+    }
+
+    return services::Status();
+}
+
+/**
+ *  \brief Transposes the auxiliary table of size nClasses x p, so that the contributions
+ *         of one feature to all the classes are stored contiguously
+ */
+template<typename algorithmFPType, CpuType cpu>
+void transposeAuxTable( size_t c, size_t p, const algorithmFPType *aux_table, algorithmFPType *aux_table_t )
+{
+    for ( size_t i = 0; i < p; i++ )
+    {
+      PRAGMA_IVDEP
+        for ( size_t j = 0; j < c; j++ )
+        {
+            aux_table_t[ i * c + j ] = aux_table[ j * p + i ];
+        }
+    }
+}
+
+} // namespace internal
+} // namespace multinomial_naive_bayes
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -46,6 +46,7 @@
 */
 
 #include "algorithms/naive_bayes/multinomial_naive_bayes_model.h"
+#include "naivebayes_model_impl.h"
 #include "daal_strings.h"
 
 using namespace daal::data_management;
@@ -60,7 +61,26 @@ namespace multinomial_naive_bayes
 namespace interface1
 {
 
-PartialModel::PartialModel() : _nObservations(0) { }
+Model::Model() : _auxTableCache(new AuxTableCache()) {}
+
+void Model::setNFeatures(size_t nFeatures)
+{
+    resetAuxTableCache();
+}
+
+void Model::resetAuxTableCache()
+{
+    if (_auxTableCache)
+        _auxTableCache->reset();
+}
+
+PartialModel::PartialModel() : _auxTableCache(new AuxTableCache()), _nObservations(0) { }
+
+void PartialModel::resetAuxTableCache()
+{
+    if (_auxTableCache)
+        _auxTableCache->reset();
+}
 
 Status Parameter::check() const
 {
@@ -46,6 +46,7 @@
 */
 
 #include "algorithms/naive_bayes/multinomial_naive_bayes_model.h"
+#include "naivebayes_model_impl.h"
 
 namespace daal
 {
@@ -62,7 +63,7 @@ namespace multinomial_naive_bayes
  * \DAAL_DEPRECATED_USE{ Model::create }
  */
 template<typename modelFPType>
-DAAL_EXPORT Model::Model(size_t nFeatures, const Parameter &parameter, modelFPType dummy)
+DAAL_EXPORT Model::Model(size_t nFeatures, const Parameter &parameter, modelFPType dummy) : _auxTableCache(new AuxTableCache())
 {
     using namespace data_management;
 
@@ -78,7 +79,8 @@ DAAL_EXPORT Model::Model(size_t nFeatures, const Parameter &parameter, modelFPTy
 }
 
 template<typename modelFPType>
-DAAL_EXPORT Model::Model(size_t nFeatures, const Parameter &parameter, modelFPType dummy, services::Status &st)
+DAAL_EXPORT Model::Model(size_t nFeatures, const Parameter &parameter, modelFPType dummy, services::Status &st) :
+    _auxTableCache(new AuxTableCache())
 {
     using namespace data_management;
 
@@ -124,7 +126,8 @@ DAAL_EXPORT ModelPtr Model::create(size_t nFeatures, const Parameter &parameter,
  * \DAAL_DEPRECATED_USE{ PartialModel::create }
  */
 template<typename modelFPType>
-DAAL_EXPORT PartialModel::PartialModel(size_t nFeatures, const Parameter &parameter, modelFPType dummy) : _nObservations(0)
+DAAL_EXPORT PartialModel::PartialModel(size_t nFeatures, const Parameter &parameter, modelFPType dummy) :
+    _auxTableCache(new AuxTableCache()), _nObservations(0)
 {
     using namespace data_management;
     const Parameter *par = &parameter;
@@ -139,7 +142,8 @@ DAAL_EXPORT PartialModel::PartialModel(size_t nFeatures, const Parameter &parame
 
 template<typename modelFPType>
 DAAL_EXPORT PartialModel::PartialModel(size_t nFeatures, const Parameter &parameter,
-                                       modelFPType dummy, services::Status &st) : _nObservations(0)
+                                       modelFPType dummy, services::Status &st) :
+    _auxTableCache(new AuxTableCache()), _nObservations(0)
 {
     using namespace data_management;
 
@@ -0,0 +1,105 @@
+/* file: naivebayes_model_impl.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the tables the multinomial naive Bayes prediction caches in the models
+//--
+*/
+
+#ifndef __NAIVEBAYES_MODEL_IMPL_H__
+#define __NAIVEBAYES_MODEL_IMPL_H__
+
+#include "algorithms/naive_bayes/multinomial_naive_bayes_model.h"
+#include "service_threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multinomial_naive_bayes
+{
+namespace interface1
+{
+
+/**
+ *  \brief Tables of logarithms of probabilities the prediction builds from a model once and reuses.
+ *         Every model owns its cache, so the predictions with different models do not contend.
+ *         The prediction builds and reads the tables with the mutex of the cache locked,
+ *         the setters of the model invalidate the tables under the same mutex
+ */
+class AuxTableCache
+{
+public:
+    AuxTableCache() {}
+
+    /* Invalidates the cached tables */
+    void reset()
+    {
+        AUTOLOCK(_mutex);
+        auxTable.reset();
+        auxTableByFeatures.reset();
+        key.clear();
+    }
+
+    daal::Mutex &mutex() { return _mutex; }
+
+    /* Sums of logarithms of priors and logarithms of the conditional probabilities of size nClasses x nFeatures,
+       computed from the counters of a partial model */
+    data_management::NumericTablePtr auxTable;
+    /* Auxiliary table transposed to nFeatures x nClasses for the prediction in the CSR format */
+    data_management::NumericTablePtr auxTableByFeatures;
+    /* Values of alpha followed by the prior class estimates auxTable of a partial model is computed with */
+    services::Collection<double> key;
+
+private:
+    daal::Mutex _mutex;
+
+    AuxTableCache(const AuxTableCache &);
+    AuxTableCache &operator=(const AuxTableCache &);
+};
+
+} // namespace interface1
+} // namespace multinomial_naive_bayes
+} // namespace algorithms
+} // namespace daal
+
+#endif
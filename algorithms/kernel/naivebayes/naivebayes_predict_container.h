@@ -77,12 +77,20 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     classifier::prediction::Result *result = static_cast<classifier::prediction::Result *>(_res);
 
     NumericTable *a = static_cast<NumericTable *>(input->get(classifier::prediction::data).get());
-    multinomial_naive_bayes::Model *m = static_cast<multinomial_naive_bayes::Model *>(input->get(classifier::prediction::model).get());
+    classifier::Model *cm = input->get(classifier::prediction::model).get();
     NumericTable *r = static_cast<NumericTable *>(result->get(classifier::prediction::prediction).get());
 
     multinomial_naive_bayes::Parameter *par = static_cast<multinomial_naive_bayes::Parameter *>(_par);
     daal::services::Environment::env &env = *_env;
 
+    /* Partial model from the online or distributed training is used without finalizing the training */
+    multinomial_naive_bayes::PartialModel *pm = dynamic_cast<multinomial_naive_bayes::PartialModel *>(cm);
+    if(pm)
+    {
+        __DAAL_CALL_KERNEL(env, internal::NaiveBayesPredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, a, pm, r, par);
+    }
+
+    multinomial_naive_bayes::Model *m = static_cast<multinomial_naive_bayes::Model *>(cm);
     __DAAL_CALL_KERNEL(env, internal::NaiveBayesPredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, a, m, r, par);
 }
 
@@ -56,9 +56,10 @@
 #include "csr_numeric_table.h"
 #include "service_data_utils.h"
 #include "service_blas.h"
-#include "service_spblas.h"
 #include "service_numeric_table.h"
 #include "service_error_handling.h"
+#include "naivebayes_aux_table_impl.i"
+#include "naivebayes_model_impl.h"
 
 #if( __CPUID__(DAAL_CPU) >= __avx512_mic__ )
 
@@ -117,26 +118,203 @@ struct methodSpecific<fastCSR, algorithmFPType, cpu>
         size_t n0, size_t n, size_t p, size_t c, int *classes, algorithmFPType *buff );
 };
 
+/**
+ *  \brief Returns the table of logarithms of probabilities in the layout used by the method.
+ *         The CSR method uses the table transposed to nFeatures x nClasses,
+ *         which is built once and cached in the model.
+ *         Must be called with the mutex of the cache locked
+ */
+template<Method method, typename algorithmFPType, CpuType cpu>
+services::Status getAuxTableForMethod( AuxTableCache &cache, const NumericTablePtr &ntAuxTable, size_t c, size_t p,
+                                       NumericTablePtr &ntAuxTableForMethod )
+{
+    ntAuxTableForMethod = ntAuxTable;
+    if( method != fastCSR )
+    {
+        return services::Status();
+    }
+
+    if( !cache.auxTableByFeatures )
+    {
+        services::Status s;
+        NumericTablePtr ntAuxTableT = HomogenNumericTable<algorithmFPType>::create(c, p, NumericTable::doAllocate, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+
+        ReadRows<algorithmFPType, cpu> rrAuxTable(ntAuxTable.get(), 0, c);
+        DAAL_CHECK_BLOCK_STATUS(rrAuxTable);
+        WriteOnlyRows<algorithmFPType, cpu> wrAuxTableT(ntAuxTableT.get(), 0, p);
+        DAAL_CHECK_BLOCK_STATUS(wrAuxTableT);
+
+        multinomial_naive_bayes::internal::transposeAuxTable<algorithmFPType, cpu>( c, p, rrAuxTable.get(), wrAuxTableT.get() );
+        cache.auxTableByFeatures = ntAuxTableT;
+    }
+    ntAuxTableForMethod = cache.auxTableByFeatures;
+    return services::Status();
+}
+
 template<typename algorithmFPType, Method method, CpuType cpu>
 services::Status NaiveBayesPredictKernel<algorithmFPType, method, cpu>::compute(const NumericTable *a, const Model *m,
                                                                     NumericTable *r, const Parameter *parameter)
 {
-    NumericTable *ntData = const_cast<NumericTable *>( a );
     Model *mdl = const_cast<Model *>(m);
+
+    const size_t p = a->getNumberOfColumns();
+    const size_t c = parameter->nClasses;
+
+    /* The prediction keeps its own reference to the table, so the table stays valid
+       when the training invalidates the cache */
+    NumericTablePtr ntAuxTable = mdl->getAuxTable();
+    if( method == fastCSR )
+    {
+        AuxTableCache &cache = *mdl->getAuxTableCache();
+        AUTOLOCK(cache.mutex());
+        services::Status s = getAuxTableForMethod<method, algorithmFPType, cpu>( cache, mdl->getAuxTable(), c, p, ntAuxTable );
+        if(!s) return s;
+    }
+
+    return predict( a, ntAuxTable.get(), r, parameter );
+}
+
+/**
+ *  \brief Reads the values of the parameters the table of logarithms of probabilities of a partial model depends on:
+ *         alpha followed by the prior class estimates. The default parameters are replaced with their values,
+ *         so the parameters that give the same table give the same key
+ */
+template<typename algorithmFPType, CpuType cpu>
+services::Status readAuxTableKey( const Parameter *parameter, size_t c, size_t p, services::Collection<double> &key )
+{
+    if( !parameter->alpha.get() )
+    {
+        for( size_t i = 0; i < p; i++ )
+        {
+            key[i] = 1.0;
+        }
+    }
+    else
+    {
+        ReadRows<algorithmFPType, cpu> rrAlpha( *parameter->alpha, 0, 1 );
+        DAAL_CHECK_BLOCK_STATUS(rrAlpha);
+        for( size_t i = 0; i < p; i++ )
+        {
+            key[i] = rrAlpha.get()[i];
+        }
+    }
+
+    if( !parameter->priorClassEstimates.get() )
+    {
+        for( size_t j = 0; j < c; j++ )
+        {
+            key[p + j] = 1.0 / (double)c;
+        }
+    }
+    else
+    {
+        ReadRows<algorithmFPType, cpu> rrPriorClassEstimates( *parameter->priorClassEstimates, 0, c );
+        DAAL_CHECK_BLOCK_STATUS(rrPriorClassEstimates);
+        for( size_t j = 0; j < c; j++ )
+        {
+            key[p + j] = rrPriorClassEstimates.get()[j];
+        }
+    }
+    return services::Status();
+}
+
+/**
+ *  \brief Computes the table of logarithms of probabilities from the counters of the partial model
+ *         and caches it in the model together with the key of the parameters it is computed with.
+ *         Must be called with the mutex of the cache locked
+ */
+template<Method method, typename algorithmFPType, CpuType cpu>
+services::Status getPartialModelAuxTable( PartialModel *mdl, AuxTableCache &cache, const services::Collection<double> &key,
+                                          const Parameter *parameter, size_t c, size_t p, NumericTablePtr &ntAuxTableForMethod )
+{
+    bool isValid = cache.auxTable && cache.key.size() == key.size();
+    for( size_t i = 0; i < key.size() && isValid; i++ )
+    {
+        isValid = (cache.key[i] == key[i]);
+    }
+
+    if( !isValid )
+    {
+        services::Status s;
+        NumericTablePtr ntAuxTable = HomogenNumericTable<algorithmFPType>::create(p, c, NumericTable::doAllocate, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+
+        ReadRows<algorithmFPType, cpu> rrC ( mdl->getClassSize().get()    , 0, c );
+        DAAL_CHECK_BLOCK_STATUS(rrC);
+        ReadRows<algorithmFPType, cpu> rrCi( mdl->getClassGroupSum().get(), 0, c );
+        DAAL_CHECK_BLOCK_STATUS(rrCi);
+        WriteOnlyRows<algorithmFPType, cpu> wrAuxTable( ntAuxTable.get(), 0, c );
+        DAAL_CHECK_BLOCK_STATUS(wrAuxTable);
+
+        TArray<algorithmFPType, cpu> log_p    ( c     );
+        TArray<algorithmFPType, cpu> log_theta( c * p );
+        DAAL_CHECK_MALLOC(log_p.get() && log_theta.get());
+
+        s = multinomial_naive_bayes::internal::computeLogProbabilities<algorithmFPType, cpu>(
+            parameter, p, rrC.get(), rrCi.get(), log_p.get(), log_theta.get(), wrAuxTable.get() );
+        if(!s) return s;
+        wrAuxTable.release();
+
+        cache.key = key;
+        DAAL_CHECK_MALLOC(cache.key.size() == key.size());
+        cache.auxTable = ntAuxTable;
+        cache.auxTableByFeatures.reset();
+    }
+
+    return getAuxTableForMethod<method, algorithmFPType, cpu>( cache, cache.auxTable, c, p, ntAuxTableForMethod );
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+services::Status NaiveBayesPredictKernel<algorithmFPType, method, cpu>::compute(const NumericTable *a, PartialModel *mdl,
+                                                                    NumericTable *r, const Parameter *parameter)
+{
+    const size_t p = a->getNumberOfColumns();
+    const size_t c = parameter->nClasses;
+
+    /* The table depends on alpha and the prior class estimates, it is recomputed when their values change */
+    services::Collection<double> key( p + c );
+    DAAL_CHECK_MALLOC(key.size() == p + c);
+    services::Status s = readAuxTableKey<algorithmFPType, cpu>( parameter, c, p, key );
+    if(!s) return s;
+
+    NumericTablePtr ntAuxTable;
+    {
+        AuxTableCache &cache = *mdl->getAuxTableCache();
+        AUTOLOCK(cache.mutex());
+        s = getPartialModelAuxTable<method, algorithmFPType, cpu>( mdl, cache, key, parameter, c, p, ntAuxTable );
+        if(!s) return s;
+    }
+
+    return predict( a, ntAuxTable.get(), r, parameter );
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+services::Status NaiveBayesPredictKernel<algorithmFPType, method, cpu>::predict(const NumericTable *a, NumericTable *ntAuxTable,
+                                                                    NumericTable *r, const Parameter *parameter)
+{
+    NumericTable *ntData = const_cast<NumericTable *>( a );
     NumericTable *ntClass = r;
 
     const size_t p = ntData->getNumberOfColumns();
     const size_t n = ntData->getNumberOfRows();
     const size_t c = parameter->nClasses;
 
-    NumericTable *ntAuxTable = mdl->getAuxTable().get();
-
-    ReadRows<algorithmFPType, cpu> rrAuxTable(ntAuxTable, 0, c);
+    ReadRows<algorithmFPType, cpu> rrAuxTable(ntAuxTable, 0, ntAuxTable->getNumberOfRows());
     DAAL_CHECK_BLOCK_STATUS(rrAuxTable);
     const algorithmFPType *aux_table = rrAuxTable.get();
 
     size_t blockSizeDeafult = _BLOCKSIZE_;
 
+    /* Split small batches of observations so that all the threads are busy */
+    const size_t nThreads = threader_get_threads_number();
+    if( nThreads > 1 && n < nThreads * blockSizeDeafult )
+    {
+        const size_t minBlockSize = 16;
+        blockSizeDeafult = n / nThreads;
+        if( blockSizeDeafult < minBlockSize ) { blockSizeDeafult = minBlockSize; }
+    }
+
     size_t nBlocks = n / blockSizeDeafult;
     nBlocks += (nBlocks * blockSizeDeafult != n);
 
@@ -226,35 +404,41 @@ services::Status methodSpecific<fastCSR, algorithmFPType, cpu>::getPredictionDat
     const size_t *colIdx = rrData.cols();
     const size_t *rowIdx = rrData.rows();
 
-    {
-        const char transa = 'n';
-        const DAAL_INT _n = n;
-        const DAAL_INT _p = p;
-        const DAAL_INT _c = c;
-        const algorithmFPType alpha = 1.0;
-        const algorithmFPType beta  = 0.0;
-        const DAAL_INT ldaty = n;
-        const char matdescra[6] = {'G',0,0,'F',0,0};
-
-        SpBlas<algorithmFPType, cpu>::xxcsrmm(&transa, &_n, &_c, &_p, &alpha,
-                                              matdescra,
-                                              values, (DAAL_INT *)colIdx, (DAAL_INT *)rowIdx,
-                                              aux_table, &_p, &beta, buff, &_n);
-    }
-
+    /* aux_table is transposed to p x c: every non-zero adds one contiguous row of class scores */
+    const size_t rowOffset = rowIdx[0];
     for( size_t j = 0; j < n; j++ )
     {
+        algorithmFPType *scores = buff + j * c;
+
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for( size_t cl = 0; cl < c; cl++ )
+        {
+            scores[cl] = 0;
+        }
+
+        const size_t kEnd = rowIdx[j + 1] - rowOffset;
+        for( size_t k = rowIdx[j] - rowOffset; k < kEnd; k++ )
+        {
+            const algorithmFPType value = values[k];
+            const algorithmFPType *featureScores = aux_table + (colIdx[k] - 1) * c;
+
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for( size_t cl = 0; cl < c; cl++ )
+            {
+                scores[cl] += value * featureScores[cl];
+            }
+        }
+
         int max_c = 0;
         algorithmFPType max_c_val = -(data_feature_utils::internal::MaxVal<algorithmFPType, cpu>::get());
 
-      PRAGMA_IVDEP
         for( size_t cl=0 ; cl<c ; cl++ )
         {
-            algorithmFPType val = buff[j + cl * n];
-
-            if( val > max_c_val )
+            if( scores[cl] > max_c_val )
             {
-                max_c_val = val;
+                max_c_val = scores[cl];
                 max_c     = cl;
             }
         }
@@ -104,6 +104,17 @@ void Input::set(classifier::prediction::ModelInputId id, const multinomial_naive
     Argument::set(id, ptr);
 }
 
+/**
+ * Sets the input partial model trained in the online or distributed processing mode
+ * in the prediction stage of the multinomial naive Bayes algorithm
+ * \param[in] id    Identifier of the input object
+ * \param[in] ptr   Pointer to the input object
+ */
+void Input::set(classifier::prediction::ModelInputId id, const multinomial_naive_bayes::PartialModelPtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
 /**
  * Checks the correctness of the input object
  * \param[in] parameter Pointer to the structure of the algorithm parameters
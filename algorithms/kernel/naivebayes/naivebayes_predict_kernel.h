@@ -71,6 +71,16 @@ class NaiveBayesPredictKernel : public Kernel
 {
 public:
     services::Status compute(const NumericTable *a, const Model *m, NumericTable *r, const Parameter *par);
+
+    /**
+     *  \brief Computes the prediction with the partial model trained in the online or distributed processing mode.
+     *         Logarithms of probabilities are computed from the counters of the partial model once
+     *         and cached in the partial model until the next update of the counters
+     */
+    services::Status compute(const NumericTable *a, PartialModel *m, NumericTable *r, const Parameter *par);
+
+protected:
+    services::Status predict(const NumericTable *a, NumericTable *ntAuxTable, NumericTable *r, const Parameter *par);
 };
 
 } // namespace internal
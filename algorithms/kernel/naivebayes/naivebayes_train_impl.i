@@ -63,6 +63,7 @@
 #include "service_data_utils.h"
 #include "service_numeric_table.h"
 #include "service_error_handling.h"
+#include "naivebayes_aux_table_impl.i"
 
 
 #if( __CPUID__(DAAL_CPU) >= __avx512_mic__ )
@@ -298,78 +299,14 @@ Status fillModel( const Parameter *nbPar, size_t p, algorithmFPType *n_c, algori
     WriteOnlyRows<algorithmFPType, cpu> wrAuxTable( *rMdl->getAuxTable(), 0, c );
     DAAL_CHECK_BLOCK_STATUS(wrAuxTable);
 
-    algorithmFPType *log_p     = wrLogP    .get();
-    algorithmFPType *log_theta = wrLogTheta.get();
-    algorithmFPType *aux_table = wrAuxTable.get();
-
-    if ( !nbPar->priorClassEstimates.get() )
-    {
-        algorithmFPType log_p_const = -daal::internal::Math<algorithmFPType, cpu>::sLog( (algorithmFPType)c );
-
-        for ( size_t j = 0; j < c; j++ )
-        {
-            log_p[j] = log_p_const;
-        }
-    }
-    else
-    {
-        ReadRows<algorithmFPType, cpu> rrPriorClassEstimates( *nbPar->priorClassEstimates, 0, c );
-        DAAL_CHECK_BLOCK_STATUS(rrPriorClassEstimates);
-        const algorithmFPType *pe = rrPriorClassEstimates.get();
-
-        daal::internal::Math<algorithmFPType, cpu>::vLog(c, pe, log_p);
-    }
-
-    if ( !nbPar->alpha.get() )
-    {
-        algorithmFPType alpha_i = 1;
-        algorithmFPType alpha   = p * alpha_i;
-
-        for ( size_t j = 0; j < c; j++ )
-        {
-            algorithmFPType denominator = (algorithmFPType)1.0 / (n_c [ j ] + alpha);
-
-          PRAGMA_VECTOR_ALWAYS
-            for ( size_t i = 0 ; i < p; i++ )
-            {
-                log_theta[ j * p + i ] = (n_ci[ j * p + i ] + alpha_i) * denominator;
-            }
-            daal::internal::Math<algorithmFPType, cpu>::vLog(p, log_theta + j * p, log_theta + j * p);
-        }
-    }
-    else
-    {
-        ReadRows<algorithmFPType, cpu> rrAlphaI( *nbPar->alpha, 0, 1 );
-        DAAL_CHECK_BLOCK_STATUS(rrAlphaI);
-        const algorithmFPType *alpha_i = rrAlphaI.get();
-
-        algorithmFPType alpha = 0;
-        for ( size_t i = 0 ; i < p; i++ )
-        {
-            alpha += alpha_i[i];
-        }
-
-        for ( size_t j = 0; j < c; j++ )
-        {
-            algorithmFPType denominator = (algorithmFPType)1.0 / (n_c [ j ] + alpha);
-
-          PRAGMA_VECTOR_ALWAYS
-            for ( size_t i = 0 ; i < p; i++ )
-            {
-                log_theta[ j * p + i ] = (n_ci[ j * p + i ] + alpha_i[i]) * denominator;
-            }
-            daal::internal::Math<algorithmFPType, cpu>::vLog(p, log_theta + j * p, log_theta + j * p);
-        }
-    }
-
-    for ( size_t j = 0; j < c; j++ )
-    {
-        for ( size_t i = 0 ; i < p; i++ )
-        {
-            aux_table[ j * p + i ] = log_theta[ j * p + i ] + log_p[j];
-        }
-    }
+    Status s = multinomial_naive_bayes::internal::computeLogProbabilities<algorithmFPType, cpu>(
+        nbPar, p, n_c, n_ci, wrLogP.get(), wrLogTheta.get(), wrAuxTable.get() );
+    if(!s) return s;
+    wrLogP    .release();
+    wrLogTheta.release();
+    wrAuxTable.release();
 
+    /* The tables are written back, invalidate the tables the prediction cached in the model */
     rMdl->setNFeatures( p );
 
     return Status();
@@ -430,9 +367,12 @@ services::Status NaiveBayesOnlineTrainKernel<algorithmFPType, method, cpu>::comp
     DAAL_CHECK_BLOCK_STATUS(wrCi);
 
     s |= collectCounters<algorithmFPType, method, cpu>( nbPar, ntData, ntClass, wrC.get(), wrCi.get() );
+    wrC .release();
+    wrCi.release();
 
     size_t n = ntData->getNumberOfRows();
 
+    /* The counters are written back, invalidate the tables the prediction cached in the model */
     mdl->setNObservations( mdl->getNObservations() + n );
     mdl->setNFeatures( ntData->getNumberOfColumns() );
 
@@ -501,6 +441,7 @@ services::Status NaiveBayesDistributedTrainKernel<algorithmFPType, method, cpu>:
         s = mergeModels<algorithmFPType, method, cpu>( nbPar, p, nModels, inPMdls, wrC.get(), wrCi.get(), merged_n );
     }
 
+    /* Also invalidates the tables the prediction cached in the model */
     outPMdl->setNObservations( outPMdl->getNObservations() + merged_n );
 
     return s;
@@ -0,0 +1,343 @@
+/* file: convolution2d_layer_backward_direct_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the gradients of convolution2d algorithm without the deep neural network library
+//--
+*/
+
+#ifndef __CONVOLUTION2D_LAYER_BACKWARD_DIRECT_IMPL_I__
+#define __CONVOLUTION2D_LAYER_BACKWARD_DIRECT_IMPL_I__
+
+#include "convolution2d_layer_backward_direct_kernel.h"
+#include "convolution2d_layer_forward_direct_impl.i"
+#include "service_tensor.h"
+#include "service_error_handling.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace neural_networks
+{
+namespace layers
+{
+namespace convolution2d
+{
+namespace backward
+{
+namespace internal
+{
+
+using namespace daal::internal;
+using namespace daal::services;
+
+template<typename algorithmFPType, CpuType cpu>
+bool DirectConvolution2dKernel<algorithmFPType, cpu>::isSupported(const services::Collection<size_t> &inDims,
+                                                                  const convolution2d::Parameter &parameter)
+{
+    return forward::internal::DirectConvolution2dKernel<algorithmFPType, cpu>::isSupported(inDims, parameter);
+}
+
+template<typename algorithmFPType, CpuType cpu>
+void DirectConvolution2dKernel<algorithmFPType, cpu>::initialize(const services::Collection<size_t> &inDims,
+    const convolution2d::Parameter &parameter, const services::Collection<size_t> &outDims)
+{
+    _batchSize     = inDims[0];
+    _nGroups       = parameter.nGroups;
+    _groupChannels = inDims[1] / _nGroups;
+    _groupKernels  = parameter.nKernels / _nGroups;
+    _height        = inDims[2];
+    _width         = inDims[3];
+    _outHeight     = outDims[2];
+    _outWidth      = outDims[3];
+    for (size_t d = 0; d < 2; d++)
+    {
+        _kernelSizes[d] = parameter.kernelSizes.size[d];
+        _strides[d]     = parameter.strides.size[d];
+        _paddings[d]    = parameter.paddings.size[d];
+    }
+}
+
+/**
+ *  Computes the gradients that are requested with non-null tensors:
+ *  the gradient with respect to the input in resultTensor, the weight and bias derivatives
+ *  averaged over the batch in wDerTensor and bDerTensor
+ */
+template<typename algorithmFPType, CpuType cpu>
+services::Status DirectConvolution2dKernel<algorithmFPType, cpu>::compute(Tensor *inGradTensor, Tensor *xTensor, Tensor *wTensor,
+    const convolution2d::Parameter &parameter, Tensor *wDerTensor, Tensor *bDerTensor, Tensor *resultTensor)
+{
+    const services::Collection<size_t> &inDims = (resultTensor ? resultTensor->getDimensions() : xTensor->getDimensions());
+    DAAL_CHECK(isSupported(inDims, parameter), ErrorIncorrectParameter);
+    initialize(inDims, parameter, inGradTensor->getDimensions());
+
+    ReadSubtensor<algorithmFPType, cpu> inGradBlock(inGradTensor);
+    DAAL_CHECK_BLOCK_STATUS(inGradBlock);
+    const algorithmFPType *g = inGradBlock.get();
+
+    Status s;
+    if (resultTensor)
+    {
+        ReadSubtensor<algorithmFPType, cpu> wBlock(wTensor);
+        DAAL_CHECK_BLOCK_STATUS(wBlock);
+        WriteOnlySubtensor<algorithmFPType, cpu> resultBlock(resultTensor);
+        DAAL_CHECK_BLOCK_STATUS(resultBlock);
+        DAAL_CHECK_STATUS(s, computeGradient(g, wBlock.get(), resultBlock.get()));
+    }
+    if (wDerTensor)
+    {
+        ReadSubtensor<algorithmFPType, cpu> xBlock(xTensor);
+        DAAL_CHECK_BLOCK_STATUS(xBlock);
+        WriteOnlySubtensor<algorithmFPType, cpu> wDerBlock(wDerTensor);
+        DAAL_CHECK_BLOCK_STATUS(wDerBlock);
+        computeWeightDerivatives(g, xBlock.get(), wDerBlock.get());
+    }
+    if (bDerTensor)
+    {
+        WriteOnlySubtensor<algorithmFPType, cpu> bDerBlock(bDerTensor);
+        DAAL_CHECK_BLOCK_STATUS(bDerBlock);
+        computeBiasDerivatives(g, bDerBlock.get());
+    }
+    return s;
+}
+
+/**
+ *  Computes the gradient with respect to the input. Each task scatters the input gradients of the kernels
+ *  of its group into one zero-padded input plane, so the threads never write to the same memory.
+ *  The innermost loop runs over the contiguous positions of an input gradient row
+ */
+template<typename algorithmFPType, CpuType cpu>
+services::Status DirectConvolution2dKernel<algorithmFPType, cpu>::computeGradient(const algorithmFPType *g, const algorithmFPType *w,
+                                                                                 algorithmFPType *dx) const
+{
+    const size_t nChannels  = _groupChannels * _nGroups;
+    const size_t nKernels   = _groupKernels * _nGroups;
+    const size_t inSize     = _height * _width;
+    const size_t outSize    = _outHeight * _outWidth;
+    const size_t kernelSize = _kernelSizes[0] * _kernelSizes[1];
+
+    /* Part of the padded input covered by the kernel windows */
+    const size_t planeHeight = (_outHeight - 1) * _strides[0] + _kernelSizes[0];
+    const size_t planeWidth  = (_outWidth  - 1) * _strides[1] + _kernelSizes[1];
+
+    SafeStatus safeStat;
+    const size_t nTasks = _batchSize * nChannels;
+    daal::threader_for(nTasks, nTasks, [&](size_t task)
+    {
+        const size_t channel = task % nChannels;
+        const size_t i       = task / nChannels;
+        const size_t grp     = channel / _groupChannels;
+        const size_t c       = channel % _groupChannels;
+
+        TArray<algorithmFPType, cpu> planeArray(planeHeight * planeWidth);
+        algorithmFPType *plane = planeArray.get();
+        DAAL_CHECK_THR(plane, ErrorMemoryAllocationFailed);
+        for (size_t j = 0; j < planeHeight * planeWidth; j++)
+        {
+            plane[j] = (algorithmFPType)0;
+        }
+
+        for (size_t k = 0; k < _groupKernels; k++)
+        {
+            const size_t kernel = grp * _groupKernels + k;
+            const algorithmFPType *gk = g + (i * nKernels + kernel) * outSize;
+            const algorithmFPType *wk = w + (kernel * _groupChannels + c) * kernelSize;
+            for (size_t kh = 0; kh < _kernelSizes[0]; kh++)
+            {
+                for (size_t oh = 0; oh < _outHeight; oh++)
+                {
+                    const algorithmFPType *gRow = gk + oh * _outWidth;
+                    algorithmFPType *planeRow = plane + (oh * _strides[0] + kh) * planeWidth;
+                    for (size_t kw = 0; kw < _kernelSizes[1]; kw++)
+                    {
+                        const algorithmFPType wValue = wk[kh * _kernelSizes[1] + kw];
+                        algorithmFPType *dst = planeRow + kw;
+                        if (_strides[1] == 1)
+                        {
+                            PRAGMA_IVDEP
+                            PRAGMA_VECTOR_ALWAYS
+                            for (size_t ow = 0; ow < _outWidth; ow++)
+                            {
+                                dst[ow] += wValue * gRow[ow];
+                            }
+                        }
+                        else
+                        {
+                            for (size_t ow = 0; ow < _outWidth; ow++)
+                            {
+                                dst[ow * _strides[1]] += wValue * gRow[ow];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        /* The input values that are not covered by any kernel window get zero gradient */
+        algorithmFPType *dxc = dx + (i * nChannels + channel) * inSize;
+        for (size_t h = 0; h < _height; h++)
+        {
+            const size_t ph = h + _paddings[0];
+            for (size_t iw = 0; iw < _width; iw++)
+            {
+                const size_t pw = iw + _paddings[1];
+                dxc[h * _width + iw] = (ph < planeHeight && pw < planeWidth ? plane[ph * planeWidth + pw] : (algorithmFPType)0);
+            }
+        }
+    });
+    return safeStat.detach();
+}
+
+/**
+ *  Computes the weight derivatives averaged over the batch. Each task computes all the taps of one
+ *  kernel and input channel pair; only the output positions whose windows cover the tap inside the input
+ *  are visited, so the input is not padded
+ */
+template<typename algorithmFPType, CpuType cpu>
+void DirectConvolution2dKernel<algorithmFPType, cpu>::computeWeightDerivatives(const algorithmFPType *g, const algorithmFPType *x,
+                                                                              algorithmFPType *wDer) const
+{
+    const size_t nChannels  = _groupChannels * _nGroups;
+    const size_t nKernels   = _groupKernels * _nGroups;
+    const size_t inSize     = _height * _width;
+    const size_t outSize    = _outHeight * _outWidth;
+    const size_t kernelSize = _kernelSizes[0] * _kernelSizes[1];
+    const algorithmFPType invBatchSize = (algorithmFPType)1.0 / (algorithmFPType)_batchSize;
+
+    const size_t nTasks = nKernels * _groupChannels;
+    daal::threader_for(nTasks, nTasks, [&](size_t task)
+    {
+        const size_t kernel  = task / _groupChannels;
+        const size_t c       = task % _groupChannels;
+        const size_t channel = (kernel / _groupKernels) * _groupChannels + c;
+
+        algorithmFPType *wDerTask = wDer + task * kernelSize;
+        for (size_t j = 0; j < kernelSize; j++)
+        {
+            wDerTask[j] = (algorithmFPType)0;
+        }
+
+        for (size_t i = 0; i < _batchSize; i++)
+        {
+            const algorithmFPType *gk = g + (i * nKernels + kernel) * outSize;
+            const algorithmFPType *xc = x + (i * nChannels + channel) * inSize;
+            for (size_t kh = 0; kh < _kernelSizes[0]; kh++)
+            {
+                for (size_t oh = 0; oh < _outHeight; oh++)
+                {
+                    const size_t ph = oh * _strides[0] + kh;
+                    if (ph < _paddings[0] || ph >= _paddings[0] + _height) { continue; }
+
+                    const algorithmFPType *gRow = gk + oh * _outWidth;
+                    const algorithmFPType *xRow = xc + (ph - _paddings[0]) * _width;
+                    for (size_t kw = 0; kw < _kernelSizes[1]; kw++)
+                    {
+                        /* Output positions ow with _paddings[1] <= ow * stride + kw < _paddings[1] + _width */
+                        const size_t owBegin = (kw < _paddings[1] ? (_paddings[1] - kw + _strides[1] - 1) / _strides[1] : 0);
+                        size_t owEnd = (_paddings[1] + _width > kw ? (_paddings[1] + _width - kw - 1) / _strides[1] + 1 : 0);
+                        owEnd = (owEnd < _outWidth ? owEnd : _outWidth);
+
+                        const algorithmFPType *xTap = xRow + kw - _paddings[1];
+                        algorithmFPType sum = 0;
+                        if (_strides[1] == 1)
+                        {
+                            PRAGMA_VECTOR_ALWAYS
+                            for (size_t ow = owBegin; ow < owEnd; ow++)
+                            {
+                                sum += gRow[ow] * xTap[ow];
+                            }
+                        }
+                        else
+                        {
+                            for (size_t ow = owBegin; ow < owEnd; ow++)
+                            {
+                                sum += gRow[ow] * xTap[ow * _strides[1]];
+                            }
+                        }
+                        wDerTask[kh * _kernelSizes[1] + kw] += sum;
+                    }
+                }
+            }
+        }
+
+        for (size_t j = 0; j < kernelSize; j++)
+        {
+            wDerTask[j] *= invBatchSize;
+        }
+    });
+}
+
+/* Computes the bias derivatives averaged over the batch */
+template<typename algorithmFPType, CpuType cpu>
+void DirectConvolution2dKernel<algorithmFPType, cpu>::computeBiasDerivatives(const algorithmFPType *g, algorithmFPType *bDer) const
+{
+    const size_t nKernels = _groupKernels * _nGroups;
+    const size_t outSize  = _outHeight * _outWidth;
+    const algorithmFPType invBatchSize = (algorithmFPType)1.0 / (algorithmFPType)_batchSize;
+
+    daal::threader_for(nKernels, nKernels, [&](size_t kernel)
+    {
+        algorithmFPType sum = 0;
+        for (size_t i = 0; i < _batchSize; i++)
+        {
+            const algorithmFPType *gk = g + (i * nKernels + kernel) * outSize;
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < outSize; j++)
+            {
+                sum += gk[j];
+            }
+        }
+        bDer[kernel] = sum * invBatchSize;
+    });
+}
+
+} // internal
+} // backward
+} // convolution2d
+} // layers
+} // neural_networks
+} // algorithms
+} // daal
+
+#endif
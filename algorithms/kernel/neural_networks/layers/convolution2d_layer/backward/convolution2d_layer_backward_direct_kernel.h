@@ -0,0 +1,110 @@
+/* file: convolution2d_layer_backward_direct_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+//++
+//  Declaration of template functions that calculate gradients of convolution2ds without the deep neural network library.
+//--
+
+
+#ifndef __CONVOLUTION2D_LAYER_BACKWARD_DIRECT_KERNEL_H__
+#define __CONVOLUTION2D_LAYER_BACKWARD_DIRECT_KERNEL_H__
+
+#include "neural_networks/layers/convolution2d/convolution2d_layer_types.h"
+#include "tensor.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace neural_networks
+{
+namespace layers
+{
+namespace convolution2d
+{
+namespace backward
+{
+namespace internal
+{
+/**
+ *  \brief Kernel for the gradients of convolution2d calculated with the direct algorithm.
+ *         Supports four-dimensional inputs with convolution over dimensions (2,3) and grouping over dimension 1
+ */
+template<typename algorithmFPType, CpuType cpu>
+class DirectConvolution2dKernel
+{
+public:
+    static bool isSupported(const services::Collection<size_t> &inDims, const convolution2d::Parameter &parameter);
+
+    services::Status compute(data_management::Tensor *inGradTensor, data_management::Tensor *xTensor, data_management::Tensor *wTensor,
+                             const convolution2d::Parameter &parameter, data_management::Tensor *wDerTensor,
+                             data_management::Tensor *bDerTensor, data_management::Tensor *resultTensor);
+
+private:
+    void initialize(const services::Collection<size_t> &inDims, const convolution2d::Parameter &parameter,
+                    const services::Collection<size_t> &outDims);
+
+    services::Status computeGradient(const algorithmFPType *g, const algorithmFPType *w, algorithmFPType *dx) const;
+    void computeWeightDerivatives(const algorithmFPType *g, const algorithmFPType *x, algorithmFPType *wDer) const;
+    void computeBiasDerivatives(const algorithmFPType *g, algorithmFPType *bDer) const;
+
+    size_t _batchSize;
+    size_t _nGroups;
+    size_t _groupChannels;
+    size_t _groupKernels;
+    size_t _height;
+    size_t _width;
+    size_t _outHeight;
+    size_t _outWidth;
+    size_t _kernelSizes[2];
+    size_t _strides[2];
+    size_t _paddings[2];
+};
+} // internal
+} // backward
+
+} // convolution2d
+} // layers
+} // neural_networks
+} // algorithms
+} // daal
+
+#endif
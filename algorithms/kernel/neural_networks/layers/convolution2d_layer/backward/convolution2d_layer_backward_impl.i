@@ -51,6 +51,7 @@
 #include "service_numeric_table.h"
 
 #include "service_mkl_tensor.h"
+#include "convolution2d_layer_backward_direct_impl.i"
 
 using namespace daal::internal;
 using namespace daal::services;
@@ -97,6 +98,38 @@ void fillDimensionArray(const services::Collection<size_t>& dims, size_t* sizes,
 template<typename algorithmFPType, Method method, CpuType cpu>
 Status Convolution2dKernel<algorithmFPType, method, cpu>::compute(Tensor *inGradTensor, Tensor *xTensor, Tensor *wTensor,
     const convolution2d::Parameter &parameter, Tensor *wDerTensor, Tensor *bDerTensor, Tensor *resultTensor)
+{
+    if (_useDirect || parameter.algorithm == directAlgorithm || parameter.algorithm == winogradAlgorithm)
+    {
+        return computeDirect(inGradTensor, xTensor, wTensor, parameter, wDerTensor, bDerTensor, resultTensor);
+    }
+
+    Status s = computeDnn(inGradTensor, xTensor, wTensor, parameter, wDerTensor, bDerTensor, resultTensor);
+    const services::Collection<size_t> &xDims = (resultTensor ? resultTensor->getDimensions() : xTensor->getDimensions());
+    if (!s && parameter.algorithm == automaticAlgorithm &&
+        DirectConvolution2dKernel<algorithmFPType, cpu>::isSupported(xDims, parameter))
+    {
+        /* The convolution primitives are not available for this shape or in this build of the library */
+        reset();
+        _useDirect = true;
+        return computeDirect(inGradTensor, xTensor, wTensor, parameter, wDerTensor, bDerTensor, resultTensor);
+    }
+    return s;
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status Convolution2dKernel<algorithmFPType, method, cpu>::computeDirect(Tensor *inGradTensor, Tensor *xTensor, Tensor *wTensor,
+    const convolution2d::Parameter &parameter, Tensor *wDerTensor, Tensor *bDerTensor, Tensor *resultTensor)
+{
+    return directKernel.compute(inGradTensor, xTensor, wTensor, parameter,
+                                (_wDerFlag ? wDerTensor : NULL),
+                                (_bDerFlag ? bDerTensor : NULL),
+                                (_resultFlag && parameter.propagateGradient ? resultTensor : NULL));
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status Convolution2dKernel<algorithmFPType, method, cpu>::computeDnn(Tensor *inGradTensor, Tensor *xTensor, Tensor *wTensor,
+    const convolution2d::Parameter &parameter, Tensor *wDerTensor, Tensor *bDerTensor, Tensor *resultTensor)
 {
     Status s;
 
@@ -392,6 +425,7 @@ services::Status Convolution2dKernel<algorithmFPType, method, cpu>::reset()
         dnn::xDelete(convBias);
         convBias = NULL;
     }
+    _useDirect = false;
     return services::Status();
 }
 
@@ -55,6 +55,7 @@
 #include "service_dnn.h"
 #include "service_dnn_internal.h"
 #include "layers_threading.h"
+#include "convolution2d_layer_backward_direct_kernel.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -81,6 +82,8 @@ template<typename algorithmFPType, Method method, CpuType cpu>
 class Convolution2dKernel : public Kernel
 {
 public:
+    Convolution2dKernel() : _useDirect(false) {}
+
     services::Status initialize(bool resultFlag = true, bool wDerFlag = true, bool bDerFlag = true);
 
     services::Status compute(Tensor *inGradTensor, Tensor *xTensor, Tensor *wTensor,
@@ -107,6 +110,12 @@ public:
 private:
     typedef daal::internal::Dnn<algorithmFPType, cpu> dnn;
 
+    services::Status computeDnn(Tensor *inGradTensor, Tensor *xTensor, Tensor *wTensor,
+    const convolution2d::Parameter &parameter, Tensor *wDerTensor, Tensor *bDerTensor, Tensor *resultTensor);
+
+    services::Status computeDirect(Tensor *inGradTensor, Tensor *xTensor, Tensor *wTensor,
+    const convolution2d::Parameter &parameter, Tensor *wDerTensor, Tensor *bDerTensor, Tensor *resultTensor);
+
     bool _resultFlag;
     bool _wDerFlag;
     bool _bDerFlag;
@@ -114,6 +123,9 @@ private:
     dnnPrimitive_t convGrad = NULL;
     dnnPrimitive_t convFilt = NULL;
     dnnPrimitive_t convBias = NULL;
+
+    bool _useDirect; /* The convolution primitives are not available, the direct algorithm is used instead */
+    DirectConvolution2dKernel<algorithmFPType, cpu> directKernel;
 };
 
 } // internal
@@ -65,6 +65,15 @@ namespace interface1
 Parameter::Parameter() : groupDimension(1), indices(2, 3), kernelSizes(2, 2), strides(2, 2), paddings(0, 0), nKernels(1), nGroups(1) {};
 
 }// namespace interface1
+
+namespace interface2
+{
+/**
+ *  Default constructor
+ */
+Parameter::Parameter() : interface1::Parameter(), algorithm(automaticAlgorithm) {};
+
+}// namespace interface2
 }// namespace convolution2d
 }// namespace layers
 }// namespace neural_networks
@@ -123,6 +123,11 @@ services::Status Input::check(const daal::algorithms::Parameter *parameter, int
 
     DAAL_CHECK_STATUS(s, data_management::checkTensor(dataTensor.get(), dataStr()));
     if( dataTensor->getDimensions().size() < 4 ) return services::Status( services::ErrorIncorrectNumberOfDimensionsInTensor );
+    if( algParameter->algorithm == winogradAlgorithm )
+    {
+        DAAL_CHECK(algParameter->kernelSizes.size[0] == 3 && algParameter->kernelSizes.size[1] == 3 &&
+                   algParameter->strides.size[0] == 1 && algParameter->strides.size[1] == 1, services::ErrorIncorrectParameter);
+    }
     if( wTensor )
     {
         services::Collection<size_t> wDims = getWeightsSizes(algParameter);
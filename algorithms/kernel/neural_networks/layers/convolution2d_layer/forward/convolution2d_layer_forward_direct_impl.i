@@ -0,0 +1,478 @@
+/* file: convolution2d_layer_forward_direct_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of convolution2d algorithm without the deep neural network library
+//--
+*/
+
+#ifndef __CONVOLUTION2D_LAYER_FORWARD_DIRECT_IMPL_I__
+#define __CONVOLUTION2D_LAYER_FORWARD_DIRECT_IMPL_I__
+
+#include "convolution2d_layer_forward_direct_kernel.h"
+#include "service_tensor.h"
+#include "service_blas.h"
+#include "service_error_handling.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace neural_networks
+{
+namespace layers
+{
+namespace convolution2d
+{
+namespace forward
+{
+namespace internal
+{
+
+using namespace daal::internal;
+using namespace daal::services;
+
+template<typename algorithmFPType, CpuType cpu>
+bool DirectConvolution2dKernel<algorithmFPType, cpu>::isSupported(const services::Collection<size_t> &inDims,
+                                                                  const convolution2d::Parameter &parameter)
+{
+    return (inDims.size() == 4 &&
+            parameter.indices.dims[0] == 2 && parameter.indices.dims[1] == 3 &&
+            parameter.groupDimension == 1 && parameter.nGroups > 0 &&
+            parameter.nKernels % parameter.nGroups == 0 &&
+            inDims[1] % parameter.nGroups == 0 &&
+            parameter.paddings.size[0] >= 0 && parameter.paddings.size[1] >= 0);
+}
+
+template<typename algorithmFPType, CpuType cpu>
+bool DirectConvolution2dKernel<algorithmFPType, cpu>::isWinogradSupported(const services::Collection<size_t> &inDims,
+                                                                          const convolution2d::Parameter &parameter)
+{
+    return (isSupported(inDims, parameter) &&
+            parameter.kernelSizes.size[0] == 3 && parameter.kernelSizes.size[1] == 3 &&
+            parameter.strides.size[0] == 1 && parameter.strides.size[1] == 1);
+}
+
+template<typename algorithmFPType, CpuType cpu>
+services::Status DirectConvolution2dKernel<algorithmFPType, cpu>::initialize(const services::Collection<size_t> &inDims,
+    const convolution2d::Parameter &parameter, const services::Collection<size_t> &outDims, bool winograd)
+{
+    DAAL_CHECK(winograd ? isWinogradSupported(inDims, parameter) : isSupported(inDims, parameter), ErrorIncorrectParameter);
+
+    _winograd      = winograd;
+    _batchSize     = inDims[0];
+    _nGroups       = parameter.nGroups;
+    _groupChannels = inDims[1] / _nGroups;
+    _groupKernels  = parameter.nKernels / _nGroups;
+    _height        = inDims[2];
+    _width         = inDims[3];
+    _outHeight     = outDims[2];
+    _outWidth      = outDims[3];
+    for (size_t d = 0; d < 2; d++)
+    {
+        _kernelSizes[d] = parameter.kernelSizes.size[d];
+        _strides[d]     = parameter.strides.size[d];
+        _paddings[d]    = parameter.paddings.size[d];
+    }
+
+    _nChannelBlocks = (_groupChannels + blockSize - 1) / blockSize;
+    _nKernelBlocks  = (_groupKernels  + blockSize - 1) / blockSize;
+    _paddedHeight   = _height + 2 * _paddings[0];
+    _paddedWidth    = _width  + 2 * _paddings[1];
+    _nTileRows      = (_outHeight + 1) / 2;
+    _nTileCols      = (_outWidth  + 1) / 2;
+
+    if (_winograd)
+    {
+        _packedInput.reset(0);
+        _packedWeights.reset(_nGroups * tileSize * _groupKernels * _groupChannels);
+    }
+    else
+    {
+        _packedInput.reset(_batchSize * _nGroups * _nChannelBlocks * _paddedHeight * _paddedWidth * blockSize);
+        DAAL_CHECK_MALLOC(_packedInput.get());
+        _packedWeights.reset(_nGroups * _nKernelBlocks * _nChannelBlocks * _kernelSizes[0] * _kernelSizes[1] * blockSize * blockSize);
+    }
+    DAAL_CHECK_MALLOC(_packedWeights.get());
+    return Status();
+}
+
+template<typename algorithmFPType, CpuType cpu>
+services::Status DirectConvolution2dKernel<algorithmFPType, cpu>::compute(Tensor *inputTensor, Tensor *wTensor, Tensor *bTensor,
+                                                                         Tensor *resultTensor)
+{
+    DAAL_CHECK(inputTensor->getDimensionSize(0) == _batchSize, ErrorIncorrectSizeOfDimensionInTensor);
+
+    ReadSubtensor<algorithmFPType, cpu> inputBlock(inputTensor);
+    DAAL_CHECK_BLOCK_STATUS(inputBlock);
+    ReadSubtensor<algorithmFPType, cpu> wBlock(wTensor);
+    DAAL_CHECK_BLOCK_STATUS(wBlock);
+    ReadSubtensor<algorithmFPType, cpu> bBlock(bTensor);
+    DAAL_CHECK_BLOCK_STATUS(bBlock);
+    WriteOnlySubtensor<algorithmFPType, cpu> resultBlock(resultTensor);
+    DAAL_CHECK_BLOCK_STATUS(resultBlock);
+
+    if (_winograd)
+    {
+        return computeWinograd(inputBlock.get(), wBlock.get(), bBlock.get(), resultBlock.get());
+    }
+    return computeDirect(inputBlock.get(), wBlock.get(), bBlock.get(), resultBlock.get());
+}
+
+/**
+ *  Computes the convolution with the input and the weights reordered into blocks of 16 channels.
+ *  Input of each sample and group is stored as [channel block][padded height][padded width][16 channels],
+ *  weights of each group are stored as [kernel block][channel block][kernel height][kernel width][16 channels][16 kernels].
+ *  The innermost loop over 16 kernels is vectorized for every CPU the kernel is compiled for
+ */
+template<typename algorithmFPType, CpuType cpu>
+services::Status DirectConvolution2dKernel<algorithmFPType, cpu>::computeDirect(const algorithmFPType *x, const algorithmFPType *w,
+                                                                               const algorithmFPType *b, algorithmFPType *y)
+{
+    const size_t nChannels   = _groupChannels * _nGroups;
+    const size_t nKernels    = _groupKernels * _nGroups;
+    const size_t inSize      = _height * _width;
+    const size_t outSize     = _outHeight * _outWidth;
+    const size_t kernelSize  = _kernelSizes[0] * _kernelSizes[1];
+    const size_t planeSize   = _paddedHeight * _paddedWidth * blockSize;
+    const size_t wBlockSize  = _nChannelBlocks * kernelSize * blockSize * blockSize;
+
+    algorithmFPType *packedInput   = _packedInput.get();
+    algorithmFPType *packedWeights = _packedWeights.get();
+
+    const size_t nInputBlocks = _batchSize * _nGroups * _nChannelBlocks;
+    daal::threader_for(nInputBlocks, nInputBlocks, [&](size_t task)
+    {
+        const size_t cb = task % _nChannelBlocks;
+        const size_t g  = (task / _nChannelBlocks) % _nGroups;
+        const size_t i  = task / (_nChannelBlocks * _nGroups);
+
+        algorithmFPType *dst = packedInput + task * planeSize;
+        for (size_t j = 0; j < planeSize; j++)
+        {
+            dst[j] = (algorithmFPType)0;
+        }
+
+        const size_t nBlockChannels = (_groupChannels - cb * blockSize < blockSize ? _groupChannels - cb * blockSize : blockSize);
+        for (size_t c = 0; c < nBlockChannels; c++)
+        {
+            const algorithmFPType *src = x + (i * nChannels + g * _groupChannels + cb * blockSize + c) * inSize;
+            for (size_t h = 0; h < _height; h++)
+            {
+                algorithmFPType *dstRow = dst + ((h + _paddings[0]) * _paddedWidth + _paddings[1]) * blockSize + c;
+                for (size_t iw = 0; iw < _width; iw++)
+                {
+                    dstRow[iw * blockSize] = src[h * _width + iw];
+                }
+            }
+        }
+    });
+
+    const size_t nWeightBlocks = _nGroups * _nKernelBlocks;
+    daal::threader_for(nWeightBlocks, nWeightBlocks, [&](size_t task)
+    {
+        const size_t kb = task % _nKernelBlocks;
+        const size_t g  = task / _nKernelBlocks;
+
+        algorithmFPType *dst = packedWeights + task * wBlockSize;
+        for (size_t cb = 0; cb < _nChannelBlocks; cb++)
+        {
+            for (size_t j = 0; j < kernelSize; j++)
+            {
+                for (size_t c = 0; c < blockSize; c++)
+                {
+                    const size_t channel = cb * blockSize + c;
+                    for (size_t k = 0; k < blockSize; k++, dst++)
+                    {
+                        const size_t kernel = kb * blockSize + k;
+                        *dst = (channel < _groupChannels && kernel < _groupKernels ?
+                                w[((g * _groupKernels + kernel) * _groupChannels + channel) * kernelSize + j] : (algorithmFPType)0);
+                    }
+                }
+            }
+        }
+    });
+
+    const size_t nTasks = _batchSize * _nGroups * _nKernelBlocks * _outHeight;
+    daal::threader_for(nTasks, nTasks, [&](size_t task)
+    {
+        const size_t oh = task % _outHeight;
+        const size_t kb = (task / _outHeight) % _nKernelBlocks;
+        const size_t g  = (task / (_outHeight * _nKernelBlocks)) % _nGroups;
+        const size_t i  = task / (_outHeight * _nKernelBlocks * _nGroups);
+
+        const algorithmFPType *xg = packedInput + (i * _nGroups + g) * _nChannelBlocks * planeSize;
+        const algorithmFPType *wg = packedWeights + (g * _nKernelBlocks + kb) * wBlockSize;
+
+        const size_t firstKernel   = g * _groupKernels + kb * blockSize;
+        const size_t nBlockKernels = (_groupKernels - kb * blockSize < blockSize ? _groupKernels - kb * blockSize : blockSize);
+
+        algorithmFPType acc[rowBlockSize * blockSize];
+        for (size_t ow0 = 0; ow0 < _outWidth; ow0 += rowBlockSize)
+        {
+            const size_t nRow = (_outWidth - ow0 < rowBlockSize ? _outWidth - ow0 : rowBlockSize);
+            for (size_t r = 0; r < nRow; r++)
+            {
+                for (size_t k = 0; k < blockSize; k++)
+                {
+                    acc[r * blockSize + k] = (k < nBlockKernels ? b[firstKernel + k] : (algorithmFPType)0);
+                }
+            }
+
+            computeDirectRow(xg, wg, oh, ow0, nRow, acc);
+
+            for (size_t k = 0; k < nBlockKernels; k++)
+            {
+                algorithmFPType *yk = y + (i * nKernels + firstKernel + k) * outSize + oh * _outWidth + ow0;
+                for (size_t r = 0; r < nRow; r++)
+                {
+                    yk[r] = acc[r * blockSize + k];
+                }
+            }
+        }
+    });
+    return Status();
+}
+
+template<typename algorithmFPType, CpuType cpu>
+void DirectConvolution2dKernel<algorithmFPType, cpu>::computeDirectRow(const algorithmFPType *x, const algorithmFPType *w,
+    size_t oh, size_t ow0, size_t nRow, algorithmFPType *acc) const
+{
+    const size_t planeSize = _paddedHeight * _paddedWidth * blockSize;
+    const size_t tapSize   = blockSize * blockSize;
+
+    for (size_t cb = 0; cb < _nChannelBlocks; cb++)
+    {
+        const algorithmFPType *xc = x + cb * planeSize;
+        const algorithmFPType *wc = w + cb * _kernelSizes[0] * _kernelSizes[1] * tapSize;
+        for (size_t kh = 0; kh < _kernelSizes[0]; kh++)
+        {
+            const algorithmFPType *xRow = xc + (oh * _strides[0] + kh) * _paddedWidth * blockSize;
+            for (size_t kw = 0; kw < _kernelSizes[1]; kw++)
+            {
+                const algorithmFPType *wTap = wc + (kh * _kernelSizes[1] + kw) * tapSize;
+                for (size_t r = 0; r < nRow; r++)
+                {
+                    const algorithmFPType *xPixel = xRow + ((ow0 + r) * _strides[1] + kw) * blockSize;
+                    algorithmFPType *accPixel = acc + r * blockSize;
+                    for (size_t c = 0; c < blockSize; c++)
+                    {
+                        const algorithmFPType xValue = xPixel[c];
+                        const algorithmFPType *wChannel = wTap + c * blockSize;
+                        PRAGMA_IVDEP
+                        PRAGMA_VECTOR_ALWAYS
+                        for (size_t k = 0; k < blockSize; k++)
+                        {
+                            accPixel[k] += xValue * wChannel[k];
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ *  Computes the convolution with the Winograd F(2x2, 3x3) algorithm:
+ *  Y = A^T [ (G g G^T) * (B^T d B) ] A for every 2x2 output tile, where the element-wise products
+ *  of the 16 transformed positions are summed over the input channels with one matrix product per position
+ */
+template<typename algorithmFPType, CpuType cpu>
+services::Status DirectConvolution2dKernel<algorithmFPType, cpu>::computeWinograd(const algorithmFPType *x, const algorithmFPType *w,
+                                                                                 const algorithmFPType *b, algorithmFPType *y)
+{
+    typedef typename Blas<algorithmFPType, cpu>::SizeType BlasSize;
+
+    const size_t nChannels = _groupChannels * _nGroups;
+    const size_t nKernels  = _groupKernels * _nGroups;
+    const size_t inSize    = _height * _width;
+    const size_t outSize   = _outHeight * _outWidth;
+    const size_t nTiles    = _nTileRows * _nTileCols;
+    const size_t nTileBlocks = (nTiles + tileBlockSize - 1) / tileBlockSize;
+    const algorithmFPType half = (algorithmFPType)0.5;
+
+    /* U = G g G^T, stored as [group][position][kernel][channel] */
+    algorithmFPType *u = _packedWeights.get();
+    const size_t nFilters = nKernels;
+    daal::threader_for(nFilters, nFilters, [&](size_t filter)
+    {
+        const size_t g = filter / _groupKernels;
+        const size_t k = filter % _groupKernels;
+        for (size_t c = 0; c < _groupChannels; c++)
+        {
+            const algorithmFPType *f = w + (filter * _groupChannels + c) * 9;
+            algorithmFPType t[4][3];
+            for (size_t j = 0; j < 3; j++)
+            {
+                t[0][j] = f[j];
+                t[1][j] = half * (f[j] + f[3 + j] + f[6 + j]);
+                t[2][j] = half * (f[j] - f[3 + j] + f[6 + j]);
+                t[3][j] = f[6 + j];
+            }
+            for (size_t r = 0; r < 4; r++)
+            {
+                const algorithmFPType v[4] = { t[r][0], half * (t[r][0] + t[r][1] + t[r][2]), half * (t[r][0] - t[r][1] + t[r][2]), t[r][2] };
+                for (size_t j = 0; j < 4; j++)
+                {
+                    u[((g * tileSize + r * 4 + j) * _groupKernels + k) * _groupChannels + c] = v[j];
+                }
+            }
+        }
+    });
+
+    SafeStatus safeStat;
+    const size_t nTasks = _batchSize * _nGroups * nTileBlocks;
+    daal::threader_for(nTasks, nTasks, [&](size_t task)
+    {
+        const size_t tb = task % nTileBlocks;
+        const size_t g  = (task / nTileBlocks) % _nGroups;
+        const size_t i  = task / (nTileBlocks * _nGroups);
+
+        const size_t firstTile = tb * tileBlockSize;
+        const size_t nt = (nTiles - firstTile < tileBlockSize ? nTiles - firstTile : tileBlockSize);
+
+        /* V = B^T d B, stored as [position][channel][tile] */
+        TArray<algorithmFPType, cpu> vArray(tileSize * _groupChannels * nt);
+        TArray<algorithmFPType, cpu> mArray(tileSize * _groupKernels * nt);
+        algorithmFPType *v = vArray.get();
+        algorithmFPType *m = mArray.get();
+        DAAL_CHECK_THR(v && m, ErrorMemoryAllocationFailed);
+
+        for (size_t c = 0; c < _groupChannels; c++)
+        {
+            const algorithmFPType *xc = x + (i * nChannels + g * _groupChannels + c) * inSize;
+            for (size_t t = 0; t < nt; t++)
+            {
+                const size_t tile = firstTile + t;
+                const int h0 = (int)(2 * (tile / _nTileCols)) - (int)_paddings[0];
+                const int w0 = (int)(2 * (tile % _nTileCols)) - (int)_paddings[1];
+
+                algorithmFPType d[4][4];
+                for (int r = 0; r < 4; r++)
+                {
+                    const int h = h0 + r;
+                    for (int j = 0; j < 4; j++)
+                    {
+                        const int iw = w0 + j;
+                        d[r][j] = (h >= 0 && h < (int)_height && iw >= 0 && iw < (int)_width ? xc[h * _width + iw] : (algorithmFPType)0);
+                    }
+                }
+
+                algorithmFPType s[4][4];
+                for (size_t j = 0; j < 4; j++)
+                {
+                    s[0][j] = d[0][j] - d[2][j];
+                    s[1][j] = d[1][j] + d[2][j];
+                    s[2][j] = d[2][j] - d[1][j];
+                    s[3][j] = d[1][j] - d[3][j];
+                }
+                for (size_t r = 0; r < 4; r++)
+                {
+                    algorithmFPType *vr = v + ((r * 4) * _groupChannels + c) * nt + t;
+                    const size_t step = _groupChannels * nt;
+                    vr[0]        = s[r][0] - s[r][2];
+                    vr[step]     = s[r][1] + s[r][2];
+                    vr[2 * step] = s[r][2] - s[r][1];
+                    vr[3 * step] = s[r][1] - s[r][3];
+                }
+            }
+        }
+
+        /* M[position] = U[position] * V[position], computed as the column-major product V^T U^T */
+        char transa = 'n';
+        char transb = 'n';
+        BlasSize mSize = (BlasSize)nt;
+        BlasSize nSize = (BlasSize)_groupKernels;
+        BlasSize kSize = (BlasSize)_groupChannels;
+        algorithmFPType one  = 1.0;
+        algorithmFPType zero = 0.0;
+        for (size_t p = 0; p < tileSize; p++)
+        {
+            Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &mSize, &nSize, &kSize, &one,
+                v + p * _groupChannels * nt, &mSize, u + (g * tileSize + p) * _groupKernels * _groupChannels, &kSize,
+                &zero, m + p * _groupKernels * nt, &mSize);
+        }
+
+        /* Y = A^T M A */
+        const size_t step = _groupKernels * nt;
+        for (size_t k = 0; k < _groupKernels; k++)
+        {
+            const size_t kernel = g * _groupKernels + k;
+            const algorithmFPType bias = b[kernel];
+            algorithmFPType *yk = y + (i * nKernels + kernel) * outSize;
+            for (size_t t = 0; t < nt; t++)
+            {
+                const algorithmFPType *mt = m + k * nt + t;
+                algorithmFPType s[2][4];
+                for (size_t j = 0; j < 4; j++)
+                {
+                    s[0][j] = mt[j * step] + mt[(4 + j) * step] + mt[(8 + j) * step];
+                    s[1][j] = mt[(4 + j) * step] - mt[(8 + j) * step] - mt[(12 + j) * step];
+                }
+
+                const size_t tile = firstTile + t;
+                const size_t oh0 = 2 * (tile / _nTileCols);
+                const size_t ow0 = 2 * (tile % _nTileCols);
+                for (size_t r = 0; r < 2 && oh0 + r < _outHeight; r++)
+                {
+                    const algorithmFPType out[2] = { s[r][0] + s[r][1] + s[r][2], s[r][1] - s[r][2] - s[r][3] };
+                    for (size_t j = 0; j < 2 && ow0 + j < _outWidth; j++)
+                    {
+                        yk[(oh0 + r) * _outWidth + ow0 + j] = out[j] + bias;
+                    }
+                }
+            }
+        }
+    });
+    return safeStat.detach();
+}
+
+} // internal
+} // forward
+} // convolution2d
+} // layers
+} // neural_networks
+} // algorithms
+} // daal
+
+#endif
@@ -0,0 +1,138 @@
+/* file: convolution2d_layer_forward_direct_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+//++
+//  Declaration of template functions that calculate convolution2ds without the deep neural network library.
+//--
+
+
+#ifndef __CONVOLUTION2D_LAYER_FORWARD_DIRECT_KERNEL_H__
+#define __CONVOLUTION2D_LAYER_FORWARD_DIRECT_KERNEL_H__
+
+#include "neural_networks/layers/convolution2d/convolution2d_layer_types.h"
+#include "service_numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace neural_networks
+{
+namespace layers
+{
+namespace convolution2d
+{
+namespace forward
+{
+namespace internal
+{
+/**
+ *  \brief Kernel for convolution2d calculation with the blocked direct or the Winograd F(2x2, 3x3) algorithm.
+ *         Supports four-dimensional inputs with convolution over dimensions (2,3) and grouping over dimension 1
+ */
+template<typename algorithmFPType, CpuType cpu>
+class DirectConvolution2dKernel
+{
+public:
+    DirectConvolution2dKernel() : _winograd(false) {}
+
+    static bool isSupported(const services::Collection<size_t> &inDims, const convolution2d::Parameter &parameter);
+    static bool isWinogradSupported(const services::Collection<size_t> &inDims, const convolution2d::Parameter &parameter);
+
+    services::Status initialize(const services::Collection<size_t> &inDims, const convolution2d::Parameter &parameter,
+                                const services::Collection<size_t> &outDims, bool winograd);
+
+    services::Status compute(data_management::Tensor *inputTensor, data_management::Tensor *wTensor, data_management::Tensor *bTensor,
+                             data_management::Tensor *resultTensor);
+
+private:
+    /* Number of channels in the block of the NCHW16c layout */
+    static const size_t blockSize = 16;
+    /* Number of output positions in a row computed at once by the direct algorithm */
+    static const size_t rowBlockSize = 8;
+    /* Number of tiles transformed at once by the Winograd algorithm */
+    static const size_t tileBlockSize = 128;
+    /* Number of elements in the transformed Winograd F(2x2, 3x3) tile */
+    static const size_t tileSize = 16;
+
+    services::Status computeDirect(const algorithmFPType *x, const algorithmFPType *w, const algorithmFPType *b, algorithmFPType *y);
+    services::Status computeWinograd(const algorithmFPType *x, const algorithmFPType *w, const algorithmFPType *b, algorithmFPType *y);
+
+    void computeDirectRow(const algorithmFPType *x, const algorithmFPType *w, size_t oh, size_t ow0, size_t nRow,
+                          algorithmFPType *acc) const;
+
+    bool _winograd;
+
+    size_t _batchSize;
+    size_t _nGroups;
+    size_t _groupChannels;
+    size_t _groupKernels;
+    size_t _height;
+    size_t _width;
+    size_t _outHeight;
+    size_t _outWidth;
+    size_t _kernelSizes[2];
+    size_t _strides[2];
+    size_t _paddings[2];
+
+    /* Number of channel and kernel blocks in one group */
+    size_t _nChannelBlocks;
+    size_t _nKernelBlocks;
+    /* Sizes of the zero-padded input */
+    size_t _paddedHeight;
+    size_t _paddedWidth;
+    /* Number of Winograd tiles in the output of one sample */
+    size_t _nTileRows;
+    size_t _nTileCols;
+
+    daal::internal::TArray<algorithmFPType, cpu> _packedInput;
+    daal::internal::TArray<algorithmFPType, cpu> _packedWeights;
+};
+} // internal
+} // forward
+
+} // convolution2d
+} // layers
+} // neural_networks
+} // algorithms
+} // daal
+
+#endif
@@ -49,6 +49,7 @@
 #include "service_numeric_table.h"
 
 #include "service_mkl_tensor.h"
+#include "convolution2d_layer_forward_direct_impl.i"
 
 using namespace daal::internal;
 using namespace daal::services;
@@ -71,6 +72,28 @@ namespace internal
 template<typename algorithmFPType, Method method, CpuType cpu>
 Status Convolution2dKernel<algorithmFPType, method, cpu>::initialize(const services::Collection<size_t>& inDimsFull, const services::Collection<size_t>& wDims,
                                                                 const convolution2d::Parameter &parameter, const services::Collection<size_t>& outDimsFull)
+{
+    useDirect = false;
+    if (parameter.algorithm == directAlgorithm || parameter.algorithm == winogradAlgorithm)
+    {
+        useDirect = true;
+        return directKernel.initialize(inDimsFull, parameter, outDimsFull, parameter.algorithm == winogradAlgorithm);
+    }
+
+    Status s = initializeDnn(inDimsFull, wDims, parameter, outDimsFull);
+    if (!s && parameter.algorithm == automaticAlgorithm &&
+        DirectConvolution2dKernel<algorithmFPType, cpu>::isSupported(inDimsFull, parameter))
+    {
+        /* The convolution primitive is not available for this shape or in this build of the library */
+        useDirect = true;
+        return directKernel.initialize(inDimsFull, parameter, outDimsFull, false);
+    }
+    return s;
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status Convolution2dKernel<algorithmFPType, method, cpu>::initializeDnn(const services::Collection<size_t>& inDimsFull, const services::Collection<size_t>& wDims,
+                                                                const convolution2d::Parameter &parameter, const services::Collection<size_t>& outDimsFull)
 {
     dnnError_t err;
 
@@ -127,6 +150,11 @@ template<typename algorithmFPType, Method method, CpuType cpu>
 Status Convolution2dKernel<algorithmFPType, method, cpu>::compute(Tensor *inputTensor, Tensor *wTensor, Tensor *bTensor,
                                                                 const convolution2d::Parameter &parameter, Tensor *resultTensor)
 {
+    if (useDirect)
+    {
+        return directKernel.compute(inputTensor, wTensor, bTensor, resultTensor);
+    }
+
     Status s;
 
     MklTensor<algorithmFPType> *inputMklTensor = dynamic_cast<MklTensor<algorithmFPType>*>(inputTensor);
@@ -249,6 +277,7 @@ Status Convolution2dKernel<algorithmFPType, method, cpu>::reset()
     if(convPrim != NULL)
     {
         dnn::xDelete(convPrim);
+        convPrim = NULL;
     }
     return Status();
 }
@@ -55,6 +55,7 @@
 #include "service_dnn.h"
 #include "service_dnn_internal.h"
 #include "layers_threading.h"
+#include "convolution2d_layer_forward_direct_kernel.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -80,7 +81,7 @@ template<typename algorithmFPType, Method method, CpuType cpu>
 class Convolution2dKernel : public Kernel
 {
 public:
-    Convolution2dKernel() : convPrim(NULL) {}
+    Convolution2dKernel() : convPrim(NULL), useDirect(false) {}
 
     services::Status compute(Tensor *inputTensor, Tensor *wTensor, Tensor *bTensor,
                                                                 const convolution2d::Parameter &parameter, Tensor *resultTensor);
@@ -95,6 +96,9 @@ private:
     typedef daal::internal::DnnLayout<algorithmFPType, cpu> xDnnLayout;
     typedef daal::internal::DnnBuffer<algorithmFPType, cpu> xDnnBuffer;
 
+    services::Status initializeDnn(const services::Collection<size_t>& inDimsFull, const services::Collection<size_t>& wDims,
+                                   const convolution2d::Parameter &parameter, const services::Collection<size_t> &outDimsFull);
+
     static const size_t dimension = 4;
 
     size_t inputSize    [ dimension ];
@@ -116,6 +120,9 @@ private:
     xDnnLayout ltUserOutput;
 
     dnnPrimitive_t convPrim;
+
+    bool useDirect;
+    DirectConvolution2dKernel<algorithmFPType, cpu> directKernel;
 };
 } // internal
 } // forward
@@ -0,0 +1,227 @@
+/* file: convolution2d_layer_forward_quantized_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of convolution2d algorithm with 8-bit integer inputs and weights
+//--
+*/
+
+#ifndef __CONVOLUTION2D_LAYER_FORWARD_QUANTIZED_IMPL_I__
+#define __CONVOLUTION2D_LAYER_FORWARD_QUANTIZED_IMPL_I__
+
+#include "convolution2d_layer_forward_quantized_kernel.h"
+#include "service_tensor.h"
+#include "service_error_handling.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace neural_networks
+{
+namespace layers
+{
+namespace convolution2d
+{
+namespace forward
+{
+namespace internal
+{
+
+using namespace daal::internal;
+using namespace daal::services;
+
+template<typename algorithmFPType, CpuType cpu>
+bool QuantizedConvolution2dKernel<algorithmFPType, cpu>::isSupported(const Tensor &inputTensor, const convolution2d::Parameter &parameter)
+{
+    return (inputTensor.getNumberOfDimensions() == 4 &&
+            parameter.indices.dims[0] == 2 && parameter.indices.dims[1] == 3 &&
+            parameter.groupDimension == 1 && parameter.nGroups > 0 &&
+            parameter.nKernels % parameter.nGroups == 0 &&
+            inputTensor.getDimensionSize(1) % parameter.nGroups == 0);
+}
+
+template<typename algorithmFPType, CpuType cpu>
+services::Status QuantizedConvolution2dKernel<algorithmFPType, cpu>::initialize(const Tensor &wTensor, const Tensor &bTensor,
+    const convolution2d::Parameter &parameter, algorithmFPType inputRange)
+{
+    DAAL_CHECK(inputRange > (algorithmFPType)0, ErrorIncorrectParameter);
+
+    _nGroups = parameter.nGroups;
+    for (size_t d = 0; d < 2; d++)
+    {
+        _kernelSizes[d] = parameter.kernelSizes.size[d];
+        _strides[d]     = parameter.strides.size[d];
+        _paddings[d]    = parameter.paddings.size[d];
+    }
+
+    /* Weights of each kernel occupy the contiguous row of (nChannels / nGroups) * kernelSize elements */
+    const size_t nKernels = parameter.nKernels;
+    const size_t rowSize  = wTensor.getSize() / nKernels;
+
+    ReadSubtensor<algorithmFPType, cpu> wBlock(const_cast<Tensor &>(wTensor));
+    DAAL_CHECK_BLOCK_STATUS(wBlock);
+    ReadSubtensor<algorithmFPType, cpu> bBlock(const_cast<Tensor &>(bTensor));
+    DAAL_CHECK_BLOCK_STATUS(bBlock);
+
+    Status s = _weights.initialize(nKernels, rowSize, wBlock.get(), _dot.maxWeight());
+    DAAL_CHECK_STATUS_VAR(s);
+
+    _biases.reset(nKernels);
+    DAAL_CHECK_MALLOC(_biases.get());
+    const algorithmFPType *b = bBlock.get();
+    for (size_t k = 0; k < nKernels; k++)
+    {
+        _biases[k] = b[k];
+    }
+
+    _inputScale = inputRange / (algorithmFPType)127.0;
+    return s;
+}
+
+template<typename algorithmFPType, CpuType cpu>
+services::Status QuantizedConvolution2dKernel<algorithmFPType, cpu>::compute(Tensor &inputTensor, Tensor &resultTensor)
+{
+    const size_t batchSize = inputTensor.getDimensionSize(0);
+    const size_t nChannels = inputTensor.getDimensionSize(1);
+    const size_t height    = inputTensor.getDimensionSize(2);
+    const size_t width     = inputTensor.getDimensionSize(3);
+
+    const size_t nKernels       = _weights.nOutputs();
+    const size_t groupChannels  = nChannels / _nGroups;
+    const size_t groupKernels   = nKernels / _nGroups;
+    const size_t colSize        = _weights.nInputs();
+    const size_t colRowSize     = _weights.rowSize();
+
+    DAAL_CHECK(groupChannels * _kernelSizes[0] * _kernelSizes[1] == colSize, ErrorIncorrectSizeOfDimensionInTensor);
+
+    const size_t outHeight = resultTensor.getDimensionSize(2);
+    const size_t outWidth  = resultTensor.getDimensionSize(3);
+    const size_t outSize   = outHeight * outWidth;
+    const size_t inSize    = height * width;
+
+    ReadSubtensor<algorithmFPType, cpu> inputBlock(inputTensor);
+    DAAL_CHECK_BLOCK_STATUS(inputBlock);
+    WriteOnlySubtensor<algorithmFPType, cpu> resultBlock(resultTensor);
+    DAAL_CHECK_BLOCK_STATUS(resultBlock);
+
+    const algorithmFPType *x = inputBlock.get();
+    algorithmFPType *y = resultBlock.get();
+
+    const size_t sampleSize = nChannels * inSize;
+    TArray<uint8_t, cpu> qInputArray(batchSize * sampleSize);
+    uint8_t *qInput = qInputArray.get();
+    DAAL_CHECK_MALLOC(qInput);
+
+    const algorithmFPType invScale = (algorithmFPType)1 / _inputScale;
+    daal::threader_for(batchSize, batchSize, [&](size_t i)
+    {
+        layers::internal::quantizeActivations<algorithmFPType, cpu>(sampleSize, sampleSize, x + i * sampleSize, invScale, qInput + i * sampleSize);
+    });
+
+    SafeStatus safeStat;
+    const size_t nTasks = batchSize * _nGroups;
+    daal::threader_for(nTasks, nTasks, [&](size_t task)
+    {
+        const size_t i = task / _nGroups;
+        const size_t g = task % _nGroups;
+
+        /* Patches of the quantized input, one padded row per output position */
+        TArray<uint8_t, cpu> colArray(outSize * colRowSize);
+        uint8_t *col = colArray.get();
+        DAAL_CHECK_MALLOC_THR(col);
+
+        const uint8_t *q = qInput + i * sampleSize + g * groupChannels * inSize;
+        for (size_t oh = 0; oh < outHeight; oh++)
+        {
+            for (size_t ow = 0; ow < outWidth; ow++)
+            {
+                uint8_t *row = col + (oh * outWidth + ow) * colRowSize;
+                size_t j = 0;
+                for (size_t c = 0; c < groupChannels; c++)
+                {
+                    for (size_t kh = 0; kh < _kernelSizes[0]; kh++)
+                    {
+                        const int h = (int)(oh * _strides[0] + kh) - _paddings[0];
+                        for (size_t kw = 0; kw < _kernelSizes[1]; kw++, j++)
+                        {
+                            const int w = (int)(ow * _strides[1] + kw) - _paddings[1];
+                            row[j] = (h >= 0 && h < (int)height && w >= 0 && w < (int)width ?
+                                      q[c * inSize + h * width + w] : layers::internal::quantizedZeroPoint);
+                        }
+                    }
+                }
+                for (; j < colRowSize; j++)
+                {
+                    row[j] = layers::internal::quantizedZeroPoint;
+                }
+            }
+        }
+
+        for (size_t kg = 0; kg < groupKernels; kg++)
+        {
+            const size_t k = g * groupKernels + kg;
+            const int8_t *wRow = _weights.row(k);
+            const int32_t compensation = _weights.compensation(k);
+            const algorithmFPType scale = _inputScale * _weights.scale(k);
+            const algorithmFPType bias  = _biases[k];
+
+            algorithmFPType *yk = y + (i * nKernels + k) * outSize;
+            for (size_t p = 0; p < outSize; p++)
+            {
+                yk[p] = (algorithmFPType)(_dot(colRowSize, col + p * colRowSize, wRow) - compensation) * scale + bias;
+            }
+        }
+    });
+    return safeStat.detach();
+}
+
+} // internal
+} // forward
+} // convolution2d
+} // layers
+} // neural_networks
+} // algorithms
+} // daal
+
+#endif
@@ -80,7 +80,10 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *inp
     const Input *eltwiseInput = dynamic_cast<const Input *>(input);
     DAAL_CHECK(eltwiseInput, services::ErrorNullInput);
     DAAL_CHECK_STATUS(s, eltwiseInput->check(parameter, method));
-    DAAL_CHECK_STATUS(s, allocateValueTensor<algorithmFPType>(eltwiseInput));
+    if (!get(layers::forward::value))
+    {
+        DAAL_CHECK_STATUS(s, allocateValueTensor<algorithmFPType>(eltwiseInput));
+    }
 
     // We call this function just to allocate
     // resultLayerData and consciously ignore returned value
@@ -0,0 +1,159 @@
+/* file: fullyconnected_layer_forward_quantized_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of fullyconnected algorithm with 8-bit integer inputs and weights
+//--
+*/
+
+#ifndef __FULLYCONNECTED_LAYER_FORWARD_QUANTIZED_IMPL_I__
+#define __FULLYCONNECTED_LAYER_FORWARD_QUANTIZED_IMPL_I__
+
+#include "fullyconnected_layer_forward_quantized_kernel.h"
+#include "service_tensor.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace neural_networks
+{
+namespace layers
+{
+namespace fullyconnected
+{
+namespace forward
+{
+namespace internal
+{
+
+using namespace daal::internal;
+using namespace daal::services;
+
+/* Number of outputs processed by one task */
+const size_t _QUANTIZED_OUTPUTS_BLOCKSIZE = 64;
+
+template<typename algorithmFPType, CpuType cpu>
+services::Status QuantizedFullyconnectedKernel<algorithmFPType, cpu>::initialize(const Tensor &wTensor, const Tensor &bTensor,
+    const fullyconnected::Parameter &parameter, algorithmFPType inputRange)
+{
+    DAAL_CHECK(inputRange > (algorithmFPType)0, ErrorIncorrectParameter);
+
+    const size_t nOutputs = parameter.nOutputs;
+    const size_t nInputs  = wTensor.getSize() / nOutputs;
+
+    ReadSubtensor<algorithmFPType, cpu> wBlock(const_cast<Tensor &>(wTensor));
+    DAAL_CHECK_BLOCK_STATUS(wBlock);
+    ReadSubtensor<algorithmFPType, cpu> bBlock(const_cast<Tensor &>(bTensor));
+    DAAL_CHECK_BLOCK_STATUS(bBlock);
+
+    Status s = _weights.initialize(nOutputs, nInputs, wBlock.get(), _dot.maxWeight());
+    DAAL_CHECK_STATUS_VAR(s);
+
+    _biases.reset(nOutputs);
+    DAAL_CHECK_MALLOC(_biases.get());
+    const algorithmFPType *b = bBlock.get();
+    for (size_t k = 0; k < nOutputs; k++)
+    {
+        _biases[k] = b[k];
+    }
+
+    _inputScale = inputRange / (algorithmFPType)127.0;
+    return s;
+}
+
+template<typename algorithmFPType, CpuType cpu>
+services::Status QuantizedFullyconnectedKernel<algorithmFPType, cpu>::compute(Tensor &inputTensor, Tensor &resultTensor)
+{
+    const size_t batchSize = inputTensor.getDimensionSize(0);
+    const size_t nInputs   = _weights.nInputs();
+    const size_t nOutputs  = _weights.nOutputs();
+    const size_t rowSize   = _weights.rowSize();
+
+    DAAL_CHECK(inputTensor.getSize() == batchSize * nInputs, ErrorIncorrectSizeOfDimensionInTensor);
+
+    ReadSubtensor<algorithmFPType, cpu> inputBlock(inputTensor);
+    DAAL_CHECK_BLOCK_STATUS(inputBlock);
+    WriteOnlySubtensor<algorithmFPType, cpu> resultBlock(resultTensor);
+    DAAL_CHECK_BLOCK_STATUS(resultBlock);
+
+    const algorithmFPType *x = inputBlock.get();
+    algorithmFPType *y = resultBlock.get();
+
+    TArray<uint8_t, cpu> qInputArray(batchSize * rowSize);
+    uint8_t *qInput = qInputArray.get();
+    DAAL_CHECK_MALLOC(qInput);
+
+    const algorithmFPType invScale = (algorithmFPType)1 / _inputScale;
+    daal::threader_for(batchSize, batchSize, [&](size_t i)
+    {
+        layers::internal::quantizeActivations<algorithmFPType, cpu>(nInputs, rowSize, x + i * nInputs, invScale, qInput + i * rowSize);
+    });
+
+    const size_t nBlocks = (nOutputs + _QUANTIZED_OUTPUTS_BLOCKSIZE - 1) / _QUANTIZED_OUTPUTS_BLOCKSIZE;
+    daal::threader_for(batchSize * nBlocks, batchSize * nBlocks, [&](size_t task)
+    {
+        const size_t i     = task / nBlocks;
+        const size_t begin = (task % nBlocks) * _QUANTIZED_OUTPUTS_BLOCKSIZE;
+        const size_t end   = (begin + _QUANTIZED_OUTPUTS_BLOCKSIZE < nOutputs ? begin + _QUANTIZED_OUTPUTS_BLOCKSIZE : nOutputs);
+
+        const uint8_t *q = qInput + i * rowSize;
+        algorithmFPType *yi = y + i * nOutputs;
+        for (size_t k = begin; k < end; k++)
+        {
+            const int32_t dot = _dot(rowSize, q, _weights.row(k)) - _weights.compensation(k);
+            yi[k] = (algorithmFPType)dot * _inputScale * _weights.scale(k) + _biases[k];
+        }
+    });
+    return Status();
+}
+
+} // internal
+} // forward
+} // fullyconnected
+} // layers
+} // neural_networks
+} // algorithms
+} // daal
+
+#endif
@@ -0,0 +1,327 @@
+/* file: layers_quantization.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Common functions for the 8-bit integer computations of the layers on the prediction stage
+//--
+*/
+
+#ifndef __LAYERS_QUANTIZATION_H__
+#define __LAYERS_QUANTIZATION_H__
+
+#include "tensor.h"
+#include "threading.h"
+#include "service_defines.h"
+#include "service_tensor.h"
+#include "service_numeric_table.h"
+#if defined (__INTEL_COMPILER) || defined (__AVX2__)
+  #include <immintrin.h>
+#endif
+
+using namespace daal::data_management;
+using namespace daal::services;
+using namespace daal::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace neural_networks
+{
+namespace layers
+{
+namespace internal
+{
+
+/* Rows of the quantized data are padded to the multiple of the widest vector of 8-bit integers */
+const size_t quantizedRowAlignment = 64;
+
+/* Value of the zero activation in the unsigned 8-bit representation */
+const uint8_t quantizedZeroPoint = 128;
+
+inline size_t getQuantizedRowSize(size_t n)
+{
+    return ((n + quantizedRowAlignment - 1) / quantizedRowAlignment) * quantizedRowAlignment;
+}
+
+/**
+ *  \brief Dot product of the unsigned 8-bit activations and the signed 8-bit weights,
+ *         the number of elements is a multiple of quantizedRowAlignment
+ */
+template<CpuType cpu>
+struct QuantizedDot
+{
+    /* Maximal absolute value of the quantized weights */
+    int maxWeight() const { return 127; }
+
+    int32_t operator()(size_t n, const uint8_t *a, const int8_t *w) const
+    {
+        int32_t sum = 0;
+        for (size_t i = 0; i < n; i++)
+        {
+            sum += (int32_t)a[i] * (int32_t)w[i];
+        }
+        return sum;
+    }
+};
+
+/* The vector specializations are compiled only if the compiler generates the instructions of the target CPU:
+   the vector extensions are checked instead of the compiler, so that the GNU and Microsoft compilers use them too.
+   Builds that compile the Intel(R) AVX-512 target for Intel(R) AVX2 only use the Intel(R) AVX2 dot product there */
+#if defined (__AVX2__) && ((__CPUID__(DAAL_CPU) == __avx2__) || (__CPUID__(DAAL_CPU) == __avx512__))
+/* Pairwise sums of the products are computed in 16 bits with saturation,
+   so the weights are limited by 63 to keep 255 * 63 * 2 in the range of the 16-bit integer */
+struct QuantizedDotAvx2
+{
+    int maxWeight() const { return 63; }
+
+    int32_t operator()(size_t n, const uint8_t *a, const int8_t *w) const
+    {
+        const __m256i ones = _mm256_set1_epi16(1);
+        __m256i acc = _mm256_setzero_si256();
+        for (size_t i = 0; i < n; i += 32)
+        {
+            const __m256i va  = _mm256_loadu_si256((const __m256i *)(a + i));
+            const __m256i vw  = _mm256_loadu_si256((const __m256i *)(w + i));
+            const __m256i p16 = _mm256_maddubs_epi16(va, vw);
+            acc = _mm256_add_epi32(acc, _mm256_madd_epi16(p16, ones));
+        }
+        __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+        sum = _mm_hadd_epi32(sum, sum);
+        sum = _mm_hadd_epi32(sum, sum);
+        return _mm_cvtsi128_si32(sum);
+    }
+};
+#endif
+
+#if defined (__AVX2__) && (__CPUID__(DAAL_CPU) == __avx2__)
+template<>
+struct QuantizedDot<avx2> : public QuantizedDotAvx2 {};
+#endif
+
+#if (__CPUID__(DAAL_CPU) == __avx512__)
+#if defined (__AVX512BW__)
+
+/* VNNI instructions are generated by the Intel(R) C++ Compiler 19.0, by the compilers targeting the CPUs with VNNI
+   and by the GNU compiler 8 or later for the function with the target attribute */
+#if defined (__AVX512VNNI__) || (defined (__INTEL_COMPILER) && (__INTEL_COMPILER >= 1900))
+  #define DAAL_QUANTIZED_VNNI
+  #define DAAL_QUANTIZED_VNNI_TARGET
+#elif defined (__GNUC__) && !defined (__clang__) && !defined (__INTEL_COMPILER) && (__GNUC__ >= 8)
+  #define DAAL_QUANTIZED_VNNI
+  #define DAAL_QUANTIZED_VNNI_TARGET __attribute__((target("avx512vnni")))
+#endif
+
+#if defined (DAAL_QUANTIZED_VNNI)
+DAAL_QUANTIZED_VNNI_TARGET inline int32_t quantizedDotVnni(size_t n, const uint8_t *a, const int8_t *w)
+{
+    __m512i acc = _mm512_setzero_si512();
+    for (size_t i = 0; i < n; i += 64)
+    {
+        acc = _mm512_dpbusd_epi32(acc, _mm512_loadu_si512(a + i), _mm512_loadu_si512(w + i));
+    }
+    return _mm512_reduce_add_epi32(acc);
+}
+#endif
+
+/* Intel(R) AVX-512 specialization. Uses VNNI instructions when they are available,
+   otherwise falls back to the AVX-512BW instructions with the weights limited by 63 */
+template<>
+struct QuantizedDot<avx512>
+{
+    QuantizedDot() : _vnni(false)
+    {
+#if defined (DAAL_QUANTIZED_VNNI)
+        _vnni = (__daal_serv_cpu_feature_avx512_vnni() != 0);
+#endif
+    }
+
+    int maxWeight() const { return _vnni ? 127 : 63; }
+
+    int32_t operator()(size_t n, const uint8_t *a, const int8_t *w) const
+    {
+#if defined (DAAL_QUANTIZED_VNNI)
+        if (_vnni) { return quantizedDotVnni(n, a, w); }
+#endif
+        __m512i acc = _mm512_setzero_si512();
+        const __m512i ones = _mm512_set1_epi16(1);
+        for (size_t i = 0; i < n; i += 64)
+        {
+            const __m512i p16 = _mm512_maddubs_epi16(_mm512_loadu_si512(a + i), _mm512_loadu_si512(w + i));
+            acc = _mm512_add_epi32(acc, _mm512_madd_epi16(p16, ones));
+        }
+        return _mm512_reduce_add_epi32(acc);
+    }
+
+private:
+    bool _vnni;
+};
+
+#undef DAAL_QUANTIZED_VNNI
+#undef DAAL_QUANTIZED_VNNI_TARGET
+
+#elif defined (__AVX2__)
+template<>
+struct QuantizedDot<avx512> : public QuantizedDotAvx2 {};
+#endif
+#endif /* __avx512__ */
+
+/**
+ * Quantizes the values into the unsigned 8-bit integers: round(x * invScale) clamped to [-127, 127] and shifted by 128.
+ * Padding elements of the row are set to the zero point
+ */
+template<typename algorithmFPType, CpuType cpu>
+inline void quantizeActivations(size_t n, size_t rowSize, const algorithmFPType *x, algorithmFPType invScale, uint8_t *q)
+{
+    const algorithmFPType maxValue = (algorithmFPType)127.0;
+    const algorithmFPType half     = (algorithmFPType)0.5;
+    for (size_t i = 0; i < n; i++)
+    {
+        algorithmFPType v = x[i] * invScale;
+        v = (v > maxValue ? maxValue : (v < -maxValue ? -maxValue : v));
+        const int r = (int)(v >= (algorithmFPType)0 ? v + half : v - half);
+        q[i] = (uint8_t)(r + (int)quantizedZeroPoint);
+    }
+    for (size_t i = n; i < rowSize; i++)
+    {
+        q[i] = quantizedZeroPoint;
+    }
+}
+
+template<typename algorithmFPType, CpuType cpu>
+inline algorithmFPType computeMaxAbs(size_t n, const algorithmFPType *x)
+{
+    algorithmFPType maxAbs = (algorithmFPType)0;
+    for (size_t i = 0; i < n; i++)
+    {
+        const algorithmFPType v = (x[i] < (algorithmFPType)0 ? -x[i] : x[i]);
+        if (v > maxAbs) { maxAbs = v; }
+    }
+    return maxAbs;
+}
+
+/**
+ *  \brief Weights of the layer quantized into the signed 8-bit integers with the scale per output.
+ *         Each output stores the padded row of weights, the scale and the sum of weights multiplied by the zero point
+ *         of activations to compensate the shift of the unsigned activations
+ */
+template<typename algorithmFPType, CpuType cpu>
+class QuantizedWeights
+{
+public:
+    QuantizedWeights() : _nOutputs(0), _nInputs(0), _rowSize(0) {}
+
+    services::Status initialize(size_t nOutputs, size_t nInputs, const algorithmFPType *weights, int maxWeight)
+    {
+        _nOutputs = nOutputs;
+        _nInputs  = nInputs;
+        _rowSize  = getQuantizedRowSize(nInputs);
+
+        _weights.reset(_nOutputs * _rowSize);
+        _scale.reset(_nOutputs);
+        _compensation.reset(_nOutputs);
+        DAAL_CHECK_MALLOC(_weights.get() && _scale.get() && _compensation.get());
+
+        daal::threader_for(_nOutputs, _nOutputs, [&](size_t k)
+        {
+            const algorithmFPType *w = weights + k * _nInputs;
+            int8_t *q = _weights.get() + k * _rowSize;
+
+            const algorithmFPType maxAbs = computeMaxAbs<algorithmFPType, cpu>(_nInputs, w);
+            const algorithmFPType scale  = (maxAbs > (algorithmFPType)0 ? maxAbs / (algorithmFPType)maxWeight : (algorithmFPType)1);
+            const algorithmFPType invScale = (algorithmFPType)1 / scale;
+
+            int32_t sum = 0;
+            for (size_t j = 0; j < _nInputs; j++)
+            {
+                const algorithmFPType v = w[j] * invScale;
+                int r = (int)(v >= (algorithmFPType)0 ? v + (algorithmFPType)0.5 : v - (algorithmFPType)0.5);
+                r = (r > maxWeight ? maxWeight : (r < -maxWeight ? -maxWeight : r));
+                q[j] = (int8_t)r;
+                sum += r;
+            }
+            for (size_t j = _nInputs; j < _rowSize; j++)
+            {
+                q[j] = 0;
+            }
+            _scale[k] = scale;
+            _compensation[k] = sum * (int32_t)quantizedZeroPoint;
+        });
+        return services::Status();
+    }
+
+    size_t nOutputs() const { return _nOutputs; }
+    size_t nInputs()  const { return _nInputs; }
+    size_t rowSize()  const { return _rowSize; }
+
+    const int8_t *row(size_t k) const { return _weights.get() + k * _rowSize; }
+    algorithmFPType scale(size_t k) const { return _scale[k]; }
+    int32_t compensation(size_t k) const { return _compensation[k]; }
+
+private:
+    size_t _nOutputs;
+    size_t _nInputs;
+    size_t _rowSize;
+    TArray<int8_t, cpu> _weights;
+    TArray<algorithmFPType, cpu> _scale;
+    TArray<int32_t, cpu> _compensation;
+};
+
+/**
+ *  \brief Interface of the forward layer kernels that compute with the 8-bit integer inputs and weights
+ */
+template<typename algorithmFPType, CpuType cpu>
+class QuantizedLayerKernel
+{
+public:
+    virtual ~QuantizedLayerKernel() {}
+
+    virtual services::Status compute(Tensor &inputTensor, Tensor &resultTensor) = 0;
+};
+
+} // namespace internal
+} // namespace layers
+} // namespace neural_networks
+} // namespace algorithms
+} // namespace daal
+
+#endif
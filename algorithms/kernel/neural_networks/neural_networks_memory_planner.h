@@ -0,0 +1,402 @@
+/* file: neural_networks_memory_planner.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the planner of the memory for the layer results
+//  on the prediction stage of neural network
+//--
+*/
+
+#ifndef __NEURAL_NETWORKS_MEMORY_PLANNER_H__
+#define __NEURAL_NETWORKS_MEMORY_PLANNER_H__
+
+#include "services/daal_memory.h"
+#include "services/collection.h"
+#include "data_management/data/homogen_tensor.h"
+#include "algorithms/neural_networks/neural_networks_types.h"
+#include "algorithms/neural_networks/neural_networks_prediction_model.h"
+#include "algorithms/neural_networks/layers/relu/relu_layer_forward.h"
+#include "algorithms/neural_networks/layers/eltwise_sum/eltwise_sum_layer_forward.h"
+#include "algorithms/neural_networks/layers/convolution2d/convolution2d_layer_forward.h"
+#include "algorithms/neural_networks/layers/lrn/lrn_layer_forward.h"
+#include "algorithms/neural_networks/layers/pooling2d/maximum_pooling2d_layer_forward.h"
+#include "algorithms/neural_networks/layers/pooling2d/average_pooling2d_layer_forward.h"
+#include "algorithms/neural_networks/layers/concat/concat_layer_forward.h"
+#include "algorithms/neural_networks/layers/split/split_layer_forward.h"
+#include "service_mkl_tensor.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace neural_networks
+{
+namespace prediction
+{
+namespace internal
+{
+
+/**
+ *  \brief Assigns the results of the forward layers to a small set of shared memory arenas.
+ *         The layers are computed in the order of their indices, so the result of a layer is alive
+ *         from the layer that produces it till the last layer from its NextLayers list.
+ *         Arenas are reused by the results with non-overlapping lifetimes, results of the last layers
+ *         of the network are never reused. The layers that can overwrite their input (relu, eltwise_sum)
+ *         compute in place if they are the last consumers of the input.
+ *         Results in the MKL-DNN layout that are consumed only by MKL-DNN layers keep their own memory,
+ *         so that the layout is not converted between such layers. The fused batch normalization layers
+ *         return the value of the preceding layer.
+ */
+template<typename modelFPType>
+class ActivationMemoryPlanner
+{
+public:
+    ActivationMemoryPlanner(ForwardLayers &forwardLayers, const services::Collection<layers::NextLayers> &nextLayers,
+                            const services::Collection<FusedLayers> &fusedLayers) :
+        _forwardLayers(forwardLayers), _nextLayers(nextLayers), _fusedLayers(fusedLayers), _nLayers(forwardLayers.size()) {}
+
+    /**
+     * Allocates the results of the layers and connects the layers with each other
+     * \return Status of computations
+     */
+    services::Status run()
+    {
+        using namespace layers;
+
+        services::Status s;
+        for (size_t layerId = 0; layerId < _nLayers; layerId++)
+        {
+            forward::LayerIfacePtr layer = _forwardLayers.get(layerId);
+            forward::ResultPtr layerResult = layer->getLayerResult();
+            const bool isTensorResult = !layerResult || layerResult->getLayout() == tensorResult;
+            const size_t lastUse = getLastUse(layerId);
+
+            data_management::TensorPtr input = getFirstInput(layer->getLayerInput());
+            size_t inputId = 0;
+            const bool fused = isFused(layerId);
+            const bool inplace = !fused && isInplaceLayer(layer) && isTensorResult &&
+                                 findTensor(input.get(), inputId) && _tensors[inputId].lastUse == layerId &&
+                                 !isSharedWithOtherInputs(layer->getLayerInput(), inputId);
+
+            if (isInplaceLayer(layer))
+            {
+                layer->getLayerParameter()->allowInplaceComputation = inplace;
+            }
+            if (layerResult && isTensorResult)
+            {
+                layerResult->set(forward::value, (inplace || fused) ? input : data_management::TensorPtr());
+            }
+
+            DAAL_CHECK_STATUS(s, layer->allocateResult());
+            layerResult = layer->getLayerResult();
+            DAAL_CHECK(layerResult, services::ErrorNullResult);
+
+            const layers::NextLayers &next = _nextLayers.get(layerId);
+            if (layerResult->getLayout() == tensorResult)
+            {
+                DAAL_CHECK_STATUS(s, planValue(layerResult, layerId, lastUse));
+            }
+            else
+            {
+                /* Results stored in the collection are owned by the layer, only their aliases of the inputs are tracked */
+                for (size_t j = 0; j < next.size(); j++)
+                {
+                    size_t valueId = 0;
+                    if (findTensor(layerResult->getValue(j).get(), valueId)) { extendLifetime(valueId, lastUse); }
+                }
+            }
+
+            for (size_t j = 0; j < next.size(); j++)
+            {
+                DAAL_CHECK_STATUS(s, _forwardLayers.get(next[j])->addInput(layerResult, j, 0));
+            }
+        }
+        return s;
+    }
+
+protected:
+    struct Arena
+    {
+        Arena() : size(0), freeAfter(0) {}
+        services::SharedPtr<modelFPType> memory;
+        size_t size;            /* Number of elements in the arena */
+        size_t freeAfter;       /* Index of the last layer that reads the arena */
+    };
+
+    struct PlannedTensor
+    {
+        PlannedTensor() : inArena(false), arena(0), lastUse(0) {}
+        data_management::TensorPtr tensor;
+        bool inArena;           /* False if the tensor keeps its own memory */
+        size_t arena;
+        size_t lastUse;         /* Index of the last layer that reads the tensor */
+    };
+
+    /* Returns the index of the last layer that uses the result of the layer, or the number of layers for the last layers */
+    size_t getLastUse(size_t layerId) const
+    {
+        const layers::NextLayers &next = _nextLayers.get(layerId);
+        if (next.size() == 0) { return _nLayers; }
+
+        size_t lastUse = layerId;
+        for (size_t j = 0; j < next.size(); j++)
+        {
+            if (next[j] > lastUse) { lastUse = next[j]; }
+        }
+        return lastUse;
+    }
+
+    bool isFused(size_t layerId) const
+    {
+        for (size_t i = 0; i < _fusedLayers.size(); i++)
+        {
+            if (_fusedLayers[i].normalizationIndex == layerId) { return true; }
+        }
+        return false;
+    }
+
+    static data_management::TensorPtr getFirstInput(layers::forward::Input *input)
+    {
+        using namespace layers;
+        if (input->getLayout() == tensorInput)
+        {
+            return input->get(forward::data);
+        }
+        LayerDataPtr inputData = input->get(forward::inputLayerData);
+        if (!inputData || inputData->size() == 0)
+        {
+            return data_management::TensorPtr();
+        }
+        return services::staticPointerCast<data_management::Tensor, data_management::SerializationIface>((*inputData)[0]);
+    }
+
+    /* Checks if the memory of the first input is also read through the other inputs of the layer */
+    bool isSharedWithOtherInputs(layers::forward::Input *input, size_t inputId) const
+    {
+        using namespace layers;
+        if (input->getLayout() == tensorInput) { return false; }
+
+        LayerDataPtr inputData = input->get(forward::inputLayerData);
+        for (size_t i = 1; i < inputData->size(); i++)
+        {
+            size_t otherId = 0;
+            data_management::TensorPtr other =
+                services::staticPointerCast<data_management::Tensor, data_management::SerializationIface>((*inputData)[i]);
+            if (!findTensor(other.get(), otherId)) { continue; }
+            if (otherId == inputId) { return true; }
+            if (_tensors[otherId].inArena && _tensors[inputId].inArena && _tensors[otherId].arena == _tensors[inputId].arena) { return true; }
+        }
+        return false;
+    }
+
+    /* Layers that are allowed to write their result into the memory of their first input */
+    static bool isInplaceLayer(const layers::forward::LayerIfacePtr &layer)
+    {
+        using namespace layers;
+        return services::dynamicPointerCast<relu::forward::Batch<modelFPType>,        forward::LayerIface>(layer).get() ||
+               services::dynamicPointerCast<eltwise_sum::forward::Batch<modelFPType>, forward::LayerIface>(layer).get();
+    }
+
+    /* Layers that read the input in the MKL-DNN layout without conversion */
+    static bool isDnnLayer(const layers::forward::LayerIfacePtr &layer)
+    {
+        using namespace layers;
+        return services::dynamicPointerCast<convolution2d::forward::Batch<modelFPType>,     forward::LayerIface>(layer).get() ||
+               services::dynamicPointerCast<relu::forward::Batch<modelFPType>,              forward::LayerIface>(layer).get() ||
+               services::dynamicPointerCast<lrn::forward::Batch<modelFPType>,               forward::LayerIface>(layer).get() ||
+               services::dynamicPointerCast<maximum_pooling2d::forward::Batch<modelFPType>, forward::LayerIface>(layer).get() ||
+               services::dynamicPointerCast<average_pooling2d::forward::Batch<modelFPType>, forward::LayerIface>(layer).get() ||
+               services::dynamicPointerCast<concat::forward::Batch<modelFPType>,            forward::LayerIface>(layer).get() ||
+               services::dynamicPointerCast<split::forward::Batch<modelFPType>,             forward::LayerIface>(layer).get();
+    }
+
+    /* Checks if all the layers that read the result of the layer, including the layers after the fused ones, are MKL-DNN layers */
+    bool hasOnlyDnnConsumers(size_t layerId) const
+    {
+        const layers::NextLayers &next = _nextLayers.get(layerId);
+        if (next.size() == 0) { return false; }
+
+        for (size_t j = 0; j < next.size(); j++)
+        {
+            if (isFused(next[j]))
+            {
+                if (!hasOnlyDnnConsumers(next[j])) { return false; }
+            }
+            else if (!isDnnLayer(_forwardLayers.get(next[j])))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool findTensor(const data_management::Tensor *tensor, size_t &tensorId) const
+    {
+        if (!tensor) { return false; }
+        for (size_t i = 0; i < _tensors.size(); i++)
+        {
+            if (_tensors[i].tensor.get() == tensor)
+            {
+                tensorId = i;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void extendLifetime(size_t tensorId, size_t lastUse)
+    {
+        PlannedTensor &planned = _tensors[tensorId];
+        if (planned.lastUse < lastUse) { planned.lastUse = lastUse; }
+        if (planned.inArena && _arenas[planned.arena].freeAfter < lastUse)
+        {
+            _arenas[planned.arena].freeAfter = lastUse;
+        }
+    }
+
+    /* Replaces the value allocated by the layer with the tensor in the shared arena */
+    services::Status planValue(const layers::forward::ResultPtr &layerResult, size_t layerId, size_t lastUse)
+    {
+        using namespace data_management;
+
+        TensorPtr value = layerResult->get(layers::forward::value);
+        if (!value) { return services::Status(); }
+
+        size_t tensorId = 0;
+        if (findTensor(value.get(), tensorId))
+        {
+            /* The layer computes in place, returns its input or is fused with the preceding layer */
+            extendLifetime(tensorId, lastUse);
+            return services::Status();
+        }
+
+        PlannedTensor planned;
+        planned.lastUse = lastUse;
+        if (dynamic_cast<daal::internal::MklTensor<modelFPType> *>(value.get()) && hasOnlyDnnConsumers(layerId))
+        {
+            planned.tensor = value;
+            _tensors.push_back(planned);
+            return services::Status();
+        }
+
+        const services::Collection<size_t> dims = value->getDimensions();
+        const size_t size = value->getSize();
+        value.reset();
+        layerResult->set(layers::forward::value, TensorPtr());
+
+        services::Status s;
+        DAAL_CHECK_STATUS(s, acquireArena(layerId, size, lastUse, planned.arena));
+
+        planned.inArena = true;
+        planned.tensor  = HomogenTensor<modelFPType>::create(dims, _arenas[planned.arena].memory, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        _tensors.push_back(planned);
+
+        layerResult->set(layers::forward::value, planned.tensor);
+        return s;
+    }
+
+    /* Finds the best fitting arena that is not used after the layer, grows or creates an arena if needed */
+    services::Status acquireArena(size_t layerId, size_t size, size_t lastUse, size_t &arena)
+    {
+        bool found = false;
+        for (size_t i = 0; i < _arenas.size(); i++)
+        {
+            if (_arenas[i].freeAfter >= layerId) { continue; }
+            if (!found)
+            {
+                arena = i;
+                found = true;
+                continue;
+            }
+            const bool fits     = _arenas[i].size >= size;
+            const bool bestFits = _arenas[arena].size >= size;
+            if ((fits && (!bestFits || _arenas[i].size < _arenas[arena].size)) ||
+                (!fits && !bestFits && _arenas[i].size > _arenas[arena].size))
+            {
+                arena = i;
+            }
+        }
+        if (!found)
+        {
+            arena = _arenas.size();
+            _arenas.push_back(Arena());
+        }
+
+        _arenas[arena].freeAfter = lastUse;
+        if (_arenas[arena].size >= size) { return services::Status(); }
+
+        /* Grow the arena and rebind the tensors that were already placed into it */
+        services::SharedPtr<modelFPType> memory((modelFPType *)services::daal_malloc(size * sizeof(modelFPType)), services::ServiceDeleter());
+        DAAL_CHECK_MALLOC(memory.get());
+
+        services::Status s;
+        _arenas[arena].memory.reset();
+        for (size_t i = 0; i < _tensors.size(); i++)
+        {
+            if (_tensors[i].inArena && _tensors[i].arena == arena)
+            {
+                data_management::HomogenTensor<modelFPType> *tensor =
+                    static_cast<data_management::HomogenTensor<modelFPType> *>(_tensors[i].tensor.get());
+                DAAL_CHECK_STATUS(s, tensor->setArray(memory));
+            }
+        }
+        _arenas[arena].memory = memory;
+        _arenas[arena].size   = size;
+        return s;
+    }
+
+    ForwardLayers &_forwardLayers;
+    const services::Collection<layers::NextLayers> &_nextLayers;
+    const services::Collection<FusedLayers> &_fusedLayers;
+    const size_t _nLayers;
+    services::Collection<Arena> _arenas;
+    services::Collection<PlannedTensor> _tensors;
+};
+
+} // namespace internal
+} // namespace prediction
+} // namespace neural_networks
+} // namespace algorithms
+} // namespace daal
+
+#endif
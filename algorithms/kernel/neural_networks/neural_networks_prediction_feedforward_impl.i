@@ -48,6 +48,16 @@
 #ifndef __NEURAL_NETWORKS_PREDICTION_FEEDFORWARD_IMPL_I__
 #define __NEURAL_NETWORKS_PREDICTION_FEEDFORWARD_IMPL_I__
 
+#include "service_math.h"
+#include "service_error_handling.h"
+#include "service_mkl_tensor.h"
+#include "daal_strings.h"
+#include "batch_normalization/batch_normalization_layer_forward_types.h"
+#include "fullyconnected/fullyconnected_layer_forward.h"
+#include "convolution2d/convolution2d_layer_forward.h"
+#include "fullyconnected_layer_forward_quantized_impl.i"
+#include "convolution2d_layer_forward_quantized_impl.i"
+
 namespace daal
 {
 namespace algorithms
@@ -78,21 +88,427 @@ Status NeuralNetworksFeedforwardPredictionKernel<algorithmFPType, method, cpu>::
 
     nLastLayers = lastLayersIndices->nLast(); /* number of last layers in the network */
 
-    /* Create a tensor to pass as an input to the first forward layer in neural network */
+    /* Batches of the input are distributed among the copies of the layers created by the model.
+       The ranges of the layer inputs are collected by one copy of the layers */
+    ModelPtr model = input->get(prediction::model);
+    const size_t nBatches = (nSamples - batchSize) / batchSize + 1;
+    calibrate = parameter->calibrate;
+    nLanes = model->getNumberOfReplicas() + 1;
+    if (nLanes > parameter->pipelineDepth) { nLanes = (parameter->pipelineDepth > 1 ? parameter->pipelineDepth : 1); }
+    if (nLanes > nBatches) { nLanes = nBatches; }
+    if (calibrate) { nLanes = 1; }
+
+    laneLayers.reset(nLanes);
+    DAAL_CHECK_MALLOC(laneLayers.get())
+    laneLayers[0] = model->getLayers();
+    for (size_t lane = 1; lane < nLanes; lane++)
+    {
+        laneLayers[lane] = model->getReplicaLayers(lane - 1);
+    }
+
+    /* Create tensors to pass as an input to the first forward layer in neural network */
     Collection<size_t> sampleSize = input->get(prediction::data)->getDimensions();
     sampleSize[0] = batchSize;
     Status s;
-    sample = HomogenTensor<algorithmFPType>::create(sampleSize, Tensor::doNotAllocate, &s);
-    DAAL_CHECK_STATUS_VAR(s);
+    samples.reset(nLanes);
+    DAAL_CHECK_MALLOC(samples.get())
+    for (size_t lane = 0; lane < nLanes; lane++)
+    {
+        samples[lane] = HomogenTensor<algorithmFPType>::create(sampleSize, Tensor::doNotAllocate, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+    }
 
     /* Initialize buffers to manage reading memory operations for the last layer results */
-    lastLayerResults.reset(nLastLayers);
+    lastLayerResults.reset(nLanes * nLastLayers);
     DAAL_CHECK_MALLOC(lastLayerResults.get())
 
     /* Initialize buffers to manage writing memory operations for the prediction results */
-    predictions.reset(nLastLayers);
+    predictions.reset(nLanes * nLastLayers);
     DAAL_CHECK_MALLOC(predictions.get())
 
+    DAAL_CHECK_STATUS(s, createLevels(nextLayers, parameter->parallelBranches));
+    DAAL_CHECK_STATUS(s, findParallelLevels(laneLayers[0].get()));
+
+    /* Fold batch normalization into the weights and biases of the preceding layers */
+    const Collection<FusedLayers> &fusedLayers = model->getFusedLayers();
+    skipLayer.reset(nLayers);
+    DAAL_CHECK_MALLOC(skipLayer.get())
+    for (size_t i = 0; i < nLayers; i++)
+    {
+        skipLayer[i] = false;
+    }
+    for (size_t i = 0; i < fusedLayers.size(); i++)
+    {
+        DAAL_CHECK_STATUS(s, foldBatchNormalization(model->getLayers().get(), fusedLayers[i]));
+        skipLayer[fusedLayers[i].normalizationIndex] = true;
+    }
+
+    for (size_t lane = 1; lane < nLanes; lane++)
+    {
+        DAAL_CHECK_STATUS(s, copyReplicaWeights(laneLayers[0].get(), laneLayers[lane].get()));
+    }
+
+    /* Create the kernels of the layers computed with 8-bit integer inputs and weights,
+       the quantization is not applied while the ranges of the inputs are collected */
+    if (quantizedKernels.size() != nLayers)
+    {
+        quantizedKernels.reset(nLayers);
+        quantizedSources.reset(nLayers);
+        DAAL_CHECK_MALLOC(quantizedKernels.get() && quantizedSources.get())
+    }
+    if (calibrate)
+    {
+        inputRanges.reset(nLayers);
+        DAAL_CHECK_MALLOC(inputRanges.get())
+        for (size_t i = 0; i < nLayers; i++)
+        {
+            inputRanges[i] = (algorithmFPType)model->getLayerQuantization(i).inputRange;
+            quantizedKernels[i].reset();
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < nLayers; i++)
+        {
+            const LayerQuantization quantization = model->getLayerQuantization(i);
+            if (skipLayer[i] || !quantization.enabled || quantization.inputRange <= 0.0)
+            {
+                quantizedKernels[i].reset();
+                continue;
+            }
+            DAAL_CHECK_STATUS(s, createQuantizedKernel(i, model->getLayer(i), quantization));
+        }
+    }
+
+    return Status();
+}
+
+/**
+ *  \brief Groups the layers into levels. The layer is placed to the level next to the levels of all its preceding layers,
+ *          so the layers of one level do not depend on each other and are computed concurrently.
+ *          Without parallel branches each layer forms its own level in the order of the layers in the network
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status NeuralNetworksFeedforwardPredictionKernel<algorithmFPType, method, cpu>::createLevels(
+    const Collection<layers::NextLayers> *nextLayers, bool parallelBranches)
+{
+    TArray<size_t, cpu> levelsArray(nLayers);
+    size_t *levels = levelsArray.get();
+    levelOffsets.reset(nLayers + 1);
+    levelLayers.reset(nLayers);
+    DAAL_CHECK_MALLOC(levels && levelOffsets.get() && levelLayers.get())
+
+    for (size_t i = 0; i < nLayers; i++)
+    {
+        levels[i] = (parallelBranches ? 0 : i);
+    }
+    if (parallelBranches)
+    {
+        for (size_t i = 0; i < nLayers; i++)
+        {
+            const layers::NextLayers &next = nextLayers->get(i);
+            for (size_t j = 0; j < next.size(); j++)
+            {
+                if (levels[next[j]] < levels[i] + 1) { levels[next[j]] = levels[i] + 1; }
+            }
+        }
+    }
+
+    nLevels = 0;
+    for (size_t i = 0; i <= nLayers; i++)
+    {
+        levelOffsets[i] = 0;
+    }
+    for (size_t i = 0; i < nLayers; i++)
+    {
+        levelOffsets[levels[i] + 1]++;
+        if (levels[i] + 1 > nLevels) { nLevels = levels[i] + 1; }
+    }
+    for (size_t l = 0; l < nLevels; l++)
+    {
+        levelOffsets[l + 1] += levelOffsets[l];
+    }
+
+    TArray<size_t, cpu> positionsArray(nLevels);
+    size_t *positions = positionsArray.get();
+    DAAL_CHECK_MALLOC(positions)
+    for (size_t l = 0; l < nLevels; l++)
+    {
+        positions[l] = levelOffsets[l];
+    }
+    for (size_t i = 0; i < nLayers; i++)
+    {
+        levelLayers[positions[levels[i]]++] = i;
+    }
+    return Status();
+}
+
+/**
+ *  \brief Returns the input tensor of the layer that contains the data with certain index,
+ *          the weights and biases are not returned
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+Tensor *NeuralNetworksFeedforwardPredictionKernel<algorithmFPType, method, cpu>::getDataInput(
+    layers::forward::Input *layerInput, size_t index)
+{
+    if (layerInput->getLayout() == layers::tensorInput)
+    {
+        return (index == 0 ? layerInput->get(forward::data).get() : NULL);
+    }
+    layers::LayerDataPtr inputData = layerInput->get(forward::inputLayerData);
+    if (!inputData || index >= inputData->size()) { return NULL; }
+    return staticPointerCast<Tensor, SerializationIface>((*inputData)[index]).get();
+}
+
+/**
+ *  \brief Marks the levels whose layers can be computed concurrently. The layers in the MKL-DNN layout convert
+ *          the layout of their input tensors in place, so the level with the MKL-DNN tensor read by several layers
+ *          is computed sequentially
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status NeuralNetworksFeedforwardPredictionKernel<algorithmFPType, method, cpu>::findParallelLevels(ForwardLayers *forwardLayers)
+{
+    levelParallel.reset(nLevels);
+    DAAL_CHECK_MALLOC(levelParallel.get())
+
+    for (size_t level = 0; level < nLevels; level++)
+    {
+        const size_t begin = levelOffsets[level];
+        const size_t end   = levelOffsets[level + 1];
+        bool isParallel = (end - begin > 1);
+        for (size_t i = begin; i < end && isParallel; i++)
+        {
+            layers::forward::Input *layerInput = forwardLayers->get(levelLayers[i])->getLayerInput();
+            for (size_t k = 0; isParallel; k++)
+            {
+                Tensor *tensor = getDataInput(layerInput, k);
+                if (!tensor) { break; }
+                if (!dynamic_cast<daal::internal::MklTensor<algorithmFPType> *>(tensor)) { continue; }
+
+                for (size_t j = i + 1; j < end && isParallel; j++)
+                {
+                    layers::forward::Input *otherInput = forwardLayers->get(levelLayers[j])->getLayerInput();
+                    for (size_t m = 0; isParallel; m++)
+                    {
+                        Tensor *other = getDataInput(otherInput, m);
+                        if (!other) { break; }
+                        if (other == tensor) { isParallel = false; }
+                    }
+                }
+            }
+        }
+        levelParallel[level] = isParallel;
+    }
+    return Status();
+}
+
+/**
+ *  \brief Copies the weights and biases of the layers of the model to the copies of the layers
+ *          that keep their own tensors
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status NeuralNetworksFeedforwardPredictionKernel<algorithmFPType, method, cpu>::copyReplicaWeights(
+    ForwardLayers *forwardLayers, ForwardLayers *replicaLayers)
+{
+    const forward::InputId learnableIds[] = { forward::weights, forward::biases };
+    for (size_t i = 0; i < nLayers; i++)
+    {
+        layers::forward::Input *layerInput   = forwardLayers->get(i)->getLayerInput();
+        layers::forward::Input *replicaInput = replicaLayers->get(i)->getLayerInput();
+        for (size_t j = 0; j < 2; j++)
+        {
+            Tensor *tensor        = layerInput->get(learnableIds[j]).get();
+            Tensor *replicaTensor = replicaInput->get(learnableIds[j]).get();
+            if (!tensor || !replicaTensor || tensor == replicaTensor) { continue; }
+
+            ReadSubtensor<algorithmFPType, cpu> block(tensor);
+            DAAL_CHECK_BLOCK_STATUS(block)
+            WriteOnlySubtensor<algorithmFPType, cpu> replicaBlock(replicaTensor);
+            DAAL_CHECK_BLOCK_STATUS(replicaBlock)
+
+            const size_t blockSize = block.getSize() * sizeof(algorithmFPType);
+            daal_memcpy_s(replicaBlock.get(), replicaBlock.getSize() * sizeof(algorithmFPType), block.get(), blockSize);
+        }
+    }
+    return Status();
+}
+
+/**
+ *  \brief Creates the kernel that computes the fully-connected or convolution layer with 8-bit integer inputs and weights.
+ *          Layers of other types and the layers with unsupported parameters are computed with floating-point data.
+ *          The kernel created on the previous computation is reused while the layer refers to the same weights
+ *          and biases tensors and the input range does not change, so the weights are not quantized again
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status NeuralNetworksFeedforwardPredictionKernel<algorithmFPType, method, cpu>::createQuantizedKernel(
+    size_t layerId, const layers::forward::LayerIfacePtr &forwardLayer, const LayerQuantization &quantization)
+{
+    Status s;
+    const algorithmFPType inputRange = (algorithmFPType)quantization.inputRange;
+    layers::forward::Input *layerInput = forwardLayer->getLayerInput();
+    TensorPtr weights = layerInput->get(forward::weights);
+    TensorPtr biases  = layerInput->get(forward::biases);
+    Tensor *weightsTensor = weights.get();
+    Tensor *biasesTensor  = biases.get();
+    if (!weightsTensor || !biasesTensor)
+    {
+        quantizedKernels[layerId].reset();
+        return s;
+    }
+
+    QuantizedKernelSource &source = quantizedSources[layerId];
+    const bool isCached = quantizedKernels[layerId].get() && source.weights.get() == weightsTensor &&
+                          source.biases.get() == biasesTensor && source.inputRange == inputRange;
+
+    if (dynamicPointerCast<fullyconnected::forward::Batch<algorithmFPType>, layers::forward::LayerIface>(forwardLayer))
+    {
+        if (isCached) { return s; }
+
+        typedef fullyconnected::forward::internal::QuantizedFullyconnectedKernel<algorithmFPType, cpu> FullyconnectedKernel;
+        const fullyconnected::Parameter *parameter = static_cast<const fullyconnected::Parameter *>(forwardLayer->getLayerParameter());
+
+        quantizedKernels[layerId].reset();
+        UniquePtr<FullyconnectedKernel, cpu> kernel(new FullyconnectedKernel());
+        DAAL_CHECK_MALLOC(kernel.get())
+        DAAL_CHECK_STATUS(s, kernel->initialize(*weightsTensor, *biasesTensor, *parameter, inputRange));
+        quantizedKernels[layerId].reset(kernel.release());
+    }
+    else if (dynamicPointerCast<convolution2d::forward::Batch<algorithmFPType>, layers::forward::LayerIface>(forwardLayer))
+    {
+        typedef convolution2d::forward::internal::QuantizedConvolution2dKernel<algorithmFPType, cpu> Convolution2dKernel;
+        const convolution2d::Parameter *parameter = static_cast<const convolution2d::Parameter *>(forwardLayer->getLayerParameter());
+        Tensor *dataTensor = layerInput->get(forward::data).get();
+        if (!dataTensor || !Convolution2dKernel::isSupported(*dataTensor, *parameter))
+        {
+            quantizedKernels[layerId].reset();
+            return s;
+        }
+        if (isCached) { return s; }
+
+        quantizedKernels[layerId].reset();
+        UniquePtr<Convolution2dKernel, cpu> kernel(new Convolution2dKernel());
+        DAAL_CHECK_MALLOC(kernel.get())
+        DAAL_CHECK_STATUS(s, kernel->initialize(*weightsTensor, *biasesTensor, *parameter, inputRange));
+        quantizedKernels[layerId].reset(kernel.release());
+    }
+    else
+    {
+        return s;
+    }
+
+    source.weights    = weights;
+    source.biases     = biases;
+    source.inputRange = inputRange;
+    return s;
+}
+
+/**
+ *  \brief Updates the maximal absolute value of the input of the fully-connected or convolution layer
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status NeuralNetworksFeedforwardPredictionKernel<algorithmFPType, method, cpu>::updateInputRange(
+    size_t layerId, const layers::forward::LayerIfacePtr &forwardLayer)
+{
+    if (!dynamicPointerCast<fullyconnected::forward::Batch<algorithmFPType>, layers::forward::LayerIface>(forwardLayer) &&
+        !dynamicPointerCast<convolution2d::forward::Batch<algorithmFPType>, layers::forward::LayerIface>(forwardLayer))
+    {
+        return Status();
+    }
+
+    Tensor *dataTensor = forwardLayer->getLayerInput()->get(forward::data).get();
+    DAAL_CHECK_EX(dataTensor, ErrorNullTensor, ArgumentName, dataStr());
+
+    ReadSubtensor<algorithmFPType, cpu> dataBlock(dataTensor);
+    DAAL_CHECK_BLOCK_STATUS(dataBlock)
+
+    const algorithmFPType maxAbs = layers::internal::computeMaxAbs<algorithmFPType, cpu>(dataBlock.getSize(), dataBlock.get());
+    if (maxAbs > inputRanges[layerId]) { inputRanges[layerId] = maxAbs; }
+    return Status();
+}
+
+/**
+ *  \brief Computes the weights and biases of the layer followed by the batch normalization layer:
+ *          W'[k] = W[k] * gamma[k] / sqrt(variance[k] + epsilon),
+ *          b'[k] = (b[k] - mean[k]) * gamma[k] / sqrt(variance[k] + epsilon) + beta[k]
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status NeuralNetworksFeedforwardPredictionKernel<algorithmFPType, method, cpu>::foldBatchNormalization(
+    ForwardLayers *forwardLayers, const FusedLayers &fused)
+{
+    layers::forward::LayerIfacePtr normalization = forwardLayers->get(fused.normalizationIndex);
+    batch_normalization::forward::Input *normalizationInput =
+        static_cast<batch_normalization::forward::Input *>(normalization->getLayerInput());
+    const batch_normalization::Parameter *parameter =
+        static_cast<const batch_normalization::Parameter *>(normalization->getLayerParameter());
+
+    Tensor *gammaTensor    = normalizationInput->get(forward::weights).get();
+    Tensor *betaTensor     = normalizationInput->get(forward::biases).get();
+    Tensor *meanTensor     = normalizationInput->get(batch_normalization::forward::populationMean).get();
+    Tensor *varianceTensor = normalizationInput->get(batch_normalization::forward::populationVariance).get();
+    DAAL_CHECK_EX(gammaTensor,    ErrorNullTensor, ArgumentName, weightsStr());
+    DAAL_CHECK_EX(betaTensor,     ErrorNullTensor, ArgumentName, biasesStr());
+    DAAL_CHECK_EX(meanTensor,     ErrorNullTensor, ArgumentName, populationMeanStr());
+    DAAL_CHECK_EX(varianceTensor, ErrorNullTensor, ArgumentName, populationVarianceStr());
+
+    layers::forward::Input *layerInput = forwardLayers->get(fused.layerIndex)->getLayerInput();
+    Tensor *foldedWeightsTensor = layerInput->get(forward::weights).get();
+    Tensor *foldedBiasesTensor  = layerInput->get(forward::biases).get();
+
+    const size_t nOutputs = fused.biases->getSize();
+    DAAL_CHECK_EX(gammaTensor->getSize() == nOutputs, ErrorIncorrectSizeOfDimensionInTensor, ArgumentName, weightsStr());
+    const size_t nWeightsPerOutput = fused.weights->getSize() / nOutputs;
+
+    ReadSubtensor<algorithmFPType, cpu> gammaBlock(gammaTensor);
+    DAAL_CHECK_BLOCK_STATUS(gammaBlock)
+    ReadSubtensor<algorithmFPType, cpu> betaBlock(betaTensor);
+    DAAL_CHECK_BLOCK_STATUS(betaBlock)
+    ReadSubtensor<algorithmFPType, cpu> meanBlock(meanTensor);
+    DAAL_CHECK_BLOCK_STATUS(meanBlock)
+    ReadSubtensor<algorithmFPType, cpu> varianceBlock(varianceTensor);
+    DAAL_CHECK_BLOCK_STATUS(varianceBlock)
+    ReadSubtensor<algorithmFPType, cpu> weightsBlock(fused.weights.get());
+    DAAL_CHECK_BLOCK_STATUS(weightsBlock)
+    ReadSubtensor<algorithmFPType, cpu> biasesBlock(fused.biases.get());
+    DAAL_CHECK_BLOCK_STATUS(biasesBlock)
+    WriteOnlySubtensor<algorithmFPType, cpu> foldedWeightsBlock(foldedWeightsTensor);
+    DAAL_CHECK_BLOCK_STATUS(foldedWeightsBlock)
+    WriteOnlySubtensor<algorithmFPType, cpu> foldedBiasesBlock(foldedBiasesTensor);
+    DAAL_CHECK_BLOCK_STATUS(foldedBiasesBlock)
+
+    const algorithmFPType *gamma    = gammaBlock.get();
+    const algorithmFPType *beta     = betaBlock.get();
+    const algorithmFPType *mean     = meanBlock.get();
+    const algorithmFPType *variance = varianceBlock.get();
+    const algorithmFPType *weights  = weightsBlock.get();
+    const algorithmFPType *biases   = biasesBlock.get();
+    algorithmFPType *foldedWeights  = foldedWeightsBlock.get();
+    algorithmFPType *foldedBiases   = foldedBiasesBlock.get();
+
+    TArray<algorithmFPType, cpu> scaleBuffer(nOutputs);
+    algorithmFPType *scale = scaleBuffer.get();
+    DAAL_CHECK_MALLOC(scale)
+
+    const algorithmFPType epsilon = (algorithmFPType)parameter->epsilon;
+    for (size_t k = 0; k < nOutputs; k++)
+    {
+        scale[k] = variance[k] + epsilon;
+    }
+    daal::internal::Math<algorithmFPType, cpu>::vSqrt(nOutputs, scale, scale);
+
+    for (size_t k = 0; k < nOutputs; k++)
+    {
+        scale[k] = gamma[k] / scale[k];
+        foldedBiases[k] = (biases[k] - mean[k]) * scale[k] + beta[k];
+
+        const algorithmFPType *w = weights + k * nWeightsPerOutput;
+        algorithmFPType *foldedW = foldedWeights + k * nWeightsPerOutput;
+       PRAGMA_IVDEP
+       PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nWeightsPerOutput; j++)
+        {
+            foldedW[j] = w[j] * scale[k];
+        }
+    }
     return Status();
 }
 
@@ -103,64 +519,162 @@ template<typename algorithmFPType, Method method, CpuType cpu>
 Status NeuralNetworksFeedforwardPredictionKernel<algorithmFPType, method, cpu>::compute(const Input *input, Result *result)
 {
     Status s;
-    ForwardLayersPtr forwardLayers = input->get(prediction::model)->getLayers();
     TensorPtr data = input->get(prediction::data);
     if (nSamples < batchSize) { return s; }
 
-    forwardLayers->get(0)->getLayerInput()->set(forward::data, sample);
+    for (size_t lane = 0; lane < nLanes; lane++)
+    {
+        ForwardLayers *forwardLayers = laneLayers[lane].get();
+        forwardLayers->get(0)->getLayerInput()->set(forward::data, samples[lane]);
 
-    /* Buffer that manages reading memory operations for the input data tensor */
-    ReadSubtensor<algorithmFPType, cpu> sampleSubtensor(data.get(), 0, 0, 0, 0);
+        for (size_t i = 0; i < nLastLayers; i++)
+        {
+            TensorPtr valueTensor = forwardLayers->get(lastLayersIndices->layerIndex(i))->getLayerResult()->get(forward::value);
+            lastLayerResults[lane * nLastLayers + i].set(*valueTensor, 0, 0, 0, 0);
+        }
+
+        /* Initialize buffers to manage writing memory operations for the prediction results */
+        for (size_t i = 0; i < nLastLayers; i++)
+        {
+            TensorPtr predictionTensor = result->get(prediction::predictionCollection, lastLayersIndices->tensorIndex(i));
+            predictions[lane * nLastLayers + i].set(*predictionTensor, 0, 0, 0, 0);
+        }
+    }
 
-    for (size_t i = 0; i < nLastLayers; i++)
+    if (nLanes == 1)
+    {
+        DAAL_CHECK_STATUS(s, computeBatches(0, data.get()));
+    }
+    else
     {
-        TensorPtr valueTensor = forwardLayers->get(lastLayersIndices->layerIndex(i))->getLayerResult()->get(forward::value);
-        lastLayerResults[i].set(*valueTensor, 0, 0, 0, 0);
+        /* Copies of the layers compute different batches at the same time */
+        SafeStatus safeStat;
+        daal::threader_for(nLanes, nLanes, [&](size_t lane)
+        {
+            safeStat |= computeBatches(lane, data.get());
+        });
+        DAAL_CHECK_SAFE_STATUS();
     }
 
-    /* Initialize buffers to manage writing memory operations for the prediction results */
-    for (size_t i = 0; i < nLastLayers; i++)
+    /* Accumulate the collected ranges of the layer inputs in the model */
+    if (calibrate)
     {
-        TensorPtr predictionTensor = result->get(prediction::predictionCollection, lastLayersIndices->tensorIndex(i));
-        predictions[i].set(*predictionTensor, 0, 0, 0, 0);
+        ModelPtr model = input->get(prediction::model);
+        for (size_t layerId = 0; layerId < nLayers; layerId++)
+        {
+            LayerQuantization quantization = model->getLayerQuantization(layerId);
+            quantization.inputRange = (double)inputRanges[layerId];
+            model->setLayerQuantization(layerId, quantization);
+        }
     }
+    return s;
+}
+
+/**
+ *  \brief Computes every nLanes-th batch of the input starting from the batch with index lane
+ *          using the copy of the layers with the same index
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status NeuralNetworksFeedforwardPredictionKernel<algorithmFPType, method, cpu>::computeBatches(size_t lane, Tensor *data)
+{
+    Status s;
+    ForwardLayers *forwardLayers = laneLayers[lane].get();
+    ReadSubtensor<algorithmFPType, cpu> *laneResults = lastLayerResults.get() + lane * nLastLayers;
+    WriteOnlySubtensor<algorithmFPType, cpu> *lanePredictions = predictions.get() + lane * nLastLayers;
 
-    for(size_t i = 0; i < nSamples - batchSize + 1; i += batchSize)
+    /* Buffer that manages reading memory operations for the input data tensor */
+    ReadSubtensor<algorithmFPType, cpu> sampleSubtensor(data, 0, 0, 0, 0);
+
+    for(size_t i = lane * batchSize; i < nSamples - batchSize + 1; i += nLanes * batchSize)
     {
         /* Retrieve next batch of input data and pass it to the first layer */
         const algorithmFPType *sampleArray = sampleSubtensor.next(0, 0, i, batchSize);
         DAAL_CHECK_BLOCK_STATUS(sampleSubtensor)
-        sample->setArray(const_cast<algorithmFPType *>(sampleArray));
+        samples[lane]->setArray(const_cast<algorithmFPType *>(sampleArray));
 
         /* Forward pass through the neural network */
-        for(size_t layerId = 0; layerId < nLayers; layerId++)
-        {
-            layers::forward::LayerIfacePtr forwardLayer = forwardLayers->get(layerId);
-            DAAL_CHECK_STATUS(s, processLayerErrors(layerId, forwardLayer->computeNoThrow()))
-        }
+        DAAL_CHECK_STATUS(s, computeLayers(forwardLayers));
 
         /* Copy results from the last layers into the user provided memory */
         for (size_t j = 0; j < nLastLayers; j++)
         {
-            const algorithmFPType *lastLayerResultArray = lastLayerResults[j].next(0, 0, 0, batchSize);
-            DAAL_CHECK_BLOCK_STATUS(lastLayerResults[j])
-            algorithmFPType *predictionArray = predictions[j].next(0, 0, i, batchSize);
-            DAAL_CHECK_BLOCK_STATUS(predictions[j])
+            const algorithmFPType *lastLayerResultArray = laneResults[j].next(0, 0, 0, batchSize);
+            DAAL_CHECK_BLOCK_STATUS(laneResults[j])
+            algorithmFPType *predictionArray = lanePredictions[j].next(0, 0, i, batchSize);
+            DAAL_CHECK_BLOCK_STATUS(lanePredictions[j])
 
-            size_t blockSize = lastLayerResults[j].getSize() * sizeof(algorithmFPType);
+            size_t blockSize = laneResults[j].getSize() * sizeof(algorithmFPType);
             daal_memcpy_s(predictionArray, blockSize, lastLayerResultArray, blockSize);
         }
     }
     return s;
 }
 
+/**
+ *  \brief Forward pass through the layers level by level
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status NeuralNetworksFeedforwardPredictionKernel<algorithmFPType, method, cpu>::computeLayers(ForwardLayers *forwardLayers)
+{
+    Status s;
+    for (size_t level = 0; level < nLevels; level++)
+    {
+        const size_t begin = levelOffsets[level];
+        const size_t nLevelLayers = levelOffsets[level + 1] - begin;
+        if (!levelParallel[level])
+        {
+            for (size_t i = 0; i < nLevelLayers; i++)
+            {
+                const size_t layerId = levelLayers[begin + i];
+                DAAL_CHECK_STATUS(s, computeLayer(layerId, forwardLayers->get(layerId)));
+            }
+            continue;
+        }
+
+        SafeStatus safeStat;
+        daal::threader_for(nLevelLayers, nLevelLayers, [&](size_t i)
+        {
+            const size_t layerId = levelLayers[begin + i];
+            safeStat |= computeLayer(layerId, forwardLayers->get(layerId));
+        });
+        DAAL_CHECK_SAFE_STATUS();
+    }
+    return s;
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status NeuralNetworksFeedforwardPredictionKernel<algorithmFPType, method, cpu>::computeLayer(
+    size_t layerId, const layers::forward::LayerIfacePtr &forwardLayer)
+{
+    Status s;
+    if (skipLayer[layerId]) { return s; }
+    if (calibrate)
+    {
+        DAAL_CHECK_STATUS(s, updateInputRange(layerId, forwardLayer));
+    }
+    if (quantizedKernels[layerId].get())
+    {
+        layers::forward::Input *layerInput = forwardLayer->getLayerInput();
+        layers::forward::Result *layerResult = forwardLayer->getLayerResult().get();
+        return processLayerErrors(layerId, quantizedKernels[layerId]->compute(
+            *layerInput->get(forward::data), *layerResult->get(forward::value)));
+    }
+    return processLayerErrors(layerId, forwardLayer->computeNoThrow());
+}
+
 template<typename algorithmFPType, Method method, CpuType cpu>
 Status NeuralNetworksFeedforwardPredictionKernel<algorithmFPType, method, cpu>::reset()
 {
     lastLayersIndices.reset();
     lastLayerResults.reset(0);
     predictions.reset(0);
-    sample.reset();
+    skipLayer.reset(0);
+    inputRanges.reset(0);
+    levelOffsets.reset(0);
+    levelLayers.reset(0);
+    levelParallel.reset(0);
+    laneLayers.reset(0);
+    samples.reset(0);
     return Status();
 }
 
@@ -55,6 +55,8 @@
 #include "service_tensor.h"
 #include "service_numeric_table.h"
 #include "neural_networks_feedforward.h"
+#include "neural_networks/neural_networks_prediction_model.h"
+#include "layers_quantization.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -84,14 +86,49 @@ public:
     services::Status reset();
 
 private:
+    services::Status foldBatchNormalization(ForwardLayers *forwardLayers, const FusedLayers &fused);
+    services::Status createQuantizedKernel(size_t layerId, const layers::forward::LayerIfacePtr &forwardLayer, const LayerQuantization &quantization);
+    services::Status updateInputRange(size_t layerId, const layers::forward::LayerIfacePtr &forwardLayer);
+    services::Status createLevels(const Collection<layers::NextLayers> *nextLayers, bool parallelBranches);
+    services::Status findParallelLevels(ForwardLayers *forwardLayers);
+    static Tensor *getDataInput(layers::forward::Input *layerInput, size_t index);
+    services::Status copyReplicaWeights(ForwardLayers *forwardLayers, ForwardLayers *replicaLayers);
+    services::Status computeBatches(size_t lane, Tensor *data);
+    services::Status computeLayers(ForwardLayers *forwardLayers);
+    services::Status computeLayer(size_t layerId, const layers::forward::LayerIfacePtr &forwardLayer);
+
+    typedef layers::internal::QuantizedLayerKernel<algorithmFPType, cpu> QuantizedKernel;
+
+    /* Weights, biases and input range the kernel of the layer computed with 8-bit integers was created for */
+    struct QuantizedKernelSource
+    {
+        QuantizedKernelSource() : inputRange(0) {}
+
+        TensorPtr weights;
+        TensorPtr biases;
+        algorithmFPType inputRange;
+    };
+
     size_t nLastLayers;
     size_t nLayers;
     size_t nSamples;
     size_t batchSize;
+    size_t nLanes;  /* Number of the copies of the layers that compute the batches concurrently */
+    size_t nLevels; /* Number of the groups of the layers that are computed one after another */
     UniquePtr<LastLayerIndices, cpu> lastLayersIndices;
-    SharedPtr<HomogenTensor<algorithmFPType> > sample;
+    TArray<ForwardLayersPtr, cpu> laneLayers;
+    TArray<SharedPtr<HomogenTensor<algorithmFPType> >, cpu> samples;
     TArray<ReadSubtensor<algorithmFPType, cpu>, cpu> lastLayerResults;
     TArray<WriteOnlySubtensor<algorithmFPType, cpu>, cpu> predictions;
+    TArray<size_t, cpu> levelOffsets; /* Offsets of the groups of the layers in levelLayers */
+    TArray<size_t, cpu> levelLayers;  /* Indices of the layers ordered by the groups, the layers of one group do not depend on each other */
+    TArray<bool, cpu> levelParallel;  /* Flags of the groups whose layers are computed concurrently */
+    TArray<bool, cpu> skipLayer; /* Flags of the layers folded into the preceding layers */
+    TArray<UniquePtr<QuantizedKernel, cpu>, cpu> quantizedKernels; /* Kernels of the layers computed with 8-bit integers,
+                                                                      kept between the computations */
+    TArray<QuantizedKernelSource, cpu> quantizedSources;
+    TArray<algorithmFPType, cpu> inputRanges; /* Maximal absolute values of the layer inputs collected on calibration */
+    bool calibrate;
 };
 
 } // namespace daal::internal
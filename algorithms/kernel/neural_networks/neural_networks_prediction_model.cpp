@@ -57,7 +57,7 @@ namespace prediction
 {
 
 /** Default constructor */
-Model::Model() : ModelImpl(), _allocatedBatchSize(0) { }
+Model::Model() : ModelImpl(), _allocatedBatchSize(0), _allocatedReuseLayerResults(false), _allocatedFuseLayers(false) { }
 
 /**
  * Constructs model object for the prediction stage of neural network
@@ -68,14 +68,14 @@ Model::Model() : ModelImpl(), _allocatedBatchSize(0) { }
  */
 Model::Model(const neural_networks::ForwardLayersPtr &forwardLayersForModel,
              const services::SharedPtr<services::Collection<layers::NextLayers> > &nextLayersForModel) :
-    ModelImpl(forwardLayersForModel, nextLayersForModel), _allocatedBatchSize(0) { }
+    ModelImpl(forwardLayersForModel, nextLayersForModel), _allocatedBatchSize(0), _allocatedReuseLayerResults(false), _allocatedFuseLayers(false) { }
 
 /**
  * Constructs model object for the prediction stage of neural network from a collection of layer descriptors
  * \param[in] topology  Collection of layer descriptors of every inserted layer
  * \DAAL_DEPRECATED_USE{ Model::create }
  */
-Model::Model(const prediction::Topology &topology) : ModelImpl(), _allocatedBatchSize(0)
+Model::Model(const prediction::Topology &topology) : ModelImpl(), _allocatedBatchSize(0), _allocatedReuseLayerResults(false), _allocatedFuseLayers(false)
 {
     for(size_t i = 0; i < topology.size(); i++)
     {
@@ -84,18 +84,21 @@ Model::Model(const prediction::Topology &topology) : ModelImpl(), _allocatedBatc
 }
 
 /** Copy constructor */
-Model::Model(const Model &model) : ModelImpl(model), _allocatedBatchSize(model._allocatedBatchSize) { }
+Model::Model(const Model &model) :
+    ModelImpl(model), _allocatedBatchSize(model._allocatedBatchSize),
+    _allocatedReuseLayerResults(model._allocatedReuseLayerResults), _allocatedFuseLayers(model._allocatedFuseLayers), _fusedLayers(model._fusedLayers),
+    _quantization(model._quantization) { }
 
 
-Model::Model(services::Status &st) : ModelImpl(st), _allocatedBatchSize(0) { }
+Model::Model(services::Status &st) : ModelImpl(st), _allocatedBatchSize(0), _allocatedReuseLayerResults(false), _allocatedFuseLayers(false) { }
 
 Model::Model(const neural_networks::ForwardLayersPtr &forwardLayersForModel,
              const services::SharedPtr<services::Collection<layers::NextLayers> > &nextLayersForModel,
              services::Status &st) :
-    ModelImpl(forwardLayersForModel, nextLayersForModel, st), _allocatedBatchSize(0) { }
+    ModelImpl(forwardLayersForModel, nextLayersForModel, st), _allocatedBatchSize(0), _allocatedReuseLayerResults(false), _allocatedFuseLayers(false) { }
 
 Model::Model(const prediction::Topology &topology, services::Status &st) :
-    ModelImpl(st), _allocatedBatchSize(0)
+    ModelImpl(st), _allocatedBatchSize(0), _allocatedReuseLayerResults(false), _allocatedFuseLayers(false)
 {
     for(size_t i = 0; i < topology.size(); i++)
     {
@@ -46,6 +46,12 @@
 */
 
 #include "neural_networks_prediction_model.h"
+#include "neural_networks_memory_planner.h"
+#include "convolution2d/convolution2d_layer_forward.h"
+#include "fullyconnected/fullyconnected_layer_forward.h"
+#include "batch_normalization/batch_normalization_layer_forward.h"
+#include "daal_strings.h"
+#include "service_mkl_tensor.h"
 
 namespace daal
 {
@@ -72,7 +78,7 @@ template<typename modelFPType>
 DAAL_EXPORT Model::Model(const neural_networks::ForwardLayersPtr &forwardLayersForModel,
                          const services::SharedPtr<services::Collection<layers::NextLayers> > &nextLayersForModel,
                          modelFPType dummy, bool storeWeightsInTable) :
-    ModelImpl(forwardLayersForModel, nextLayersForModel, storeWeightsInTable), _allocatedBatchSize(0)
+    ModelImpl(forwardLayersForModel, nextLayersForModel, storeWeightsInTable), _allocatedBatchSize(0), _allocatedReuseLayerResults(false), _allocatedFuseLayers(false)
 {
     bool checkWeightsAndBiasesAlloc = false;
     createWeightsAndBiases<modelFPType>(checkWeightsAndBiasesAlloc);
@@ -82,7 +88,7 @@ template<typename modelFPType>
 DAAL_EXPORT Model::Model(const neural_networks::ForwardLayersPtr &forwardLayersForModel,
                          const services::SharedPtr<services::Collection<layers::NextLayers> > &nextLayersForModel,
                          modelFPType dummy, bool storeWeightsInTable, services::Status &st) :
-    ModelImpl(forwardLayersForModel, nextLayersForModel, storeWeightsInTable, st), _allocatedBatchSize(0)
+    ModelImpl(forwardLayersForModel, nextLayersForModel, storeWeightsInTable, st), _allocatedBatchSize(0), _allocatedReuseLayerResults(false), _allocatedFuseLayers(false)
 {
     bool checkWeightsAndBiasesAlloc = false;
     st |= createWeightsAndBiases<modelFPType>(checkWeightsAndBiasesAlloc);
@@ -107,6 +113,153 @@ DAAL_EXPORT ModelPtr Model::create(const neural_networks::ForwardLayersPtr &forw
     DAAL_DEFAULT_CREATE_IMPL_EX(Model, forwardLayersForModel, nextLayersForModel, (modelFPType)0.0, storeWeightsInTable);
 }
 
+template<typename modelFPType>
+DAAL_EXPORT services::Status Model::planLayerResults()
+{
+    internal::ActivationMemoryPlanner<modelFPType> planner(*_forwardLayers, *_nextLayers, _fusedLayers);
+    return planner.run();
+}
+
+template<typename modelFPType>
+DAAL_EXPORT services::Status Model::fuseLayers()
+{
+    using namespace services;
+    using namespace layers;
+
+    const size_t nLayers = _forwardLayers->size();
+    for (size_t i = 0; i < nLayers; i++)
+    {
+        /* The result of the layer is read by the batch normalization layer only */
+        const NextLayers &next = _nextLayers->get(i);
+        if (next.size() != 1) { continue; }
+
+        forward::LayerIfacePtr layer = _forwardLayers->get(i);
+        const bool hasWeightsPerOutput =
+            dynamicPointerCast<convolution2d::forward::Batch<modelFPType>,  forward::LayerIface>(layer).get() ||
+            dynamicPointerCast<fullyconnected::forward::Batch<modelFPType>, forward::LayerIface>(layer).get();
+        if (!hasWeightsPerOutput) { continue; }
+
+        SharedPtr<batch_normalization::forward::Batch<modelFPType> > normalization =
+            dynamicPointerCast<batch_normalization::forward::Batch<modelFPType>, forward::LayerIface>(_forwardLayers->get(next[0]));
+
+        /* Outputs of the convolution and fully-connected layers are stored along the dimension 1 */
+        if (!normalization || normalization->parameter.dimension != 1) { continue; }
+
+        _fusedLayers.push_back(FusedLayers(i, next[0]));
+    }
+    return services::Status();
+}
+
+template<typename modelFPType>
+DAAL_EXPORT services::Status Model::createFusedWeightsAndBiases()
+{
+    using namespace data_management;
+    using namespace layers;
+
+    services::Status s;
+    for (size_t i = 0; i < _fusedLayers.size(); i++)
+    {
+        FusedLayers &fused = _fusedLayers[i];
+        if (fused.weights) { continue; }
+
+        forward::Input *input = _forwardLayers->get(fused.layerIndex)->getLayerInput();
+        fused.weights = input->get(forward::weights);
+        fused.biases  = input->get(forward::biases);
+        DAAL_CHECK_EX(fused.weights, services::ErrorNullTensor, services::ArgumentName, weightsStr());
+        DAAL_CHECK_EX(fused.biases,  services::ErrorNullTensor, services::ArgumentName, biasesStr());
+
+        /* Model keeps the original weights and biases, the layer computes with their folded copies.
+           Convolution keeps the folded copies in the MKL-DNN layout between the batches */
+        TensorPtr weights, biases;
+        if (services::dynamicPointerCast<convolution2d::forward::Batch<modelFPType>, forward::LayerIface>(_forwardLayers->get(fused.layerIndex)))
+        {
+            weights.reset(new daal::internal::MklTensor<modelFPType>(fused.weights->getDimensions(), Tensor::doAllocate));
+            biases.reset(new daal::internal::MklTensor<modelFPType>(fused.biases->getDimensions(), Tensor::doAllocate));
+            DAAL_CHECK_MALLOC(weights && biases);
+        }
+        else
+        {
+            weights = HomogenTensor<modelFPType>::create(fused.weights->getDimensions(), Tensor::doAllocate, &s);
+            DAAL_CHECK_STATUS_VAR(s);
+            biases = HomogenTensor<modelFPType>::create(fused.biases->getDimensions(), Tensor::doAllocate, &s);
+            DAAL_CHECK_STATUS_VAR(s);
+        }
+
+        input->set(forward::weights, weights);
+        input->set(forward::biases,  biases);
+    }
+    return s;
+}
+
+template<typename modelFPType>
+DAAL_EXPORT services::Status Model::createReplicas(size_t nReplicas)
+{
+    using namespace services;
+    using namespace data_management;
+    using namespace layers;
+
+    services::Status s;
+    _replicas.clear();
+
+    const size_t nLayers = _forwardLayers->size();
+    const Collection<size_t> &sampleSize = _forwardLayers->get(0)->getLayerInput()->get(forward::data)->getDimensions();
+
+    for (size_t r = 0; r < nReplicas; r++)
+    {
+        /* Copies of the layers refer to the same weights and biases as the layers of the model */
+        ForwardLayersPtr replica(new ForwardLayers());
+        DAAL_CHECK_MALLOC(replica);
+        for (size_t i = 0; i < nLayers; i++)
+        {
+            forward::LayerIfacePtr layer = _forwardLayers->get(i)->clone();
+            DAAL_CHECK_MALLOC(layer);
+            forward::Input *input = layer->getLayerInput();
+            input->eraseInputData();
+
+            /* Tensors in the MKL-DNN layout change their layout on access, so each copy keeps its own tensors of this kind.
+               Their values are copied from the layers of the model by the prediction kernel */
+            const forward::InputId learnableIds[] = { forward::weights, forward::biases };
+            for (size_t j = 0; j < 2; j++)
+            {
+                TensorPtr tensor = input->get(learnableIds[j]);
+                if (!dynamicPointerCast<daal::internal::MklTensor<modelFPType>, Tensor>(tensor)) { continue; }
+
+                TensorPtr copy(new daal::internal::MklTensor<modelFPType>(tensor->getDimensions(), Tensor::doAllocate));
+                DAAL_CHECK_MALLOC(copy);
+                input->set(learnableIds[j], copy);
+            }
+            replica->push_back(layer);
+        }
+
+        replica->get(0)->getLayerInput()->set(forward::data, HomogenTensor<modelFPType>::create(sampleSize, Tensor::doAllocate, &s));
+        DAAL_CHECK_STATUS_VAR(s);
+
+        for (size_t i = 0; i < nLayers; i++)
+        {
+            forward::LayerIfacePtr layer = replica->get(i);
+            for (size_t j = 0; j < _fusedLayers.size(); j++)
+            {
+                if (_fusedLayers[j].normalizationIndex != i) { continue; }
+                forward::ResultPtr fusedResult = replica->get(_fusedLayers[j].layerIndex)->getLayerResult();
+                layer->getLayerResult()->set(forward::value, fusedResult->get(forward::value));
+            }
+
+            s |= layer->allocateResult();
+            forward::ResultPtr layerResult = layer->getLayerResult();
+            const NextLayers &next = _nextLayers->get(i);
+            for (size_t j = 0; j < next.size(); j++)
+            {
+                s |= replica->get(next[j])->addInput(layerResult, j, 0);
+            }
+            layer->enableResetOnCompute(false);
+        }
+        DAAL_CHECK_STATUS_VAR(s);
+
+        _replicas.push_back(replica);
+    }
+    return s;
+}
+
 template DAAL_EXPORT Model::Model(const neural_networks::ForwardLayersPtr &,
                                   const services::SharedPtr<services::Collection<layers::NextLayers> >&,
                                   DAAL_FPTYPE, bool);
@@ -119,6 +272,11 @@ template DAAL_EXPORT ModelPtr Model::create<DAAL_FPTYPE>(const neural_networks::
                                                          const services::SharedPtr<services::Collection<layers::NextLayers> >&,
                                                          bool, services::Status*);
 
+template DAAL_EXPORT services::Status Model::planLayerResults<DAAL_FPTYPE>();
+template DAAL_EXPORT services::Status Model::fuseLayers<DAAL_FPTYPE>();
+template DAAL_EXPORT services::Status Model::createFusedWeightsAndBiases<DAAL_FPTYPE>();
+template DAAL_EXPORT services::Status Model::createReplicas<DAAL_FPTYPE>(size_t);
+
 } // namespace prediction
 } // namespace neural_networks
 } // namespace algorithms
@@ -106,7 +106,8 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::setupCompute()
     KeyValueDataCollectionPtr groundTruthCollectionPtr = input->get(training::groundTruthCollection);
 
     __DAAL_CALL_KERNEL(env, internal::TrainingKernelBatch,
-        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), initialize, data, nnModel, groundTruthCollectionPtr, parameter);
+        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), initialize, data, nnModel, groundTruthCollectionPtr, parameter,
+        input->get(training::batchProvider).get());
 }
 
 template<typename algorithmFPType, Method method, CpuType cpu>
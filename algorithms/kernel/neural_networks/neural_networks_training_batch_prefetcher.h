@@ -0,0 +1,406 @@
+/* file: neural_networks_training_batch_prefetcher.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+//++
+//  Declaration and implementation of the prefetching of training batches from the batch provider.
+//--
+
+
+#ifndef __NEURAL_NETWORKS_TRAINING_BATCH_PREFETCHER_H__
+#define __NEURAL_NETWORKS_TRAINING_BATCH_PREFETCHER_H__
+
+#include "neural_networks/neural_networks_training_batch_provider.h"
+#include "data_management/data/homogen_tensor.h"
+#include "engine_batch_impl.h"
+#include "service_rng.h"
+#include "service_memory.h"
+#include "service_numeric_table.h"
+#include "service_threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace neural_networks
+{
+namespace training
+{
+namespace internal
+{
+
+using namespace daal::data_management;
+using namespace daal::services;
+using namespace daal::internal;
+
+/**
+ * \brief Ring of training batches filled from the batch provider by a background task.
+ *        The consumer holds at most one slot, the slots that follow it are filled by the producer.
+ *        The producer runs while there are free slots, and it is restarted by the consumer after every taken batch,
+ *        so only one task calls the batch provider at a time.
+ *
+ *        If shuffling is enabled, the producer loads a window of several batches from the provider,
+ *        permutes its samples and gathers the batches from the window in the permuted order.
+ *
+ *        The producer is a task of the same task scheduler that runs the computations of the layers,
+ *        so it occupies one of the compute threads while it loads. The loading overlaps the training
+ *        only if a worker thread is free to take the task. With one thread, or with the sequential
+ *        threading layer, the producer runs inside next() and the loading is not overlapped
+ */
+template<typename algorithmFPType, CpuType cpu>
+class BatchPrefetcher
+{
+public:
+    typedef SharedPtr<HomogenTensor<algorithmFPType> > HomogenTensorPtr;
+
+    BatchPrefetcher() : _provider(NULL), _engine(NULL), _batchSize(0), _nSlots(0), _windowSize(0),
+        _nWindowSamples(0), _windowPosition(0), _first(0), _nFilled(0), _current(0),
+        _isEndOfData(false), _isProducerRunning(false)
+    {}
+
+    ~BatchPrefetcher()
+    {
+        stop();
+    }
+
+    /**
+     * Allocates the batches and starts loading them in the background
+     * \param[in] provider          Provider of the training samples
+     * \param[in] batchSize         Number of samples in the batch
+     * \param[in] nSlots            Number of batches in the ring
+     * \param[in] shuffleBufferSize Number of samples shuffled together, 0 if the samples are not shuffled
+     * \param[in] engine            Engine used to shuffle the samples
+     */
+    Status initialize(BatchProvider *provider, size_t batchSize, size_t nSlots, size_t shuffleBufferSize, engines::BatchBase *engine)
+    {
+        DAAL_CHECK(provider && batchSize, ErrorIncorrectParameter);
+        _provider  = provider;
+        _batchSize = batchSize;
+        _nSlots    = (nSlots < 2 ? 2 : nSlots);
+        _current   = _nSlots;
+
+        Status s;
+        _data.reset(_nSlots);
+        _groundTruth.reset(_nSlots);
+        DAAL_CHECK_MALLOC(_data.get() && _groundTruth.get());
+        for (size_t i = 0; i < _nSlots; i++)
+        {
+            DAAL_CHECK_STATUS(s, createTensors(_batchSize, _data[i], _groundTruth[i]));
+        }
+
+        if (shuffleBufferSize)
+        {
+            _engine = dynamic_cast<engines::internal::BatchBaseImpl *>(engine);
+            DAAL_CHECK(_engine, ErrorIncorrectEngineParameter);
+
+            _windowSize = ((shuffleBufferSize + _batchSize - 1) / _batchSize) * _batchSize;
+            DAAL_CHECK_STATUS(s, createTensors(_windowSize, _windowData, _windowGroundTruth));
+            _permutation.reset(_windowSize);
+            DAAL_CHECK_MALLOC(_permutation.get());
+        }
+
+        startProducer();
+        return s;
+    }
+
+    /**
+     * Returns the tensor of the training data of the batch in the slot
+     */
+    HomogenTensor<algorithmFPType> *getData(size_t slot) const { return _data[slot].get(); }
+
+    /**
+     * Returns the collection of the ground-truth tensors of the batch in the slot
+     */
+    const KeyValueDataCollectionPtr &getGroundTruth(size_t slot) const { return _groundTruth[slot]; }
+
+    /**
+     * Makes the next batch current. Waits for the batch only if it is not loaded yet
+     * \param[out] slot         Slot of the current batch
+     * \param[out] isAvailable  False if there are no more batches
+     */
+    Status next(size_t &slot, bool &isAvailable)
+    {
+        {
+            AutoLock lock(_mutex);
+            _current = _nSlots;
+        }
+        isAvailable = false;
+
+        for (;;)
+        {
+            bool isProducerStopped = false;
+            {
+                AutoLock lock(_mutex);
+                if (!_status)
+                {
+                    return _status;
+                }
+                if (_nFilled)
+                {
+                    _current = _first;
+                    _first = (_first + 1) % _nSlots;
+                    _nFilled--;
+                    slot = _current;
+                    isAvailable = true;
+                    isProducerStopped = !_isProducerRunning;
+                }
+                else if (_isEndOfData && !_isProducerRunning)
+                {
+                    return Status();
+                }
+            }
+
+            if (isAvailable)
+            {
+                if (isProducerStopped)
+                {
+                    startProducer();
+                }
+                return Status();
+            }
+
+            /* The next batch is not loaded yet */
+            startProducer();
+            _tasks.wait();
+        }
+    }
+
+    /**
+     * Stops loading of the batches and waits for the background task
+     */
+    void stop()
+    {
+        {
+            AutoLock lock(_mutex);
+            _isEndOfData = true;
+        }
+        _tasks.wait();
+    }
+
+    void produce()
+    {
+        for (;;)
+        {
+            size_t slot;
+            {
+                AutoLock lock(_mutex);
+                const size_t nBusy = _nFilled + (_current < _nSlots ? 1 : 0);
+                if (_isEndOfData || nBusy >= _nSlots || !_status)
+                {
+                    _isProducerRunning = false;
+                    return;
+                }
+                slot = (_first + _nFilled) % _nSlots;
+            }
+
+            /* The slot is neither held by the consumer nor filled, so it is accessed without the lock */
+            size_t nLoaded = 0;
+            Status s = load(slot, nLoaded);
+
+            AutoLock lock(_mutex);
+            _status |= s;
+            /* Incomplete batch at the end of the data set is not used for training */
+            if (s && nLoaded == _batchSize)
+            {
+                _nFilled++;
+            }
+            else
+            {
+                _isEndOfData = true;
+            }
+        }
+    }
+
+private:
+    struct Producer
+    {
+        Producer(BatchPrefetcher &prefetcher) : _prefetcher(prefetcher) {}
+        void operator()() { _prefetcher.produce(); }
+        BatchPrefetcher &_prefetcher;
+    };
+
+    void startProducer()
+    {
+        {
+            AutoLock lock(_mutex);
+            if (_isProducerRunning || _isEndOfData || !_status)
+            {
+                return;
+            }
+            _isProducerRunning = true;
+        }
+        /* The task can be taken by any thread of the compute arena, including the threads of the layer computations.
+         * The task group runs the producer synchronously if the library is linked with the sequential threading layer */
+        Producer producer(*this);
+        _tasks.run(producer);
+    }
+
+    Status createTensors(size_t nSamples, HomogenTensorPtr &data, KeyValueDataCollectionPtr &groundTruth)
+    {
+        Status s;
+        Collection<size_t> dims = _provider->getSampleDimensions();
+        dims.insert(0, nSamples);
+        data = HomogenTensor<algorithmFPType>::create(dims, Tensor::doAllocate, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+
+        groundTruth = KeyValueDataCollectionPtr(new KeyValueDataCollection());
+        DAAL_CHECK_MALLOC(groundTruth.get());
+
+        const size_t nGroundTruths = _provider->getNumberOfGroundTruths();
+        DAAL_CHECK(nGroundTruths, ErrorIncorrectNumberOfElementsInInputCollection);
+        for (size_t i = 0; i < nGroundTruths; i++)
+        {
+            Collection<size_t> groundTruthDims = _provider->getGroundTruthDimensions(i);
+            groundTruthDims.insert(0, nSamples);
+            HomogenTensorPtr groundTruthTensor = HomogenTensor<algorithmFPType>::create(groundTruthDims, Tensor::doAllocate, &s);
+            DAAL_CHECK_STATUS_VAR(s);
+            (*groundTruth)[_provider->getGroundTruthKey(i)] = groundTruthTensor;
+        }
+        return s;
+    }
+
+    Status load(size_t slot, size_t &nLoaded)
+    {
+        if (!_windowSize)
+        {
+            return _provider->loadSamples(_batchSize, *_data[slot], *_groundTruth[slot], nLoaded);
+        }
+
+        Status s;
+        if (_windowPosition + _batchSize > _nWindowSamples)
+        {
+            /* The window is used up, the samples left in it do not form a batch */
+            if (_nWindowSamples < _windowSize && _nWindowSamples > 0)
+            {
+                nLoaded = 0;
+                return s;
+            }
+            DAAL_CHECK_STATUS(s, loadWindow());
+        }
+        if (_windowPosition + _batchSize > _nWindowSamples)
+        {
+            nLoaded = 0;
+            return s;
+        }
+
+        gather(*_data[slot], *_windowData);
+        for (size_t i = 0; i < _groundTruth[slot]->size(); i++)
+        {
+            HomogenTensor<algorithmFPType> *dst = static_cast<HomogenTensor<algorithmFPType> *>(_groundTruth[slot]->getValueByIndex((int)i).get());
+            HomogenTensor<algorithmFPType> *src = static_cast<HomogenTensor<algorithmFPType> *>(_windowGroundTruth->getValueByIndex((int)i).get());
+            gather(*dst, *src);
+        }
+        _windowPosition += _batchSize;
+        nLoaded = _batchSize;
+        return s;
+    }
+
+    /* Loads the next window of samples and permutes them with the Fisher-Yates shuffle */
+    Status loadWindow()
+    {
+        Status s;
+        DAAL_CHECK_STATUS(s, _provider->loadSamples(_windowSize, *_windowData, *_windowGroundTruth, _nWindowSamples));
+        _windowPosition = 0;
+
+        int *permutation = _permutation.get();
+        for (size_t i = 0; i < _nWindowSamples; i++)
+        {
+            permutation[i] = (int)i;
+        }
+
+        daal::internal::RNGs<int, cpu> rng;
+        for (size_t i = _nWindowSamples; i > 1; i--)
+        {
+            int j = 0;
+            DAAL_CHECK(!rng.uniform(1, &j, _engine->getState(), 0, (int)i), ErrorIncorrectErrorcodeFromGenerator);
+            const int tmp = permutation[i - 1];
+            permutation[i - 1] = permutation[j];
+            permutation[j] = tmp;
+        }
+        return s;
+    }
+
+    /* Copies the samples of the next batch from the window in the permuted order */
+    void gather(HomogenTensor<algorithmFPType> &dst, HomogenTensor<algorithmFPType> &src)
+    {
+        const size_t sampleSize = dst.getSize() / _batchSize;
+        const algorithmFPType *srcArray = src.getArray();
+        algorithmFPType *dstArray = dst.getArray();
+        const int *permutation = _permutation.get() + _windowPosition;
+        for (size_t i = 0; i < _batchSize; i++)
+        {
+            daal_memcpy_s(dstArray + i * sampleSize, sampleSize * sizeof(algorithmFPType),
+                          srcArray + permutation[i] * sampleSize, sampleSize * sizeof(algorithmFPType));
+        }
+    }
+
+    BatchProvider *_provider;
+    engines::internal::BatchBaseImpl *_engine;
+    size_t _batchSize;
+    size_t _nSlots;
+
+    TArray<HomogenTensorPtr, cpu> _data;
+    TArray<KeyValueDataCollectionPtr, cpu> _groundTruth;
+
+    size_t _windowSize;         /* Number of samples shuffled together, 0 if the samples are not shuffled */
+    size_t _nWindowSamples;     /* Number of samples loaded into the window */
+    size_t _windowPosition;     /* Index of the first sample of the next batch in the permutation */
+    HomogenTensorPtr _windowData;
+    KeyValueDataCollectionPtr _windowGroundTruth;
+    TArray<int, cpu> _permutation;
+
+    size_t _first;              /* Index of the oldest filled slot */
+    size_t _nFilled;            /* Number of filled slots not yet taken by the consumer */
+    size_t _current;            /* Slot held by the consumer, _nSlots if none */
+    bool _isEndOfData;
+    bool _isProducerRunning;
+    Status _status;
+
+    Mutex _mutex;
+    task_group _tasks;
+};
+
+} // namespace internal
+} // namespace training
+} // namespace neural_networks
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -48,6 +48,10 @@
 #ifndef __NEURAL_NETWORKS_TRAINING_FEEDFORWARD_IMPL_I__
 #define __NEURAL_NETWORKS_TRAINING_FEEDFORWARD_IMPL_I__
 
+#include "service_error_handling.h"
+#include "threading.h"
+#include "batch_normalization/batch_normalization_layer_forward_types.h"
+
 namespace daal
 {
 namespace algorithms
@@ -67,10 +71,11 @@ template<typename algorithmFPType, Method method, CpuType cpu>
 Status TrainingKernelBatch<algorithmFPType, method, cpu>::initialize(
     Tensor* data, Model* nnModel,
     const KeyValueDataCollectionPtr &groundTruthCollectionPtr,
-    const neural_networks::training::Parameter *parameter)
+    const neural_networks::training::Parameter *parameter,
+    BatchProvider *provider)
 {
     Status s;
-    DAAL_CHECK_STATUS(s, this->initializeBase(data, nnModel, groundTruthCollectionPtr, parameter))
+    DAAL_CHECK_STATUS(s, this->initializeBase(data, nnModel, groundTruthCollectionPtr, parameter, provider))
 
     ForwardLayersPtr forwardLayers = nnModel->getForwardLayers();
     learnableLayerIndices.reset(new LearnableLayerIndices(forwardLayers.get()));
@@ -186,7 +191,8 @@ Status TrainingKernelDistributed<algorithmFPType, method, cpu>::compute(
     WriteRows<algorithmFPType, cpu> batchSizeBlock(*(partialResult->get(batchSize)), 0, 1);
     DAAL_CHECK_BLOCK_STATUS(batchSizeBlock)
     algorithmFPType* batchSizeArray = batchSizeBlock.get();
-    batchSizeArray[0] = nnModel->getForwardLayer(0)->getLayerInput()->get(layers::forward::data)->getDimensionSize(0);
+    batchSizeArray[0] = nnModel->getForwardLayer(0)->getLayerInput()->get(layers::forward::data)->getDimensionSize(0) *
+                        (nnModel->getNumberOfReplicas() + 1);
     return s;
 }
 
@@ -302,54 +308,89 @@ template<typename algorithmFPType, CpuType cpu>
 Status TrainingKernelBase<algorithmFPType, cpu>::initializeBase(
     Tensor *data, Model *nnModel,
     const KeyValueDataCollectionPtr &groundTruthCollectionPtr,
-    const neural_networks::training::Parameter *parameter)
+    const neural_networks::training::Parameter *parameter,
+    BatchProvider *provider)
 {
-    ForwardLayersPtr forwardLayers = nnModel->getForwardLayers();
-    batchSizeParam = nnModel->getForwardLayer(0)->getLayerInput()->get(layers::forward::data)->getDimensionSize(0);
-    nLayers = forwardLayers->size();
+    /* Each copy of the neural network processes its part of the batch */
+    nReplicas = nnModel->getNumberOfReplicas() + 1;
+    replicaBatchSize = nnModel->getForwardLayer(0)->getLayerInput()->get(layers::forward::data)->getDimensionSize(0);
+    batchSizeParam = replicaBatchSize * nReplicas;
+    nLayers = nnModel->getForwardLayers()->size();
+
+    Status s;
+    KeyValueDataCollectionPtr groundTruthCollection = groundTruthCollectionPtr;
+    if (provider)
+    {
+        /* The batches are loaded in the background while the network is trained */
+        prefetcher.reset(new BatchPrefetcher<algorithmFPType, cpu>());
+        DAAL_CHECK_MALLOC(prefetcher.get())
+        DAAL_CHECK_STATUS(s, prefetcher->initialize(provider, batchSizeParam, parameter->nPrefetchedBatches,
+                                                    parameter->shuffleBufferSize, parameter->engine.get()))
+
+        /* The dimensions of the samples and the ground truth are taken from the buffers of the batches */
+        data = prefetcher->getData(0);
+        groundTruthCollection = prefetcher->getGroundTruth(0);
+    }
 
     nSamples = data->getDimensionSize(0);
     if (nSamples < batchSizeParam) { return Status(); }
 
     /* Get the number of last layers in the network and their indeces */
-    lastLayersIndices.reset(new LastLayerIndices(nnModel->getNextLayers().get(), groundTruthCollectionPtr));
+    lastLayersIndices.reset(new LastLayerIndices(nnModel->getNextLayers().get(), groundTruthCollection));
     DAAL_CHECK_MALLOC(lastLayersIndices.get() && lastLayersIndices->isValid())
 
     nLastLayers = lastLayersIndices->nLast(); /* number of last layers in the network */
 
-    /* Create a tensor to pass as an input to the first forward layer in neural network */
-    Collection<size_t> sampleSize = data->getDimensions();
-    sampleSize[0] = batchSizeParam;
-    Status s;
-    sample = HomogenTensor<algorithmFPType>::create(sampleSize, Tensor::doNotAllocate, &s);
-    DAAL_CHECK_STATUS_VAR(s);
+    replicas.reset(nReplicas);
+    DAAL_CHECK_MALLOC(replicas.get())
+    replicas[0] = nnModel;
+    for (size_t r = 1; r < nReplicas; r++)
+    {
+        replicas[r] = nnModel->getReplica(r - 1).get();
+    }
 
+    /* Create tensors to pass as an input to the first forward layer in neural network */
+    Collection<size_t> sampleSize = data->getDimensions();
+    sampleSize[0] = replicaBatchSize;
+    samples.reset(nReplicas);
+    DAAL_CHECK_MALLOC(samples.get())
+    for (size_t r = 0; r < nReplicas; r++)
+    {
+        samples[r] = HomogenTensor<algorithmFPType>::create(sampleSize, Tensor::doNotAllocate, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+    }
 
     /* Initialize buffers to manage reading memory operations for the ground truth input tensors */
-    groundTruthTensors.reset(nLastLayers);
+    groundTruthTensors.reset(nReplicas * nLastLayers);
     DAAL_CHECK_MALLOC(groundTruthTensors.get())
 
     /* Create tensors to pass as input ground truth to the loss layers in neural network */
-    sampleGroundTruthCollection.reset(nLastLayers);
+    sampleGroundTruthCollection.reset(nReplicas * nLastLayers);
     DAAL_CHECK_MALLOC(sampleGroundTruthCollection.get())
 
     for (size_t i = 0; i < nLastLayers; i++)
     {
-        TensorPtr groundTruthTensor = Tensor::cast((*groundTruthCollectionPtr)[lastLayersIndices->tensorIndex(i)]);
+        TensorPtr groundTruthTensor = Tensor::cast((*groundTruthCollection)[lastLayersIndices->tensorIndex(i)]);
         Collection<size_t> sampleGroundTruthSize = groundTruthTensor->getDimensions();
-        sampleGroundTruthSize[0] = batchSizeParam;
-        HomogenTensorPtr sampleGroundTruth = HomogenTensor<algorithmFPType>::create(sampleGroundTruthSize, Tensor::doNotAllocate, &s);
-        DAAL_CHECK_STATUS_VAR(s);
+        sampleGroundTruthSize[0] = replicaBatchSize;
+        size_t layerId = lastLayersIndices->layerIndex(i);
 
-        sampleGroundTruthCollection[i] = sampleGroundTruth;
+        for (size_t r = 0; r < nReplicas; r++)
+        {
+            HomogenTensorPtr sampleGroundTruth = HomogenTensor<algorithmFPType>::create(sampleGroundTruthSize, Tensor::doNotAllocate, &s);
+            DAAL_CHECK_STATUS_VAR(s);
 
-        size_t layerId = lastLayersIndices->layerIndex(i);
-        loss::forward::Batch *lossLayer = static_cast<loss::forward::Batch *>(forwardLayers->get(layerId).get());
-        loss::forward::Input *lossInput = static_cast<loss::forward::Input *>(lossLayer->getLayerInput());
-        lossInput->set(loss::forward::groundTruth, sampleGroundTruth);
-        lossLayer->getLayerResult()->setResultForBackward(lossInput);
+            sampleGroundTruthCollection[r * nLastLayers + i] = sampleGroundTruth;
+
+            loss::forward::Batch *lossLayer = static_cast<loss::forward::Batch *>(replicas[r]->getForwardLayer(layerId).get());
+            loss::forward::Input *lossInput = static_cast<loss::forward::Input *>(lossLayer->getLayerInput());
+            lossInput->set(loss::forward::groundTruth, sampleGroundTruth);
+            lossLayer->getLayerResult()->setResultForBackward(lossInput);
+        }
     }
-    return s;
+
+    /* The copies start the training from the weights and biases of the model */
+    return broadcastWeightsAndBiases();
 }
 
 template<typename algorithmFPType, CpuType cpu>
@@ -357,69 +398,349 @@ Status TrainingKernelBase<algorithmFPType, cpu>::computeBase(
     Tensor *data, Model *nnModel,
     const KeyValueDataCollectionPtr &groundTruthCollectionPtr)
 {
-    ForwardLayersPtr forwardLayers = nnModel->getForwardLayers();
-    BackwardLayersPtr backwardLayers = nnModel->getBackwardLayers();
-
-    forward::Input *firstForwardInput = forwardLayers->get(0)->getLayerInput();
-    forward::ResultPtr firstForwardResult = forwardLayers->get(0)->getLayerResult();
+    if (nSamples < batchSizeParam) { return Status(); }
+    if (prefetcher.get()) { return computeFromProvider(nnModel); }
 
-    firstForwardInput->set(forward::data, sample);
-    firstForwardResult->setResultForBackward(firstForwardInput);
+    Status s;
+    DAAL_CHECK_STATUS(s, setFirstLayersInput())
 
-    /* Buffer that manages reading memory operations for the input data tensor */
-    ReadSubtensor<algorithmFPType, cpu> dataSubtensor(data, 0, 0, 0, 0);
+    /* Buffers that manage reading memory operations for the input data tensor */
+    TArray<ReadSubtensor<algorithmFPType, cpu>, cpu> dataSubtensors(nReplicas);
+    DAAL_CHECK_MALLOC(dataSubtensors.get())
 
-    for (size_t i = 0; i < nLastLayers; i++)
+    for (size_t r = 0; r < nReplicas; r++)
     {
-        TensorPtr groundTruthTensor = Tensor::cast((*groundTruthCollectionPtr)[lastLayersIndices->tensorIndex(i)]);
-        groundTruthTensors[i].set(*groundTruthTensor, 0, 0, 0, 0);
+        dataSubtensors[r].set(data, 0, 0, 0, 0);
+
+        for (size_t i = 0; i < nLastLayers; i++)
+        {
+            TensorPtr groundTruthTensor = Tensor::cast((*groundTruthCollectionPtr)[lastLayersIndices->tensorIndex(i)]);
+            groundTruthTensors[r * nLastLayers + i].set(*groundTruthTensor, 0, 0, 0, 0);
+        }
     }
 
     size_t maxIterations = getMaxIterations(nSamples, batchSizeParam);
 
-    Status s;
     for(size_t i = 0; i < maxIterations * batchSizeParam; i += batchSizeParam)
     {
-        /* Update weights and biases of the network */
-        dataSubtensor.next(0, 0, i, batchSizeParam);
-        DAAL_CHECK_BLOCK_STATUS(dataSubtensor)
-        sample->setArray(const_cast<algorithmFPType *>(dataSubtensor.get()));
+        /* Pass the parts of the batch to the copies of the neural network */
+        for (size_t r = 0; r < nReplicas; r++)
+        {
+            const size_t offset = i + r * replicaBatchSize;
+            dataSubtensors[r].next(0, 0, offset, replicaBatchSize);
+            DAAL_CHECK_BLOCK_STATUS(dataSubtensors[r])
+            samples[r]->setArray(const_cast<algorithmFPType *>(dataSubtensors[r].get()));
 
-        for (size_t j = 0; j < nLastLayers; j++)
+            for (size_t j = 0; j < nLastLayers; j++)
+            {
+                ReadSubtensor<algorithmFPType, cpu> &groundTruthBlock = groundTruthTensors[r * nLastLayers + j];
+                groundTruthBlock.next(0, 0, offset, replicaBatchSize);
+                DAAL_CHECK_BLOCK_STATUS(groundTruthBlock)
+                sampleGroundTruthCollection[r * nLastLayers + j]->setArray(const_cast<algorithmFPType *>(groundTruthBlock.get()));
+            }
+        }
+
+        DAAL_CHECK_STATUS(s, trainBatch(nnModel))
+    }
+    return s;
+}
+
+/**
+ *  \brief Trains the neural network on the batches loaded from the batch provider
+ *          until the end of the data or until the number of iterations of the solver is reached.
+ *          The next batches are loaded in the background while the current batch is processed
+ */
+template<typename algorithmFPType, CpuType cpu>
+Status TrainingKernelBase<algorithmFPType, cpu>::computeFromProvider(Model *nnModel)
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, setFirstLayersInput())
+
+    /* The number of samples is unknown, so only the number of iterations of the solver limits the training */
+    const size_t maxIterations = getMaxIterations((size_t)-1, batchSizeParam);
+
+    for (size_t i = 0; i < maxIterations; i++)
+    {
+        size_t slot = 0;
+        bool isAvailable = false;
+        DAAL_CHECK_STATUS(s, prefetcher->next(slot, isAvailable))
+        if (!isAvailable) { break; }
+
+        /* The batch is stored in contiguous memory, so the copies of the network get views of its parts */
+        HomogenTensor<algorithmFPType> *batchData = prefetcher->getData(slot);
+        const KeyValueDataCollectionPtr &batchGroundTruth = prefetcher->getGroundTruth(slot);
+        const size_t sampleSize = batchData->getSize() / batchSizeParam;
+
+        for (size_t r = 0; r < nReplicas; r++)
         {
-            HomogenTensorPtr sampleGroundTruth = HomogenTensor<algorithmFPType>::cast(sampleGroundTruthCollection[j]);
-            groundTruthTensors[j].next(0, 0, i, batchSizeParam);
-            DAAL_CHECK_BLOCK_STATUS(groundTruthTensors[j])
-            sampleGroundTruth->setArray(const_cast<algorithmFPType *>(groundTruthTensors[j].get()));
+            samples[r]->setArray(batchData->getArray() + r * replicaBatchSize * sampleSize);
+
+            for (size_t j = 0; j < nLastLayers; j++)
+            {
+                HomogenTensor<algorithmFPType> *groundTruth =
+                    static_cast<HomogenTensor<algorithmFPType> *>((*batchGroundTruth)[lastLayersIndices->tensorIndex(j)].get());
+                const size_t groundTruthSize = groundTruth->getSize() / batchSizeParam;
+                sampleGroundTruthCollection[r * nLastLayers + j]->setArray(groundTruth->getArray() + r * replicaBatchSize * groundTruthSize);
+            }
         }
 
-        /* Forward pass through the neural network */
-        for(size_t layerId = 0; layerId < nLayers; layerId++)
+        DAAL_CHECK_STATUS(s, trainBatch(nnModel))
+    }
+    return s;
+}
+
+/**
+ *  \brief Sets the parts of the batch as the input of the first layers of the copies of the neural network
+ */
+template<typename algorithmFPType, CpuType cpu>
+Status TrainingKernelBase<algorithmFPType, cpu>::setFirstLayersInput()
+{
+    for (size_t r = 0; r < nReplicas; r++)
+    {
+        forward::Input *firstForwardInput = replicas[r]->getForwardLayer(0)->getLayerInput();
+        forward::ResultPtr firstForwardResult = replicas[r]->getForwardLayer(0)->getLayerResult();
+
+        firstForwardInput->set(forward::data, samples[r]);
+        firstForwardResult->setResultForBackward(firstForwardInput);
+    }
+    return Status();
+}
+
+/**
+ *  \brief Processes the batch by the copies of the neural network and updates the weights and biases of the model
+ */
+template<typename algorithmFPType, CpuType cpu>
+Status TrainingKernelBase<algorithmFPType, cpu>::trainBatch(Model *nnModel)
+{
+    Status s;
+    if (nReplicas == 1)
+    {
+        DAAL_CHECK_STATUS(s, computeReplica(0))
+    }
+    else
+    {
+        SafeStatus safeStat;
+        daal::threader_for(nReplicas, nReplicas, [&](size_t r)
+        {
+            safeStat |= computeReplica(r);
+        });
+        DAAL_CHECK_SAFE_STATUS();
+        DAAL_CHECK_STATUS(s, reduceDerivatives())
+        DAAL_CHECK_STATUS(s, reducePopulationStatistics())
+    }
+
+    /* Update weights and biases of the network */
+    DAAL_CHECK_STATUS(s, updateWeights(*nnModel))
+    return broadcastWeightsAndBiases();
+}
+
+/**
+ *  \brief Forward and backward passes through the copy of the neural network
+ */
+template<typename algorithmFPType, CpuType cpu>
+Status TrainingKernelBase<algorithmFPType, cpu>::computeReplica(size_t replica)
+{
+    ForwardLayersPtr forwardLayers = replicas[replica]->getForwardLayers();
+    BackwardLayersPtr backwardLayers = replicas[replica]->getBackwardLayers();
+
+    Status s;
+    /* Forward pass through the neural network */
+    for(size_t layerId = 0; layerId < nLayers; layerId++)
+    {
+        layers::forward::LayerIfacePtr forwardLayer = forwardLayers->get(layerId);
+        DAAL_CHECK_STATUS(s, processLayerErrors(layerId, forwardLayer->computeNoThrow()))
+    }
+
+    /* Backward pass through the neural network */
+    for(int layerId = nLayers - 1; layerId >= 0; layerId--)
+    {
+        layers::backward::LayerIfacePtr backwardLayer = backwardLayers->get(layerId);
+        DAAL_CHECK_STATUS(s, processLayerErrors(layerId, backwardLayer->computeNoThrow()))
+    }
+    return s;
+}
+
+/**
+ *  \brief Averages the derivatives computed by the copies of the neural network in the derivatives of the model.
+ *          The derivatives are summed in log2(nReplicas) steps. On each step the copy with index r + step
+ *          is added to the copy with index r, where r is a multiple of 2 * step. The pairs of one step
+ *          do not share memory and are summed concurrently without synchronization
+ */
+template<typename algorithmFPType, CpuType cpu>
+Status TrainingKernelBase<algorithmFPType, cpu>::reduceDerivatives()
+{
+    const layers::backward::ResultId derivativeIds[] = { layers::backward::weightDerivatives, layers::backward::biasDerivatives };
+    const size_t nTensors = nLayers * 2;
+
+    for (size_t step = 1; step < nReplicas; step *= 2)
+    {
+        const size_t nPairs = (nReplicas - step + 2 * step - 1) / (2 * step);
+        const size_t nTasks = nPairs * nTensors;
+
+        SafeStatus safeStat;
+        daal::threader_for(nTasks, nTasks, [&](size_t task)
+        {
+            const size_t r = (task / nTensors) * 2 * step;
+            const size_t layerId = (task % nTensors) / 2;
+            const layers::backward::ResultId id = derivativeIds[task % 2];
+
+            Tensor *sumTensor = replicas[r]->getBackwardLayer(layerId)->getLayerResult()->get(id).get();
+            Tensor *addTensor = replicas[r + step]->getBackwardLayer(layerId)->getLayerResult()->get(id).get();
+            if (!sumTensor || !addTensor || sumTensor->getSize() == 0) { return; }
+            DAAL_CHECK_THR(sumTensor->getSize() == addTensor->getSize(), ErrorIncorrectSizeOfDimensionInTensor);
+
+            WriteSubtensor<algorithmFPType, cpu> sumBlock(sumTensor);
+            DAAL_CHECK_BLOCK_STATUS_THR(sumBlock)
+            ReadSubtensor<algorithmFPType, cpu> addBlock(addTensor);
+            DAAL_CHECK_BLOCK_STATUS_THR(addBlock)
+
+            algorithmFPType *sum = sumBlock.get();
+            const algorithmFPType *add = addBlock.get();
+            const size_t size = sumBlock.getSize();
+           PRAGMA_IVDEP
+           PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < size; j++)
+            {
+                sum[j] += add[j];
+            }
+        });
+        DAAL_CHECK_SAFE_STATUS();
+    }
+
+    /* Copies process equal parts of the batch, so the derivative of the batch is the mean of their derivatives */
+    const algorithmFPType invNReplicas = (algorithmFPType)1.0 / (algorithmFPType)nReplicas;
+    SafeStatus safeStat;
+    daal::threader_for(nTensors, nTensors, [&](size_t task)
+    {
+        Tensor *tensor = replicas[0]->getBackwardLayer(task / 2)->getLayerResult()->get(derivativeIds[task % 2]).get();
+        if (!tensor || tensor->getSize() == 0) { return; }
+
+        WriteSubtensor<algorithmFPType, cpu> block(tensor);
+        DAAL_CHECK_BLOCK_STATUS_THR(block)
+        algorithmFPType *derivatives = block.get();
+        const size_t size = block.getSize();
+       PRAGMA_IVDEP
+       PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < size; j++)
         {
-            layers::forward::LayerIfacePtr forwardLayer = forwardLayers->get(layerId);
-            DAAL_CHECK_STATUS(s, processLayerErrors(layerId, forwardLayer->computeNoThrow()))
+            derivatives[j] *= invNReplicas;
         }
+    });
+    return safeStat.detach();
+}
+
+/**
+ *  \brief Averages the population mean and variance of the batch normalization layers over the copies
+ *          of the neural network in the model and copies the averages back to the copies.
+ *          The copies start the batch from the same statistics and update them with the equal parts of the batch,
+ *          so the average is the population mean of the whole batch and the mean of the variances of the parts
+ */
+template<typename algorithmFPType, CpuType cpu>
+Status TrainingKernelBase<algorithmFPType, cpu>::reducePopulationStatistics()
+{
+    const batch_normalization::LayerDataId statisticsIds[] = { batch_normalization::auxPopulationMean,
+                                                               batch_normalization::auxPopulationVariance };
+    const algorithmFPType invNReplicas = (algorithmFPType)1.0 / (algorithmFPType)nReplicas;
 
-        /* Backward pass through the neural network */
-        for(int layerId = nLayers - 1; layerId >= 0; layerId--)
+    for (size_t layerId = 0; layerId < nLayers; layerId++)
+    {
+        batch_normalization::forward::Result *result =
+            dynamic_cast<batch_normalization::forward::Result *>(replicas[0]->getForwardLayer(layerId)->getLayerResult().get());
+        if (!result) { continue; }
+
+        for (size_t k = 0; k < 2; k++)
         {
-            layers::backward::LayerIfacePtr backwardLayer = backwardLayers->get(layerId);
-            DAAL_CHECK_STATUS(s, processLayerErrors(layerId, backwardLayer->computeNoThrow()))
+            Tensor *tensor = result->get(statisticsIds[k]).get();
+            if (!tensor || tensor->getSize() == 0) { continue; }
+
+            WriteSubtensor<algorithmFPType, cpu> block(tensor);
+            DAAL_CHECK_BLOCK_STATUS(block)
+            algorithmFPType *values = block.get();
+            const size_t size = block.getSize();
+
+            for (size_t r = 1; r < nReplicas; r++)
+            {
+                batch_normalization::forward::Result *replicaResult =
+                    static_cast<batch_normalization::forward::Result *>(replicas[r]->getForwardLayer(layerId)->getLayerResult().get());
+                Tensor *replicaTensor = replicaResult->get(statisticsIds[k]).get();
+                DAAL_CHECK(replicaTensor && replicaTensor->getSize() == size, ErrorIncorrectSizeOfDimensionInTensor);
+
+                ReadSubtensor<algorithmFPType, cpu> replicaBlock(replicaTensor);
+                DAAL_CHECK_BLOCK_STATUS(replicaBlock)
+                const algorithmFPType *replicaValues = replicaBlock.get();
+               PRAGMA_IVDEP
+               PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < size; j++)
+                {
+                    values[j] += replicaValues[j];
+                }
+            }
+           PRAGMA_IVDEP
+           PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < size; j++)
+            {
+                values[j] *= invNReplicas;
+            }
+
+            for (size_t r = 1; r < nReplicas; r++)
+            {
+                batch_normalization::forward::Result *replicaResult =
+                    static_cast<batch_normalization::forward::Result *>(replicas[r]->getForwardLayer(layerId)->getLayerResult().get());
+                WriteOnlySubtensor<algorithmFPType, cpu> replicaBlock(replicaResult->get(statisticsIds[k]).get());
+                DAAL_CHECK_BLOCK_STATUS(replicaBlock)
+                daal_memcpy_s(replicaBlock.get(), size * sizeof(algorithmFPType), values, size * sizeof(algorithmFPType));
+            }
         }
+    }
+    return Status();
+}
+
+/**
+ *  \brief Copies the weights and biases of the model to the copies of the neural network
+ */
+template<typename algorithmFPType, CpuType cpu>
+Status TrainingKernelBase<algorithmFPType, cpu>::broadcastWeightsAndBiases()
+{
+    if (nReplicas == 1) { return Status(); }
+
+    const forward::InputId learnableIds[] = { forward::weights, forward::biases };
+    for (size_t layerId = 0; layerId < nLayers; layerId++)
+    {
+        for (size_t k = 0; k < 2; k++)
+        {
+            Tensor *tensor = replicas[0]->getForwardLayer(layerId)->getLayerInput()->get(learnableIds[k]).get();
+            if (!tensor || tensor->getSize() == 0) { continue; }
+
+            ReadSubtensor<algorithmFPType, cpu> block(tensor);
+            DAAL_CHECK_BLOCK_STATUS(block)
+            const algorithmFPType *values = block.get();
+            const size_t size = block.getSize();
 
-        /* Update weights and biases of the network */
-        DAAL_CHECK_STATUS(s, updateWeights(*nnModel))
+            SafeStatus safeStat;
+            daal::threader_for(nReplicas - 1, nReplicas - 1, [&](size_t r)
+            {
+                Tensor *replicaTensor = replicas[r + 1]->getForwardLayer(layerId)->getLayerInput()->get(learnableIds[k]).get();
+                DAAL_CHECK_THR(replicaTensor && replicaTensor->getSize() == size, ErrorIncorrectSizeOfDimensionInTensor);
+
+                WriteOnlySubtensor<algorithmFPType, cpu> replicaBlock(replicaTensor);
+                DAAL_CHECK_BLOCK_STATUS_THR(replicaBlock)
+                daal_memcpy_s(replicaBlock.get(), size * sizeof(algorithmFPType), values, size * sizeof(algorithmFPType));
+            });
+            DAAL_CHECK_SAFE_STATUS();
+        }
     }
-    return s;
+    return Status();
 }
 
 template<typename algorithmFPType, CpuType cpu>
 Status TrainingKernelBase<algorithmFPType, cpu>::resetBase()
 {
+    prefetcher.reset();
     lastLayersIndices.reset();
     sampleGroundTruthCollection.reset(0);
     groundTruthTensors.reset(0);
-    sample.reset();
+    samples.reset(0);
+    replicas.reset(0);
     return Status();
 }
 
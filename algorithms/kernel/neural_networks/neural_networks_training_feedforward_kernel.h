@@ -59,6 +59,7 @@
 #include "service_tensor.h"
 #include "neural_networks_feedforward.h"
 #include "neural_networks_training_feedforward.h"
+#include "neural_networks_training_batch_prefetcher.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -88,7 +89,8 @@ public:
 protected:
     Status initializeBase(Tensor* data, Model *nnModel,
                           const KeyValueDataCollectionPtr &groundTruthCollectionPtr,
-                          const neural_networks::training::Parameter *parameter);
+                          const neural_networks::training::Parameter *parameter,
+                          BatchProvider *provider = NULL);
 
     Status computeBase(Tensor *data, Model *model,
                        const KeyValueDataCollectionPtr &groundTruthCollectionPtr);
@@ -99,15 +101,27 @@ protected:
     virtual size_t getMaxIterations(size_t nSamples, size_t batchSizeParam) const = 0;
 
 private:
+    Status computeFromProvider(Model *nnModel);
+    Status setFirstLayersInput();
+    Status trainBatch(Model *nnModel);
+    Status computeReplica(size_t replica);
+    Status reduceDerivatives();
+    Status reducePopulationStatistics();
+    Status broadcastWeightsAndBiases();
+
     size_t batchSizeParam;
+    size_t replicaBatchSize; /* Part of the batch processed by one copy of the neural network */
+    size_t nReplicas;        /* Number of the copies of the neural network including the model itself */
     size_t nLastLayers;
     size_t nLayers;
     size_t nSamples;
 
-    HomogenTensorPtr sample;
     UniquePtr<LastLayerIndices, cpu> lastLayersIndices;
+    TArray<Model *, cpu> replicas;
+    TArray<HomogenTensorPtr, cpu> samples;
     TArray<HomogenTensorPtr, cpu> sampleGroundTruthCollection;
     TArray<ReadSubtensor<algorithmFPType, cpu>, cpu> groundTruthTensors;
+    UniquePtr<BatchPrefetcher<algorithmFPType, cpu>, cpu> prefetcher; /* Batches loaded from the batch provider, NULL if the input is in tensors */
 };
 
 /**
@@ -119,7 +133,8 @@ class TrainingKernelBatch : public TrainingKernelBase<algorithmFPType, cpu>
 public:
     Status initialize(Tensor* data, Model* nnModel,
                       const KeyValueDataCollectionPtr &groundTruthCollectionPtr,
-                      const neural_networks::training::Parameter *parameter);
+                      const neural_networks::training::Parameter *parameter,
+                      BatchProvider *provider);
 
     Status compute(Tensor* data, Model* nnModel,
                    const KeyValueDataCollectionPtr &groundTruthCollectionPtr);
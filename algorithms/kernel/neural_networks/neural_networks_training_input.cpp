@@ -87,6 +87,11 @@ TensorPtr Input::get(InputCollectionId id, size_t key) const
     return Tensor::cast((*collection)[key]);
 }
 
+BatchProviderPtr Input::get(InputBatchProviderId id) const
+{
+    return dynamicPointerCast<BatchProvider, SerializationIface>(Argument::get(id));
+}
+
 void Input::set(InputId id, const TensorPtr &value)
 {
     if (id == groundTruth)
@@ -111,11 +116,23 @@ void Input::add(InputCollectionId id, size_t key, const TensorPtr &value)
     (*collection)[key] = value;
 }
 
+void Input::set(InputBatchProviderId id, const BatchProviderPtr &value)
+{
+    Argument::set(id, value);
+}
+
 Status Input::check(const daal::algorithms::Parameter *par, int method) const
 {
     const Parameter *param = static_cast<const Parameter *>(par);
-    TensorPtr dataTensor = get(data);
     Status s;
+    if (get(batchProvider))
+    {
+        /* The samples of the provider are checked against the model in Result::check() */
+        DAAL_CHECK_EX(param->optimizationSolver, ErrorIncorrectParameter, ParameterName, optimizationSolverStr());
+        return s;
+    }
+
+    TensorPtr dataTensor = get(data);
     DAAL_CHECK_STATUS(s, checkTensor(dataTensor.get(), dataStr()))
 
     size_t nSamples = dataTensor->getDimensionSize(0);
@@ -47,6 +47,12 @@
 
 #include "neural_networks_training_model.h"
 #include "neural_networks_weights_and_biases.h"
+#include "neural_networks/layers/dropout/dropout_layer_types.h"
+#include "neural_networks/layers/pooling2d/stochastic_pooling2d_layer_types.h"
+#include "neural_networks/layers/spatial_pooling2d/spatial_stochastic_pooling2d_layer_types.h"
+#include "algorithms/engines/mt19937/mt19937.h"
+#include "algorithms/distributions/uniform/uniform.h"
+#include "engine_batch_impl.h"
 
 namespace daal
 {
@@ -79,7 +85,94 @@ services::Status DAAL_EXPORT Model::createWeightsAndBiasesDerivatives()
     return s;
 }
 
+/**
+ * Generates the seeds of the engines of the copies of the layer from the engine of the layer.
+ * The state of the engine is restored, so the sequence of random numbers of the layer in the model does not change
+ */
+static services::Status generateReplicaSeeds(const engines::EnginePtr &engine, size_t nSeeds, services::Collection<size_t> &seeds)
+{
+    using namespace services;
+    using namespace data_management;
+
+    engines::internal::BatchBaseImpl *engineImpl = dynamic_cast<engines::internal::BatchBaseImpl *>(engine.get());
+    DAAL_CHECK(engineImpl, ErrorIncorrectEngineParameter);
+
+    Status s;
+    Collection<byte> state(engineImpl->getStateSize());
+    DAAL_CHECK_MALLOC(state.size() == (size_t)engineImpl->getStateSize());
+    DAAL_CHECK_STATUS(s, engine->saveState(&state[0]));
+
+    SharedPtr<HomogenNumericTable<double> > seedsTable = HomogenNumericTable<double>::create(1, nSeeds, NumericTable::doAllocate, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    distributions::uniform::Batch<double> uniform(0.0, 4294967296.0);
+    uniform.parameter.engine = engine;
+    uniform.input.set(distributions::tableToFill, seedsTable);
+    DAAL_CHECK_STATUS(s, uniform.computeNoThrow());
+    DAAL_CHECK_STATUS(s, engine->loadState(&state[0]));
+
+    seeds.clear();
+    const double *values = seedsTable->getArray();
+    for (size_t r = 0; r < nSeeds; r++)
+    {
+        seeds.push_back((size_t)values[r]);
+    }
+    return s;
+}
+
+template<typename modelFPType>
+services::Status DAAL_EXPORT Model::createReplicas(const services::Collection<size_t> &sampleSize, const Topology &topology,
+                                                   const Parameter &parameter, size_t nReplicas)
+{
+    using namespace services;
+    using namespace layers;
+
+    Status s;
+    _replicas.clear();
+
+    Parameter replicaParameter = parameter;
+    replicaParameter.nReplicas = 1;
+    for (size_t r = 0; r < nReplicas; r++)
+    {
+        SharedPtr<Model> replica = Model::create(&s);
+        DAAL_CHECK_STATUS_VAR(s);
+        DAAL_CHECK_STATUS(s, replica->initialize<modelFPType>(sampleSize, topology, replicaParameter));
+        _replicas.push_back(replica);
+    }
+    if (nReplicas == 0) { return s; }
+
+    /* Copies of the layers share the engines of the layers in the topology.
+       The copies compute concurrently, so the layers that generate random numbers get their own engines
+       seeded from the engine of the layer */
+    const size_t nLayers = _replicas[0]->getForwardLayers()->size();
+    Collection<size_t> seeds;
+    for (size_t i = 0; i < nLayers; i++)
+    {
+        layers::Parameter *layerParameter = _replicas[0]->getForwardLayer(i)->getLayerParameter();
+        engines::EnginePtr layerEngine;
+        if (dropout::Parameter *p = dynamic_cast<dropout::Parameter *>(layerParameter)) { layerEngine = p->engine; }
+        else if (stochastic_pooling2d::Parameter *p = dynamic_cast<stochastic_pooling2d::Parameter *>(layerParameter)) { layerEngine = p->engine; }
+        else if (spatial_stochastic_pooling2d::Parameter *p = dynamic_cast<spatial_stochastic_pooling2d::Parameter *>(layerParameter)) { layerEngine = p->engine; }
+        if (!layerEngine) { continue; }
+
+        DAAL_CHECK_STATUS(s, generateReplicaSeeds(layerEngine, nReplicas, seeds));
+        for (size_t r = 0; r < nReplicas; r++)
+        {
+            engines::EnginePtr engine = engines::mt19937::Batch<modelFPType>::create(seeds[r]);
+            DAAL_CHECK_MALLOC(engine);
+
+            layerParameter = _replicas[r]->getForwardLayer(i)->getLayerParameter();
+            if (dropout::Parameter *p = dynamic_cast<dropout::Parameter *>(layerParameter)) { p->engine = engine; }
+            else if (stochastic_pooling2d::Parameter *p = dynamic_cast<stochastic_pooling2d::Parameter *>(layerParameter)) { p->engine = engine; }
+            else if (spatial_stochastic_pooling2d::Parameter *p = dynamic_cast<spatial_stochastic_pooling2d::Parameter *>(layerParameter)) { p->engine = engine; }
+        }
+    }
+    return s;
+}
+
 template DAAL_EXPORT services::Status Model::createWeightsAndBiasesDerivatives<DAAL_FPTYPE>();
+template DAAL_EXPORT services::Status Model::createReplicas<DAAL_FPTYPE>(const services::Collection<size_t> &, const Topology &,
+                                                                        const Parameter &, size_t);
 
 }
 }
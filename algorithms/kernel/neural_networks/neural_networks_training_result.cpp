@@ -40,6 +40,8 @@
 *******************************************************************************/
 
 #include "neural_networks_training_result.h"
+#include "neural_networks_training_input.h"
+#include "neural_networks_training_batch_provider.h"
 #include "daal_strings.h"
 
 using namespace daal::data_management;
@@ -69,6 +71,54 @@ void Result::set(ResultId id, const ModelPtr &value)
     Argument::set(id, value);
 }
 
+static Status checkBatchProvider(BatchProvider &provider, Model &trainModel)
+{
+    /* The samples of the provider must match the input of the first layer of the model */
+    TensorPtr modelData;
+    if(trainModel.getForwardLayer(0) && trainModel.getForwardLayer(0)->getLayerInput())
+    {
+        modelData = trainModel.getForwardLayer(0)->getLayerInput()->get(layers::forward::data);
+    }
+    DAAL_CHECK(modelData, ErrorNullModel)
+
+    const Collection<size_t> &modelDims = modelData->getDimensions();
+    const Collection<size_t> sampleDims = provider.getSampleDimensions();
+    DAAL_CHECK_EX(sampleDims.size() + 1 == modelDims.size(), ErrorIncorrectNumberOfDimensionsInTensor, ArgumentName, dataStr());
+    for(size_t i = 0; i < sampleDims.size(); i++)
+    {
+        if(sampleDims[i] != modelDims[i + 1])
+        {
+            SharedPtr<Error> error = Error::create(ErrorIncorrectSizeOfDimensionInTensor, ArgumentName, dataStr());
+            error->addIntDetail(Dimension, (int)(i + 1));
+            return Status(error);
+        }
+    }
+
+    /* One ground truth is expected per last layer, stored with the index of the layer as the key */
+    SharedPtr<Collection<layers::NextLayers> > nextLayers = trainModel.getNextLayers();
+    DAAL_CHECK(nextLayers, ErrorNullModel)
+    size_t nLastLayers = 0;
+    for(size_t layerId = 0; layerId < nextLayers->size(); layerId++)
+    {
+        if(nextLayers->get(layerId).size() == 0) { nLastLayers++; }
+    }
+    const size_t nGroundTruths = provider.getNumberOfGroundTruths();
+    DAAL_CHECK_EX(nGroundTruths == nLastLayers, ErrorIncorrectNumberOfElementsInInputCollection, ArgumentName, groundTruthLabelsStr());
+    if(nLastLayers == 1) { return Status(); }
+
+    for(size_t i = 0; i < nGroundTruths; i++)
+    {
+        const size_t key = provider.getGroundTruthKey(i);
+        if(key >= nextLayers->size() || nextLayers->get(key).size() != 0)
+        {
+            SharedPtr<Error> error = Error::create(ErrorIncorrectElementInCollection, ArgumentName, groundTruthLabelsStr());
+            error->addIntDetail(ElementInCollection, (int)key);
+            return Status(error);
+        }
+    }
+    return Status();
+}
+
 Status Result::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const
 {
     ModelPtr trainModel = get(model);
@@ -79,10 +129,18 @@ Status Result::check(const daal::algorithms::Input *input, const daal::algorithm
         size_t batchSizeFromModel = 0;
         if(trainModel->getForwardLayer(0) && trainModel->getForwardLayer(0)->getLayerInput() && trainModel->getForwardLayer(0)->getLayerInput()->get(layers::forward::data))
         {
-            batchSizeFromModel = trainModel->getForwardLayer(0)->getLayerInput()->get(layers::forward::data)->getDimensionSize(0);
+            /* Each copy of the neural network processes its part of the batch */
+            batchSizeFromModel = trainModel->getForwardLayer(0)->getLayerInput()->get(layers::forward::data)->getDimensionSize(0) *
+                                 (trainModel->getNumberOfReplicas() + 1);
         }
         DAAL_CHECK(batchSizeFromModel == param->optimizationSolver->getParameter()->batchSize, ErrorInconsistenceModelAndBatchSizeInParameter);
     }
+    const Input *trainInput = dynamic_cast<const Input *>(input);
+    BatchProviderPtr provider = trainInput ? trainInput->get(batchProvider) : BatchProviderPtr();
+    if(provider)
+    {
+        return checkBatchProvider(*provider, *trainModel);
+    }
     return Status();
 }
 
@@ -0,0 +1,282 @@
+/* file: cross_entropy_loss_dense_default_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of cross-entropy loss algorithm
+//--
+*/
+
+#include "service_numeric_table.h"
+#include "service_math.h"
+#include "objective_function_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace cross_entropy_loss
+{
+namespace internal
+{
+
+using namespace objective_function::internal;
+
+static const size_t blockSizeDefault = 512;
+
+/**
+ *  \brief Kernel for cross-entropy loss objective function calculation.
+ *  Blocks of rows are processed in parallel, the thread-local sums are reduced into the results.
+ *  The data set can be dense or CSR numeric table.
+ *  The argument and the gradient are K x (p + 1) arrays, the hessian consists of K x K blocks of size (p + 1) x (p + 1)
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+inline services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::compute(NumericTable *dataNT, NumericTable *dependentVariablesNT, NumericTable *argumentNT,
+                                                             NumericTable *valueNT, NumericTable *hessianNT, NumericTable *gradientNT, Parameter *parameter)
+{
+    const size_t nFeatures = dataNT->getNumberOfColumns();
+    const size_t nClasses = parameter->nClasses;
+    const size_t ldTheta = nFeatures + 1;
+    const size_t argumentSize = nClasses * ldTheta;
+    const bool interceptFlag = parameter->interceptFlag;
+
+    ReadRows<int, cpu> indicesRows;
+    const int *indices = nullptr;
+    size_t batchSize = 0;
+    Status s;
+    DAAL_CHECK_STATUS(s, getBatchIndices<cpu>(parameter, dataNT->getNumberOfRows(), indicesRows, indices, batchSize));
+
+    ReadRows<algorithmFPType, cpu> argumentRows(argumentNT, 0, argumentSize);
+    DAAL_CHECK_BLOCK_STATUS(argumentRows);
+    const algorithmFPType *theta = argumentRows.get();
+
+    WriteOnlyRows<algorithmFPType, cpu> valueRows(valueNT, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(valueRows);
+    WriteOnlyRows<algorithmFPType, cpu> gradientRows(gradientNT, 0, argumentSize);
+    DAAL_CHECK_BLOCK_STATUS(gradientRows);
+    WriteOnlyRows<algorithmFPType, cpu> hessianRows(hessianNT, 0, argumentSize);
+    DAAL_CHECK_BLOCK_STATUS(hessianRows);
+
+    algorithmFPType *value    = valueRows.get();
+    algorithmFPType *gradient = gradientRows.get();
+    algorithmFPType *hessian  = hessianRows.get();
+
+    typedef LinearModelHelper<algorithmFPType, cpu> Helper;
+    typedef Math<algorithmFPType, cpu> math;
+    const size_t blockSize = (batchSize < blockSizeDefault ? batchSize : blockSizeDefault);
+    /* Probabilities, residuals, weights of the hessian blocks and the weighted rows of the block */
+    const size_t bufferSize = 2 * blockSize * nClasses + (hessian ? blockSize * (nFeatures + 1) : 0);
+
+    DAAL_CHECK_STATUS(s, (computeSum<algorithmFPType, cpu>(dataNT, dependentVariablesNT, indices, batchSize, blockSize, bufferSize,
+        value, gradient, argumentSize, hessian, argumentSize * argumentSize,
+        [=](tls_sum_t<algorithmFPType, cpu> &local, size_t nRows) -> Status
+    {
+        algorithmFPType *prob = local.buffer;
+        algorithmFPType *r = prob + blockSize * nClasses;
+        const algorithmFPType *y = local.reader.y();
+
+        for(size_t i = 0; i < nRows; i++)
+        {
+            DAAL_CHECK(y[i] >= 0 && (size_t)y[i] < nClasses, services::ErrorIncorrectClassLabels);
+        }
+
+        Helper::computeLinearPredictors(local.reader, nRows, nFeatures, nClasses, theta, interceptFlag, prob);
+
+        /* Softmax shifted by the largest linear predictor of the row */
+        for(size_t i = 0; i < nRows; i++)
+        {
+            algorithmFPType *probI = prob + i * nClasses;
+            algorithmFPType maxF = probI[0];
+            for(size_t k = 1; k < nClasses; k++)
+            {
+                maxF = (probI[k] > maxF ? probI[k] : maxF);
+            }
+            for(size_t k = 0; k < nClasses; k++)
+            {
+                probI[k] -= maxF;
+            }
+            if(value)
+            {
+                local.value -= probI[(size_t)y[i]];
+            }
+        }
+        math::vExp(nRows * nClasses, prob, prob);
+
+        for(size_t i = 0; i < nRows; i++)
+        {
+            algorithmFPType *probI = prob + i * nClasses;
+            algorithmFPType sum = 0;
+            for(size_t k = 0; k < nClasses; k++)
+            {
+                sum += probI[k];
+            }
+            if(value)
+            {
+                local.value += math::sLog(sum);
+            }
+            const algorithmFPType inv = (algorithmFPType)1.0 / sum;
+            for(size_t k = 0; k < nClasses; k++)
+            {
+                probI[k] *= inv;
+            }
+        }
+
+        if(gradient)
+        {
+            for(size_t i = 0; i < nRows; i++)
+            {
+                for(size_t k = 0; k < nClasses; k++)
+                {
+                    r[i * nClasses + k] = prob[i * nClasses + k];
+                }
+                r[i * nClasses + (size_t)y[i]] -= 1;
+            }
+            Helper::addGradient(local.reader, nRows, nFeatures, nClasses, r, local.gradient);
+        }
+
+        if(hessian)
+        {
+            /* Block (k, l) is sum_i p_ik * (delta_kl - p_il) * (1, x_i)(1, x_i)^T,
+               the weights are non-negative on the diagonal blocks and non-positive elsewhere */
+            algorithmFPType *w = r + blockSize * nClasses;
+            algorithmFPType *xw = w + blockSize;
+            for(size_t k = 0; k < nClasses; k++)
+            {
+                for(size_t l = 0; l <= k; l++)
+                {
+                    for(size_t i = 0; i < nRows; i++)
+                    {
+                        const algorithmFPType pk = prob[i * nClasses + k];
+                        w[i] = (k == l ? pk * (1 - pk) : pk * prob[i * nClasses + l]);
+                    }
+                    Helper::addCrossProduct(local.reader, nRows, nFeatures, w, (k == l ? 1 : -1),
+                                            local.hessian + k * ldTheta * argumentSize + l * ldTheta, argumentSize, xw);
+                }
+            }
+        }
+        return Status();
+    })));
+
+    const algorithmFPType batchSizeInv = (algorithmFPType)1.0 / batchSize;
+    const algorithmFPType penaltyL1 = parameter->penaltyL1;
+    const algorithmFPType penaltyL2 = parameter->penaltyL2;
+    if(value)
+    {
+        value[0] *= batchSizeInv;
+        for(size_t k = 0; k < nClasses; k++)
+        {
+            for(size_t j = 1; j < ldTheta; j++)
+            {
+                const algorithmFPType t = theta[k * ldTheta + j];
+                value[0] += penaltyL1 * (t < 0 ? -t : t) + penaltyL2 * t * t;
+            }
+        }
+    }
+    if(gradient)
+    {
+        for(size_t k = 0; k < nClasses; k++)
+        {
+            gradient[k * ldTheta] = (interceptFlag ? gradient[k * ldTheta] * batchSizeInv : 0);
+            for(size_t j = 1; j < ldTheta; j++)
+            {
+                gradient[k * ldTheta + j] = gradient[k * ldTheta + j] * batchSizeInv + 2 * penaltyL2 * theta[k * ldTheta + j];
+            }
+        }
+    }
+    if(hessian)
+    {
+        for(size_t k = 0; k < nClasses; k++)
+        {
+            for(size_t l = 0; l <= k; l++)
+            {
+                algorithmFPType *block = hessian + k * ldTheta * argumentSize + l * ldTheta;
+                Helper::symmetrize(block, nFeatures, argumentSize);
+                if(l == k)
+                    continue;
+                /* The blocks are symmetric, block (l, k) is a copy of block (k, l) */
+                algorithmFPType *blockT = hessian + l * ldTheta * argumentSize + k * ldTheta;
+                for(size_t a = 0; a < ldTheta; a++)
+                {
+                    for(size_t b = 0; b < ldTheta; b++)
+                    {
+                        blockT[a * argumentSize + b] = block[a * argumentSize + b];
+                    }
+                }
+            }
+        }
+        for(size_t j = 0; j < argumentSize * argumentSize; j++)
+        {
+            hessian[j] *= batchSizeInv;
+        }
+        for(size_t k = 0; k < nClasses; k++)
+        {
+            for(size_t j = 1; j < ldTheta; j++)
+            {
+                const size_t idx = k * ldTheta + j;
+                hessian[idx * argumentSize + idx] += 2 * penaltyL2;
+            }
+            if(!interceptFlag)
+            {
+                /* The intercept terms are fixed: their rows and columns are the ones of the identity matrix */
+                const size_t idx = k * ldTheta;
+                for(size_t j = 0; j < argumentSize; j++)
+                {
+                    hessian[idx * argumentSize + j] = 0;
+                    hessian[j * argumentSize + idx] = 0;
+                }
+                hessian[idx * argumentSize + idx] = 1;
+            }
+        }
+    }
+    return s;
+}
+
+} // namespace daal::internal
+
+} // namespace cross_entropy_loss
+
+} // namespace optimization_solver
+
+} // namespace algorithms
+
+} // namespace daal
@@ -0,0 +1,216 @@
+/* file: logistic_loss_dense_default_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of logistic loss algorithm
+//--
+*/
+
+#include "service_numeric_table.h"
+#include "service_math.h"
+#include "objective_function_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace logistic_loss
+{
+namespace internal
+{
+
+using namespace objective_function::internal;
+
+static const size_t blockSizeDefault = 512;
+
+/**
+ *  \brief Kernel for logistic loss objective function calculation.
+ *  Blocks of rows are processed in parallel, the thread-local sums are reduced into the results.
+ *  The data set can be dense or CSR numeric table
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+inline services::Status LogLossKernel<algorithmFPType, method, cpu>::compute(NumericTable *dataNT, NumericTable *dependentVariablesNT, NumericTable *argumentNT,
+                                                             NumericTable *valueNT, NumericTable *hessianNT, NumericTable *gradientNT, Parameter *parameter)
+{
+    const size_t nFeatures = dataNT->getNumberOfColumns();
+    const size_t argumentSize = nFeatures + 1;
+    const bool interceptFlag = parameter->interceptFlag;
+
+    ReadRows<int, cpu> indicesRows;
+    const int *indices = nullptr;
+    size_t batchSize = 0;
+    Status s;
+    DAAL_CHECK_STATUS(s, getBatchIndices<cpu>(parameter, dataNT->getNumberOfRows(), indicesRows, indices, batchSize));
+
+    ReadRows<algorithmFPType, cpu> argumentRows(argumentNT, 0, argumentSize);
+    DAAL_CHECK_BLOCK_STATUS(argumentRows);
+    const algorithmFPType *theta = argumentRows.get();
+
+    WriteOnlyRows<algorithmFPType, cpu> valueRows(valueNT, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(valueRows);
+    WriteOnlyRows<algorithmFPType, cpu> gradientRows(gradientNT, 0, argumentSize);
+    DAAL_CHECK_BLOCK_STATUS(gradientRows);
+    WriteOnlyRows<algorithmFPType, cpu> hessianRows(hessianNT, 0, argumentSize);
+    DAAL_CHECK_BLOCK_STATUS(hessianRows);
+
+    algorithmFPType *value    = valueRows.get();
+    algorithmFPType *gradient = gradientRows.get();
+    algorithmFPType *hessian  = hessianRows.get();
+
+    typedef LinearModelHelper<algorithmFPType, cpu> Helper;
+    typedef Math<algorithmFPType, cpu> math;
+    const size_t blockSize = (batchSize < blockSizeDefault ? batchSize : blockSizeDefault);
+    /* Linear predictors, sigmoids, weights of the hessian and the weighted rows of the block */
+    const size_t bufferSize = 3 * blockSize + (hessian ? blockSize * nFeatures : 0);
+
+    DAAL_CHECK_STATUS(s, (computeSum<algorithmFPType, cpu>(dataNT, dependentVariablesNT, indices, batchSize, blockSize, bufferSize,
+        value, gradient, argumentSize, hessian, argumentSize * argumentSize,
+        [=](tls_sum_t<algorithmFPType, cpu> &local, size_t nRows) -> Status
+    {
+        algorithmFPType *f = local.buffer;
+        algorithmFPType *sigma = f + blockSize;
+        algorithmFPType *w = sigma + blockSize;
+        const algorithmFPType *y = local.reader.y();
+        const algorithmFPType one = 1.0;
+
+        Helper::computeLinearPredictors(local.reader, nRows, nFeatures, 1, theta, interceptFlag, f);
+
+        /* exp(-|f|) keeps the sigmoid and the logarithm finite for the large linear predictors */
+        for(size_t i = 0; i < nRows; i++)
+        {
+            sigma[i] = (f[i] < 0 ? f[i] : -f[i]);
+        }
+        math::vExp(nRows, sigma, sigma);
+
+        if(value)
+        {
+            /* For the labels y in {0, 1}: -y * log(sigma(f)) - (1 - y) * log(1 - sigma(f)) = log(1 + exp(f)) - y * f,
+               written as max(f, 0) - y * f + log(1 + exp(-|f|)) */
+            math::vLog1p(nRows, sigma, w);
+            for(size_t i = 0; i < nRows; i++)
+            {
+                local.value += (f[i] > 0 ? f[i] : 0) - y[i] * f[i] + w[i];
+            }
+        }
+
+        for(size_t i = 0; i < nRows; i++)
+        {
+            const algorithmFPType inv = one / (one + sigma[i]);
+            sigma[i] = (f[i] >= 0 ? inv : sigma[i] * inv);
+        }
+
+        if(hessian)
+        {
+            for(size_t i = 0; i < nRows; i++)
+            {
+                w[i] = sigma[i] * (one - sigma[i]);
+            }
+            Helper::addCrossProduct(local.reader, nRows, nFeatures, w, one, local.hessian, argumentSize, w + blockSize);
+        }
+
+        if(gradient)
+        {
+            for(size_t i = 0; i < nRows; i++)
+            {
+                sigma[i] -= y[i];
+            }
+            Helper::addGradient(local.reader, nRows, nFeatures, 1, sigma, local.gradient);
+        }
+        return Status();
+    })));
+
+    const algorithmFPType batchSizeInv = (algorithmFPType)1.0 / batchSize;
+    const algorithmFPType penaltyL1 = parameter->penaltyL1;
+    const algorithmFPType penaltyL2 = parameter->penaltyL2;
+    if(value)
+    {
+        value[0] *= batchSizeInv;
+        for(size_t j = 1; j < argumentSize; j++)
+        {
+            value[0] += penaltyL1 * (theta[j] < 0 ? -theta[j] : theta[j]) + penaltyL2 * theta[j] * theta[j];
+        }
+    }
+    if(gradient)
+    {
+        gradient[0] = (interceptFlag ? gradient[0] * batchSizeInv : 0);
+        for(size_t j = 1; j < argumentSize; j++)
+        {
+            gradient[j] = gradient[j] * batchSizeInv + 2 * penaltyL2 * theta[j];
+        }
+    }
+    if(hessian)
+    {
+        Helper::symmetrize(hessian, nFeatures, argumentSize);
+        for(size_t j = 0; j < argumentSize * argumentSize; j++)
+        {
+            hessian[j] *= batchSizeInv;
+        }
+        for(size_t j = 1; j < argumentSize; j++)
+        {
+            hessian[j * argumentSize + j] += 2 * penaltyL2;
+        }
+        if(!interceptFlag)
+        {
+            /* The intercept term is fixed: its row and column are the ones of the identity matrix,
+               so the hessian stays non-singular and the Newton step does not change the intercept */
+            for(size_t j = 1; j < argumentSize; j++)
+            {
+                hessian[j] = 0;
+                hessian[j * argumentSize] = 0;
+            }
+            hessian[0] = 1;
+        }
+    }
+    return s;
+}
+
+} // namespace daal::internal
+
+} // namespace logistic_loss
+
+} // namespace optimization_solver
+
+} // namespace algorithms
+
+} // namespace daal
@@ -45,7 +45,6 @@
 
 
 #include "mse_dense_default_batch_kernel.h"
-#include "mse_dense_default_batch_task_impl.i"
 #include "mse_dense_default_batch_impl.i"
 #include "mse_dense_default_batch_container.h"
 
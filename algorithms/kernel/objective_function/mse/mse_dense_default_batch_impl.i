@@ -45,6 +45,9 @@
 //--
 */
 
+#include "service_numeric_table.h"
+#include "objective_function_utils.h"
+
 namespace daal
 {
 namespace algorithms
@@ -55,168 +58,100 @@ namespace mse
 {
 namespace internal
 {
+
+using namespace objective_function::internal;
+
+static const size_t blockSizeDefault = 512;
+
 /**
- *  \brief Kernel for mse objective function calculation
+ *  \brief Kernel for mse objective function calculation.
+ *  Blocks of rows are processed in parallel, the thread-local sums are reduced into the results
  */
 template<typename algorithmFPType, Method method, CpuType cpu>
 inline services::Status MSEKernel<algorithmFPType, method, cpu>::compute(NumericTable *dataNT, NumericTable *dependentVariablesNT, NumericTable *argumentNT,
                                                              NumericTable *valueNT, NumericTable *hessianNT, NumericTable *gradientNT, Parameter *parameter)
 {
-    const size_t nDataRows = dataNT->getNumberOfRows();
-    if(parameter->batchIndices.get() != NULL && parameter->batchIndices->getNumberOfColumns() != nDataRows)
-    {
-        MSETaskSample<algorithmFPType, cpu> task(dataNT, dependentVariablesNT, argumentNT, valueNT, hessianNT, gradientNT, parameter, blockSizeDefault);
-        return run(task);
-    }
-    MSETaskAll<algorithmFPType, cpu> task(dataNT, dependentVariablesNT, argumentNT, valueNT, hessianNT, gradientNT, parameter, blockSizeDefault);
-    return run(task);
-}
-
-template<typename algorithmFPType, Method method, CpuType cpu>
-services::Status MSEKernel<algorithmFPType, method, cpu>::run(MSETask<algorithmFPType, cpu>& task)
-{
-    algorithmFPType *argumentArray = NULL;
-    Status s = task.init(argumentArray);
-    if(!s)
-        return s;
-    algorithmFPType *dataBlock = NULL, *dependentVariablesBlock = NULL;
-    algorithmFPType *value = NULL, *gradient = NULL, *hessian = NULL;
-    DAAL_CHECK_STATUS(s, task.getResultValues(value, gradient, hessian));
-    task.setResultValuesToZero(value, gradient, hessian);
-
-    size_t blockSize = blockSizeDefault;
-    size_t nBlocks = task.batchSize / blockSizeDefault;
-    nBlocks += (nBlocks * blockSizeDefault != task.batchSize);
-    if(nBlocks == 1) { blockSize = task.batchSize; }
-
-    for(size_t block = 0; s.ok() && (block < nBlocks); block++)
-    {
-        if( block == nBlocks - 1 )
-            blockSize = task.batchSize - block * blockSizeDefault;
-
-        s = task.getCurrentBlock(block * blockSizeDefault, blockSize, dataBlock, dependentVariablesBlock);
-        if(s)
-            computeMSE(blockSize, task, dataBlock, argumentArray, dependentVariablesBlock, value, gradient, hessian);
-        task.releaseCurrentBlock();
-    }
-
-    if(s)
-        normalizeResults(task, value, gradient, hessian);
-    task.releaseResultValues();
-    return s;
-}
-
-template<typename algorithmFPType, Method method, CpuType cpu>
-inline void MSEKernel<algorithmFPType, method, cpu>::computeMSE(
-    size_t blockSize,
-    MSETask<algorithmFPType, cpu> &task,
-    algorithmFPType *data,
-    algorithmFPType *argumentArray,
-    algorithmFPType *dependentVariablesArray,
-    algorithmFPType *value,
-    algorithmFPType *gradient,
-    algorithmFPType *hessian)
-{
-    char trans = 'T';
-    algorithmFPType one = 1.0;
-    algorithmFPType zero = 0.0;
-    DAAL_INT n   = (DAAL_INT)blockSize;
-    size_t nTheta = task.nTheta;
-    DAAL_INT dim = (DAAL_INT)nTheta;
-    DAAL_INT ione = 1;
-    algorithmFPType theta0 = argumentArray[0];
-    algorithmFPType *theta = &argumentArray[1];
-    algorithmFPType *xMultTheta = task.xMultTheta.get();
-
-    if (task.gradientFlag || task.valueFlag)
-    {
-        Blas<algorithmFPType, cpu>::xgemv(&trans, &dim, &n, &one, data, &dim, theta, &ione, &zero, xMultTheta, &ione);
-
-        for(size_t i = 0; i < blockSize; i++)
-        {
-            xMultTheta[i] = xMultTheta[i] + theta0 - dependentVariablesArray[i];
-        }
-    }
-
-    if (task.gradientFlag)
+    const size_t nFeatures = dataNT->getNumberOfColumns();
+    const size_t argumentSize = nFeatures + 1;
+
+    ReadRows<int, cpu> indicesRows;
+    const int *indices = nullptr;
+    size_t batchSize = 0;
+    Status s;
+    DAAL_CHECK_STATUS(s, getBatchIndices<cpu>(parameter, dataNT->getNumberOfRows(), indicesRows, indices, batchSize));
+
+    ReadRows<algorithmFPType, cpu> argumentRows(argumentNT, 0, argumentSize);
+    DAAL_CHECK_BLOCK_STATUS(argumentRows);
+    const algorithmFPType *theta = argumentRows.get();
+
+    WriteOnlyRows<algorithmFPType, cpu> valueRows(valueNT, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(valueRows);
+    WriteOnlyRows<algorithmFPType, cpu> gradientRows(gradientNT, 0, argumentSize);
+    DAAL_CHECK_BLOCK_STATUS(gradientRows);
+    WriteOnlyRows<algorithmFPType, cpu> hessianRows(hessianNT, 0, argumentSize);
+    DAAL_CHECK_BLOCK_STATUS(hessianRows);
+
+    algorithmFPType *value    = valueRows.get();
+    algorithmFPType *gradient = gradientRows.get();
+    algorithmFPType *hessian  = hessianRows.get();
+
+    typedef LinearModelHelper<algorithmFPType, cpu> Helper;
+    const size_t blockSize = (batchSize < blockSizeDefault ? batchSize : blockSizeDefault);
+
+    DAAL_CHECK_STATUS(s, (computeSum<algorithmFPType, cpu>(dataNT, dependentVariablesNT, indices, batchSize, blockSize, blockSize,
+        value, gradient, argumentSize, hessian, argumentSize * argumentSize,
+        [=](tls_sum_t<algorithmFPType, cpu> &local, size_t nRows) -> Status
     {
-        for(size_t i = 0; i < blockSize; i++)
+        if(value || gradient)
         {
-            gradient[0] += xMultTheta[i];
-            for(size_t j = 0; j < nTheta; j++)
+            /* Residuals of the linear model */
+            algorithmFPType *r = local.buffer;
+            const algorithmFPType *y = local.reader.y();
+            Helper::computeLinearPredictors(local.reader, nRows, nFeatures, 1, theta, true, r);
+            for(size_t i = 0; i < nRows; i++)
             {
-                gradient[j + 1] += xMultTheta[i] * data[i * nTheta + j];
+                r[i] -= y[i];
             }
-        }
-    }
-
-    if (task.valueFlag)
-    {
-        for(size_t i = 0; i < blockSize; i++)
-        {
-            value[0] += xMultTheta[i] * xMultTheta[i];
-        }
-    }
-
-    if (task.hessianFlag)
-    {
-        char uplo  = 'U';
-        char notrans = 'N';
-        DAAL_INT argumentSize = dim + 1;
-
-        Blas<algorithmFPType, cpu>::xsyrk(&uplo, &notrans, &dim, &n, &one, data, &dim, &one, hessian + argumentSize + 1, &argumentSize);
-
-        for (size_t i = 0; i < blockSize; i++)
-        {
-            for (size_t j = 0; j < nTheta; j++)
+            if(value)
             {
-                hessian[j + 1] += data[i * nTheta + j];
+                for(size_t i = 0; i < nRows; i++)
+                {
+                    local.value += r[i] * r[i];
+                }
             }
-        }
-
-        for (size_t i = 0; i < argumentSize; i++)
-        {
-            for (size_t j = 1; j < i; j++)
+            if(gradient)
             {
-                hessian[j * argumentSize + i] = hessian[i * argumentSize + j];
+                Helper::addGradient(local.reader, nRows, nFeatures, 1, r, local.gradient);
             }
-            hessian[i * argumentSize] = hessian[i];
         }
-    }
-}
+        if(hessian)
+        {
+            Helper::addCrossProduct(local.reader, nRows, nFeatures, nullptr, 1, local.hessian, argumentSize, nullptr);
+        }
+        return Status();
+    })));
 
-template<typename algorithmFPType, Method method, CpuType cpu>
-void MSEKernel<algorithmFPType, method, cpu>::normalizeResults(
-    MSETask<algorithmFPType, cpu> &task,
-    algorithmFPType *value,
-    algorithmFPType *gradient,
-    algorithmFPType *hessian
-)
-{
-    size_t argumentSize = task.argumentSize;
-    const algorithmFPType one = 1.0;
-    algorithmFPType batchSizeInv = (algorithmFPType)one / task.batchSize;
-    if (task.valueFlag)
+    const algorithmFPType batchSizeInv = (algorithmFPType)1.0 / batchSize;
+    if(value)
     {
-        value[0] /= (algorithmFPType)(2 * task.batchSize);
+        value[0] *= (algorithmFPType)0.5 * batchSizeInv;
     }
-
-    if (task.gradientFlag)
+    if(gradient)
     {
         for(size_t j = 0; j < argumentSize; j++)
         {
             gradient[j] *= batchSizeInv;
         }
     }
-
-    if (task.hessianFlag)
+    if(hessian)
     {
-        hessian[0] = one;
-        for(size_t j = 1; j < argumentSize * argumentSize; j++)
+        Helper::symmetrize(hessian, nFeatures, argumentSize);
+        for(size_t j = 0; j < argumentSize * argumentSize; j++)
         {
             hessian[j] *= batchSizeInv;
         }
     }
+    return s;
 }
 
 } // namespace daal::internal
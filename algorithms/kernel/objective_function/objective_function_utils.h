@@ -0,0 +1,590 @@
+/* file: objective_function_utils.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Building blocks of the objective functions represented as sums of terms
+//  computed over the rows of the data set.
+//--
+*/
+
+#ifndef __OBJECTIVE_FUNCTION_UTILS_H__
+#define __OBJECTIVE_FUNCTION_UTILS_H__
+
+#include "numeric_table.h"
+#include "csr_numeric_table.h"
+#include "sum_of_functions_types.h"
+#include "service_numeric_table.h"
+#include "service_memory.h"
+#include "service_math.h"
+#include "service_blas.h"
+#include "service_error_handling.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace objective_function
+{
+namespace internal
+{
+
+using namespace daal::data_management;
+using namespace daal::internal;
+using namespace daal::services;
+using namespace daal::services::internal;
+
+/**
+ *  Provides access to the rows of the data set and the dependent variables.
+ *  The rows are read either as a contiguous range or as the range of the batch indices.
+ *  Rows of a CSR numeric table are returned in CSR format with one-based column indices and
+ *  row offsets; rows of other numeric tables are returned as a dense row-major block
+ */
+template<typename algorithmFPType, CpuType cpu>
+class BlockReader
+{
+public:
+    BlockReader(NumericTable *data, NumericTable *dependentVariables, const int *indices, size_t blockSize) :
+        _data(data), _csrData(dynamic_cast<CSRNumericTableIface *>(data)), _dependentVariables(dependentVariables),
+        _indices(indices), _nFeatures(data->getNumberOfColumns()),
+        _x(nullptr), _y(nullptr), _values(nullptr), _colIndices(nullptr), _rowOffsets(nullptr)
+    {
+        if(_indices)
+        {
+            _yBuffer.reset(blockSize);
+            if(_csrData)
+                _rowOffsetsBuffer.reset(blockSize + 1);
+            else
+                _xBuffer.reset(blockSize * _nFeatures);
+        }
+    }
+
+    bool isValid() const
+    {
+        if(!_indices)
+            return true;
+        return _yBuffer.get() && (_csrData ? _rowOffsetsBuffer.get() != nullptr : _xBuffer.get() != nullptr);
+    }
+
+    bool isSparse() const { return (_csrData != nullptr); }
+
+    Status read(size_t startRow, size_t nRows)
+    {
+        return (_indices ? gather(_indices + startRow, nRows) : readRange(startRow, nRows));
+    }
+
+    const algorithmFPType *x() const { return _x; }
+    const algorithmFPType *y() const { return _y; }
+    const algorithmFPType *values() const { return _values; }
+    const size_t *colIndices() const { return _colIndices; }
+    const size_t *rowOffsets() const { return _rowOffsets; }
+
+private:
+    Status readRange(size_t startRow, size_t nRows)
+    {
+        _y = _yRows.set(_dependentVariables, startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS(_yRows);
+        if(_csrData)
+        {
+            _csrRows.set(_csrData, startRow, nRows);
+            DAAL_CHECK_BLOCK_STATUS(_csrRows);
+            _values     = _csrRows.values();
+            _colIndices = _csrRows.cols();
+            _rowOffsets = _csrRows.rows();
+        }
+        else
+        {
+            _x = _xRows.set(_data, startRow, nRows);
+            DAAL_CHECK_BLOCK_STATUS(_xRows);
+        }
+        return Status();
+    }
+
+    Status gather(const int *indices, size_t nRows)
+    {
+        algorithmFPType *y = _yBuffer.get();
+        for(size_t i = 0; i < nRows; i++)
+        {
+            const algorithmFPType *yRow = _yRows.set(_dependentVariables, indices[i], 1);
+            DAAL_CHECK_BLOCK_STATUS(_yRows);
+            y[i] = yRow[0];
+        }
+        _y = y;
+        return (_csrData ? gatherSparse(indices, nRows) : gatherDense(indices, nRows));
+    }
+
+    Status gatherDense(const int *indices, size_t nRows)
+    {
+        algorithmFPType *x = _xBuffer.get();
+        for(size_t i = 0; i < nRows; i++)
+        {
+            const algorithmFPType *xRow = _xRows.set(_data, indices[i], 1);
+            DAAL_CHECK_BLOCK_STATUS(_xRows);
+            for(size_t j = 0; j < _nFeatures; j++)
+            {
+                x[i * _nFeatures + j] = xRow[j];
+            }
+        }
+        _x = x;
+        return Status();
+    }
+
+    /* The number of non-zero values in the sampled rows is not known in advance:
+       the first pass computes the row offsets, the second pass copies the rows */
+    Status gatherSparse(const int *indices, size_t nRows)
+    {
+        size_t *rowOffsets = _rowOffsetsBuffer.get();
+        rowOffsets[0] = 1;
+        for(size_t i = 0; i < nRows; i++)
+        {
+            _csrRows.set(_csrData, indices[i], 1);
+            DAAL_CHECK_BLOCK_STATUS(_csrRows);
+            rowOffsets[i + 1] = rowOffsets[i] + (_csrRows.rows()[1] - _csrRows.rows()[0]);
+        }
+
+        const size_t nValues = rowOffsets[nRows] - 1;
+        if(nValues > _valuesBuffer.size())
+        {
+            _valuesBuffer.reset(nValues);
+            _colIndicesBuffer.reset(nValues);
+            DAAL_CHECK_MALLOC(_valuesBuffer.get() && _colIndicesBuffer.get());
+        }
+        algorithmFPType *values = _valuesBuffer.get();
+        size_t *colIndices = _colIndicesBuffer.get();
+
+        for(size_t i = 0; i < nRows; i++)
+        {
+            _csrRows.set(_csrData, indices[i], 1);
+            DAAL_CHECK_BLOCK_STATUS(_csrRows);
+            const algorithmFPType *rowValues = _csrRows.values();
+            const size_t *rowColIndices = _csrRows.cols();
+            const size_t offset = rowOffsets[i] - 1;
+            for(size_t k = 0; k < rowOffsets[i + 1] - rowOffsets[i]; k++)
+            {
+                values[offset + k] = rowValues[k];
+                colIndices[offset + k] = rowColIndices[k];
+            }
+        }
+        _values     = values;
+        _colIndices = colIndices;
+        _rowOffsets = rowOffsets;
+        return Status();
+    }
+
+    NumericTable *_data;
+    CSRNumericTableIface *_csrData;
+    NumericTable *_dependentVariables;
+    const int *_indices;
+    size_t _nFeatures;
+
+    ReadRows<algorithmFPType, cpu> _xRows;
+    ReadRows<algorithmFPType, cpu> _yRows;
+    ReadRowsCSR<algorithmFPType, cpu> _csrRows;
+
+    TArray<algorithmFPType, cpu> _xBuffer;
+    TArray<algorithmFPType, cpu> _yBuffer;
+    TArray<algorithmFPType, cpu> _valuesBuffer;
+    TArray<size_t, cpu> _colIndicesBuffer;
+    TArray<size_t, cpu> _rowOffsetsBuffer;
+
+    const algorithmFPType *_x;
+    const algorithmFPType *_y;
+    const algorithmFPType *_values;
+    const size_t *_colIndices;
+    const size_t *_rowOffsets;
+};
+
+/**
+ *  Thread-local partial sums of the objective function value, gradient and hessian
+ */
+template<typename algorithmFPType, CpuType cpu>
+struct tls_sum_t
+{
+    DAAL_NEW_DELETE();
+    BlockReader<algorithmFPType, cpu> reader;
+    algorithmFPType  value;
+    algorithmFPType *gradient;
+    algorithmFPType *hessian;
+    algorithmFPType *buffer;
+
+    tls_sum_t(NumericTable *data, NumericTable *dependentVariables, const int *indices, size_t blockSize,
+              size_t gradientSize, size_t hessianSize, size_t bufferSize) :
+        reader(data, dependentVariables, indices, blockSize), value(0), gradient(nullptr), hessian(nullptr), buffer(nullptr),
+        _gradientSize(gradientSize), _hessianSize(hessianSize), _bufferSize(bufferSize)
+    {
+        if(gradientSize)
+            gradient = service_scalable_calloc<algorithmFPType, cpu>(gradientSize);
+        if(hessianSize)
+            hessian = service_scalable_calloc<algorithmFPType, cpu>(hessianSize);
+        if(bufferSize)
+            buffer = service_scalable_malloc<algorithmFPType, cpu>(bufferSize);
+    }
+
+    bool isValid() const
+    {
+        return reader.isValid() && (!_gradientSize || gradient) && (!_hessianSize || hessian) && (!_bufferSize || buffer);
+    }
+
+    ~tls_sum_t()
+    {
+        if(gradient)
+            service_scalable_free<algorithmFPType, cpu>(gradient);
+        if(hessian)
+            service_scalable_free<algorithmFPType, cpu>(hessian);
+        if(buffer)
+            service_scalable_free<algorithmFPType, cpu>(buffer);
+    }
+
+private:
+    size_t _gradientSize;
+    size_t _hessianSize;
+    size_t _bufferSize;
+};
+
+/**
+ *  Returns the batch indices of the sum of functions or nullptr if all the terms are used
+ */
+template<CpuType cpu>
+Status getBatchIndices(const sum_of_functions::Parameter *parameter, size_t nTerms,
+                       ReadRows<int, cpu> &indicesRows, const int *&indices, size_t &batchSize)
+{
+    indices = nullptr;
+    batchSize = nTerms;
+    NumericTable *batchIndices = parameter->batchIndices.get();
+    if(batchIndices && batchIndices->getNumberOfColumns() != nTerms)
+    {
+        batchSize = batchIndices->getNumberOfColumns();
+        indices = indicesRows.set(batchIndices, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(indicesRows);
+    }
+    return Status();
+}
+
+/**
+ *  Computes the sum of the terms over the blocks of rows in parallel.
+ *  computeBlock(tls_sum_t &local, size_t nRows) adds the terms of the block of rows
+ *  loaded into local.reader to the thread-local partial sums.
+ *  The partial sums are reduced into value, gradient and hessian; the results
+ *  that are not requested are passed as null pointers
+ */
+template<typename algorithmFPType, CpuType cpu, typename ComputeBlock>
+Status computeSum(NumericTable *data, NumericTable *dependentVariables, const int *indices, size_t nRows,
+                  size_t blockSize, size_t bufferSize,
+                  algorithmFPType *value, algorithmFPType *gradient, size_t gradientSize,
+                  algorithmFPType *hessian, size_t hessianSize, const ComputeBlock &computeBlock)
+{
+    if(!gradient)
+        gradientSize = 0;
+    if(!hessian)
+        hessianSize = 0;
+
+    size_t nBlocks = nRows / blockSize;
+    nBlocks += (nBlocks * blockSize != nRows);
+
+    SafeStatus safeStat;
+    daal::tls<tls_sum_t<algorithmFPType, cpu> *> tlsData([=, &safeStat]()
+    {
+        tls_sum_t<algorithmFPType, cpu> *local = new tls_sum_t<algorithmFPType, cpu>(data, dependentVariables, indices, blockSize,
+                                                                                    gradientSize, hessianSize, bufferSize);
+        if(!local || !local->isValid())
+        {
+            safeStat.add(services::ErrorMemoryAllocationFailed);
+            delete local;
+            local = nullptr;
+        }
+        return local;
+    });
+
+    daal::threader_for(nBlocks, nBlocks, [&](int iBlock)
+    {
+        tls_sum_t<algorithmFPType, cpu> *local = tlsData.local();
+        if(!local)
+            return;
+
+        const size_t startRow = iBlock * blockSize;
+        const size_t nRowsInBlock = (iBlock == nBlocks - 1) ? nRows - startRow : blockSize;
+
+        Status s = local->reader.read(startRow, nRowsInBlock);
+        if(s)
+            s = computeBlock(*local, nRowsInBlock);
+        if(!s)
+            safeStat.add(s);
+    });
+
+    if(value)
+        *value = 0;
+    for(size_t j = 0; j < gradientSize; j++)
+        gradient[j] = 0;
+    for(size_t j = 0; j < hessianSize; j++)
+        hessian[j] = 0;
+
+    tlsData.reduce([=](tls_sum_t<algorithmFPType, cpu> *local)
+    {
+        if(!local)
+            return;
+        if(value)
+            *value += local->value;
+        for(size_t j = 0; j < gradientSize; j++)
+            gradient[j] += local->gradient[j];
+        for(size_t j = 0; j < hessianSize; j++)
+            hessian[j] += local->hessian[j];
+        delete local;
+    });
+    return safeStat.detach();
+}
+
+/**
+ *  Building blocks of the linear models used by the objective functions.
+ *  The argument of the K linear models is stored in the K x (p + 1) row-major array theta,
+ *  theta[k * (p + 1)] is the intercept term of the k-th model
+ */
+template<typename algorithmFPType, CpuType cpu>
+struct LinearModelHelper
+{
+    /* Computes s[i * K + k] = theta_k0 + x_i^T theta_k for the rows of the block */
+    static void computeLinearPredictors(const BlockReader<algorithmFPType, cpu> &reader, size_t nRows, size_t nFeatures,
+                                        size_t nModels, const algorithmFPType *theta, bool interceptFlag, algorithmFPType *s)
+    {
+        const size_t ldTheta = nFeatures + 1;
+        if(reader.isSparse())
+        {
+            const algorithmFPType *values = reader.values();
+            const size_t *colIndices = reader.colIndices();
+            const size_t *rowOffsets = reader.rowOffsets();
+            for(size_t i = 0; i < nRows; i++)
+            {
+                for(size_t k = 0; k < nModels; k++)
+                {
+                    const algorithmFPType *thetaK = theta + k * ldTheta;
+                    algorithmFPType sum = 0;
+                    for(size_t idx = rowOffsets[i] - rowOffsets[0]; idx < rowOffsets[i + 1] - rowOffsets[0]; idx++)
+                    {
+                        sum += values[idx] * thetaK[colIndices[idx]];
+                    }
+                    s[i * nModels + k] = sum;
+                }
+            }
+        }
+        else
+        {
+            algorithmFPType *x = const_cast<algorithmFPType *>(reader.x());
+            algorithmFPType *thetaPtr = const_cast<algorithmFPType *>(theta + 1);
+            algorithmFPType one = 1.0;
+            algorithmFPType zero = 0.0;
+            DAAL_INT n = (DAAL_INT)nRows;
+            DAAL_INT dim = (DAAL_INT)nFeatures;
+            DAAL_INT k = (DAAL_INT)nModels;
+            DAAL_INT ld = (DAAL_INT)ldTheta;
+            if(nModels == 1)
+            {
+                char trans = 'T';
+                DAAL_INT ione = 1;
+                Blas<algorithmFPType, cpu>::xxgemv(&trans, &dim, &n, &one, x, &dim, thetaPtr, &ione, &zero, s, &ione);
+            }
+            else
+            {
+                char trans = 'T';
+                char notrans = 'N';
+                Blas<algorithmFPType, cpu>::xxgemm(&trans, &notrans, &k, &n, &dim, &one, thetaPtr, &ld, x, &dim, &zero, s, &k);
+            }
+        }
+
+        if(interceptFlag)
+        {
+            for(size_t i = 0; i < nRows; i++)
+            {
+                for(size_t k = 0; k < nModels; k++)
+                {
+                    s[i * nModels + k] += theta[k * ldTheta];
+                }
+            }
+        }
+    }
+
+    /* Adds sum_i r[i * K + k] * (1, x_i) to the k-th row of the K x (p + 1) array g */
+    static void addGradient(const BlockReader<algorithmFPType, cpu> &reader, size_t nRows, size_t nFeatures,
+                            size_t nModels, const algorithmFPType *r, algorithmFPType *g)
+    {
+        const size_t ldG = nFeatures + 1;
+        for(size_t i = 0; i < nRows; i++)
+        {
+            for(size_t k = 0; k < nModels; k++)
+            {
+                g[k * ldG] += r[i * nModels + k];
+            }
+        }
+
+        if(reader.isSparse())
+        {
+            const algorithmFPType *values = reader.values();
+            const size_t *colIndices = reader.colIndices();
+            const size_t *rowOffsets = reader.rowOffsets();
+            for(size_t i = 0; i < nRows; i++)
+            {
+                for(size_t idx = rowOffsets[i] - rowOffsets[0]; idx < rowOffsets[i + 1] - rowOffsets[0]; idx++)
+                {
+                    for(size_t k = 0; k < nModels; k++)
+                    {
+                        g[k * ldG + colIndices[idx]] += r[i * nModels + k] * values[idx];
+                    }
+                }
+            }
+        }
+        else
+        {
+            algorithmFPType *x = const_cast<algorithmFPType *>(reader.x());
+            algorithmFPType *rPtr = const_cast<algorithmFPType *>(r);
+            algorithmFPType one = 1.0;
+            DAAL_INT n = (DAAL_INT)nRows;
+            DAAL_INT dim = (DAAL_INT)nFeatures;
+            DAAL_INT k = (DAAL_INT)nModels;
+            DAAL_INT ld = (DAAL_INT)ldG;
+            char notrans = 'N';
+            if(nModels == 1)
+            {
+                DAAL_INT ione = 1;
+                Blas<algorithmFPType, cpu>::xxgemv(&notrans, &dim, &n, &one, x, &dim, rPtr, &ione, &one, g + 1, &ione);
+            }
+            else
+            {
+                char trans = 'T';
+                Blas<algorithmFPType, cpu>::xxgemm(&notrans, &trans, &dim, &k, &n, &one, x, &dim, rPtr, &k, &one, g + 1, &ld);
+            }
+        }
+    }
+
+    /**
+     * Adds alpha * sum_i w_i * (1, x_i)(1, x_i)^T to the (p + 1) x (p + 1) block h with the leading dimension ldh.
+     * Only the first row and the lower triangle of the block are updated, see symmetrize().
+     * The weights w_i must be non-negative; w == nullptr stands for the unit weights.
+     * The buffer of size nRows x p is used for the dense data with weights
+     */
+    static void addCrossProduct(const BlockReader<algorithmFPType, cpu> &reader, size_t nRows, size_t nFeatures,
+                                const algorithmFPType *w, algorithmFPType alpha, algorithmFPType *h, size_t ldh,
+                                algorithmFPType *buffer)
+    {
+        if(reader.isSparse())
+        {
+            const algorithmFPType *values = reader.values();
+            const size_t *colIndices = reader.colIndices();
+            const size_t *rowOffsets = reader.rowOffsets();
+            for(size_t i = 0; i < nRows; i++)
+            {
+                const algorithmFPType wi = (w ? alpha * w[i] : alpha);
+                const size_t begin = rowOffsets[i] - rowOffsets[0];
+                const size_t end = rowOffsets[i + 1] - rowOffsets[0];
+                h[0] += wi;
+                for(size_t a = begin; a < end; a++)
+                {
+                    const algorithmFPType wx = wi * values[a];
+                    h[colIndices[a]] += wx;
+                    for(size_t b = begin; b < end; b++)
+                    {
+                        if(colIndices[b] <= colIndices[a])
+                            h[colIndices[a] * ldh + colIndices[b]] += wx * values[b];
+                    }
+                }
+            }
+            return;
+        }
+
+        const algorithmFPType *x = reader.x();
+        for(size_t i = 0; i < nRows; i++)
+        {
+            const algorithmFPType wi = (w ? alpha * w[i] : alpha);
+            h[0] += wi;
+            for(size_t j = 0; j < nFeatures; j++)
+            {
+                h[j + 1] += wi * x[i * nFeatures + j];
+            }
+        }
+
+        algorithmFPType *a = const_cast<algorithmFPType *>(x);
+        if(w)
+        {
+            for(size_t i = 0; i < nRows; i++)
+            {
+                const algorithmFPType sqrtW = Math<algorithmFPType, cpu>::sSqrt(w[i]);
+                for(size_t j = 0; j < nFeatures; j++)
+                {
+                    buffer[i * nFeatures + j] = sqrtW * x[i * nFeatures + j];
+                }
+            }
+            a = buffer;
+        }
+
+        char uplo = 'U';
+        char notrans = 'N';
+        algorithmFPType one = 1.0;
+        DAAL_INT n = (DAAL_INT)nRows;
+        DAAL_INT dim = (DAAL_INT)nFeatures;
+        DAAL_INT ld = (DAAL_INT)ldh;
+        Blas<algorithmFPType, cpu>::xxsyrk(&uplo, &notrans, &dim, &n, &alpha, a, &dim, &one, h + ldh + 1, &ld);
+    }
+
+    /* Restores the symmetric (p + 1) x (p + 1) block from its first row and lower triangle */
+    static void symmetrize(algorithmFPType *h, size_t nFeatures, size_t ldh)
+    {
+        for(size_t i = 1; i <= nFeatures; i++)
+        {
+            h[i * ldh] = h[i];
+            for(size_t j = 1; j < i; j++)
+            {
+                h[j * ldh + i] = h[i * ldh + j];
+            }
+        }
+    }
+};
+
+} // namespace internal
+
+} // namespace objective_function
+
+} // namespace optimization_solver
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,109 @@
+/* file: coordinate_descent_dense_default_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+//++
+//  Implementation of coordinate descent algorithm
+//--
+
+
+#include "coordinate_descent_task.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace coordinate_descent
+{
+namespace internal
+{
+
+/**
+ *  \brief Kernel for the coordinate descent minimization of the Mean squared error objective function
+ *  with the elastic net penalty
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+services::Status CoordinateDescentKernel<algorithmFPType, method, cpu>::compute(NumericTable *data, NumericTable *dependentVariables,
+    NumericTable *inputArgument, NumericTable *minimum, NumericTable *nIterations, const Parameter *parameter)
+{
+    const size_t argumentSize = inputArgument->getNumberOfRows();
+    DAAL_CHECK(argumentSize == data->getNumberOfColumns() + 1, ErrorIncorrectNumberOfRows);
+
+    WriteOnlyRows<int, cpu> nIterationsRows(nIterations, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nIterationsRows);
+    int *nProceededIterations = nIterationsRows.get();
+    nProceededIterations[0] = 0;
+
+    WriteOnlyRows<algorithmFPType, cpu> minimumRows(minimum, 0, argumentSize);
+    DAAL_CHECK_BLOCK_STATUS(minimumRows);
+    algorithmFPType *theta = minimumRows.get();
+    {
+        ReadRows<algorithmFPType, cpu> inputArgumentRows(inputArgument, 0, argumentSize);
+        DAAL_CHECK_BLOCK_STATUS(inputArgumentRows);
+        const algorithmFPType *startValue = inputArgumentRows.get();
+        for(size_t j = 0; j < argumentSize; j++)
+        {
+            theta[j] = startValue[j];
+        }
+    }
+
+    CoordinateDescentTask<algorithmFPType, cpu> task(data, dependentVariables, parameter->interceptFlag);
+    Status s;
+    DAAL_CHECK_STATUS(s, task.init());
+
+    size_t nIter = 0;
+    DAAL_CHECK_STATUS(s, task.solve(0, theta, (algorithmFPType)parameter->penaltyL1, (algorithmFPType)parameter->penaltyL2,
+                                    (algorithmFPType)parameter->previousPenaltyL1, parameter->screeningFlag, false,
+                                    parameter->nIterations, (algorithmFPType)parameter->accuracyThreshold, nIter));
+    nProceededIterations[0] = (int)nIter;
+    return s;
+}
+
+} // namespace daal::internal
+
+} // namespace coordinate_descent
+
+} // namespace optimization_solver
+
+} // namespace algorithms
+
+} // namespace daal
@@ -0,0 +1,816 @@
+/* file: coordinate_descent_task.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Cyclic coordinate descent for the least squares problem with the elastic net penalty.
+//--
+*/
+
+#ifndef __COORDINATE_DESCENT_TASK_H__
+#define __COORDINATE_DESCENT_TASK_H__
+
+#include "objective_function_utils.h"
+#include "service_defines.h"
+#include "service_sparse_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace coordinate_descent
+{
+namespace internal
+{
+
+using namespace daal::data_management;
+using namespace daal::internal;
+using namespace daal::services;
+using namespace daal::services::internal;
+using namespace objective_function::internal;
+
+/**
+ *  Minimizes 1/(2n) |y - theta_0 - X theta|^2 + penaltyL1 * |theta|_1 + penaltyL2 * |theta|_2^2
+ *  over the components of theta for each column y of the dependent variables.
+ *
+ *  The coordinates of the working set are updated with the covariance updates: the gradient over
+ *  the working set is kept up to date with the cached inner products of the centered columns of X.
+ *  The data is accessed only to extend the cache when features enter the working set and to compute
+ *  the gradient over all the features from the residuals at the end of each round. The working set
+ *  is selected with the sequential strong rules and extended with the features that violate
+ *  the optimality conditions. The cache and the last gradient are kept between the calls to solve(),
+ *  so the consecutive problems of a regularization path are warm started.
+ *
+ *  If the working set grows above _cacheCapacityMax features, for example when the screening
+ *  is disabled or penaltyL1 is zero, the cache is dropped and the coordinates are updated
+ *  with the naive updates instead: the gradient component is computed from the residuals and
+ *  the column of the feature, and the residuals are updated after each step. Sparse data is
+ *  converted into columns once for the naive updates, so each step touches only the non-zero
+ *  values of the column. The passes over a column are split into blocks of rows processed in parallel
+ */
+template<typename algorithmFPType, CpuType cpu>
+class CoordinateDescentTask
+{
+public:
+    CoordinateDescentTask(NumericTable *data, NumericTable *dependentVariables, bool interceptFlag) :
+        _data(data), _dependentVariables(dependentVariables), _interceptFlag(interceptFlag),
+        _nRows(data->getNumberOfRows()), _nFeatures(data->getNumberOfColumns()),
+        _nResponses(dependentVariables->getNumberOfColumns()),
+        _blockSize(data->getNumberOfRows() < _blockSizeDefault ? data->getNumberOfRows() : _blockSizeDefault),
+        _gram(nullptr), _cacheSize(0), _cacheCapacity(0), _workingSetSize(0),
+        _naiveUpdates(false), _sparseColumns(nullptr), _residualSum(0), _gradientResponse(0), _gradientValid(false)
+    {}
+
+    ~CoordinateDescentTask()
+    {
+        if(_gram)
+            service_free<algorithmFPType, cpu>(_gram);
+        delete _sparseColumns;
+    }
+
+    /**
+     *  Computes the means of the features and of the dependent variables and
+     *  the inner products of the centered features with the dependent variables
+     */
+    Status init()
+    {
+        const size_t p = _nFeatures;
+        const size_t nResponses = _nResponses;
+        _means.reset(p);
+        _yMeans.reset(nResponses);
+        _xty.reset(nResponses * p);
+        _gradient.reset(p);
+        _cacheGradient.reset(p);
+        _cacheFeatures.reset(p);
+        _cachePosition.reset(p);
+        _workingSet.reset(p);
+        _inWorkingSet.reset(p);
+        DAAL_CHECK_MALLOC(_means.get() && _yMeans.get() && _xty.get() && _gradient.get() && _cacheGradient.get() &&
+                          _cacheFeatures.get() && _cachePosition.get() && _workingSet.get() && _inWorkingSet.get());
+        for(size_t j = 0; j < p; j++)
+        {
+            _cachePosition[j] = -1;
+            _inWorkingSet[j] = 0;
+        }
+
+        /* The sums of the columns of X and X^T y are the gradient sums of the nResponses + 1 linear models
+           with the residuals (y, 1) */
+        const size_t nModels = nResponses + 1;
+        const size_t ld = p + 1;
+        TArray<algorithmFPType, cpu> sums(nModels * ld);
+        DAAL_CHECK_MALLOC(sums.get());
+
+        Status s;
+        DAAL_CHECK_STATUS(s, (computeSum<algorithmFPType, cpu>(_data, _dependentVariables, nullptr, _nRows, _blockSize, _blockSize * nModels,
+            (algorithmFPType *)nullptr, sums.get(), nModels * ld, (algorithmFPType *)nullptr, 0,
+            [=](tls_sum_t<algorithmFPType, cpu> &local, size_t nRows) -> Status
+        {
+            algorithmFPType *r = local.buffer;
+            const algorithmFPType *y = local.reader.y();
+            for(size_t i = 0; i < nRows; i++)
+            {
+                for(size_t k = 0; k < nResponses; k++)
+                {
+                    r[i * nModels + k] = y[i * nResponses + k];
+                }
+                r[i * nModels + nResponses] = 1;
+            }
+            Helper::addGradient(local.reader, nRows, p, nModels, r, local.gradient);
+            return Status();
+        })));
+
+        const algorithmFPType invN = (algorithmFPType)1.0 / (algorithmFPType)_nRows;
+        const algorithmFPType *colSums = sums.get() + nResponses * ld + 1;
+        for(size_t j = 0; j < p; j++)
+        {
+            _means[j] = (_interceptFlag ? colSums[j] * invN : 0);
+        }
+        for(size_t k = 0; k < nResponses; k++)
+        {
+            const algorithmFPType *xty = sums.get() + k * ld;
+            _yMeans[k] = (_interceptFlag ? xty[0] * invN : 0);
+            for(size_t j = 0; j < p; j++)
+            {
+                _xty[k * p + j] = xty[j + 1] - _yMeans[k] * colSums[j];
+            }
+        }
+        return s;
+    }
+
+    /**
+     *  Returns the smallest L1 regularization coefficient for which the minimum of the problem
+     *  for the given response is zero, the first point of the regularization path
+     */
+    algorithmFPType maxPenaltyL1(size_t response) const
+    {
+        const algorithmFPType *xty = _xty.get() + response * _nFeatures;
+        algorithmFPType maxValue = 0;
+        for(size_t j = 0; j < _nFeatures; j++)
+        {
+            const algorithmFPType value = (xty[j] < 0 ? -xty[j] : xty[j]);
+            maxValue = (value > maxValue ? value : maxValue);
+        }
+        return maxValue / (algorithmFPType)_nRows;
+    }
+
+    /**
+     *  Minimizes the objective function for the given response starting from theta.
+     *  theta is the array of size p + 1, theta[0] is the intercept term; if the intercept is not
+     *  computed, theta[0] keeps its input value.
+     *  If warmStart is true, theta must be the minimum computed by the previous call to solve()
+     *  for the same response, the gradient at theta is then taken from that call.
+     *  nIterations returns the number of passes over the coordinates of the working set
+     */
+    Status solve(size_t response, algorithmFPType *theta, algorithmFPType penaltyL1, algorithmFPType penaltyL2,
+                 algorithmFPType previousPenaltyL1, bool screeningFlag, bool warmStart,
+                 size_t maxIterations, algorithmFPType accuracyThreshold, size_t &nIterations)
+    {
+        Status s;
+        nIterations = 0;
+        if(!(warmStart && _gradientValid && _gradientResponse == response))
+        {
+            DAAL_CHECK_STATUS(s, computeGradient(response, theta));
+        }
+        if(_naiveUpdates)
+        {
+            DAAL_CHECK_STATUS(s, computeResiduals(response, theta));
+        }
+
+        const size_t p = _nFeatures;
+        const algorithmFPType *c = _gradient.get();
+        if(previousPenaltyL1 <= 0)
+        {
+            for(size_t j = 0; j < p; j++)
+            {
+                const algorithmFPType absC = (c[j] < 0 ? -c[j] : c[j]);
+                previousPenaltyL1 = (absC > previousPenaltyL1 ? absC : previousPenaltyL1);
+            }
+        }
+
+        /* Sequential strong rule: the features with |c_j| < 2 * penaltyL1 - previousPenaltyL1 are discarded */
+        const algorithmFPType strongThreshold = 2 * penaltyL1 - previousPenaltyL1;
+        clearWorkingSet();
+        TArray<size_t, cpu> candidates(p);
+        DAAL_CHECK_MALLOC(candidates.get());
+        size_t nCandidates = 0;
+        for(size_t j = 0; j < p; j++)
+        {
+            const algorithmFPType absC = (c[j] < 0 ? -c[j] : c[j]);
+            if(theta[j + 1] != 0 || !screeningFlag || absC >= strongThreshold)
+            {
+                candidates[nCandidates++] = j;
+            }
+        }
+        DAAL_CHECK_STATUS(s, addToWorkingSet(candidates.get(), nCandidates, response, theta));
+
+        TArray<size_t, cpu> nonZero(p);
+        DAAL_CHECK_MALLOC(nonZero.get());
+        for(;;)
+        {
+            /* Full passes over the working set alternate with the passes over its non-zero coordinates */
+            while(nIterations < maxIterations)
+            {
+                algorithmFPType maxDecrease = 0;
+                nIterations++;
+                DAAL_CHECK_STATUS(s, sweep(_workingSet.get(), _workingSetSize, theta, penaltyL1, penaltyL2, maxDecrease));
+                if(maxDecrease < accuracyThreshold)
+                    break;
+
+                while(nIterations < maxIterations)
+                {
+                    size_t nNonZero = 0;
+                    for(size_t i = 0; i < _workingSetSize; i++)
+                    {
+                        if(theta[_cacheFeatures[_workingSet[i]] + 1] != 0)
+                            nonZero[nNonZero++] = _workingSet[i];
+                    }
+                    nIterations++;
+                    DAAL_CHECK_STATUS(s, sweep(nonZero.get(), nNonZero, theta, penaltyL1, penaltyL2, maxDecrease));
+                    if(maxDecrease < accuracyThreshold)
+                        break;
+                }
+            }
+
+            DAAL_CHECK_STATUS(s, computeGradient(response, theta));
+            if(nIterations >= maxIterations)
+                break;
+
+            /* Optimality conditions for the features outside of the working set */
+            nCandidates = 0;
+            for(size_t j = 0; j < p; j++)
+            {
+                const algorithmFPType absC = (c[j] < 0 ? -c[j] : c[j]);
+                if(!_inWorkingSet[j] && absC > penaltyL1)
+                {
+                    candidates[nCandidates++] = j;
+                }
+            }
+            if(nCandidates == 0)
+                break;
+            DAAL_CHECK_STATUS(s, addToWorkingSet(candidates.get(), nCandidates, response, theta));
+            for(size_t i = 0; i < _workingSetSize; i++)
+            {
+                _cacheGradient[_workingSet[i]] = c[_cacheFeatures[_workingSet[i]]];
+            }
+        }
+        return s;
+    }
+
+private:
+    typedef LinearModelHelper<algorithmFPType, cpu> Helper;
+
+    /* Sets the intercept term that minimizes the objective function for the given coefficients */
+    void setIntercept(size_t response, algorithmFPType *theta) const
+    {
+        if(!_interceptFlag)
+            return;
+        algorithmFPType intercept = _yMeans[response];
+        for(size_t j = 0; j < _nFeatures; j++)
+        {
+            intercept -= _means[j] * theta[j + 1];
+        }
+        theta[0] = intercept;
+    }
+
+    /* Computes c_j = 1/n sum_i (x_ij - mean_j) * r_i, where r are the residuals at theta,
+       the anti-gradient of the least squares part of the objective function */
+    Status computeGradient(size_t response, algorithmFPType *theta)
+    {
+        setIntercept(response, theta);
+
+        const size_t p = _nFeatures;
+        const size_t nResponses = _nResponses;
+        const algorithmFPType *thetaConst = theta;
+        TArray<algorithmFPType, cpu> sums(p + 1);
+        DAAL_CHECK_MALLOC(sums.get());
+
+        Status s;
+        DAAL_CHECK_STATUS(s, (computeSum<algorithmFPType, cpu>(_data, _dependentVariables, nullptr, _nRows, _blockSize, _blockSize,
+            (algorithmFPType *)nullptr, sums.get(), p + 1, (algorithmFPType *)nullptr, 0,
+            [=](tls_sum_t<algorithmFPType, cpu> &local, size_t nRows) -> Status
+        {
+            algorithmFPType *r = local.buffer;
+            const algorithmFPType *y = local.reader.y();
+            Helper::computeLinearPredictors(local.reader, nRows, p, 1, thetaConst, true, r);
+            for(size_t i = 0; i < nRows; i++)
+            {
+                r[i] = y[i * nResponses + response] - r[i];
+            }
+            Helper::addGradient(local.reader, nRows, p, 1, r, local.gradient);
+            return Status();
+        })));
+
+        const algorithmFPType invN = (algorithmFPType)1.0 / (algorithmFPType)_nRows;
+        const algorithmFPType residualSum = sums[0];
+        for(size_t j = 0; j < p; j++)
+        {
+            _gradient[j] = (sums[j + 1] - _means[j] * residualSum) * invN;
+        }
+        _gradientResponse = response;
+        _gradientValid = true;
+        return s;
+    }
+
+    /* Performs a pass of the coordinate updates over the given cache positions.
+       maxDecrease returns the largest decrease of the objective function caused by one update */
+    Status sweep(const size_t *positions, size_t nPositions, algorithmFPType *theta,
+                 algorithmFPType penaltyL1, algorithmFPType penaltyL2, algorithmFPType &maxDecrease)
+    {
+        maxDecrease = 0;
+        if(_naiveUpdates)
+            return sweepNaive(positions, nPositions, theta, penaltyL1, penaltyL2, maxDecrease);
+
+        const algorithmFPType invN = (algorithmFPType)1.0 / (algorithmFPType)_nRows;
+        algorithmFPType *g = _cacheGradient.get();
+        for(size_t i = 0; i < nPositions; i++)
+        {
+            const size_t pos = positions[i];
+            const algorithmFPType *gramRow = _gram + pos * _cacheCapacity;
+            const algorithmFPType a = gramRow[pos] * invN;
+            const algorithmFPType denominator = a + 2 * penaltyL2;
+            if(denominator <= 0)
+                continue;
+
+            algorithmFPType &thetaJ = theta[_cacheFeatures[pos] + 1];
+            const algorithmFPType delta = updateCoordinate(g[pos] + a * thetaJ, denominator, penaltyL1, thetaJ, maxDecrease);
+            if(delta == 0)
+                continue;
+
+            /* Covariance update of the gradient over the cached features */
+            const algorithmFPType scale = delta * invN;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t q = 0; q < _cacheSize; q++)
+            {
+                g[q] -= gramRow[q] * scale;
+            }
+        }
+        return Status();
+    }
+
+    /* Naive updates: the cache positions are the features, the gradient component is computed from the residuals */
+    Status sweepNaive(const size_t *positions, size_t nPositions, algorithmFPType *theta,
+                      algorithmFPType penaltyL1, algorithmFPType penaltyL2, algorithmFPType &maxDecrease)
+    {
+        const size_t n = _nRows;
+        const algorithmFPType invN = (algorithmFPType)1.0 / (algorithmFPType)n;
+        ReadColumns<algorithmFPType, cpu> columnBlock;
+        Status s;
+        for(size_t i = 0; i < nPositions; i++)
+        {
+            const size_t j = positions[i];
+            const algorithmFPType *x = nullptr;
+            const size_t *rows = nullptr;
+            size_t nValues = 0;
+            DAAL_CHECK_STATUS(s, readColumn(j, columnBlock, x, rows, nValues));
+
+            algorithmFPType dot = 0;
+            algorithmFPType columnSum = 0;
+            algorithmFPType squaresSum = 0;
+            DAAL_CHECK_STATUS(s, computeColumnSums(x, rows, nValues, dot, columnSum, squaresSum));
+
+            /* Residuals are not centered, the centering of the column removes their mean */
+            const algorithmFPType mean = _means[j];
+            const algorithmFPType a = (squaresSum - 2 * mean * columnSum + (algorithmFPType)n * mean * mean) * invN;
+            const algorithmFPType denominator = a + 2 * penaltyL2;
+            if(denominator <= 0)
+                continue;
+
+            algorithmFPType &thetaJ = theta[j + 1];
+            const algorithmFPType g = (dot - mean * _residualSum) * invN;
+            const algorithmFPType delta = updateCoordinate(g + a * thetaJ, denominator, penaltyL1, thetaJ, maxDecrease);
+            if(delta == 0)
+                continue;
+
+            updateResiduals(x, rows, nValues, delta);
+            _residualSum -= delta * columnSum;
+        }
+        return s;
+    }
+
+    /* Gets column j of the data: nValues values x with their 1-based row indices rows for sparse data,
+       all the n values of the column and rows equal to nullptr for dense data */
+    Status readColumn(size_t j, ReadColumns<algorithmFPType, cpu> &columnBlock,
+                      const algorithmFPType *&x, const size_t *&rows, size_t &nValues)
+    {
+        if(_sparseColumns)
+        {
+            const size_t *offsets = _sparseColumns->offsets();
+            x = _sparseColumns->values() + offsets[j] - 1;
+            rows = _sparseColumns->indices() + offsets[j] - 1;
+            nValues = offsets[j + 1] - offsets[j];
+            return Status();
+        }
+        x = columnBlock.set(_data, j, 0, _nRows);
+        rows = nullptr;
+        nValues = _nRows;
+        return columnBlock.status();
+    }
+
+    /* Computes the inner product of the column with the residuals, the sum and the sum of squares of its values */
+    Status computeColumnSums(const algorithmFPType *x, const size_t *rows, size_t nValues,
+                             algorithmFPType &dot, algorithmFPType &columnSum, algorithmFPType &squaresSum) const
+    {
+        const size_t nBlocks = nValues / _columnBlockSize + !!(nValues % _columnBlockSize);
+        TArray<algorithmFPType, cpu> partialSums(3 * nBlocks);
+        DAAL_CHECK_MALLOC(!nBlocks || partialSums.get());
+
+        const algorithmFPType *r = _residuals.get();
+        algorithmFPType *partial = partialSums.get();
+        daal::threader_for(nBlocks, nBlocks, [=](int iBlock)
+        {
+            const size_t begin = iBlock * _columnBlockSize;
+            const size_t end = (begin + _columnBlockSize < nValues ? begin + _columnBlockSize : nValues);
+            algorithmFPType blockDot = 0;
+            algorithmFPType blockSum = 0;
+            algorithmFPType blockSquares = 0;
+            if(rows)
+            {
+                for(size_t k = begin; k < end; k++)
+                {
+                    blockDot += x[k] * r[rows[k] - 1];
+                    blockSum += x[k];
+                    blockSquares += x[k] * x[k];
+                }
+            }
+            else
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for(size_t k = begin; k < end; k++)
+                {
+                    blockDot += x[k] * r[k];
+                    blockSum += x[k];
+                    blockSquares += x[k] * x[k];
+                }
+            }
+            partial[3 * iBlock]     = blockDot;
+            partial[3 * iBlock + 1] = blockSum;
+            partial[3 * iBlock + 2] = blockSquares;
+        });
+
+        dot = columnSum = squaresSum = 0;
+        for(size_t iBlock = 0; iBlock < nBlocks; iBlock++)
+        {
+            dot        += partial[3 * iBlock];
+            columnSum  += partial[3 * iBlock + 1];
+            squaresSum += partial[3 * iBlock + 2];
+        }
+        return Status();
+    }
+
+    /* Subtracts delta times the column from the residuals */
+    void updateResiduals(const algorithmFPType *x, const size_t *rows, size_t nValues, algorithmFPType delta)
+    {
+        const size_t nBlocks = nValues / _columnBlockSize + !!(nValues % _columnBlockSize);
+        algorithmFPType *r = _residuals.get();
+        daal::threader_for(nBlocks, nBlocks, [=](int iBlock)
+        {
+            const size_t begin = iBlock * _columnBlockSize;
+            const size_t end = (begin + _columnBlockSize < nValues ? begin + _columnBlockSize : nValues);
+            if(rows)
+            {
+                PRAGMA_IVDEP
+                for(size_t k = begin; k < end; k++)
+                {
+                    r[rows[k] - 1] -= delta * x[k];
+                }
+            }
+            else
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for(size_t k = begin; k < end; k++)
+                {
+                    r[k] -= delta * x[k];
+                }
+            }
+        });
+    }
+
+    /* Soft-thresholding step of one coordinate. Returns the change of the coordinate */
+    static algorithmFPType updateCoordinate(algorithmFPType z, algorithmFPType denominator, algorithmFPType penaltyL1,
+                                            algorithmFPType &thetaJ, algorithmFPType &maxDecrease)
+    {
+        algorithmFPType newThetaJ = 0;
+        if(z > penaltyL1)
+            newThetaJ = (z - penaltyL1) / denominator;
+        else if(z < -penaltyL1)
+            newThetaJ = (z + penaltyL1) / denominator;
+
+        const algorithmFPType delta = newThetaJ - thetaJ;
+        thetaJ = newThetaJ;
+        const algorithmFPType decrease = (algorithmFPType)0.5 * denominator * delta * delta;
+        maxDecrease = (decrease > maxDecrease ? decrease : maxDecrease);
+        return delta;
+    }
+
+    /* Computes the residuals y - theta_0 - X theta for the given response column by column */
+    Status computeResiduals(size_t response, const algorithmFPType *theta)
+    {
+        const size_t n = _nRows;
+        algorithmFPType *r = _residuals.get();
+        {
+            ReadColumns<algorithmFPType, cpu> yBlock(_dependentVariables, response, 0, n);
+            DAAL_CHECK_BLOCK_STATUS(yBlock);
+            const algorithmFPType *y = yBlock.get();
+            for(size_t k = 0; k < n; k++)
+            {
+                r[k] = y[k] - theta[0];
+            }
+        }
+        ReadColumns<algorithmFPType, cpu> columnBlock;
+        Status s;
+        for(size_t j = 0; j < _nFeatures; j++)
+        {
+            const algorithmFPType thetaJ = theta[j + 1];
+            if(thetaJ == 0)
+                continue;
+            const algorithmFPType *x = nullptr;
+            const size_t *rows = nullptr;
+            size_t nValues = 0;
+            DAAL_CHECK_STATUS(s, readColumn(j, columnBlock, x, rows, nValues));
+            updateResiduals(x, rows, nValues, thetaJ);
+        }
+        _residualSum = 0;
+        for(size_t k = 0; k < n; k++)
+        {
+            _residualSum += r[k];
+        }
+        return s;
+    }
+
+    /* Drops the cache and switches to the naive updates, the cache positions become the features.
+       Sparse data is converted into columns here once for all the following updates */
+    Status switchToNaiveUpdates(size_t response, const algorithmFPType *theta)
+    {
+        _residuals.reset(_nRows);
+        DAAL_CHECK_MALLOC(_residuals.get());
+        if(dynamic_cast<CSRNumericTableIface *>(_data))
+        {
+            _sparseColumns = new ReadColumnsSparse<algorithmFPType, cpu>(_data);
+            DAAL_CHECK_MALLOC(_sparseColumns);
+            DAAL_CHECK_STATUS_VAR(_sparseColumns->status());
+        }
+        for(size_t i = 0; i < _workingSetSize; i++)
+        {
+            _workingSet[i] = _cacheFeatures[_workingSet[i]];
+        }
+        for(size_t j = 0; j < _nFeatures; j++)
+        {
+            _cacheFeatures[j] = j;
+            _cachePosition[j] = (int)j;
+        }
+        if(_gram)
+            service_free<algorithmFPType, cpu>(_gram);
+        _gram = nullptr;
+        _cacheSize = _nFeatures;
+        _cacheCapacity = 0;
+        _naiveUpdates = true;
+        return computeResiduals(response, theta);
+    }
+
+    void clearWorkingSet()
+    {
+        for(size_t i = 0; i < _workingSetSize; i++)
+        {
+            _inWorkingSet[_cacheFeatures[_workingSet[i]]] = 0;
+        }
+        _workingSetSize = 0;
+    }
+
+    /* Adds the features to the working set; the features that are not cached yet are added to the cache.
+       theta is the current argument of the problem for the given response */
+    Status addToWorkingSet(const size_t *features, size_t nFeatures, size_t response, const algorithmFPType *theta)
+    {
+        TArray<size_t, cpu> newFeatures(nFeatures);
+        DAAL_CHECK_MALLOC(!nFeatures || newFeatures.get());
+        size_t nNew = 0;
+        for(size_t i = 0; i < nFeatures; i++)
+        {
+            if(_cachePosition[features[i]] < 0)
+                newFeatures[nNew++] = features[i];
+        }
+        Status s;
+        if(nNew && _cacheSize + nNew > _cacheCapacityMax)
+        {
+            DAAL_CHECK_STATUS(s, switchToNaiveUpdates(response, theta));
+        }
+        else if(nNew)
+        {
+            DAAL_CHECK_STATUS(s, extendCache(newFeatures.get(), nNew));
+        }
+        for(size_t i = 0; i < nFeatures; i++)
+        {
+            const size_t j = features[i];
+            if(_inWorkingSet[j])
+                continue;
+            _inWorkingSet[j] = 1;
+            _workingSet[_workingSetSize++] = _cachePosition[j];
+            _cacheGradient[_cachePosition[j]] = _gradient[j];
+        }
+        return s;
+    }
+
+    Status reserveCache(size_t capacity)
+    {
+        if(capacity <= _cacheCapacity)
+            return Status();
+        size_t newCapacity = (2 * _cacheCapacity > _cacheCapacityMin ? 2 * _cacheCapacity : _cacheCapacityMin);
+        newCapacity = (newCapacity > capacity ? newCapacity : capacity);
+        newCapacity = (newCapacity < _nFeatures ? newCapacity : _nFeatures);
+
+        algorithmFPType *gram = service_malloc<algorithmFPType, cpu>(newCapacity * newCapacity);
+        DAAL_CHECK_MALLOC(gram);
+        for(size_t a = 0; a < _cacheSize; a++)
+        {
+            for(size_t b = 0; b < _cacheSize; b++)
+            {
+                gram[a * newCapacity + b] = _gram[a * _cacheCapacity + b];
+            }
+        }
+        if(_gram)
+            service_free<algorithmFPType, cpu>(_gram);
+        _gram = gram;
+        _cacheCapacity = newCapacity;
+        return Status();
+    }
+
+    /* Computes the inner products of the centered new features with all the cached features in one pass over the data */
+    Status extendCache(const size_t *features, size_t nNew)
+    {
+        Status s;
+        DAAL_CHECK_STATUS(s, reserveCache(_cacheSize + nNew));
+
+        const size_t first = _cacheSize;
+        for(size_t t = 0; t < nNew; t++)
+        {
+            _cacheFeatures[first + t] = features[t];
+            _cachePosition[features[t]] = (int)(first + t);
+        }
+        _cacheSize += nNew;
+
+        const size_t p = _nFeatures;
+        const size_t nCached = _cacheSize;
+        const size_t *cacheFeatures = _cacheFeatures.get();
+        const int *cachePosition = _cachePosition.get();
+        TArray<algorithmFPType, cpu> crossProducts(nNew * nCached);
+        DAAL_CHECK_MALLOC(crossProducts.get());
+
+        DAAL_CHECK_STATUS(s, (computeSum<algorithmFPType, cpu>(_data, _dependentVariables, nullptr, _nRows, _blockSize, _blockSize * nCached,
+            (algorithmFPType *)nullptr, crossProducts.get(), nNew * nCached, (algorithmFPType *)nullptr, 0,
+            [=](tls_sum_t<algorithmFPType, cpu> &local, size_t nRows) -> Status
+        {
+            /* Rows of the block restricted to the cached features */
+            algorithmFPType *xc = local.buffer;
+            const BlockReader<algorithmFPType, cpu> &reader = local.reader;
+            if(reader.isSparse())
+            {
+                const algorithmFPType *values = reader.values();
+                const size_t *colIndices = reader.colIndices();
+                const size_t *rowOffsets = reader.rowOffsets();
+                for(size_t i = 0; i < nRows * nCached; i++)
+                {
+                    xc[i] = 0;
+                }
+                for(size_t i = 0; i < nRows; i++)
+                {
+                    for(size_t idx = rowOffsets[i] - rowOffsets[0]; idx < rowOffsets[i + 1] - rowOffsets[0]; idx++)
+                    {
+                        const int pos = cachePosition[colIndices[idx] - 1];
+                        if(pos >= 0)
+                            xc[i * nCached + pos] = values[idx];
+                    }
+                }
+            }
+            else
+            {
+                const algorithmFPType *x = reader.x();
+                for(size_t i = 0; i < nRows; i++)
+                {
+                    for(size_t c = 0; c < nCached; c++)
+                    {
+                        xc[i * nCached + c] = x[i * p + cacheFeatures[c]];
+                    }
+                }
+            }
+
+            for(size_t i = 0; i < nRows; i++)
+            {
+                const algorithmFPType *xcRow = xc + i * nCached;
+                for(size_t t = 0; t < nNew; t++)
+                {
+                    const algorithmFPType xit = xcRow[first + t];
+                    if(xit == 0)
+                        continue;
+                    algorithmFPType *sum = local.gradient + t * nCached;
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for(size_t c = 0; c < nCached; c++)
+                    {
+                        sum[c] += xit * xcRow[c];
+                    }
+                }
+            }
+            return Status();
+        })));
+
+        const algorithmFPType n = (algorithmFPType)_nRows;
+        for(size_t t = 0; t < nNew; t++)
+        {
+            const algorithmFPType meanT = _means[_cacheFeatures[first + t]];
+            for(size_t c = 0; c < nCached; c++)
+            {
+                const algorithmFPType value = crossProducts[t * nCached + c] - n * meanT * _means[_cacheFeatures[c]];
+                _gram[(first + t) * _cacheCapacity + c] = value;
+                _gram[c * _cacheCapacity + first + t] = value;
+            }
+        }
+        return s;
+    }
+
+    static const size_t _blockSizeDefault = 512;
+    static const size_t _cacheCapacityMin = 64;
+    static const size_t _cacheCapacityMax = 4096;   /* Limits the cache to 4096 x 4096 inner products */
+    static const size_t _columnBlockSize = 4096;    /* Number of values of a column processed by one thread in the naive updates */
+
+    NumericTable *_data;
+    NumericTable *_dependentVariables;
+    bool _interceptFlag;
+    size_t _nRows;
+    size_t _nFeatures;
+    size_t _nResponses;
+    size_t _blockSize;
+
+    TArray<algorithmFPType, cpu> _means;         /* Means of the features, zero if the intercept is not computed */
+    TArray<algorithmFPType, cpu> _yMeans;        /* Means of the dependent variables, zero if the intercept is not computed */
+    TArray<algorithmFPType, cpu> _xty;           /* Inner products of the centered features with the dependent variables */
+    TArray<algorithmFPType, cpu> _gradient;      /* Anti-gradient over all the features from the last pass over the data */
+
+    algorithmFPType *_gram;                      /* Inner products of the centered cached features */
+    TArray<algorithmFPType, cpu> _cacheGradient; /* Anti-gradient over the cached features kept up to date by the covariance updates */
+    TArray<size_t, cpu> _cacheFeatures;          /* Features in the order of their positions in the cache */
+    TArray<int, cpu> _cachePosition;             /* Positions of the features in the cache, -1 for the features that are not cached */
+    size_t _cacheSize;
+    size_t _cacheCapacity;
+
+    TArray<size_t, cpu> _workingSet;             /* Cache positions of the features of the working set */
+    TArray<char, cpu> _inWorkingSet;
+    size_t _workingSetSize;
+
+    bool _naiveUpdates;                          /* The cache is dropped, the coordinates are updated from the residuals */
+    ReadColumnsSparse<algorithmFPType, cpu> *_sparseColumns; /* Columns of the sparse data for the naive updates */
+    TArray<algorithmFPType, cpu> _residuals;     /* Residuals y - theta_0 - X theta of the current response for the naive updates */
+    algorithmFPType _residualSum;
+
+    size_t _gradientResponse;
+    bool _gradientValid;
+};
+
+} // namespace internal
+} // namespace coordinate_descent
+} // namespace optimization_solver
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,90 @@
+/* file: coordinate_descent_types.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of coordinate descent solver classes.
+//--
+*/
+
+#include "algorithms/optimization_solver/coordinate_descent/coordinate_descent_types.h"
+#include "algorithms/optimization_solver/objective_function/mse_types.h"
+#include "daal_strings.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace coordinate_descent
+{
+namespace interface1
+{
+
+Parameter::Parameter(const sum_of_functions::BatchPtr &function_, size_t nIterations_, double accuracyThreshold_,
+                     double penaltyL1_, double penaltyL2_) :
+    optimization_solver::iterative_solver::Parameter(function_, nIterations_, accuracyThreshold_),
+    penaltyL1(penaltyL1_),
+    penaltyL2(penaltyL2_),
+    previousPenaltyL1(0.0),
+    interceptFlag(true),
+    screeningFlag(true)
+{}
+
+services::Status Parameter::check() const
+{
+    services::Status s = iterative_solver::Parameter::check();
+    if(!s) return s;
+
+    DAAL_CHECK_EX(dynamic_cast<const mse::Input *>(function->sumOfFunctionsInput), services::ErrorIncorrectParameter,
+                  services::ArgumentName, objectiveFunctionStr());
+    DAAL_CHECK_EX(penaltyL1 >= 0, services::ErrorIncorrectParameter, services::ArgumentName, penaltyL1Str());
+    DAAL_CHECK_EX(penaltyL2 >= 0, services::ErrorIncorrectParameter, services::ArgumentName, penaltyL2Str());
+    DAAL_CHECK_EX(previousPenaltyL1 >= 0, services::ErrorIncorrectParameter, services::ArgumentName, previousPenaltyL1Str());
+    return s;
+}
+
+} // namespace interface1
+} // namespace coordinate_descent
+} // namespace optimization_solver
+} // namespace algorithm
+} // namespace daal
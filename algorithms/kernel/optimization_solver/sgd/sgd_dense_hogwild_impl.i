@@ -0,0 +1,318 @@
+/* file: sgd_dense_hogwild_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of sgd hogwild algorithm
+//
+// Feng Niu, Benjamin Recht, Christopher Re, Stephen J. Wright HOGWILD!: A Lock-Free Approach to Parallelizing Stochastic Gradient Descent
+//--
+*/
+
+#ifndef __SGD_DENSE_HOGWILD_IMPL_I__
+#define __SGD_DENSE_HOGWILD_IMPL_I__
+
+#include "service_numeric_table.h"
+#include "service_math.h"
+#include "service_utils.h"
+#include "service_rng.h"
+#include "service_error_handling.h"
+#include "service_data_utils.h"
+#include "engine_batch_impl.h"
+#include "iterative_solver_kernel.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace sgd
+{
+namespace internal
+{
+
+/**
+ *  \brief Kernel for SGD hogwild calculation.
+ *  Each worker computes the stochastic gradient at the snapshot of the shared argument and applies the update
+ *  to the shared argument without locks. The gradient is discarded if more than maxStaleness updates
+ *  were applied by other workers since the snapshot was taken
+ */
+template<typename algorithmFPType, CpuType cpu>
+services::Status SGDKernel<algorithmFPType, hogwild, cpu>::compute(NumericTable *inputArgument, NumericTable *minimum, NumericTable *nProceededIterationsNT,
+        Parameter<hogwild> *parameter, NumericTable *learningRateSequence,
+        NumericTable *batchIndices, OptionalArgument *optionalArgument, OptionalArgument *optionalResult, engines::BatchBase &engine)
+{
+    typedef daal::internal::RNGs<int, cpu> RNGsType;
+    services::Status s;
+    const size_t argumentSize = inputArgument->getNumberOfRows();
+    const size_t nIter = parameter->nIterations;
+    const size_t batchSize = parameter->batchSize;
+    const algorithmFPType accuracyThreshold = parameter->accuracyThreshold;
+
+    WriteRows<int, cpu, NumericTable> nProceededIterationsBD(*nProceededIterationsNT, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nProceededIterationsBD);
+    int *nProceededIterations = nProceededIterationsBD.get();
+    nProceededIterations[0] = 0;
+
+    WriteRows<algorithmFPType, cpu, NumericTable> workValueBD(*minimum, 0, argumentSize);
+    DAAL_CHECK_BLOCK_STATUS(workValueBD);
+    algorithmFPType *workValue = workValueBD.get();
+    {
+        ReadRows<algorithmFPType, cpu, NumericTable> startValueBD(*inputArgument, 0, argumentSize);
+        DAAL_CHECK_BLOCK_STATUS(startValueBD);
+        daal_memcpy_s(workValue, argumentSize * sizeof(algorithmFPType), startValueBD.get(), argumentSize * sizeof(algorithmFPType));
+    }
+
+    /* if nIter == 0, set result as start point, the number of executed iters to 0 */
+    if(nIter == 0)
+        return s;
+
+    size_t startIteration = 0;
+    NumericTable *lastIterationInput = optionalArgument ? NumericTable::cast(optionalArgument->get(iterative_solver::lastIteration)).get() : nullptr;
+    if(lastIterationInput)
+    {
+        ReadRows<int, cpu, NumericTable> lastIterationInputBD(lastIterationInput, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(lastIterationInputBD);
+        startIteration = lastIterationInputBD.get()[0];
+    }
+
+    ReadRows<algorithmFPType, cpu, NumericTable> learningRateBD(*learningRateSequence, 0, learningRateSequence->getNumberOfRows());
+    DAAL_CHECK_BLOCK_STATUS(learningRateBD);
+    const algorithmFPType *learningRateArray = learningRateBD.get();
+    const size_t learningRateLength = learningRateSequence->getNumberOfRows();
+
+    ReadRows<int, cpu> predefinedBatchIndicesBD(batchIndices, 0, nIter);
+    DAAL_CHECK_BLOCK_STATUS(predefinedBatchIndicesBD);
+    const int *predefinedBatchIndices = predefinedBatchIndicesBD.get();
+
+    sum_of_functions::BatchPtr function = parameter->function;
+    const size_t nTerms = function->sumOfFunctionsParameter->numberOfTerms;
+    const IndicesStatus indicesStatus = (batchIndices ? user : (batchSize < nTerms ? random : all));
+
+    size_t nWorkers = daal::threader_get_threads_number();
+    nWorkers = (nWorkers < nIter ? nWorkers : nIter);
+    nWorkers = (nWorkers ? nWorkers : 1);
+
+    /* The seeds of the workers are generated by the engine of the algorithm, so the sequence of batch indices
+       of each worker is reproducible */
+    TArray<int, cpu> seeds(nWorkers);
+    DAAL_CHECK_MALLOC(seeds.get());
+    if(indicesStatus == random)
+    {
+        engines::internal::BatchBaseImpl *engineImpl = dynamic_cast<engines::internal::BatchBaseImpl *>(&engine);
+        DAAL_CHECK(engineImpl, ErrorIncorrectEngineParameter);
+        const int maxSeed = daal::data_feature_utils::internal::MaxVal<int, cpu>::get();
+        DAAL_CHECK(!RNGsType().uniform(nWorkers, seeds.get(), engineImpl->getState(), 0, maxSeed), ErrorIncorrectErrorcodeFromGenerator);
+    }
+    else
+    {
+        for(size_t i = 0; i < nWorkers; i++)
+            seeds[i] = 0;
+    }
+
+    TArray<SGDHogwildWorker<algorithmFPType, cpu> *, cpu> workers(nWorkers);
+    DAAL_CHECK_MALLOC(workers.get());
+    for(size_t i = 0; i < nWorkers; i++)
+    {
+        workers[i] = nullptr;
+    }
+    for(size_t i = 0; i < nWorkers; i++)
+    {
+        workers[i] = new SGDHogwildWorker<algorithmFPType, cpu>(function, argumentSize, batchSize, indicesStatus != all, (unsigned int)seeds[i]);
+        if(!workers[i])
+        {
+            s = Status(ErrorMemoryAllocationFailed);
+            break;
+        }
+        if(!(s = workers[i]->init()))
+            break;
+    }
+
+    SGDHogwildScheduler scheduler(nIter, parameter->maxStaleness);
+    SafeStatus safeStat;
+    if(s)
+    {
+        daal::threader_for(nWorkers, nWorkers, [&](int iWorker)
+        {
+            SGDHogwildWorker<algorithmFPType, cpu> &worker = *workers[iWorker];
+            algorithmFPType *argument = worker.argument.get();
+            int *indices = worker.indices.get();
+            size_t iteration = 0;
+            size_t version = 0;
+            while(scheduler.next(iteration, version))
+            {
+                /* Snapshot of the shared argument, other workers keep updating it */
+                for(size_t j = 0; j < argumentSize; j++)
+                {
+                    argument[j] = workValue[j];
+                }
+
+                if(indicesStatus == user)
+                {
+                    for(size_t j = 0; j < batchSize; j++)
+                    {
+                        indices[j] = predefinedBatchIndices[iteration * batchSize + j];
+                    }
+                }
+                else if(indicesStatus == random)
+                {
+                    if(RNGsType().uniformWithoutReplacement(batchSize, indices, worker.brng, 0, (int)nTerms))
+                    {
+                        safeStat.add(ErrorIncorrectErrorcodeFromGenerator);
+                        scheduler.stop();
+                        return;
+                    }
+                }
+
+                Status localStatus = worker.function->computeNoThrow();
+                if(!localStatus)
+                {
+                    safeStat.add(localStatus);
+                    scheduler.stop();
+                    return;
+                }
+
+                NumericTable *gradientNT = worker.function->getResult()->get(objective_function::gradientIdx).get();
+                ReadRows<algorithmFPType, cpu, NumericTable> gradientBD(gradientNT, 0, argumentSize);
+                if(!gradientBD.status())
+                {
+                    safeStat.add(gradientBD.status());
+                    scheduler.stop();
+                    return;
+                }
+                const algorithmFPType *gradient = gradientBD.get();
+
+                if(nIter > 1)
+                {
+                    algorithmFPType pointNorm = 0;
+                    algorithmFPType gradientNorm = 0;
+                    for(size_t j = 0; j < argumentSize; j++)
+                    {
+                        pointNorm += argument[j] * argument[j];
+                        gradientNorm += gradient[j] * gradient[j];
+                    }
+                    const algorithmFPType one(1.0);
+                    const algorithmFPType gradientThreshold = accuracyThreshold *
+                        daal::internal::Math<algorithmFPType, cpu>::sMax(one, daal::internal::Math<algorithmFPType, cpu>::sSqrt(pointNorm));
+                    if(daal::internal::Math<algorithmFPType, cpu>::sSqrt(gradientNorm) < gradientThreshold)
+                    {
+                        scheduler.stop();
+                        return;
+                    }
+                }
+
+                if(!scheduler.accept(version))
+                    continue;
+
+                /* Lock-free update of the shared argument */
+                const algorithmFPType learningRate = learningRateArray[(startIteration + iteration) % learningRateLength];
+                for(size_t j = 0; j < argumentSize; j++)
+                {
+                    workValue[j] -= learningRate * gradient[j];
+                }
+            }
+        });
+        s = safeStat.detach();
+    }
+
+    for(size_t i = 0; i < nWorkers; i++)
+    {
+        delete workers[i];
+    }
+
+    nProceededIterations[0] = (int)scheduler.nApplied();
+
+    NumericTable *lastIterationResult = optionalResult ? NumericTable::cast(optionalResult->get(iterative_solver::lastIteration)).get() : nullptr;
+    if(s && lastIterationResult)
+    {
+        WriteRows<int, cpu, NumericTable> lastIterationResultBD(lastIterationResult, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(lastIterationResultBD);
+        lastIterationResultBD.get()[0] = (int)(startIteration + scheduler.nApplied());
+    }
+    return s;
+}
+
+template<typename algorithmFPType, CpuType cpu>
+SGDHogwildWorker<algorithmFPType, cpu>::SGDHogwildWorker(const sum_of_functions::BatchPtr &function_, size_t argumentSize_, size_t batchSize_,
+    bool sampleFlag_, unsigned int seed) :
+    function(function_->clone()),
+    argument(argumentSize_),
+    indices(batchSize_),
+    brng(seed),
+    argumentSize(argumentSize_),
+    batchSize(batchSize_),
+    sampleFlag(sampleFlag_)
+{}
+
+template<typename algorithmFPType, CpuType cpu>
+services::Status SGDHogwildWorker<algorithmFPType, cpu>::init()
+{
+    services::Status s;
+    DAAL_CHECK_MALLOC(function.get() && argument.get() && indices.get());
+
+    ntArgument.reset(new HomogenNumericTableCPU<algorithmFPType, cpu>(argument.get(), 1, argumentSize, s));
+    DAAL_CHECK_MALLOC(ntArgument.get());
+    DAAL_CHECK_STATUS_VAR(s);
+    function->sumOfFunctionsInput->set(sum_of_functions::argument, ntArgument);
+
+    if(sampleFlag)
+    {
+        ntBatchIndices.reset(new HomogenNumericTableCPU<int, cpu>(indices.get(), batchSize, 1, s));
+        DAAL_CHECK_MALLOC(ntBatchIndices.get());
+        DAAL_CHECK_STATUS_VAR(s);
+        function->sumOfFunctionsParameter->batchIndices = ntBatchIndices;
+    }
+    else
+    {
+        function->sumOfFunctionsParameter->batchIndices = NumericTablePtr();
+    }
+    return s;
+}
+
+} // namespace daal::internal
+} // namespace sgd
+} // namespace optimization_solver
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,165 @@
+/* file: sgd_dense_hogwild_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+//++
+//  Declaration of template function that calculate sgd.
+//--
+
+
+#ifndef __SGD_DENSE_HOGWILD_KERNEL_H__
+#define __SGD_DENSE_HOGWILD_KERNEL_H__
+
+#include "sgd_batch.h"
+#include "kernel.h"
+#include "numeric_table.h"
+#include "iterative_solver_kernel.h"
+#include "sgd_dense_kernel.h"
+#include "sgd_dense_minibatch_kernel.h"
+#include "service_numeric_table.h"
+#include "service_rng.h"
+#include "service_threading.h"
+#include "daal_atomic_int.h"
+
+using namespace daal::data_management;
+using namespace daal::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace sgd
+{
+namespace internal
+{
+
+template<typename algorithmFPType, CpuType cpu>
+class SGDKernel<algorithmFPType, hogwild, cpu> : public iterative_solver::internal::IterativeSolverKernel<algorithmFPType, cpu>
+{
+public:
+    services::Status compute(NumericTable *inputArgument, NumericTable *minimum, NumericTable *nIterations,
+                 Parameter<hogwild> *parameter, NumericTable *learningRateSequence,
+                 NumericTable *batchIndices, OptionalArgument *optionalArgument, OptionalArgument *optionalResult, engines::BatchBase &engine);
+};
+
+/**
+ * Resources of one asynchronous worker: a copy of the objective function,
+ * the snapshot of the shared argument it computes the gradient at and the generator of the batch indices
+ */
+template<typename algorithmFPType, CpuType cpu>
+struct SGDHogwildWorker
+{
+    DAAL_NEW_DELETE();
+
+    SGDHogwildWorker(const sum_of_functions::BatchPtr &function, size_t argumentSize, size_t batchSize, bool sampleFlag, unsigned int seed);
+
+    services::Status init();
+
+    sum_of_functions::BatchPtr function;
+    TArray<algorithmFPType, cpu> argument;
+    TArray<int, cpu> indices;
+    SharedPtr<daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu> > ntArgument;
+    SharedPtr<daal::internal::HomogenNumericTableCPU<int, cpu> > ntBatchIndices;
+    daal::internal::BaseRNGs<cpu> brng;
+    size_t argumentSize;
+    size_t batchSize;
+    bool sampleFlag;
+};
+
+/**
+ * Distributes the iterations among the workers and bounds the staleness of the applied gradients.
+ * The version of the argument is the number of the updates applied to it.
+ * The counters are atomic, so the workers do not serialize on the scheduler;
+ * the staleness bound is checked before the update is counted and may be exceeded by the number of the workers
+ */
+class SGDHogwildScheduler
+{
+public:
+    SGDHogwildScheduler(size_t nIterations, size_t maxStaleness) :
+        _nIterations(nIterations), _maxStaleness(maxStaleness), _nIssued(0), _nApplied(0), _stopFlag(0) {}
+
+    /* Returns false if all the iterations are issued or the algorithm has converged */
+    bool next(size_t &iteration, size_t &version)
+    {
+        if(_stopFlag.get())
+            return false;
+        const int issued = _nIssued.inc();
+        if((size_t)issued > _nIterations)
+            return false;
+        iteration = (size_t)(issued - 1);
+        version = (size_t)_nApplied.get();
+        return true;
+    }
+
+    /* Returns true if the gradient computed at the given version of the argument can be applied */
+    bool accept(size_t version)
+    {
+        if(_stopFlag.get() || (size_t)_nApplied.get() - version > _maxStaleness)
+            return false;
+        _nApplied.inc();
+        return true;
+    }
+
+    void stop() { _stopFlag.set(1); }
+
+    size_t nApplied() const { return (size_t)_nApplied.get(); }
+
+private:
+    size_t _nIterations;
+    size_t _maxStaleness;
+    AtomicInt _nIssued;
+    AtomicInt _nApplied;
+    AtomicInt _stopFlag;
+};
+
+} // namespace daal::internal
+
+} // namespace sgd
+
+} // namespace optimization_solver
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -215,6 +215,43 @@ services::Status Parameter<momentum>::check() const
     return s;
 }
 
+Parameter<hogwild>::Parameter(
+    const sum_of_functions::BatchPtr &function,
+    size_t nIterations,
+    double accuracyThreshold,
+    NumericTablePtr batchIndices,
+    size_t batchSize,
+    size_t maxStaleness,
+    NumericTablePtr learningRateSequence,
+    size_t seed) :
+    BaseParameter(function,
+                  nIterations,
+                  accuracyThreshold,
+                  batchIndices,
+                  learningRateSequence,
+                  batchSize,
+                  seed),
+    maxStaleness(maxStaleness)
+{}
+
+/**
+ * Checks the correctness of the parameter
+ */
+services::Status Parameter<hogwild>::check() const
+{
+    services::Status s = BaseParameter::check();
+    if(!s) return s;
+    if(batchIndices.get() != NULL)
+    {
+        s |= checkNumericTable(batchIndices.get(), batchIndicesStr(), 0, 0, batchSize, nIterations);
+        if(!s) return s;
+    }
+
+    DAAL_CHECK_EX(batchSize <= function->sumOfFunctionsParameter->numberOfTerms && batchSize > 0, ErrorIncorrectParameter, \
+                  ArgumentName, "batchSize");
+    return s;
+}
+
 Input::Input() {}
 Input::Input(const Input& other) {}
 
@@ -0,0 +1,243 @@
+/* file: outlierdetection_bacon_dense_distr_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of multivariate BACON outlier detection in the distributed processing mode
+//--
+*/
+
+#ifndef __BACONOUTLIER_DETECTION_DENSE_DISTR_IMPL_I__
+#define __BACONOUTLIER_DETECTION_DENSE_DISTR_IMPL_I__
+
+#include "outlierdetection_bacon_dense_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace bacon_outlier_detection
+{
+namespace internal
+{
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OutlierDetectionDistrStep1Kernel<algorithmFPType, method, cpu>::compute(
+    NumericTable &dataTable, NumericTable *meanTable, NumericTable *covarianceTable, NumericTable *thresholdTable,
+    NumericTable &nObservationsTable, NumericTable &nSubsetObservationsTable, NumericTable &partialSumTable,
+    NumericTable &partialCrossProductTable, NumericTable &partialWeightsTable, NumericTable &partialShiftTable, const Parameter &par)
+{
+    typedef BaconHelper<algorithmFPType, cpu> helper;
+
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const size_t nVectors  = dataTable.getNumberOfRows();
+
+    WriteOnlyRows<algorithmFPType, cpu> maskBlock(partialWeightsTable, 0, nVectors);
+    DAAL_CHECK_BLOCK_STATUS(maskBlock)
+    algorithmFPType *mask = maskBlock.get();
+
+    WriteOnlyRows<algorithmFPType, cpu> shiftBlock(partialShiftTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(shiftBlock)
+    algorithmFPType *shift = shiftBlock.get();
+
+    Status s;
+    if (meanTable)
+    {
+        /* Select the local part of the basic subset by the Mahalanobis distances to the current basic subset */
+        ReadRows<algorithmFPType, cpu> meanBlock(*meanTable, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(meanBlock)
+        ReadRows<algorithmFPType, cpu> covarianceBlock(*covarianceTable, 0, nFeatures);
+        DAAL_CHECK_BLOCK_STATUS(covarianceBlock)
+        ReadRows<algorithmFPType, cpu> thresholdBlock(*thresholdTable, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(thresholdBlock)
+
+        /* Shift the observations by the current location estimate for the accurate cross-product, as in the batch mode */
+        for (size_t j = 0; j < nFeatures; j++) { shift[j] = meanBlock.get()[j]; }
+
+        TArray<algorithmFPType, cpu> distanceArray(nVectors);
+        DAAL_CHECK_MALLOC(distanceArray.get());
+        DAAL_CHECK_STATUS(s, helper::computeMahalanobisDistances(dataTable, meanBlock.get(), covarianceBlock.get(), distanceArray.get()));
+        helper::selectBelowThreshold(nVectors, distanceArray.get(), thresholdBlock.get()[0], mask);
+    }
+    else
+    {
+        /* First iteration: all the local observations form the basic subset, they are shifted by the first of them */
+        for (size_t i = 0; i < nVectors; i++) { mask[i] = (algorithmFPType)1.0; }
+
+        ReadRows<algorithmFPType, cpu> firstRow(dataTable, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(firstRow)
+        for (size_t j = 0; j < nFeatures; j++) { shift[j] = firstRow.get()[j]; }
+    }
+
+    WriteOnlyRows<algorithmFPType, cpu> sumBlock(partialSumTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(sumBlock)
+    WriteOnlyRows<algorithmFPType, cpu> crossProductBlock(partialCrossProductTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(crossProductBlock)
+
+    algorithmFPType nSubset = 0;
+    DAAL_CHECK_STATUS(s, helper::computeMoments(dataTable, mask, shift, nSubset, sumBlock.get(), crossProductBlock.get()));
+
+    WriteOnlyRows<algorithmFPType, cpu> nObservationsBlock(nObservationsTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nObservationsBlock)
+    WriteOnlyRows<algorithmFPType, cpu> nSubsetBlock(nSubsetObservationsTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nSubsetBlock)
+
+    nObservationsBlock.get()[0] = (algorithmFPType)nVectors;
+    nSubsetBlock.get()[0] = nSubset;
+    return s;
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OutlierDetectionDistrStep2Kernel<algorithmFPType, method, cpu>::compute(
+    size_t nBlocks, NumericTable **nObservationsTables, NumericTable **nSubsetObservationsTables,
+    NumericTable **partialSumTables, NumericTable **partialCrossProductTables, NumericTable **partialShiftTables,
+    NumericTable *prevBasicSubsetSizeTable,
+    NumericTable &meanTable, NumericTable &covarianceTable, NumericTable &thresholdTable,
+    NumericTable &basicSubsetSizeTable, NumericTable &convergenceFlagTable, const Parameter &par)
+{
+    typedef BaconHelper<algorithmFPType, cpu> helper;
+
+    const size_t nFeatures = partialSumTables[0]->getNumberOfColumns();
+
+    TArray<algorithmFPType, cpu> momentsArray(3 * nFeatures + nFeatures * nFeatures);
+    DAAL_CHECK_MALLOC(momentsArray.get());
+    algorithmFPType *sum = momentsArray.get();
+    algorithmFPType *crossProduct = sum + nFeatures;
+    algorithmFPType *shift = crossProduct + nFeatures * nFeatures;
+    algorithmFPType *diff = shift + nFeatures;
+    for (size_t j = 0; j < nFeatures + nFeatures * nFeatures; j++) { sum[j] = 0; }
+
+    {
+        ReadRows<algorithmFPType, cpu> shiftBlock(*partialShiftTables[0], 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(shiftBlock)
+        for (size_t j = 0; j < nFeatures; j++) { shift[j] = shiftBlock.get()[j]; }
+    }
+
+    /* Merge the partial moments of the basic subset computed on local nodes. The moments are moved to the shift
+       of the first node: for d = s_b - s, sum = S_b + n_b * d, crossProduct = C_b + d * S_b^t + S_b * d^t + n_b * d * d^t.
+       The local nodes use the same shift after the first iteration, so d = 0 and the moments are added exactly */
+    algorithmFPType nVectors = 0;
+    algorithmFPType nSubset = 0;
+    for (size_t b = 0; b < nBlocks; b++)
+    {
+        ReadRows<algorithmFPType, cpu> nObservationsBlock(*nObservationsTables[b], 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(nObservationsBlock)
+        ReadRows<algorithmFPType, cpu> nSubsetBlock(*nSubsetObservationsTables[b], 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(nSubsetBlock)
+        ReadRows<algorithmFPType, cpu> sumBlock(*partialSumTables[b], 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(sumBlock)
+        ReadRows<algorithmFPType, cpu> crossProductBlock(*partialCrossProductTables[b], 0, nFeatures);
+        DAAL_CHECK_BLOCK_STATUS(crossProductBlock)
+        ReadRows<algorithmFPType, cpu> shiftBlock(*partialShiftTables[b], 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(shiftBlock)
+
+        const algorithmFPType nPartialSubset = nSubsetBlock.get()[0];
+        nVectors += nObservationsBlock.get()[0];
+        nSubset  += nPartialSubset;
+        const algorithmFPType *partialSum = sumBlock.get();
+        const algorithmFPType *partialCrossProduct = crossProductBlock.get();
+        const algorithmFPType *partialShift = shiftBlock.get();
+        for (size_t j = 0; j < nFeatures; j++) { diff[j] = partialShift[j] - shift[j]; }
+
+        for (size_t j = 0; j < nFeatures; j++) { sum[j] += partialSum[j] + nPartialSubset * diff[j]; }
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                crossProduct[i * nFeatures + j] += partialCrossProduct[i * nFeatures + j] + diff[i] * partialSum[j] +
+                                                   partialSum[i] * diff[j] + nPartialSubset * diff[i] * diff[j];
+            }
+        }
+    }
+    DAAL_CHECK(nVectors > (algorithmFPType)(nFeatures + 1), ErrorIncorrectNumberOfObservations);
+
+    WriteOnlyRows<algorithmFPType, cpu> meanBlock(meanTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(meanBlock)
+    WriteOnlyRows<algorithmFPType, cpu> covarianceBlock(covarianceTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(covarianceBlock)
+
+    Status s;
+    DAAL_CHECK_STATUS(s, helper::computeMeanCovariance(nFeatures, nSubset, sum, crossProduct, shift, meanBlock.get(), covarianceBlock.get()));
+
+    const size_t n = (size_t)nVectors;
+    const size_t r = (size_t)nSubset;
+    algorithmFPType threshold = 0;
+    int isConverged = 0;
+    if (prevBasicSubsetSizeTable)
+    {
+        ReadRows<algorithmFPType, cpu> prevSizeBlock(*prevBasicSubsetSizeTable, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(prevSizeBlock)
+        const size_t prevR = (size_t)prevSizeBlock.get()[0];
+        const size_t delta = (r > prevR ? r - prevR : prevR - r);
+
+        threshold = helper::computeThreshold(n, nFeatures, r, par.alpha);
+        isConverged = ((double)delta <= par.toleranceToConverge * (double)r);
+    }
+    else
+    {
+        /* First iteration: the basic subset is all the observations, the threshold selects approximately
+           the initial number of observations closest to their mean */
+        const size_t m = helper::getInitialSubsetSize(n, nFeatures);
+        threshold = Math<algorithmFPType, cpu>::sSqrt(helper::chiSquareQuantile(nFeatures, (algorithmFPType)m / nVectors));
+    }
+
+    WriteOnlyRows<algorithmFPType, cpu> thresholdBlock(thresholdTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(thresholdBlock)
+    WriteOnlyRows<algorithmFPType, cpu> sizeBlock(basicSubsetSizeTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(sizeBlock)
+    WriteOnlyRows<int, cpu> flagBlock(convergenceFlagTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(flagBlock)
+
+    thresholdBlock.get()[0] = threshold;
+    sizeBlock.get()[0] = nSubset;
+    flagBlock.get()[0] = isConverged;
+    return s;
+}
+
+} // namespace internal
+
+} // namespace bacon_outlier_detection
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
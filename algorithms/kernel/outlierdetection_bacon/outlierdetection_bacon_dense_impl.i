@@ -52,7 +52,12 @@
 #include "outlier_detection_bacon_types.h"
 #include "service_numeric_table.h"
 #include "service_math.h"
-#include "service_stat.h"
+#include "service_blas.h"
+#include "service_lapack.h"
+#include "service_memory.h"
+#include "service_data_utils.h"
+#include "service_sort.h"
+#include "threading.h"
 
 namespace daal
 {
@@ -66,43 +71,453 @@ namespace internal
 using namespace daal::internal;
 using namespace daal::data_management;
 using namespace daal::services;
+using namespace daal::services::internal;
+using namespace daal::algorithms::internal;
 
-template <typename algorithmFPType, Method method, CpuType cpu>
-services::Status OutlierDetectionKernel<algorithmFPType, method, cpu>::compute(NumericTable &dataTable, NumericTable &resultTable, const Parameter &par)
+/********************* tls_moments_t class ****************************************************/
+template<typename algorithmFPType, CpuType cpu> struct tls_moments_t
+{
+    DAAL_NEW_DELETE();
+    algorithmFPType  nSubset;
+    algorithmFPType *sum;
+    algorithmFPType *crossProduct;
+    algorithmFPType *buffer;
+
+    tls_moments_t(size_t nFeatures, size_t blockSize) : nSubset(0), sum(nullptr), crossProduct(nullptr), buffer(nullptr)
+    {
+        sum          = service_scalable_calloc<algorithmFPType, cpu>(nFeatures);
+        crossProduct = service_scalable_calloc<algorithmFPType, cpu>(nFeatures * nFeatures);
+        buffer       = service_scalable_malloc<algorithmFPType, cpu>(nFeatures * blockSize);
+    }
+
+    bool isValid() const { return sum && crossProduct && buffer; }
+
+    ~tls_moments_t()
+    {
+        if(sum)
+            service_scalable_free<algorithmFPType, cpu>(sum);
+        if(crossProduct)
+            service_scalable_free<algorithmFPType, cpu>(crossProduct);
+        if(buffer)
+            service_scalable_free<algorithmFPType, cpu>(buffer);
+    }
+};
+
+/**
+ *  Building blocks of the BACON algorithm shared by the batch and distributed processing modes.
+ *  The observations are processed in blocks of rows in parallel; the basic subset is represented
+ *  by the mask array that contains 1 for the observations in the subset and 0 otherwise
+ */
+template <typename algorithmFPType, CpuType cpu>
+struct BaconHelper
 {
-    const __int64 nBaconParams = 3;
-    algorithmFPType baconParams[nBaconParams];
+    typedef Math<algorithmFPType, cpu> math;
+
+    static const size_t blockSize = 256;
+    static const size_t initialSubsetFactor = 4;    /* Size of the initial basic subset is initialSubsetFactor * nFeatures */
+
+    static size_t getNumberOfBlocks(size_t nVectors)
+    {
+        return nVectors / blockSize + !!(nVectors % blockSize);
+    }
+
+    /* Size of the initial basic subset */
+    static size_t getInitialSubsetSize(size_t nVectors, size_t nFeatures)
+    {
+        const size_t m = initialSubsetFactor * nFeatures;
+        return (m < nVectors ? m : nVectors);
+    }
+
+    /* (1 - alpha) quantile of the chi-square distribution with nFeatures degrees of freedom, Wilson-Hilferty approximation */
+    static algorithmFPType chiSquareQuantile(size_t nFeatures, algorithmFPType q)
+    {
+        if (q >= (algorithmFPType)1.0) { return daal::data_feature_utils::internal::MaxVal<algorithmFPType, cpu>::get(); }
+        const algorithmFPType a = (algorithmFPType)2.0 / ((algorithmFPType)9.0 * (algorithmFPType)nFeatures);
+        const algorithmFPType t = (algorithmFPType)1.0 - a + math::sCdfNormInv(q) * math::sSqrt(a);
+        return (t > 0 ? (algorithmFPType)nFeatures * t * t * t : (algorithmFPType)0.0);
+    }
+
+    /* Threshold on the Mahalanobis distance that defines the next basic subset given the size of the current one */
+    static algorithmFPType computeThreshold(size_t nVectors, size_t nFeatures, size_t nSubset, double alpha)
+    {
+        const algorithmFPType n = (algorithmFPType)nVectors;
+        const algorithmFPType p = (algorithmFPType)nFeatures;
+        const algorithmFPType r = (algorithmFPType)nSubset;
+        const algorithmFPType h = (algorithmFPType)((nVectors + nFeatures + 1) / 2);
+
+        algorithmFPType cnp = (algorithmFPType)1.0 + (p + (algorithmFPType)1.0) / (n - p);
+        if (n - h - p > 0) { cnp += (algorithmFPType)1.0 / (n - h - p); }
+        const algorithmFPType chr = (h > r ? (h - r) / (h + r) : (algorithmFPType)0.0);
+
+        return (cnp + chr) * math::sSqrt(chiSquareQuantile(nFeatures, (algorithmFPType)1.0 - (algorithmFPType)alpha));
+    }
+
+    /**
+     *  Computes the number of observations in the basic subset, their sums and cross-product matrix.
+     *  The observations are shifted by the shift vector if it is provided
+     */
+    static Status computeMoments(NumericTable &dataTable, const algorithmFPType *mask, const algorithmFPType *shift,
+                                 algorithmFPType &nSubset, algorithmFPType *sum, algorithmFPType *crossProduct)
+    {
+        const size_t nVectors  = dataTable.getNumberOfRows();
+        const size_t nFeatures = dataTable.getNumberOfColumns();
+        const size_t nBlocks   = getNumberOfBlocks(nVectors);
+
+        SafeStatus safeStat;
+        daal::tls<tls_moments_t<algorithmFPType, cpu> *> tlsData([=, &safeStat]()
+        {
+            tls_moments_t<algorithmFPType, cpu> *ptr = new tls_moments_t<algorithmFPType, cpu>(nFeatures, blockSize);
+            if(!ptr || !ptr->isValid())
+            {
+                safeStat.add(services::ErrorMemoryAllocationFailed);
+                delete ptr;
+                ptr = nullptr;
+            }
+            return ptr;
+        });
+
+        daal::threader_for(nBlocks, nBlocks, [ =, &tlsData, &dataTable, &safeStat ](int iBlock)
+        {
+            tls_moments_t<algorithmFPType, cpu> *local = tlsData.local();
+            if(!local)
+                return;
+
+            const size_t startRow = iBlock * blockSize;
+            const size_t nRows = (startRow + blockSize > nVectors ? nVectors - startRow : blockSize);
+
+            ReadRows<algorithmFPType, cpu> dataRows(dataTable, startRow, nRows);
+            DAAL_CHECK_BLOCK_STATUS_THR(dataRows);
+            const algorithmFPType *data = dataRows.get();
+
+            /* Gather the observations of the basic subset */
+            DAAL_INT nSelected = 0;
+            for (size_t i = 0; i < nRows; i++)
+            {
+                if (mask[startRow + i] == (algorithmFPType)0.0) { continue; }
+
+                algorithmFPType *row = local->buffer + nSelected * nFeatures;
+               PRAGMA_IVDEP
+               PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nFeatures; j++)
+                {
+                    row[j] = data[i * nFeatures + j] - (shift ? shift[j] : (algorithmFPType)0.0);
+                    local->sum[j] += row[j];
+                }
+                nSelected++;
+            }
+            if (!nSelected)
+                return;
+            local->nSubset += (algorithmFPType)nSelected;
+
+            char uplo  = 'U';
+            char trans = 'N';
+            algorithmFPType one = (algorithmFPType)1.0;
+            DAAL_INT dim = (DAAL_INT)nFeatures;
+            Blas<algorithmFPType, cpu>::xxsyrk(&uplo, &trans, &dim, &nSelected, &one, local->buffer, &dim,
+                                               &one, local->crossProduct, &dim);
+        } );
+
+        nSubset = 0;
+        for (size_t j = 0; j < nFeatures; j++) { sum[j] = 0; }
+        for (size_t j = 0; j < nFeatures * nFeatures; j++) { crossProduct[j] = 0; }
+
+        tlsData.reduce([ =, &nSubset ](tls_moments_t<algorithmFPType, cpu> *local)
+        {
+            if(!local)
+                return;
+            nSubset += local->nSubset;
+            for (size_t j = 0; j < nFeatures; j++) { sum[j] += local->sum[j]; }
+            for (size_t j = 0; j < nFeatures * nFeatures; j++) { crossProduct[j] += local->crossProduct[j]; }
+            delete local;
+        });
+        DAAL_CHECK_SAFE_STATUS();
+
+        /* Only the lower triangle of the row-major cross-product matrix is computed */
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            for (size_t j = i + 1; j < nFeatures; j++)
+            {
+                crossProduct[i * nFeatures + j] = crossProduct[j * nFeatures + i];
+            }
+        }
+        return Status();
+    }
+
+    /**
+     *  Computes the mean and variance-covariance matrix of the basic subset from its moments.
+     *  The moments are computed for the observations shifted by the shift vector if it is provided
+     */
+    static Status computeMeanCovariance(size_t nFeatures, algorithmFPType nSubset, const algorithmFPType *sum,
+                                        const algorithmFPType *crossProduct, const algorithmFPType *shift,
+                                        algorithmFPType *mean, algorithmFPType *covariance)
+    {
+        DAAL_CHECK(nSubset > (algorithmFPType)1.0, ErrorOutlierDetectionInternal);
+
+        const algorithmFPType invN   = (algorithmFPType)1.0 / nSubset;
+        const algorithmFPType invNm1 = (algorithmFPType)1.0 / (nSubset - (algorithmFPType)1.0);
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                covariance[i * nFeatures + j] = (crossProduct[i * nFeatures + j] - sum[i] * sum[j] * invN) * invNm1;
+            }
+        }
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            mean[j] = sum[j] * invN + (shift ? shift[j] : (algorithmFPType)0.0);
+        }
+        return Status();
+    }
 
-    switch (par.initMethod)
+    /* Computes Mahalanobis distances from all observations to the basic subset with the given mean and covariance */
+    static Status computeMahalanobisDistances(NumericTable &dataTable, const algorithmFPType *mean,
+                                              const algorithmFPType *covariance, algorithmFPType *distance)
     {
-    case baconMedian:
-    default:
+        const size_t nVectors  = dataTable.getNumberOfRows();
+        const size_t nFeatures = dataTable.getNumberOfColumns();
+        const size_t nBlocks   = getNumberOfBlocks(nVectors);
+
+        /* Cholesky factor of the variance-covariance matrix */
+        TArray<algorithmFPType, cpu> choleskyArray(nFeatures * nFeatures);
+        algorithmFPType *cholesky = choleskyArray.get();
+        DAAL_CHECK_MALLOC(cholesky);
+        for (size_t j = 0; j < nFeatures * nFeatures; j++) { cholesky[j] = covariance[j]; }
+
+        char uplo = 'L';
+        DAAL_INT dim = (DAAL_INT)nFeatures;
+        DAAL_INT info = 0;
+        Lapack<algorithmFPType, cpu>::xpotrf(&uplo, &dim, cholesky, &dim, &info);
+        DAAL_CHECK(info == 0, ErrorOutlierDetectionInternal);
+
+        SafeStatus safeStat;
+        daal::tls<algorithmFPType *> tlsBuffer([=, &safeStat]()
+        {
+            algorithmFPType *ptr = service_scalable_malloc<algorithmFPType, cpu>(nFeatures * blockSize);
+            if(!ptr)
+                safeStat.add(services::ErrorMemoryAllocationFailed);
+            return ptr;
+        });
+
+        daal::threader_for(nBlocks, nBlocks, [ =, &tlsBuffer, &dataTable, &safeStat ](int iBlock)
+        {
+            algorithmFPType *buffer = tlsBuffer.local();
+            if(!buffer)
+                return;
+
+            const size_t startRow = iBlock * blockSize;
+            const size_t nRows = (startRow + blockSize > nVectors ? nVectors - startRow : blockSize);
+
+            ReadRows<algorithmFPType, cpu> dataRows(dataTable, startRow, nRows);
+            DAAL_CHECK_BLOCK_STATUS_THR(dataRows);
+            const algorithmFPType *data = dataRows.get();
+
+            for (size_t i = 0; i < nRows * nFeatures; i += nFeatures)
+            {
+               PRAGMA_IVDEP
+               PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nFeatures; j++)
+                {
+                    buffer[i + j] = data[i + j] - mean[j];
+                }
+            }
+
+            /* Solve L * z = (x - mean) for all the observations of the block at once */
+            char uplo  = 'L';
+            char trans = 'N';
+            char diag  = 'N';
+            DAAL_INT dim   = (DAAL_INT)nFeatures;
+            DAAL_INT nrhs  = (DAAL_INT)nRows;
+            DAAL_INT info  = 0;
+            Lapack<algorithmFPType, cpu>::xxtrtrs(&uplo, &trans, &diag, &dim, &nrhs, const_cast<algorithmFPType *>(cholesky), &dim,
+                                                  buffer, &dim, &info);
+            if (info != 0)
+            {
+                safeStat.add(services::ErrorOutlierDetectionInternal);
+                return;
+            }
+
+            for (size_t i = 0; i < nRows; i++)
+            {
+                algorithmFPType d = 0;
+                for (size_t j = 0; j < nFeatures; j++)
+                {
+                    d += buffer[i * nFeatures + j] * buffer[i * nFeatures + j];
+                }
+                distance[startRow + i] = math::sSqrt(d);
+            }
+        } );
+
+        tlsBuffer.reduce([](algorithmFPType *buffer)
+        {
+            if(buffer)
+                service_scalable_free<algorithmFPType, cpu>(buffer);
+        });
+        return safeStat.detach();
+    }
+
+    /* Computes coordinate-wise median of the observations and Euclidean distances from all observations to it */
+    static Status computeMedianDistances(NumericTable &dataTable, algorithmFPType *median, algorithmFPType *distance)
     {
-        baconParams[0] = (algorithmFPType)__DAAL_VSL_SS_METHOD_BACON_MEDIAN_INIT;
-        break;
+        const size_t nVectors  = dataTable.getNumberOfRows();
+        const size_t nFeatures = dataTable.getNumberOfColumns();
+        const size_t nBlocks   = getNumberOfBlocks(nVectors);
+
+        SafeStatus safeStat;
+        daal::tls<algorithmFPType *> tlsColumn([=, &safeStat]()
+        {
+            algorithmFPType *ptr = service_scalable_malloc<algorithmFPType, cpu>(nVectors);
+            if(!ptr)
+                safeStat.add(services::ErrorMemoryAllocationFailed);
+            return ptr;
+        });
+
+        daal::threader_for(nFeatures, nFeatures, [ =, &tlsColumn, &dataTable, &safeStat ](int j)
+        {
+            algorithmFPType *column = tlsColumn.local();
+            if(!column)
+                return;
+
+            ReadColumns<algorithmFPType, cpu> dataColumn(dataTable, j, 0, nVectors);
+            DAAL_CHECK_BLOCK_STATUS_THR(dataColumn);
+            const algorithmFPType *values = dataColumn.get();
+            for (size_t i = 0; i < nVectors; i++) { column[i] = values[i]; }
+
+            /* The elements before the selected one are not greater than it, so the lower middle element is their maximum */
+            const size_t half = nVectors / 2;
+            const algorithmFPType upper = qSelect<algorithmFPType, cpu>(nVectors, column, half);
+            if (nVectors % 2)
+            {
+                median[j] = upper;
+                return;
+            }
+            algorithmFPType lower = column[0];
+            for (size_t i = 1; i < half; i++) { lower = (column[i] > lower ? column[i] : lower); }
+            median[j] = (lower + upper) * (algorithmFPType)0.5;
+        } );
+
+        tlsColumn.reduce([](algorithmFPType *column)
+        {
+            if(column)
+                service_scalable_free<algorithmFPType, cpu>(column);
+        });
+        DAAL_CHECK_SAFE_STATUS();
+
+        daal::threader_for(nBlocks, nBlocks, [ =, &dataTable, &safeStat ](int iBlock)
+        {
+            const size_t startRow = iBlock * blockSize;
+            const size_t nRows = (startRow + blockSize > nVectors ? nVectors - startRow : blockSize);
+
+            ReadRows<algorithmFPType, cpu> dataRows(dataTable, startRow, nRows);
+            DAAL_CHECK_BLOCK_STATUS_THR(dataRows);
+            const algorithmFPType *data = dataRows.get();
+
+            for (size_t i = 0; i < nRows; i++)
+            {
+                algorithmFPType d = 0;
+                for (size_t j = 0; j < nFeatures; j++)
+                {
+                    const algorithmFPType diff = data[i * nFeatures + j] - median[j];
+                    d += diff * diff;
+                }
+                distance[startRow + i] = math::sSqrt(d);
+            }
+        } );
+        return safeStat.detach();
     }
-    case baconMahalanobis:
+
+    /* Selects the nSelect observations with the smallest distances into the basic subset */
+    static Status selectSmallest(size_t nVectors, const algorithmFPType *distance, size_t nSelect, algorithmFPType *mask, size_t &nSubset)
     {
-        baconParams[0] = (algorithmFPType)__DAAL_VSL_SS_METHOD_BACON_MAHALANOBIS_INIT;
-        break;
+        TArray<algorithmFPType, cpu> sortedArray(nVectors);
+        algorithmFPType *sorted = sortedArray.get();
+        DAAL_CHECK_MALLOC(sorted);
+
+        for (size_t i = 0; i < nVectors; i++) { sorted[i] = distance[i]; }
+        const algorithmFPType threshold = qSelect<algorithmFPType, cpu>(nVectors, sorted, nSelect - 1);
+        nSubset = 0;
+        for (size_t i = 0; i < nVectors; i++)
+        {
+            mask[i] = (distance[i] <= threshold ? (algorithmFPType)1.0 : (algorithmFPType)0.0);
+            nSubset += (distance[i] <= threshold);
+        }
+        return Status();
     }
+
+    /* Selects the observations with the distances below the threshold into the basic subset */
+    static size_t selectBelowThreshold(size_t nVectors, const algorithmFPType *distance, algorithmFPType threshold, algorithmFPType *mask)
+    {
+        size_t nSubset = 0;
+        for (size_t i = 0; i < nVectors; i++)
+        {
+            mask[i] = (distance[i] < threshold ? (algorithmFPType)1.0 : (algorithmFPType)0.0);
+            nSubset += (distance[i] < threshold);
+        }
+        return nSubset;
     }
-    baconParams[1] = (algorithmFPType)(par.alpha);
-    baconParams[2] = (algorithmFPType)(par.toleranceToConverge);
+};
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OutlierDetectionKernel<algorithmFPType, method, cpu>::compute(NumericTable &dataTable, NumericTable &resultTable, const Parameter &par)
+{
+    typedef BaconHelper<algorithmFPType, cpu> helper;
 
-    size_t nFeatures = dataTable.getNumberOfColumns();
-    size_t nVectors  = dataTable.getNumberOfRows();
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const size_t nVectors  = dataTable.getNumberOfRows();
+    DAAL_CHECK(nVectors > nFeatures + 1, ErrorIncorrectNumberOfObservations);
 
-    ReadRows<algorithmFPType, cpu> dataBlock(dataTable, 0, nVectors);
-    DAAL_CHECK_BLOCK_STATUS(dataBlock)
+    TArray<algorithmFPType, cpu> maskArray(nVectors);
+    TArray<algorithmFPType, cpu> distanceArray(nVectors);
+    TArray<algorithmFPType, cpu> momentsArray(3 * nFeatures + 2 * nFeatures * nFeatures);
+    DAAL_CHECK_MALLOC(maskArray.get() && distanceArray.get() && momentsArray.get());
+
+    algorithmFPType *mask         = maskArray.get();
+    algorithmFPType *distance     = distanceArray.get();
+    algorithmFPType *mean         = momentsArray.get();
+    algorithmFPType *shift        = mean + nFeatures;
+    algorithmFPType *sum          = shift + nFeatures;
+    algorithmFPType *covariance   = sum + nFeatures;
+    algorithmFPType *crossProduct = covariance + nFeatures * nFeatures;
+
+    /* Initial basic subset: the observations closest to the median or to the mean of all observations */
+    Status s;
+    algorithmFPType nSubsetFP = 0;
+    if (par.initMethod == baconMahalanobis)
+    {
+        for (size_t i = 0; i < nVectors; i++) { mask[i] = (algorithmFPType)1.0; }
+        DAAL_CHECK_STATUS(s, helper::computeMoments(dataTable, mask, NULL, nSubsetFP, sum, crossProduct));
+        DAAL_CHECK_STATUS(s, helper::computeMeanCovariance(nFeatures, nSubsetFP, sum, crossProduct, NULL, mean, covariance));
+        DAAL_CHECK_STATUS(s, helper::computeMahalanobisDistances(dataTable, mean, covariance, distance));
+    }
+    else
+    {
+        DAAL_CHECK_STATUS(s, helper::computeMedianDistances(dataTable, mean, distance));
+    }
+
+    size_t nSubset = 0;
+    DAAL_CHECK_STATUS(s, helper::selectSmallest(nVectors, distance, helper::getInitialSubsetSize(nVectors, nFeatures), mask, nSubset));
+
+    /* Grow the basic subset until its size stabilizes */
+    for (size_t iter = 0; iter < nVectors; iter++)
+    {
+        /* Shift the observations by the previous location estimate for the accurate cross-product */
+        for (size_t j = 0; j < nFeatures; j++) { shift[j] = mean[j]; }
+
+        DAAL_CHECK_STATUS(s, helper::computeMoments(dataTable, mask, shift, nSubsetFP, sum, crossProduct));
+        DAAL_CHECK_STATUS(s, helper::computeMeanCovariance(nFeatures, nSubsetFP, sum, crossProduct, shift, mean, covariance));
+        DAAL_CHECK_STATUS(s, helper::computeMahalanobisDistances(dataTable, mean, covariance, distance));
+
+        const algorithmFPType threshold = helper::computeThreshold(nVectors, nFeatures, nSubset, par.alpha);
+        const size_t nNewSubset = helper::selectBelowThreshold(nVectors, distance, threshold, mask);
+
+        const size_t delta = (nNewSubset > nSubset ? nNewSubset - nSubset : nSubset - nNewSubset);
+        nSubset = nNewSubset;
+        if ((double)delta <= par.toleranceToConverge * (double)nSubset) { break; }
+    }
 
     WriteOnlyRows<algorithmFPType, cpu> resultBlock(resultTable, 0, nVectors);
     DAAL_CHECK_BLOCK_STATUS(resultBlock)
-
-    const algorithmFPType *data = dataBlock.get();
     algorithmFPType *weight = resultBlock.get();
-
-    Statistics<algorithmFPType, cpu>::xoutlierdetection(data, (__int64)nFeatures, (__int64)nVectors, nBaconParams, baconParams, weight);
+    for (size_t i = 0; i < nVectors; i++) { weight[i] = mask[i]; }
 
     return Status();
 }
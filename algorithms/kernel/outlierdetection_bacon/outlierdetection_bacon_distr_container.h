@@ -0,0 +1,172 @@
+/* file: outlierdetection_bacon_distr_container.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of BACON outlier detection algorithm container for the distributed processing mode.
+//--
+*/
+
+#include "outlier_detection_bacon_distributed.h"
+#include "outlierdetection_bacon_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace bacon_outlier_detection
+{
+namespace interface1
+{
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step1Local, algorithmFPType, method, cpu>::DistributedContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::OutlierDetectionDistrStep1Kernel, algorithmFPType, method);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step1Local, algorithmFPType, method, cpu>::~DistributedContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status DistributedContainer<step1Local, algorithmFPType, method, cpu>::compute()
+{
+    DistributedStep1LocalInput *input = static_cast<DistributedStep1LocalInput *>(_in);
+    PartialResult *partialResult = static_cast<PartialResult *>(_pres);
+    Parameter *par = static_cast<Parameter *>(_par);
+
+    NumericTable &data          = *(input->get(InputId::data));
+    NumericTable *mean          = input->get(inputBasicSubsetMean).get();
+    NumericTable *covariance    = input->get(inputBasicSubsetCovariance).get();
+    NumericTable *threshold     = input->get(inputBasicSubsetThreshold).get();
+
+    NumericTable &nObs          = *(partialResult->get(nObservations));
+    NumericTable &nSubsetObs    = *(partialResult->get(nSubsetObservations));
+    NumericTable &sum           = *(partialResult->get(partialSum));
+    NumericTable &crossProduct  = *(partialResult->get(partialCrossProduct));
+    NumericTable &weights       = *(partialResult->get(partialWeights));
+    NumericTable &shift         = *(partialResult->get(partialShift));
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::OutlierDetectionDistrStep1Kernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, defaultDense), compute,
+                       data, mean, covariance, threshold, nObs, nSubsetObs, sum, crossProduct, weights, shift, *par);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status DistributedContainer<step1Local, algorithmFPType, method, cpu>::finalizeCompute()
+{
+    return services::Status();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step2Master, algorithmFPType, method, cpu>::DistributedContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::OutlierDetectionDistrStep2Kernel, algorithmFPType, method);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step2Master, algorithmFPType, method, cpu>::~DistributedContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status DistributedContainer<step2Master, algorithmFPType, method, cpu>::compute()
+{
+    DistributedStep2MasterInput *input = static_cast<DistributedStep2MasterInput *>(_in);
+    DistributedPartialResult *partialResult = static_cast<DistributedPartialResult *>(_pres);
+    Parameter *par = static_cast<Parameter *>(_par);
+
+    DataCollection *collection = input->get(partialResults).get();
+    const size_t nBlocks = collection->size();
+
+    TArray<NumericTable *, cpu> tablesArray(5 * nBlocks);
+    NumericTable **tables = tablesArray.get();
+    DAAL_CHECK_MALLOC(tables);
+
+    NumericTable **nObs          = tables;
+    NumericTable **nSubsetObs    = tables + nBlocks;
+    NumericTable **sums          = tables + 2 * nBlocks;
+    NumericTable **crossProducts = tables + 3 * nBlocks;
+    NumericTable **shifts        = tables + 4 * nBlocks;
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        PartialResult *pres = static_cast<PartialResult *>((*collection)[i].get());
+        nObs[i]          = pres->get(nObservations).get();
+        nSubsetObs[i]    = pres->get(nSubsetObservations).get();
+        sums[i]          = pres->get(partialSum).get();
+        crossProducts[i] = pres->get(partialCrossProduct).get();
+        shifts[i]        = pres->get(partialShift).get();
+    }
+
+    NumericTable *prevSize      = input->get(inputBasicSubsetSize).get();
+    NumericTable &mean          = *(partialResult->get(basicSubsetMean));
+    NumericTable &covariance    = *(partialResult->get(basicSubsetCovariance));
+    NumericTable &threshold     = *(partialResult->get(basicSubsetThreshold));
+    NumericTable &subsetSize    = *(partialResult->get(basicSubsetSize));
+    NumericTable &flag          = *(partialResult->get(convergenceFlag));
+
+    daal::services::Environment::env &env = *_env;
+    services::Status s = __DAAL_CALL_KERNEL_STATUS(env, internal::OutlierDetectionDistrStep2Kernel,
+                                                   __DAAL_KERNEL_ARGUMENTS(algorithmFPType, defaultDense), compute,
+                                                   nBlocks, nObs, nSubsetObs, sums, crossProducts, shifts, prevSize,
+                                                   mean, covariance, threshold, subsetSize, flag, *par);
+
+    collection->clear();
+    return s;
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status DistributedContainer<step2Master, algorithmFPType, method, cpu>::finalizeCompute()
+{
+    return services::Status();
+}
+
+}
+
+} // namespace bacon_outlier_detection
+
+} // namespace algorithms
+
+} // namespace daal
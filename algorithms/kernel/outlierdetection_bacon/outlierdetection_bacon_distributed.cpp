@@ -0,0 +1,331 @@
+/* file: outlierdetection_bacon_distributed.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the BACON outlier detection classes for the distributed processing mode
+//--
+*/
+
+#include "outlier_detection_bacon_types.h"
+#include "serialization_utils.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace bacon_outlier_detection
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(PartialResult, SERIALIZATION_OUTLIER_DETECTION_BACON_PARTIAL_RESULT_ID);
+__DAAL_REGISTER_SERIALIZATION_CLASS(DistributedPartialResult, SERIALIZATION_OUTLIER_DETECTION_BACON_DISTRIBUTED_PARTIAL_RESULT_ID);
+
+DistributedStep1LocalInput::DistributedStep1LocalInput() : Input(lastStep1LocalInputId + 1) {}
+DistributedStep1LocalInput::DistributedStep1LocalInput(const DistributedStep1LocalInput& other) : Input(other) {}
+
+/**
+ * Returns input object for the BACON outlier detection algorithm in the first step of the distributed processing mode
+ * \param[in] id    Identifier of the %input object
+ * \return          %Input object that corresponds to the given identifier
+ */
+NumericTablePtr DistributedStep1LocalInput::get(Step1LocalInputId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets input object for the BACON outlier detection algorithm in the first step of the distributed processing mode
+ * \param[in] id    Identifier of the %input object
+ * \param[in] ptr   Pointer to the input object
+ */
+void DistributedStep1LocalInput::set(Step1LocalInputId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Checks input object for the BACON outlier detection algorithm in the first step of the distributed processing mode
+ * \param[in] par     Algorithm parameters
+ * \param[in] method  Computation method for the algorithm
+ */
+services::Status DistributedStep1LocalInput::check(const daal::algorithms::Parameter *par, int method) const
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, Input::check(par, method));
+
+    /* The median-based initialization needs the global coordinate-wise medians of the data,
+       which cannot be merged from the local partial results */
+    const Parameter *algParameter = static_cast<const Parameter *>(par);
+    DAAL_CHECK_EX(algParameter->initMethod == baconMahalanobis, ErrorIncorrectParameter, ParameterName, initMethodStr());
+
+    NumericTablePtr mean = get(inputBasicSubsetMean);
+    NumericTablePtr covariance = get(inputBasicSubsetCovariance);
+    NumericTablePtr threshold = get(inputBasicSubsetThreshold);
+    if (!mean && !covariance && !threshold)
+    {
+        /* First iteration: all the local observations form the basic subset */
+        return s;
+    }
+
+    const size_t nFeatures = get(data)->getNumberOfColumns();
+    DAAL_CHECK_STATUS(s, checkNumericTable(mean.get(), basicSubsetMeanStr(), 0, 0, nFeatures, 1));
+    DAAL_CHECK_STATUS(s, checkNumericTable(covariance.get(), basicSubsetCovarianceStr(), 0, 0, nFeatures, nFeatures));
+    return checkNumericTable(threshold.get(), basicSubsetThresholdStr(), 0, 0, 1, 1);
+}
+
+PartialResult::PartialResult() : daal::algorithms::PartialResult(lastPartialResultId + 1) {}
+
+/**
+ * Returns partial result of the BACON outlier detection algorithm
+ * \param[in] id   Identifier of the partial result
+ * \return         Partial result that corresponds to the given identifier
+ */
+NumericTablePtr PartialResult::get(PartialResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets partial result of the BACON outlier detection algorithm
+ * \param[in] id    Identifier of the partial result
+ * \param[in] ptr   Pointer to the partial result
+ */
+void PartialResult::set(PartialResultId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Returns the number of features in the partial result
+ * \return Number of features
+ */
+size_t PartialResult::getNumberOfFeatures() const
+{
+    return get(partialSum)->getNumberOfColumns();
+}
+
+/**
+ * Checks partial results of the BACON outlier detection algorithm
+ * \param[in] input   Pointer to %Input objects of the algorithm
+ * \param[in] par     Pointer to the parameters of the algorithm
+ * \param[in] method  Computation method
+ */
+services::Status PartialResult::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const
+{
+    const DistributedStep1LocalInput *algInput = static_cast<const DistributedStep1LocalInput *>(input);
+    const size_t nVectors = algInput->get(data)->getNumberOfRows();
+    const size_t nFeatures = algInput->get(data)->getNumberOfColumns();
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, check(par, method));
+    DAAL_CHECK_EX(getNumberOfFeatures() == nFeatures, ErrorIncorrectNumberOfColumns, ArgumentName, partialSumStr());
+    return checkNumericTable(get(partialWeights).get(), partialWeightsStr(), packed_mask, 0, 1, nVectors);
+}
+
+/**
+ * Checks partial results of the BACON outlier detection algorithm
+ * \param[in] par     Pointer to the parameters of the algorithm
+ * \param[in] method  Computation method
+ */
+services::Status PartialResult::check(const daal::algorithms::Parameter *par, int method) const
+{
+    const int unexpectedLayouts = (int)packed_mask;
+    services::Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(nObservations).get(), nObservationsStr(), unexpectedLayouts, 0, 1, 1));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(nSubsetObservations).get(), nSubsetObservationsStr(), unexpectedLayouts, 0, 1, 1));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(partialSum).get(), partialSumStr(), unexpectedLayouts, 0, 0, 1));
+    const size_t nFeatures = getNumberOfFeatures();
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(partialCrossProduct).get(), partialCrossProductStr(), unexpectedLayouts, 0, nFeatures, nFeatures));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(partialShift).get(), partialShiftStr(), unexpectedLayouts, 0, nFeatures, 1));
+    return checkNumericTable(get(partialWeights).get(), partialWeightsStr(), unexpectedLayouts, 0, 1);
+}
+
+DistributedStep2MasterInput::DistributedStep2MasterInput() : daal::algorithms::Input(lastMasterNumericTableInputId + 1)
+{
+    Argument::set(partialResults, DataCollectionPtr(new DataCollection()));
+}
+
+DistributedStep2MasterInput::DistributedStep2MasterInput(const DistributedStep2MasterInput& other) : daal::algorithms::Input(other) {}
+
+/**
+ * Returns an input object for the BACON outlier detection algorithm in the second step of the distributed processing mode
+ * \param[in] id    Identifier of the input object
+ * \return          %Input object that corresponds to the given identifier
+ */
+DataCollectionPtr DistributedStep2MasterInput::get(MasterInputId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Returns an optional input object for the BACON outlier detection algorithm in the second step of the distributed processing mode
+ * \param[in] id    Identifier of the input object
+ * \return          %Input object that corresponds to the given identifier
+ */
+NumericTablePtr DistributedStep2MasterInput::get(MasterNumericTableInputId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets an input object for the BACON outlier detection algorithm in the second step of the distributed processing mode
+ * \param[in] id    Identifier of the input object
+ * \param[in] ptr   Pointer to the object
+ */
+void DistributedStep2MasterInput::set(MasterInputId id, const DataCollectionPtr &ptr)
+{
+    Argument::set(id, staticPointerCast<SerializationIface, DataCollection>(ptr));
+}
+
+/**
+ * Sets an optional input object for the BACON outlier detection algorithm in the second step of the distributed processing mode
+ * \param[in] id    Identifier of the input object
+ * \param[in] ptr   Pointer to the object
+ */
+void DistributedStep2MasterInput::set(MasterNumericTableInputId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Adds partial results computed on local nodes to the input for the BACON outlier detection algorithm
+ * in the second step of the distributed processing mode
+ * \param[in] id    Identifier of the input object
+ * \param[in] value Pointer to the object
+ */
+void DistributedStep2MasterInput::add(MasterInputId id, const PartialResultPtr &value)
+{
+    DataCollectionPtr collection = get(id);
+    collection->push_back(value);
+}
+
+/**
+ * Checks an input object for the BACON outlier detection algorithm in the second step of the distributed processing mode
+ * \param[in] par     Algorithm parameter
+ * \param[in] method  Computation method
+ */
+services::Status DistributedStep2MasterInput::check(const daal::algorithms::Parameter *par, int method) const
+{
+    const Parameter *algParameter = static_cast<const Parameter *>(par);
+    DAAL_CHECK_EX(algParameter->initMethod == baconMahalanobis, ErrorIncorrectParameter, ParameterName, initMethodStr());
+
+    DataCollectionPtr collection = get(partialResults);
+    DAAL_CHECK(collection, ErrorNullInputDataCollection);
+
+    const size_t nBlocks = collection->size();
+    DAAL_CHECK(nBlocks > 0, ErrorIncorrectNumberOfInputNumericTables);
+
+    services::Status s;
+    size_t nFeatures = 0;
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        PartialResultPtr pres = dynamicPointerCast<PartialResult, SerializationIface>((*collection)[i]);
+        DAAL_CHECK(pres, ErrorIncorrectElementInPartialResultCollection);
+        DAAL_CHECK_STATUS(s, pres->check(par, method));
+
+        if (i == 0)
+        {
+            nFeatures = pres->getNumberOfFeatures();
+        }
+        DAAL_CHECK_EX(pres->getNumberOfFeatures() == nFeatures, ErrorIncorrectNumberOfColumns, ArgumentName, partialSumStr());
+    }
+
+    NumericTablePtr prevSize = get(inputBasicSubsetSize);
+    if (prevSize)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(prevSize.get(), basicSubsetSizeStr(), 0, 0, 1, 1));
+    }
+    return s;
+}
+
+DistributedPartialResult::DistributedPartialResult() : daal::algorithms::PartialResult(lastDistributedPartialResultId + 1) {}
+
+/**
+ * Returns partial result of the BACON outlier detection algorithm
+ * \param[in] id   Identifier of the partial result
+ * \return         Partial result that corresponds to the given identifier
+ */
+NumericTablePtr DistributedPartialResult::get(DistributedPartialResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets partial result of the BACON outlier detection algorithm
+ * \param[in] id    Identifier of the partial result
+ * \param[in] ptr   Pointer to the partial result
+ */
+void DistributedPartialResult::set(DistributedPartialResultId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Checks partial results of the BACON outlier detection algorithm in the second step of the distributed processing mode
+ * \param[in] input   Pointer to %Input objects of the algorithm
+ * \param[in] par     Pointer to the parameters of the algorithm
+ * \param[in] method  Computation method
+ */
+services::Status DistributedPartialResult::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const
+{
+    const DistributedStep2MasterInput *algInput = static_cast<const DistributedStep2MasterInput *>(input);
+    DataCollectionPtr collection = algInput->get(partialResults);
+    PartialResultPtr pres = staticPointerCast<bacon_outlier_detection::PartialResult, SerializationIface>((*collection)[0]);
+    const size_t nFeatures = pres->getNumberOfFeatures();
+
+    const int unexpectedLayouts = (int)packed_mask;
+    services::Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(basicSubsetMean).get(), basicSubsetMeanStr(), unexpectedLayouts, 0, nFeatures, 1));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(basicSubsetCovariance).get(), basicSubsetCovarianceStr(), unexpectedLayouts, 0, nFeatures, nFeatures));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(basicSubsetThreshold).get(), basicSubsetThresholdStr(), unexpectedLayouts, 0, 1, 1));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(basicSubsetSize).get(), basicSubsetSizeStr(), unexpectedLayouts, 0, 1, 1));
+    return checkNumericTable(get(convergenceFlag).get(), convergenceFlagStr(), unexpectedLayouts, 0, 1, 1);
+}
+
+} // namespace interface1
+} // namespace bacon_outlier_detection
+} // namespace algorithms
+} // namespace daal
@@ -49,6 +49,7 @@
 #define __OUTLIERDETECTION_BACON_KERNEL_H__
 
 #include "outlier_detection_bacon.h"
+#include "outlier_detection_bacon_distributed.h"
 #include "kernel.h"
 #include "service_numeric_table.h"
 #include "service_math.h"
@@ -71,6 +72,25 @@ struct OutlierDetectionKernel : public Kernel
     services::Status compute(NumericTable &data, NumericTable &weights, const Parameter &par);
 };
 
+template <typename algorithmFPType, Method method, CpuType cpu>
+struct OutlierDetectionDistrStep1Kernel : public Kernel
+{
+    services::Status compute(NumericTable &data, NumericTable *mean, NumericTable *covariance, NumericTable *threshold,
+                             NumericTable &nObservations, NumericTable &nSubsetObservations, NumericTable &partialSum,
+                             NumericTable &partialCrossProduct, NumericTable &partialWeights, NumericTable &partialShift,
+                             const Parameter &par);
+};
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+struct OutlierDetectionDistrStep2Kernel : public Kernel
+{
+    services::Status compute(size_t nBlocks, NumericTable **nObservations, NumericTable **nSubsetObservations,
+                             NumericTable **partialSums, NumericTable **partialCrossProducts, NumericTable **partialShifts,
+                             NumericTable *prevBasicSubsetSize,
+                             NumericTable &mean, NumericTable &covariance, NumericTable &threshold,
+                             NumericTable &basicSubsetSize, NumericTable &convergenceFlag, const Parameter &par);
+};
+
 } // namespace internal
 
 } // namespace bacon_outlier_detection
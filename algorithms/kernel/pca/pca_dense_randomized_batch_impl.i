@@ -0,0 +1,276 @@
+/* file: pca_dense_randomized_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the PCA randomized method in the batch processing mode
+//--
+*/
+
+#ifndef __PCA_DENSE_RANDOMIZED_BATCH_IMPL_I__
+#define __PCA_DENSE_RANDOMIZED_BATCH_IMPL_I__
+
+#include "service_math.h"
+#include "service_memory.h"
+#include "service_numeric_table.h"
+#include "service_error_handling.h"
+#include "threading.h"
+#include "svd/svd_dense_randomized_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace internal
+{
+
+using namespace daal::services::internal;
+using namespace daal::data_management;
+using namespace daal::internal;
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCARandomizedBatchKernel<algorithmFPType, cpu>::compute
+        (InputDataType type,
+         NumericTable& data,
+         const BatchParameter<algorithmFPType, randomizedDense> *parameter,
+         NumericTable &eigenvalues, NumericTable &eigenvectors,
+         NumericTable &means, NumericTable &variances)
+{
+    const size_t nVectors  = data.getNumberOfRows();
+    const size_t nFeatures = data.getNumberOfColumns();
+    const size_t nComponents = parameter->nComponents;
+
+    TArray<algorithmFPType, cpu> meanPtr(nFeatures);
+    TArray<algorithmFPType, cpu> invSigmaPtr(nFeatures);
+    algorithmFPType *mean     = meanPtr.get();
+    algorithmFPType *invSigma = invSigmaPtr.get();
+    DAAL_CHECK_MALLOC(mean && invSigma);
+
+    Status status;
+    const bool isRawData = (type == nonNormalizedDataset);
+    if (isRawData)
+    {
+        /* invSigma holds the variances until they are written to the result */
+        DAAL_CHECK_STATUS(status, computeMeansAndVariances(data, mean, invSigma));
+
+        if (parameter->resultsToCompute & pca::mean)
+        {
+            WriteOnlyRows<algorithmFPType, cpu> meansBlock(means, 0, 1);
+            DAAL_CHECK_BLOCK_STATUS(meansBlock);
+            daal::services::daal_memcpy_s(meansBlock.get(), nFeatures * sizeof(algorithmFPType), mean, nFeatures * sizeof(algorithmFPType));
+        }
+        if (parameter->resultsToCompute & variance)
+        {
+            WriteOnlyRows<algorithmFPType, cpu> variancesBlock(variances, 0, 1);
+            DAAL_CHECK_BLOCK_STATUS(variancesBlock);
+            daal::services::daal_memcpy_s(variancesBlock.get(), nFeatures * sizeof(algorithmFPType), invSigma, nFeatures * sizeof(algorithmFPType));
+        }
+
+        /* Features with zero variance do not contribute to the correlation matrix */
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            if (invSigma[j])
+                invSigma[j] = algorithmFPType(1.0) / daal::internal::Math<algorithmFPType, cpu>::sSqrt(invSigma[j]);
+        }
+    }
+    else
+    {
+        if (parameter->resultsToCompute & pca::mean)
+        {
+            DAAL_CHECK_STATUS(status, this->fillTable(means, (algorithmFPType)0));
+        }
+        if (parameter->resultsToCompute & variance)
+        {
+            DAAL_CHECK_STATUS(status, this->fillTable(variances, (algorithmFPType)1));
+        }
+    }
+
+    {
+        WriteOnlyRows<algorithmFPType, cpu> eigenvaluesBlock(eigenvalues, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(eigenvaluesBlock);
+        WriteOnlyRows<algorithmFPType, cpu> eigenvectorsBlock(eigenvectors, 0, nComponents);
+        DAAL_CHECK_BLOCK_STATUS(eigenvectorsBlock);
+        algorithmFPType *eigenvaluesArray = eigenvaluesBlock.get();
+
+        /* Data is centered and scaled implicitly, the input table is not modified */
+        svd::internal::RandomizedSVD<algorithmFPType, cpu> randomizedSvd(data, isRawData ? mean : 0, isRawData ? invSigma : 0);
+        DAAL_CHECK_STATUS(status, randomizedSvd.compute(nComponents, parameter->nPowerIterations, parameter->seed,
+                                                        eigenvaluesArray, eigenvectorsBlock.get(), 0));
+
+        /* Singular values of the correlation matrix are its eigenvalues,
+           squared singular values of the normalized data are scaled to the eigenvalues */
+        if (type != correlation)
+        {
+            const algorithmFPType invNm1 = algorithmFPType(1.0) / algorithmFPType(nVectors - 1);
+            for (size_t i = 0; i < nComponents; i++)
+            {
+                eigenvaluesArray[i] = eigenvaluesArray[i] * eigenvaluesArray[i] * invNm1;
+            }
+        }
+    }
+
+    if (parameter->isDeterministic)
+    {
+        DAAL_CHECK_STATUS(status, this->signFlipEigenvectors(eigenvectors));
+    }
+    return status;
+}
+
+/**
+ *  Computes means and unbiased variances of features in one pass over the data:
+ *  blocks of rows are reduced with two passes over the block in cache and merged pairwise
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCARandomizedBatchKernel<algorithmFPType, cpu>::computeMeansAndVariances(NumericTable& data,
+    algorithmFPType *mean, algorithmFPType *variance)
+{
+    const size_t nVectors  = data.getNumberOfRows();
+    const size_t nFeatures = data.getNumberOfColumns();
+    const size_t blockSize = svd::internal::randomizedRowsInBlock;
+    const size_t nBlocks   = nVectors / blockSize + !!(nVectors % blockSize);
+
+    /* Thread local storage: number of rows, means, sums of squared deviations, block means and block sums of squared deviations */
+    const size_t nLocal = 1 + 4 * nFeatures;
+    daal::tls<algorithmFPType *> tlsMoments([ = ]()
+    {
+        return service_scalable_calloc<algorithmFPType, cpu>(nLocal);
+    });
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [ =, &tlsMoments, &data, &safeStat ](size_t iBlock)
+    {
+        const size_t startRow = iBlock * blockSize;
+        const size_t nRows = (iBlock == nBlocks - 1) ? nVectors - startRow : blockSize;
+
+        algorithmFPType *local = tlsMoments.local();
+        DAAL_CHECK_MALLOC_THR(local);
+
+        ReadRows<algorithmFPType, cpu> dataRows(data, startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(dataRows);
+        const algorithmFPType *x = dataRows.get();
+
+        algorithmFPType *localMean  = local + 1;
+        algorithmFPType *localM2    = localMean + nFeatures;
+        algorithmFPType *blockMean  = localM2 + nFeatures;
+        algorithmFPType *blockM2    = blockMean + nFeatures;
+
+        for (size_t j = 0; j < nFeatures; j++) { blockMean[j] = 0; blockM2[j] = 0; }
+        for (size_t i = 0; i < nRows; i++)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                blockMean[j] += x[i * nFeatures + j];
+            }
+        }
+        const algorithmFPType invBlockN = algorithmFPType(1.0) / algorithmFPType(nRows);
+        for (size_t j = 0; j < nFeatures; j++) { blockMean[j] *= invBlockN; }
+        for (size_t i = 0; i < nRows; i++)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                const algorithmFPType delta = x[i * nFeatures + j] - blockMean[j];
+                blockM2[j] += delta * delta;
+            }
+        }
+
+        /* Merge the block moments into the moments of the thread */
+        const algorithmFPType n1 = local[0];
+        const algorithmFPType n2 = algorithmFPType(nRows);
+        const algorithmFPType n  = n1 + n2;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            const algorithmFPType delta = blockMean[j] - localMean[j];
+            localMean[j] += delta * n2 / n;
+            localM2[j]   += blockM2[j] + delta * delta * n1 * n2 / n;
+        }
+        local[0] = n;
+    });
+
+    TArrayCalloc<algorithmFPType, cpu> m2Ptr(nFeatures);
+    algorithmFPType *m2 = m2Ptr.get();
+    for (size_t j = 0; j < nFeatures; j++) { mean[j] = 0; }
+    algorithmFPType nTotal = 0;
+
+    tlsMoments.reduce([ =, &nTotal ](algorithmFPType *local)
+    {
+        if (!local) { return; }
+        const algorithmFPType n1 = nTotal;
+        const algorithmFPType n2 = local[0];
+        if (m2 && n2 > 0)
+        {
+            const algorithmFPType n = n1 + n2;
+            const algorithmFPType *localMean = local + 1;
+            const algorithmFPType *localM2   = localMean + nFeatures;
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                const algorithmFPType delta = localMean[j] - mean[j];
+                mean[j] += delta * n2 / n;
+                m2[j]   += localM2[j] + delta * delta * n1 * n2 / n;
+            }
+            nTotal = n;
+        }
+        service_scalable_free<algorithmFPType, cpu>(local);
+    });
+    DAAL_CHECK_SAFE_STATUS();
+    DAAL_CHECK_MALLOC(m2);
+
+    const algorithmFPType invNm1 = algorithmFPType(1.0) / algorithmFPType(nVectors - 1);
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        variance[j] = m2[j] * invNm1;
+    }
+    return services::Status();
+}
+
+} // namespace internal
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+
+#endif
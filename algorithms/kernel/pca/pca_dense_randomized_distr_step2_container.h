@@ -0,0 +1,121 @@
+/* file: pca_dense_randomized_distr_step2_container.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of PCA randomized algorithm container.
+//--
+*/
+
+#ifndef __PCA_DENSE_RANDOMIZED_DISTR_STEP2_CONTAINER_H__
+#define __PCA_DENSE_RANDOMIZED_DISTR_STEP2_CONTAINER_H__
+
+#include "kernel.h"
+#include "pca_distributed.h"
+#include "pca_dense_randomized_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+
+template <typename algorithmFPType, CpuType cpu>
+DistributedContainer<step2Master, algorithmFPType, randomizedDense, cpu>::DistributedContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::PCARandomizedStep2MasterKernel, algorithmFPType);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+DistributedContainer<step2Master, algorithmFPType, randomizedDense, cpu>::~DistributedContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status DistributedContainer<step2Master, algorithmFPType, randomizedDense, cpu>::compute()
+{
+    DistributedInput<randomizedDense> *input = static_cast<DistributedInput<randomizedDense> *>(_in);
+    PartialResult<randomizedDense> *partialResult = static_cast<PartialResult<randomizedDense> *>(_pres);
+
+    data_management::DataCollectionPtr inputPartialResults = input->get(pca::partialResults);
+
+    data_management::NumericTablePtr nObservations = partialResult->get(pca::nObservationsRandomized);
+    data_management::NumericTablePtr sum           = partialResult->get(pca::sumRandomized);
+    data_management::NumericTablePtr sumSquares    = partialResult->get(pca::sumSquaresRandomized);
+    data_management::NumericTablePtr sketch        = partialResult->get(pca::sketchRandomized);
+
+    daal::services::Environment::env &env = *_env;
+
+    services::Status s = __DAAL_CALL_KERNEL_STATUS(env, internal::PCARandomizedStep2MasterKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType),
+        compute, inputPartialResults, *nObservations, *sum, *sumSquares, *sketch);
+
+    inputPartialResults->clear();
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status DistributedContainer<step2Master, algorithmFPType, randomizedDense, cpu>::finalizeCompute()
+{
+    Result *result = static_cast<Result *>(_res);
+    PartialResult<randomizedDense> *partialResult = static_cast<PartialResult<randomizedDense> *>(_pres);
+    DistributedParameter<step2Master, algorithmFPType, randomizedDense> *parameter =
+        static_cast<DistributedParameter<step2Master, algorithmFPType, randomizedDense> *>(_par);
+
+    data_management::NumericTablePtr nObservations = partialResult->get(pca::nObservationsRandomized);
+    data_management::NumericTablePtr sum           = partialResult->get(pca::sumRandomized);
+    data_management::NumericTablePtr sumSquares    = partialResult->get(pca::sumSquaresRandomized);
+    data_management::NumericTablePtr sketch        = partialResult->get(pca::sketchRandomized);
+
+    data_management::NumericTablePtr eigenvalues  = result->get(pca::eigenvalues);
+    data_management::NumericTablePtr eigenvectors = result->get(pca::eigenvectors);
+
+    daal::services::Environment::env &env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::PCARandomizedStep2MasterKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType),
+        finalizeCompute, *nObservations, *sum, *sumSquares, *sketch, parameter, *eigenvalues, *eigenvectors);
+}
+
+}
+}
+} // namespace daal
+#endif
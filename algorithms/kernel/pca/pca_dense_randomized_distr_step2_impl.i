@@ -0,0 +1,132 @@
+/* file: pca_dense_randomized_distr_step2_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the PCA randomized method on the master node.
+//  Sketches of local nodes are computed with the same Gaussian matrix,
+//  so they are merged by summation as well as the feature sums.
+//--
+*/
+
+#ifndef __PCA_DENSE_RANDOMIZED_DISTR_STEP2_IMPL_I__
+#define __PCA_DENSE_RANDOMIZED_DISTR_STEP2_IMPL_I__
+
+#include "service_numeric_table.h"
+#include "service_error_handling.h"
+#include "pca_dense_randomized_online_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace internal
+{
+
+using namespace daal::data_management;
+using namespace daal::internal;
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCARandomizedStep2MasterKernel<algorithmFPType, cpu>::compute(const DataCollectionPtr& inputPartialResults,
+    NumericTable& nObservationsTable, NumericTable& sumTable, NumericTable& sumSquaresTable, NumericTable& sketchTable)
+{
+    const size_t nFeatures = sumTable.getNumberOfColumns();
+    const size_t nSketch   = sketchTable.getNumberOfRows();
+
+    WriteRows<algorithmFPType, cpu> nObservationsBlock(nObservationsTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nObservationsBlock);
+    WriteRows<algorithmFPType, cpu> sumBlock(sumTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(sumBlock);
+    WriteRows<algorithmFPType, cpu> sumSquaresBlock(sumSquaresTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(sumSquaresBlock);
+    WriteRows<algorithmFPType, cpu> sketchBlock(sketchTable, 0, nSketch);
+    DAAL_CHECK_BLOCK_STATUS(sketchBlock);
+
+    algorithmFPType *nObservations = nObservationsBlock.get();
+    algorithmFPType *sum           = sumBlock.get();
+    algorithmFPType *sumSquares    = sumSquaresBlock.get();
+    algorithmFPType *sketch        = sketchBlock.get();
+
+    const size_t nBlocks = inputPartialResults->size();
+    for (size_t iBlock = 0; iBlock < nBlocks; iBlock++)
+    {
+        PartialResult<randomizedDense> *partialResult = static_cast<PartialResult<randomizedDense> *>((*inputPartialResults)[iBlock].get());
+
+        ReadRows<algorithmFPType, cpu> localNObservations(partialResult->get(nObservationsRandomized).get(), 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(localNObservations);
+        ReadRows<algorithmFPType, cpu> localSum(partialResult->get(sumRandomized).get(), 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(localSum);
+        ReadRows<algorithmFPType, cpu> localSumSquares(partialResult->get(sumSquaresRandomized).get(), 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(localSumSquares);
+        ReadRows<algorithmFPType, cpu> localSketch(partialResult->get(sketchRandomized).get(), 0, nSketch);
+        DAAL_CHECK_BLOCK_STATUS(localSketch);
+
+        nObservations[0] += localNObservations.get()[0];
+
+        const algorithmFPType *localSumArray        = localSum.get();
+        const algorithmFPType *localSumSquaresArray = localSumSquares.get();
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            sum[j]        += localSumArray[j];
+            sumSquares[j] += localSumSquaresArray[j];
+        }
+
+        const algorithmFPType *localSketchArray = localSketch.get();
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < nFeatures * nSketch; i++)
+        {
+            sketch[i] += localSketchArray[i];
+        }
+    }
+    return services::Status();
+}
+
+} // namespace internal
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,370 @@
+/* file: pca_dense_randomized_online_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the PCA randomized method in the online processing mode.
+//  Each block of data updates the feature sums and the sketch X'X * Omega of the
+//  cross-product, so the data is read once. On finalization the sketch of the correlation
+//  matrix is restored from the sums and the leading eigenpairs are computed with
+//  the Nystrom approximation.
+//--
+*/
+
+#ifndef __PCA_DENSE_RANDOMIZED_ONLINE_IMPL_I__
+#define __PCA_DENSE_RANDOMIZED_ONLINE_IMPL_I__
+
+#include "service_math.h"
+#include "service_memory.h"
+#include "service_numeric_table.h"
+#include "service_error_handling.h"
+#include "service_blas.h"
+#include "service_lapack.h"
+#include "service_data_utils.h"
+#include "threading.h"
+#include "svd/svd_dense_randomized_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace internal
+{
+
+using namespace daal::services::internal;
+using namespace daal::data_management;
+using namespace daal::internal;
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCARandomizedOnlineKernel<algorithmFPType, cpu>::compute(NumericTable& data,
+    const OnlineParameter<algorithmFPType, randomizedDense>* parameter,
+    NumericTable& nObservationsTable, NumericTable& sumTable, NumericTable& sumSquaresTable, NumericTable& sketchTable)
+{
+    const size_t nVectors  = data.getNumberOfRows();
+    const size_t nFeatures = data.getNumberOfColumns();
+    const size_t nSketch   = sketchTable.getNumberOfRows();
+    const size_t blockSize = svd::internal::randomizedRowsInBlock;
+    const size_t nBlocks   = nVectors / blockSize + !!(nVectors % blockSize);
+
+    TArray<algorithmFPType, cpu> omegaPtr(nFeatures * nSketch);
+    algorithmFPType *omega = omegaPtr.get();
+    DAAL_CHECK_MALLOC(omega);
+
+    Status status;
+    DAAL_CHECK_STATUS(status, (svd::internal::generateGaussianTestMatrix<algorithmFPType, cpu>(nFeatures, nSketch, parameter->seed, omega)));
+
+    /* Thread local storage: sketch, sums, sums of squares and the product of the block with Omega */
+    const size_t nAccumulated = nFeatures * nSketch + 2 * nFeatures;
+    const size_t nLocal = nAccumulated + blockSize * nSketch;
+    daal::tls<algorithmFPType *> tlsSketch([ = ]()
+    {
+        return service_scalable_calloc<algorithmFPType, cpu>(nLocal);
+    });
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [ =, &tlsSketch, &data, &safeStat ](size_t iBlock)
+    {
+        const size_t startRow = iBlock * blockSize;
+        const size_t nRows = (iBlock == nBlocks - 1) ? nVectors - startRow : blockSize;
+
+        algorithmFPType *local = tlsSketch.local();
+        DAAL_CHECK_MALLOC_THR(local);
+
+        ReadRows<algorithmFPType, cpu> dataRows(data, startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(dataRows);
+        const algorithmFPType *x = dataRows.get();
+
+        algorithmFPType *localSketch     = local;
+        algorithmFPType *localSum        = localSketch + nFeatures * nSketch;
+        algorithmFPType *localSumSquares = localSum + nFeatures;
+        algorithmFPType *y               = localSumSquares + nFeatures;
+
+        const algorithmFPType one  = 1.0;
+        const algorithmFPType zero = 0.0;
+        DAAL_INT p  = (DAAL_INT)nFeatures;
+        DAAL_INT l  = (DAAL_INT)nSketch;
+        DAAL_INT nr = (DAAL_INT)nRows;
+
+        /* Y = X_b * Omega, X_b is the column-major p x nRows matrix X_b' */
+        const char t = 't';
+        const char n = 'n';
+        Blas<algorithmFPType, cpu>::xxgemm(&t, &n, &nr, &l, &p, &one, x, &p, omega, &p, &zero, y, &nr);
+        /* S += X_b' * Y */
+        Blas<algorithmFPType, cpu>::xxgemm(&n, &n, &p, &l, &nr, &one, x, &p, y, &nr, &one, localSketch, &p);
+
+        for (size_t i = 0; i < nRows; i++)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                localSum[j]        += x[i * nFeatures + j];
+                localSumSquares[j] += x[i * nFeatures + j] * x[i * nFeatures + j];
+            }
+        }
+    });
+
+    TArrayCalloc<algorithmFPType, cpu> accumulatedPtr(nAccumulated);
+    algorithmFPType *accumulated = accumulatedPtr.get();
+
+    tlsSketch.reduce([ = ](algorithmFPType *local)
+    {
+        if (!local) { return; }
+        if (accumulated)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < nAccumulated; i++)
+            {
+                accumulated[i] += local[i];
+            }
+        }
+        service_scalable_free<algorithmFPType, cpu>(local);
+    });
+    DAAL_CHECK_SAFE_STATUS();
+    DAAL_CHECK_MALLOC(accumulated);
+
+    WriteRows<algorithmFPType, cpu> nObservationsBlock(nObservationsTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nObservationsBlock);
+    WriteRows<algorithmFPType, cpu> sumBlock(sumTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(sumBlock);
+    WriteRows<algorithmFPType, cpu> sumSquaresBlock(sumSquaresTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(sumSquaresBlock);
+    WriteRows<algorithmFPType, cpu> sketchBlock(sketchTable, 0, nSketch);
+    DAAL_CHECK_BLOCK_STATUS(sketchBlock);
+
+    /* Row j of the sketch table is the j-th column of the column-major p x l sketch */
+    algorithmFPType *sketch = sketchBlock.get();
+    for (size_t i = 0; i < nFeatures * nSketch; i++)
+    {
+        sketch[i] += accumulated[i];
+    }
+    algorithmFPType *sum        = sumBlock.get();
+    algorithmFPType *sumSquares = sumSquaresBlock.get();
+    const algorithmFPType *accumulatedSum        = accumulated + nFeatures * nSketch;
+    const algorithmFPType *accumulatedSumSquares = accumulatedSum + nFeatures;
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        sum[j]        += accumulatedSum[j];
+        sumSquares[j] += accumulatedSumSquares[j];
+    }
+    nObservationsBlock.get()[0] += algorithmFPType(nVectors);
+    return status;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCARandomizedOnlineKernel<algorithmFPType, cpu>::finalizeCompute(NumericTable& nObservationsTable,
+    NumericTable& sumTable, NumericTable& sumSquaresTable, NumericTable& sketchTable,
+    const OnlineParameter<algorithmFPType, randomizedDense>* parameter,
+    NumericTable& eigenvalues, NumericTable& eigenvectors)
+{
+    const size_t nFeatures   = sumTable.getNumberOfColumns();
+    const size_t nSketch     = sketchTable.getNumberOfRows();
+    const size_t nComponents = eigenvalues.getNumberOfColumns();
+    DAAL_CHECK(nComponents <= nSketch, ErrorIncorrectNumberOfColumnsInOutputNumericTable);
+
+    ReadRows<algorithmFPType, cpu> nObservationsBlock(nObservationsTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nObservationsBlock);
+    ReadRows<algorithmFPType, cpu> sumBlock(sumTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(sumBlock);
+    ReadRows<algorithmFPType, cpu> sumSquaresBlock(sumSquaresTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(sumSquaresBlock);
+    ReadRows<algorithmFPType, cpu> sketchBlock(sketchTable, 0, nSketch);
+    DAAL_CHECK_BLOCK_STATUS(sketchBlock);
+
+    const algorithmFPType nObservations = nObservationsBlock.get()[0];
+    DAAL_CHECK(nObservations > 1, ErrorIncorrectNumberOfObservations);
+    const algorithmFPType *sum        = sumBlock.get();
+    const algorithmFPType *sumSquares = sumSquaresBlock.get();
+    const algorithmFPType *sketch     = sketchBlock.get();
+
+    TArray<algorithmFPType, cpu> omegaPtr(nFeatures * nSketch);
+    TArray<algorithmFPType, cpu> yPtr(nFeatures * nSketch);
+    TArray<algorithmFPType, cpu> invSigmaPtr(nFeatures);
+    TArrayCalloc<algorithmFPType, cpu> shiftPtr(nSketch);
+    algorithmFPType *omega    = omegaPtr.get();
+    algorithmFPType *y        = yPtr.get();
+    algorithmFPType *invSigma = invSigmaPtr.get();
+    algorithmFPType *shift    = shiftPtr.get();
+    DAAL_CHECK_MALLOC(omega && y && invSigma && shift);
+
+    Status status;
+    DAAL_CHECK_STATUS(status, (svd::internal::generateGaussianTestMatrix<algorithmFPType, cpu>(nFeatures, nSketch, parameter->seed, omega)));
+
+    const algorithmFPType invN   = algorithmFPType(1.0) / nObservations;
+    const algorithmFPType invNm1 = algorithmFPType(1.0) / (nObservations - algorithmFPType(1.0));
+
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        const algorithmFPType var = (sumSquares[i] - sum[i] * sum[i] * invN) * invNm1;
+        invSigma[i] = (var > 0 ? algorithmFPType(1.0) / daal::internal::Math<algorithmFPType, cpu>::sSqrt(var) : algorithmFPType(0));
+    }
+
+    /* Covariance sketch: Y = (X'X * Omega - s * (s' * Omega) / n) / (n - 1) */
+    for (size_t j = 0; j < nSketch; j++)
+    {
+        algorithmFPType dot = 0;
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            dot += sum[i] * omega[j * nFeatures + i];
+        }
+        shift[j] = dot * invN;
+    }
+    algorithmFPType norm2 = 0;
+    for (size_t j = 0; j < nSketch; j++)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            const algorithmFPType yij = (sketch[j * nFeatures + i] - sum[i] * shift[j]) * invNm1;
+            y[j * nFeatures + i] = yij;
+            norm2 += yij * yij;
+        }
+    }
+
+    /* Small shift keeps the core matrix Omega' * Y positive definite in finite precision */
+    const algorithmFPType nu = daal::data_feature_utils::internal::EpsilonVal<algorithmFPType, cpu>::get() *
+                               daal::internal::Math<algorithmFPType, cpu>::sSqrt(algorithmFPType(nFeatures) * norm2);
+    for (size_t i = 0; i < nFeatures * nSketch; i++)
+    {
+        y[i] += nu * omega[i];
+    }
+
+    /* B = Omega' * Y = R' * R */
+    TArray<algorithmFPType, cpu> bPtr(nSketch * nSketch);
+    algorithmFPType *b = bPtr.get();
+    DAAL_CHECK_MALLOC(b);
+    {
+        const char t = 't';
+        const char n = 'n';
+        const algorithmFPType one  = 1.0;
+        const algorithmFPType zero = 0.0;
+        DAAL_INT p = (DAAL_INT)nFeatures;
+        DAAL_INT l = (DAAL_INT)nSketch;
+        Blas<algorithmFPType, cpu>::xgemm(&t, &n, &l, &l, &p, &one, omega, &p, y, &p, &zero, b, &l);
+    }
+    for (size_t j = 0; j < nSketch; j++)
+    {
+        for (size_t i = 0; i < j; i++)
+        {
+            const algorithmFPType bij = (b[j * nSketch + i] + b[i * nSketch + j]) * algorithmFPType(0.5);
+            b[j * nSketch + i] = bij;
+            b[i * nSketch + j] = bij;
+        }
+    }
+
+    char uplo = 'U';
+    DAAL_INT l = (DAAL_INT)nSketch;
+    DAAL_INT p = (DAAL_INT)nFeatures;
+    DAAL_INT info = 0;
+    Lapack<algorithmFPType, cpu>::xpotrf(&uplo, &l, b, &l, &info);
+    DAAL_CHECK(info == 0, ErrorPCAFailedToComputeCorrelationEigenvalues);
+
+    /* E' = R'^-1 * Y' so that E * E' = Y * B^-1 * Y' approximates the covariance matrix */
+    TArray<algorithmFPType, cpu> etPtr(nSketch * nFeatures);
+    algorithmFPType *et = etPtr.get();
+    DAAL_CHECK_MALLOC(et);
+    for (size_t j = 0; j < nSketch; j++)
+    {
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            et[i * nSketch + j] = y[j * nFeatures + i];
+        }
+    }
+    char trans = 'T';
+    char diag  = 'N';
+    Lapack<algorithmFPType, cpu>::xtrtrs(&uplo, &trans, &diag, &l, &p, b, &l, et, &l, &info);
+    DAAL_CHECK(info == 0, ErrorPCAFailedToComputeCorrelationEigenvalues);
+
+    /* Scaling of the features turns the covariance approximation into the correlation one */
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nSketch; j++)
+        {
+            et[i * nSketch + j] *= invSigma[i];
+        }
+    }
+
+    /* E' = W * S * U', eigenvalues of the correlation matrix are S^2 and eigenvectors are the rows of U' */
+    TArray<algorithmFPType, cpu> sPtr(nSketch);
+    TArray<algorithmFPType, cpu> wPtr(nSketch * nSketch);
+    TArray<algorithmFPType, cpu> utPtr(nSketch * nFeatures);
+    algorithmFPType *s  = sPtr.get();
+    algorithmFPType *w  = wPtr.get();
+    algorithmFPType *ut = utPtr.get();
+    DAAL_CHECK_MALLOC(s && w && ut);
+    DAAL_CHECK_STATUS(status, (svd::internal::compute_svd_on_one_node<algorithmFPType, cpu>(l, p, et, l, s, w, l, ut, l)));
+
+    WriteOnlyRows<algorithmFPType, cpu> eigenvaluesBlock(eigenvalues, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(eigenvaluesBlock);
+    WriteOnlyRows<algorithmFPType, cpu> eigenvectorsBlock(eigenvectors, 0, nComponents);
+    DAAL_CHECK_BLOCK_STATUS(eigenvectorsBlock);
+    algorithmFPType *eigenvaluesArray  = eigenvaluesBlock.get();
+    algorithmFPType *eigenvectorsArray = eigenvectorsBlock.get();
+
+    /* The sketch approximates the covariance matrix shifted by nu * I, which is nu * invSigma^2 on the diagonal
+       after the scaling. The shift is removed from each eigenvalue along its eigenvector, negative values are clamped */
+    for (size_t k = 0; k < nComponents; k++)
+    {
+        algorithmFPType shiftK = 0;
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            const algorithmFPType uik = ut[i * nSketch + k];
+            eigenvectorsArray[k * nFeatures + i] = uik;
+            shiftK += uik * uik * invSigma[i] * invSigma[i];
+        }
+        const algorithmFPType eigenvalue = s[k] * s[k] - nu * shiftK;
+        eigenvaluesArray[k] = (eigenvalue > 0 ? eigenvalue : algorithmFPType(0));
+    }
+    return status;
+}
+
+} // namespace internal
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -142,6 +142,16 @@ void Result::set(ResultId id, const NumericTablePtr &value)
 */
 services::Status Result::check(const daal::algorithms::PartialResult *pr, const daal::algorithms::Parameter *parameter, int method) const
 {
+    if (method == randomizedDense)
+    {
+        const PartialResultBase *partialRes = static_cast<const PartialResultBase *>(pr);
+        DAAL_CHECK(partialRes, ErrorNullPtr);
+        NumericTablePtr eigenvaluesTable = get(eigenvalues);
+        DAAL_CHECK_EX(eigenvaluesTable, ErrorNullOutputNumericTable, ArgumentName, eigenvaluesStr());
+        const size_t nComponents = eigenvaluesTable->getNumberOfColumns();
+        DAAL_CHECK_EX(nComponents > 0 && nComponents <= partialRes->getNFeatures(), ErrorIncorrectParameter, ParameterName, nComponentsStr());
+        return checkImpl(partialRes->getNFeatures(), nComponents, none);
+    }
     return checkImpl(0, 0, eigenvalue);
 }
 
@@ -184,12 +194,17 @@ services::Status Result::check(const daal::algorithms::Input *input, const daal:
     const auto* par = static_cast<const BaseBatchParameter*>(parameter);
     DAAL_CHECK(par, ErrorNullPtr);
 
-    size_t nComponents = par->nComponents;
+    size_t nComponents = (method == randomizedDense ? par->nComponents : 0);
     DAAL_UINT64 resultsToCompute = par->resultsToCompute;
 
     const interface1::InputIface *in = static_cast<const interface1::InputIface *>(input);
     DAAL_CHECK(in, ErrorNullPtr);
 
+    if (method == randomizedDense)
+    {
+        DAAL_CHECK_EX(nComponents > 0 && nComponents <= in->getNFeatures(), ErrorIncorrectParameter, ParameterName, nComponentsStr());
+    }
+
     return checkImpl(in->getNFeatures(), nComponents, resultsToCompute);
 }
 
@@ -68,7 +68,8 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *inp
     const auto* par = static_cast<const BaseBatchParameter*>(parameter);
     DAAL_CHECK(par, services::ErrorNullPtr);
 
-    size_t nComponents = par->nComponents;
+    /* Only the randomized method computes the reduced set of components */
+    size_t nComponents = (method == randomizedDense ? par->nComponents : 0);
     DAAL_UINT64 resultsToCompute = par->resultsToCompute;
 
     auto impl = ResultImpl::cast(getStorage());
@@ -86,15 +87,22 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *inp
 template<typename algorithmFPType>
 DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::PartialResult *partialResult, daal::algorithms::Parameter *parameter, const Method method)
 {
+    auto impl = ResultImpl::cast(getStorage());
+    DAAL_CHECK(impl, services::ErrorNullPtr);
+
+    if (method == randomizedDense)
+    {
+        const auto* par = static_cast<const OnlineParameter<algorithmFPType, randomizedDense>*>(parameter);
+        DAAL_CHECK(par, services::ErrorNullPtr);
+        return impl->allocate<algorithmFPType>(partialResult, par->nComponents, none);
+    }
+
     const auto* par = static_cast<const BaseBatchParameter*>(parameter);
     DAAL_CHECK(par, services::ErrorNullPtr);
 
-    size_t nComponents = par->nComponents;
+    size_t nComponents = 0;
     DAAL_UINT64 resultsToCompute = par->resultsToCompute;
 
-    auto impl = ResultImpl::cast(getStorage());
-    DAAL_CHECK(impl, services::ErrorNullPtr);
-
     return impl->allocate<algorithmFPType>(partialResult, nComponents, resultsToCompute);
 }
 
@@ -46,6 +46,7 @@
 */
 
 #include "pca_result_impl.h"
+#include "daal_strings.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -63,16 +64,27 @@ namespace interface2
 /**
 * Checks the results of the PCA algorithm implementation
 * \param[in] nFeatures      Number of features
+* \param[in] nComponents    Number of computed components, 0 if all nFeatures components are computed
 * \param[in] nTables        Number of tables
 *
 * \return Status
 */
 services::Status ResultImpl::check(size_t nFeatures, size_t nComponents, size_t nTables) const
 {
-    Status status = interface1::ResultImpl::check(nFeatures, nTables);
-    DAAL_CHECK_STATUS_VAR(status);
-    // TODO:
-    return status;
+    if (nComponents == 0)
+    {
+        Status status = interface1::ResultImpl::check(nFeatures, nTables);
+        DAAL_CHECK_STATUS_VAR(status);
+        // TODO:
+        return status;
+    }
+
+    DAAL_CHECK(size() == nTables, ErrorIncorrectNumberOfOutputNumericTables);
+    const int packedLayouts = packed_mask;
+    Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(NumericTable::cast(get(eigenvalues)).get(), eigenvaluesStr(), packedLayouts, 0, nComponents, 1));
+    DAAL_CHECK_STATUS(s, checkNumericTable(NumericTable::cast(get(eigenvectors)).get(), eigenvectorsStr(), packedLayouts, 0, nFeatures, nComponents));
+    return s;
 }
 
 } // namespace interface2
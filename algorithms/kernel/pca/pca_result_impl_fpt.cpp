@@ -91,15 +91,27 @@ services::Status ResultImpl::allocate(const daal::algorithms::PartialResult *par
 /**
 * Allocates memory for storing partial results of the PCA algorithm
 * \param[in] nFeatures      Number of features
-* \param[in] nComponents    Number of components
+* \param[in] nComponents    Number of components, 0 if all nFeatures components are computed
 * \param[in] resultsToCompute     Results to compute
 * \return Status of computations
 */
 template <typename algorithmFPType>
 services::Status ResultImpl::allocate(size_t nFeatures, size_t nComponents, DAAL_UINT64 resultsToCompute)
 {
-    services::Status status = interface1::ResultImpl::allocate<algorithmFPType>(nFeatures);
-    DAAL_CHECK_STATUS_VAR(status);
+    services::Status status;
+    if (nComponents > 0)
+    {
+        /* Only the leading nComponents eigenpairs are computed */
+        setTable(eigenvalues, data_management::HomogenNumericTable<algorithmFPType>::create(nComponents, 1, data_management::NumericTableIface::doAllocate, 0, &status));
+        DAAL_CHECK_STATUS_VAR(status);
+        setTable(eigenvectors, data_management::HomogenNumericTable<algorithmFPType>::create(nFeatures, nComponents, data_management::NumericTableIface::doAllocate, 0, &status));
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+    else
+    {
+        status = interface1::ResultImpl::allocate<algorithmFPType>(nFeatures);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
     if (resultsToCompute & eigenvalue)
     {
         isWhitening = true;
@@ -146,15 +146,45 @@ Status Result::check(const daal::algorithms::Input *in, const daal::algorithms::
     size_t nVectors = input->get(data)->getNumberOfRows();
     size_t nFeatures = input->get(data)->getNumberOfColumns();
 
+    return checkImpl(nFeatures, nVectors);
+}
+
+/**
+* Checks the correctness of the result object in the online processing mode
+* \param[in] pres   Pointer to the partial result
+* \param[in] par    Pointer to the structure of the algorithm parameters
+* \param[in] method Computation method
+*/
+Status Result::check(const daal::algorithms::PartialResult *pres, const daal::algorithms::Parameter *par, int method) const
+{
+    const qr::OnlinePartialResult *partialResult = static_cast<const qr::OnlinePartialResult *>(pres);
+
+    size_t nVectors = partialResult->getNumberOfRows();
+    size_t nFeatures = partialResult->getNumberOfColumns();
+
+    return checkImpl(nFeatures, nVectors);
+}
+
+/**
+* Checks the sizes of the result tables, matrix Q is not checked if the number of rows is zero
+* \param[in] nFeatures Number of columns in the input data set
+* \param[in] nVectors  Number of rows in the input data set
+*/
+Status Result::checkImpl(size_t nFeatures, size_t nVectors) const
+{
     int unexpectedLayouts = (int)NumericTableIface::csrArray |
                             (int)NumericTableIface::upperPackedTriangularMatrix |
                             (int)NumericTableIface::lowerPackedTriangularMatrix |
                             (int)NumericTableIface::upperPackedSymmetricMatrix |
                             (int)NumericTableIface::lowerPackedSymmetricMatrix;
 
-    Status s = checkNumericTable(get(matrixQ).get(), matrixQStr(),
-                                 unexpectedLayouts, 0, nFeatures, nVectors);
-    if(!s) { return s; }
+    Status s;
+    if(nVectors)
+    {
+        s |= checkNumericTable(get(matrixQ).get(), matrixQStr(),
+                               unexpectedLayouts, 0, nFeatures, nVectors);
+        if(!s) { return s; }
+    }
     s |= checkNumericTable(get(permutationMatrix).get(), permutationMatrixStr(),
                            unexpectedLayouts, 0, nFeatures, 1);
     if(!s) { return s; }
@@ -67,11 +67,41 @@ namespace pivoted_qr
 template <typename algorithmFPType>
 DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
 {
-    services::Status s;
     size_t m = static_cast<const Input *>(input)->get(data)->getNumberOfColumns();
     size_t n = static_cast<const Input *>(input)->get(data)->getNumberOfRows();
 
-    set(matrixQ, HomogenNumericTable<algorithmFPType>::create(m, n, NumericTable::doAllocate, &s));
+    return allocateImpl<algorithmFPType>(m, n);
+}
+
+/**
+ * Allocates memory for storing final results of the pivoted QR algorithm in the online processing mode
+ * \param[in] partialResult  Pointer to partial result
+ * \param[in] parameter      Pointer to parameter
+ * \param[in] method         Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method)
+{
+    const qr::OnlinePartialResult *pres = static_cast<const qr::OnlinePartialResult *>(partialResult);
+    size_t m = pres->getNumberOfColumns();
+    size_t n = pres->getNumberOfRows();
+
+    return allocateImpl<algorithmFPType>(m, n);
+}
+
+/**
+ * Allocates memory for storing final results of the pivoted QR algorithm
+ * \param[in] m  Number of columns in the input data set
+ * \param[in] n  Number of rows in the input data set, matrix Q is not allocated if it is zero
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocateImpl(size_t m, size_t n)
+{
+    services::Status s;
+    if(n)
+    {
+        set(matrixQ, HomogenNumericTable<algorithmFPType>::create(m, n, NumericTable::doAllocate, &s));
+    }
     set(matrixR, HomogenNumericTable<algorithmFPType>::create(m, m, NumericTable::doAllocate, &s));
     set(permutationMatrix, HomogenNumericTable<size_t>::create(m, 1, NumericTable::doAllocate, 0, &s));
     return s;
@@ -55,6 +55,8 @@ namespace pivoted_qr
 {
 
 template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method);
+template DAAL_EXPORT services::Status Result::allocateImpl<DAAL_FPTYPE>(size_t nFeatures, size_t nVectors);
 
 }// namespace pivoted_qr
 }// namespace algorithms
@@ -0,0 +1,139 @@
+/* file: pivoted_qr_distr_step2_container.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of pivoted_qr calculation algorithm container on the second step
+//  in the distributed processing mode.
+//--
+*/
+
+#ifndef __PIVOTED_QR_DISTR_STEP2_CONTAINER_H__
+#define __PIVOTED_QR_DISTR_STEP2_CONTAINER_H__
+
+#include "pivoted_qr_types.h"
+#include "pivoted_qr_distributed.h"
+#include "pivoted_qr_kernel.h"
+#include "service_numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pivoted_qr
+{
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step2Master, algorithmFPType, method, cpu>::DistributedContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::PivotedQRDistributedStep2Kernel, method, algorithmFPType);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step2Master, algorithmFPType, method, cpu>::~DistributedContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+services::Status DistributedContainer<step2Master, algorithmFPType, method, cpu>::compute()
+{
+    qr::DistributedStep2Input *input = static_cast<qr::DistributedStep2Input *>(_in);
+    DistributedPartialResult *partialResult = static_cast<DistributedPartialResult *>(_pres);
+    Parameter *parameter = static_cast<Parameter *>(_par);
+
+    KeyValueDataCollection *inCollection = input->get(qr::inputOfStep2FromStep1).get();
+
+    size_t nBlocks = input->getNBlocks();
+    size_t nNodes  = inCollection->size();
+
+    KeyValueDataCollection *perNodePartials = partialResult->get(outputOfStep2ForStep3).get();
+    Result *result = partialResult->get(finalResultFromStep2Master).get();
+
+    daal::internal::TArray<const NumericTable *, cpu> rBlocksPtr(nBlocks);
+    daal::internal::TArray<NumericTable *, cpu> qBlocksPtr(nBlocks);
+    const NumericTable **rBlocks = rBlocksPtr.get();
+    NumericTable **qBlocks = qBlocksPtr.get();
+    DAAL_CHECK_MALLOC(rBlocks && qBlocks);
+
+    size_t iBlocks = 0;
+    for(size_t i = 0; i < nNodes; i++)
+    {
+        DataCollection *nodeCollection = static_cast<DataCollection *>((*inCollection   ).getValueByIndex((int)i).get());
+        DataCollection *nodePartials   = static_cast<DataCollection *>((*perNodePartials).getValueByIndex((int)i).get());
+
+        size_t nodeSize = nodeCollection->size();
+
+        for(size_t j = 0; j < nodeSize; j++)
+        {
+            rBlocks[iBlocks + j] = static_cast<NumericTable *>((*nodeCollection)[j].get());
+            qBlocks[iBlocks + j] = static_cast<NumericTable *>((*nodePartials  )[j].get());
+        }
+
+        iBlocks += nodeSize;
+    }
+
+    NumericTable *matrixRTable = result->get(matrixR).get();
+    NumericTable *permutationMatrixTable = result->get(permutationMatrix).get();
+    NumericTable *permutedColumnsTable = parameter->permutedColumns.get();
+
+    daal::services::Environment::env &env = *_env;
+
+    services::Status s = __DAAL_CALL_KERNEL_STATUS(env, internal::PivotedQRDistributedStep2Kernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute,
+                                                   nBlocks, rBlocks, qBlocks, *matrixRTable, *permutationMatrixTable, permutedColumnsTable);
+
+    inCollection->clear();
+    return s;
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+services::Status DistributedContainer<step2Master, algorithmFPType, method, cpu>::finalizeCompute()
+{
+    return services::Status();
+}
+
+} //namespace pivoted_qr
+
+} //namespace algorithms
+
+} //namespace daal
+
+#endif
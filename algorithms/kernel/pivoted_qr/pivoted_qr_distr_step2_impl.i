@@ -0,0 +1,126 @@
+/* file: pivoted_qr_distr_step2_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the second step of the pivoted QR decomposition algorithm
+//  in the distributed processing mode
+//--
+*/
+
+#ifndef __PIVOTED_QR_DISTR_STEP2_IMPL_I__
+#define __PIVOTED_QR_DISTR_STEP2_IMPL_I__
+
+#include "pivoted_qr_tsqr_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pivoted_qr
+{
+namespace internal
+{
+
+/**
+ *  \brief Kernel for the pivoted QR calculation of the stacked R factors of the blocks of rows
+ */
+template <daal::algorithms::pivoted_qr::Method method, typename algorithmFPType, CpuType cpu>
+Status PivotedQRDistributedStep2Kernel<method, algorithmFPType, cpu>::compute(size_t nBlocks, const NumericTable *const *rBlocks,
+    NumericTable *const *qBlocks, NumericTable &RTable, NumericTable &PTable, NumericTable *permutedColumns)
+{
+    const size_t n = rBlocks[0]->getNumberOfColumns();
+    const size_t ldStack = nBlocks * n;
+
+    TArray<DAAL_INT, cpu> jpvtPtr(n);
+    DAAL_INT *jpvt = jpvtPtr.get();
+    DAAL_CHECK_MALLOC(jpvt);
+    Status s = initPivots<algorithmFPType, cpu>(n, permutedColumns, jpvt);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    TArray<algorithmFPType, cpu> rStackTPtr(ldStack * n);
+    algorithmFPType *rStackT = rStackTPtr.get();
+    TArray<algorithmFPType, cpu> q2Ptr(nBlocks * n * n);
+    algorithmFPType *q2 = q2Ptr.get();
+    DAAL_CHECK_MALLOC(rStackT && q2);
+
+    for(size_t k = 0; k < nBlocks; k++)
+    {
+        ReadRows<algorithmFPType, cpu> blockR(const_cast<NumericTable *>(rBlocks[k]), 0, n);
+        DAAL_CHECK_BLOCK_STATUS(blockR);
+        const algorithmFPType *rk = blockR.get();
+        for(size_t j = 0; j < n; j++)
+        {
+            for(size_t i = 0; i < n; i++)
+            {
+                rStackT[j * ldStack + k * n + i] = rk[i * n + j];
+            }
+        }
+    }
+
+    {
+        WriteOnlyRows<algorithmFPType, cpu> blockR(RTable, 0, n);
+        DAAL_CHECK_BLOCK_STATUS(blockR);
+        s = computeStackedRPivotedQR<algorithmFPType, cpu>(nBlocks, n, rStackT, q2, blockR.get(), jpvt);
+        DAAL_CHECK_STATUS_VAR(s);
+    }
+
+    for(size_t k = 0; k < nBlocks; k++)
+    {
+        WriteOnlyRows<algorithmFPType, cpu> blockQ(qBlocks[k], 0, n);
+        DAAL_CHECK_BLOCK_STATUS(blockQ);
+        algorithmFPType *qk = blockQ.get();
+        const algorithmFPType *q2k = q2 + k * n * n;
+        for(size_t i = 0; i < n * n; i++)
+        {
+            qk[i] = q2k[i];
+        }
+    }
+
+    return writePivots<algorithmFPType, cpu>(n, jpvt, PTable);
+}
+
+} // namespace internal
+} // namespace pivoted_qr
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,177 @@
+/* file: pivoted_qr_distr_step2_result.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the pivoted QR decomposition algorithm partial result
+//  of the second step in the distributed processing mode
+//--
+*/
+
+#include "pivoted_qr_types.h"
+#include "serialization_utils.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pivoted_qr
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(DistributedPartialResult, SERIALIZATION_PIVOTED_QR_DISTRIBUTED_PARTIAL_RESULT_ID);
+
+/** Default constructor */
+DistributedPartialResult::DistributedPartialResult() : daal::algorithms::PartialResult(lastDistributedPartialResultId + 1) {}
+
+/**
+ * Returns partial result of the pivoted QR decomposition algorithm.
+ * KeyValueDataCollection under outputOfStep2ForStep3 id is structured the same as KeyValueDataCollection under
+ * qr::inputOfStep2FromStep1 id of the algorithm input
+ * \param[in] id    Identifier of the partial result
+ * \return          Partial result that corresponds to the given identifier
+ */
+KeyValueDataCollectionPtr DistributedPartialResult::get(DistributedPartialResultCollectionId id) const
+{
+    return staticPointerCast<KeyValueDataCollection, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Returns the result of the pivoted QR decomposition algorithm with the matrix R and the permutation matrix calculated
+ * \param[in] id    Identifier of the result
+ * \return          Result that corresponds to the given identifier
+ */
+ResultPtr DistributedPartialResult::get(DistributedPartialResultId id) const
+{
+    return staticPointerCast<Result, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets KeyValueDataCollection to store partial result of the pivoted QR decomposition algorithm
+ * \param[in] id    Identifier of partial result
+ * \param[in] value Pointer to the KeyValueDataCollection object
+ */
+void DistributedPartialResult::set(DistributedPartialResultCollectionId id, const KeyValueDataCollectionPtr &value)
+{
+    Argument::set(id, value);
+}
+
+/**
+ * Sets Result object to store the result of the pivoted QR decomposition algorithm
+ * \param[in] id    Identifier of the result
+ * \param[in] value Pointer to the Result object
+ */
+void DistributedPartialResult::set(DistributedPartialResultId id, const ResultPtr &value)
+{
+    Argument::set(id, value);
+}
+
+/**
+ * Checks partial results of the algorithm
+ * \param[in] parameter Pointer to parameters
+ * \param[in] method    Computation method
+ */
+Status DistributedPartialResult::check(const daal::algorithms::Parameter *parameter, int method) const
+{
+    KeyValueDataCollectionPtr resultKeyValueDC = get(outputOfStep2ForStep3);
+    DAAL_CHECK_EX(resultKeyValueDC, ErrorNullOutputDataCollection, ArgumentName, outputOfStep2ForStep3Str());
+
+    size_t nNodes = resultKeyValueDC->size();
+    DAAL_CHECK_EX(nNodes > 0, ErrorIncorrectNumberOfElementsInResultCollection, ArgumentName, outputOfStep2ForStep3Str());
+
+    DAAL_CHECK_EX((*resultKeyValueDC).getValueByIndex(0), ErrorNullOutputDataCollection, ArgumentName, QRNodeCollectionStr());
+    DataCollectionPtr firstNodeCollection = DataCollection::cast((*resultKeyValueDC).getValueByIndex(0));
+    DAAL_CHECK_EX(firstNodeCollection, ErrorIncorrectElementInPartialResultCollection, ArgumentName, outputOfStep2ForStep3Str());
+    DAAL_CHECK_EX(firstNodeCollection->size() > 0, ErrorIncorrectNumberOfElementsInResultCollection, ArgumentName, QRNodeCollectionStr());
+
+    DAAL_CHECK_EX((*firstNodeCollection)[0], ErrorNullNumericTable, ArgumentName, QRNodeCollectionNTStr());
+    NumericTablePtr firstNumTable = NumericTable::cast((*firstNodeCollection)[0]);
+    DAAL_CHECK_EX(firstNumTable, ErrorIncorrectElementInNumericTableCollection, ArgumentName, QRNodeCollectionStr());
+
+    Status s = checkNumericTable(firstNumTable.get(), QRNodeCollectionNTStr());
+    if(!s) { return s; }
+    size_t nFeatures = firstNumTable->getNumberOfColumns();
+
+    int unexpectedLayouts = (int)packed_mask;
+    for(size_t i = 0 ; i < nNodes ; i++)
+    {
+        DAAL_CHECK_EX((*resultKeyValueDC).getValueByIndex((int)i), ErrorNullOutputDataCollection, ArgumentName, QRNodeCollectionStr());
+        DataCollectionPtr nodeCollection = DataCollection::cast((*resultKeyValueDC).getValueByIndex((int)i));
+        DAAL_CHECK_EX(nodeCollection, ErrorIncorrectElementInPartialResultCollection, ArgumentName, outputOfStep2ForStep3Str());
+        size_t nodeSize = nodeCollection->size();
+        DAAL_CHECK_EX(nodeSize > 0, ErrorIncorrectNumberOfElementsInResultCollection, ArgumentName, QRNodeCollectionStr());
+        for(size_t j = 0 ; j < nodeSize ; j++)
+        {
+            DAAL_CHECK_EX((*nodeCollection)[j], ErrorNullNumericTable, ArgumentName, QRNodeCollectionNTStr());
+            NumericTablePtr qNumTableInNodeCollection = NumericTable::cast((*nodeCollection)[j]);
+            DAAL_CHECK_EX(qNumTableInNodeCollection, ErrorIncorrectElementInNumericTableCollection, ArgumentName, QRNodeCollectionStr());
+            s |= checkNumericTable(qNumTableInNodeCollection.get(), QRNodeCollectionNTStr(), unexpectedLayouts, 0, nFeatures, nFeatures);
+            if(!s) { return s; }
+        }
+    }
+
+    ResultPtr result = get(finalResultFromStep2Master);
+    DAAL_CHECK(result, ErrorNullResult);
+    s |= checkNumericTable(result->get(matrixR).get(), matrixRStr(), unexpectedLayouts, 0, nFeatures, nFeatures);
+    if(!s) { return s; }
+    s |= checkNumericTable(result->get(permutationMatrix).get(), permutationMatrixStr(), unexpectedLayouts, 0, nFeatures, 1);
+    return s;
+}
+
+/**
+ * Checks partial results of the algorithm
+ * \param[in] input      Pointer to input objects
+ * \param[in] parameter  Pointer to parameters
+ * \param[in] method     Computation method
+ */
+Status DistributedPartialResult::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const
+{
+    return check(parameter, method);
+}
+
+} // namespace interface1
+} // namespace pivoted_qr
+} // namespace algorithms
+} // namespace daal
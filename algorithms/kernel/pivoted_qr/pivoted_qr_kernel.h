@@ -74,6 +74,44 @@ public:
 
 };
 
+/**
+ *  \brief Kernel for the pivoted QR calculation that decomposes the blocks of rows in parallel
+ *         and applies the pivoting to the stacked R factors of the blocks
+ */
+template<typename algorithmFPType, CpuType cpu>
+class PivotedQRKernel<tsqrDense, algorithmFPType, cpu> : public Kernel
+{
+public:
+    services::Status compute(const NumericTable &dataTable, NumericTable &QTable, NumericTable &RTable, NumericTable &PTable, NumericTable *permutedColumns);
+
+protected:
+    static size_t getNumberOfBlocks(size_t nRows, size_t nCols);
+};
+
+/**
+ *  \brief Kernel for the pivoted QR calculation of the stacked R factors of the blocks of rows
+ */
+template<daal::algorithms::pivoted_qr::Method method, typename algorithmFPType, CpuType cpu>
+class PivotedQRDistributedStep2Kernel : public Kernel
+{
+public:
+    services::Status compute(size_t nBlocks, const NumericTable *const *rBlocks, NumericTable *const *qBlocks,
+                             NumericTable &RTable, NumericTable &PTable, NumericTable *permutedColumns);
+};
+
+/**
+ *  \brief Kernel for the pivoted QR calculation in the online processing mode
+ */
+template<daal::algorithms::pivoted_qr::Method method, typename algorithmFPType, CpuType cpu>
+class PivotedQROnlineKernel : public Kernel
+{
+public:
+    services::Status compute(const NumericTable &dataTable, NumericTable &QTable, NumericTable &RTable);
+
+    services::Status finalizeCompute(size_t nBlocks, const NumericTable *const *rBlocks, const NumericTable *const *qBlocks,
+                                     NumericTable &QTable, NumericTable &RTable, NumericTable &PTable, NumericTable *permutedColumns);
+};
+
 } // namespace daal::internal
 }
 }
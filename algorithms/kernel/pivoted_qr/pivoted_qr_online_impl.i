@@ -0,0 +1,132 @@
+/* file: pivoted_qr_online_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the pivoted QR decomposition algorithm in the online processing mode
+//--
+*/
+
+#ifndef __PIVOTED_QR_ONLINE_IMPL_I__
+#define __PIVOTED_QR_ONLINE_IMPL_I__
+
+#include "pivoted_qr_distr_step2_impl.i"
+#include "qr_dense_default_kernel.h"
+#include "qr_dense_default_batch_impl.i"
+#include "qr_dense_default_distr_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pivoted_qr
+{
+namespace internal
+{
+
+/**
+ *  \brief Kernel for the QR decomposition of a new block of rows
+ */
+template <daal::algorithms::pivoted_qr::Method method, typename algorithmFPType, CpuType cpu>
+Status PivotedQROnlineKernel<method, algorithmFPType, cpu>::compute(const NumericTable &dataTable, NumericTable &QTable, NumericTable &RTable)
+{
+    const NumericTable *a[1] = { &dataTable };
+    NumericTable *r[2] = { &QTable, &RTable };
+
+    qr::internal::QRBatchKernel<algorithmFPType, qr::defaultDense, cpu> kernel;
+    return kernel.compute(1, a, 2, r);
+}
+
+/**
+ *  \brief Kernel for the pivoted QR decomposition of the stacked R factors of the blocks
+ *         and for the calculation of the resulting matrix Q
+ */
+template <daal::algorithms::pivoted_qr::Method method, typename algorithmFPType, CpuType cpu>
+Status PivotedQROnlineKernel<method, algorithmFPType, cpu>::finalizeCompute(size_t nBlocks, const NumericTable *const *rBlocks,
+    const NumericTable *const *qBlocks, NumericTable &QTable, NumericTable &RTable, NumericTable &PTable, NumericTable *permutedColumns)
+{
+    const size_t n = rBlocks[0]->getNumberOfColumns();
+
+    TArray<NumericTable *, cpu> q2BlocksPtr(nBlocks);
+    TArray<const NumericTable *, cpu> step3InPtr(2 * nBlocks);
+    NumericTable **q2Blocks = q2BlocksPtr.get();
+    const NumericTable **step3In = step3InPtr.get();
+    DAAL_CHECK_MALLOC(q2Blocks && step3In);
+
+    Status s;
+    size_t nAllocated = 0;
+    for(; nAllocated < nBlocks && s; nAllocated++)
+    {
+        q2Blocks[nAllocated] = new HomogenNumericTableCPU<algorithmFPType, cpu>(n, n, s);
+    }
+
+    if(s)
+    {
+        PivotedQRDistributedStep2Kernel<method, algorithmFPType, cpu> step2Kernel;
+        s = step2Kernel.compute(nBlocks, rBlocks, q2Blocks, RTable, PTable, permutedColumns);
+    }
+
+    if(s)
+    {
+        for(size_t k = 0; k < nBlocks; k++)
+        {
+            step3In[k]           = qBlocks[k];
+            step3In[nBlocks + k] = q2Blocks[k];
+        }
+        NumericTable *step3Out[1] = { &QTable };
+
+        qr::internal::QRDistributedStep3Kernel<algorithmFPType, qr::defaultDense, cpu> step3Kernel;
+        s = step3Kernel.compute(2 * nBlocks, step3In, 1, step3Out);
+    }
+
+    for(size_t k = 0; k < nAllocated; k++)
+    {
+        delete q2Blocks[k];
+    }
+    return s;
+}
+
+} // namespace internal
+} // namespace pivoted_qr
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,317 @@
+/* file: pivoted_qr_tsqr_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the pivoted QR decomposition of tall-skinny matrices
+//  via QR decompositions of the blocks of rows
+//--
+*/
+
+#ifndef __PIVOTED_QR_TSQR_IMPL_I__
+#define __PIVOTED_QR_TSQR_IMPL_I__
+
+#include "service_lapack.h"
+#include "service_blas.h"
+#include "service_memory.h"
+#include "service_defines.h"
+#include "service_numeric_table.h"
+#include "threading.h"
+
+#include "pivoted_qr_kernel.h"
+#include "pivoted_qr_impl.i"
+#include "qr_dense_default_impl.i"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pivoted_qr
+{
+namespace internal
+{
+
+/* Initializes the array of pivots from the permutedColumns parameter, all columns are free if it is not set */
+template <typename algorithmFPType, CpuType cpu>
+Status initPivots(size_t n, NumericTable *permutedColumns, DAAL_INT *jpvt)
+{
+    if(permutedColumns)
+    {
+        ReadRows<int, cpu> permutedColumnsBlock(permutedColumns, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(permutedColumnsBlock);
+        const int *jpvtFromParameter = permutedColumnsBlock.get();
+        for(size_t i = 0; i < n; i++)
+        {
+            jpvt[i] = jpvtFromParameter[i];
+        }
+    }
+    else
+    {
+        for(size_t i = 0; i < n; i++)
+        {
+            jpvt[i] = 0;
+        }
+    }
+    return Status();
+}
+
+/*
+  Input:
+    rStackT at input : column-major (nBlocks * n x n) matrix of the stacked upper triangular factors R_k
+    jpvt    at input : pivots as in the permutedColumns parameter
+  Output:
+    q2      : nBlocks row-major (n x n) blocks of the orthogonal factor of the stacked matrix
+    r       : row-major (n x n) upper triangular factor of the stacked matrix
+    jpvt    : 1-based column permutation
+*/
+template <typename algorithmFPType, CpuType cpu>
+Status computeStackedRPivotedQR(size_t nBlocks, size_t n, algorithmFPType *rStackT, algorithmFPType *q2, algorithmFPType *r, DAAL_INT *jpvt)
+{
+    const size_t ldStack = nBlocks * n;
+
+    TArray<algorithmFPType, cpu> rTPtr(n * n);
+    algorithmFPType *rT = rTPtr.get();
+    DAAL_CHECK_MALLOC(rT);
+
+    ServiceStatus status = compute_pivoted_QR_on_one_node<algorithmFPType, cpu>((DAAL_INT)ldStack, (DAAL_INT)n, rStackT, (DAAL_INT)ldStack,
+                                                                                rT, (DAAL_INT)n, jpvt);
+    if(status != SERV_ERR_OK)
+    {
+        if(status == SERV_ERR_MALLOC) return Status(ErrorMemoryAllocationFailed);
+        else return Status(ErrorPivotedQRInternal);
+    }
+
+    for(size_t k = 0; k < nBlocks; k++)
+    {
+        algorithmFPType *q2k = q2 + k * n * n;
+        for(size_t i = 0; i < n; i++)
+        {
+            for(size_t j = 0; j < n; j++)
+            {
+                q2k[i * n + j] = rStackT[j * ldStack + k * n + i];
+            }
+        }
+    }
+
+    for(size_t i = 0; i < n; i++)
+    {
+        for(size_t j = 0; j < i; j++)
+        {
+            r[i * n + j] = 0.0;
+        }
+        for(size_t j = i; j < n; j++)
+        {
+            r[i * n + j] = rT[j * n + i];
+        }
+    }
+    return Status();
+}
+
+/* q (m x n) = q1 (m x n) * q2 (n x n), all matrices are row-major */
+template <typename algorithmFPType, CpuType cpu>
+void multiplyQBlocks(DAAL_INT m, DAAL_INT n, const algorithmFPType *q1, const algorithmFPType *q2, algorithmFPType *q)
+{
+    const char notrans = 'N';
+    const algorithmFPType one = 1.0;
+    const algorithmFPType zero = 0.0;
+    Blas<algorithmFPType, cpu>::xxgemm(&notrans, &notrans, &n, &m, &n, &one, q2, &n, q1, &n, &zero, q, &n);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status writePivots(size_t n, const DAAL_INT *jpvt, NumericTable &PTable)
+{
+    WriteOnlyRows<algorithmFPType, cpu> blockP(PTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(blockP);
+    algorithmFPType *p = blockP.get();
+    for(size_t i = 0; i < n; i++)
+    {
+        p[i] = jpvt[i];
+    }
+    return Status();
+}
+
+/**
+ *  Splits the rows into blocks that are large enough for the QR decomposition of each block
+ *  to be compute bound, but keeps the stacked R factors small compared to the input
+ */
+template <typename algorithmFPType, CpuType cpu>
+size_t PivotedQRKernel<tsqrDense, algorithmFPType, cpu>::getNumberOfBlocks(size_t nRows, size_t nCols)
+{
+    const size_t minBlockSize = (nCols > 256 ? nCols : 256);
+    const size_t maxBlocks    = 128;
+    size_t nBlocks = nRows / minBlockSize;
+
+    const size_t nThreadBlocks = 2 * threader_get_threads_number();
+    if(nBlocks > nThreadBlocks) { nBlocks = nThreadBlocks; }
+    if(nBlocks > maxBlocks)     { nBlocks = maxBlocks; }
+    return nBlocks;
+}
+
+/**
+ *  \brief Kernel for the pivoted QR calculation of tall-skinny matrices
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status PivotedQRKernel<tsqrDense, algorithmFPType, cpu>::compute(
+    const NumericTable &dataTable, NumericTable &QTable, NumericTable &RTable, NumericTable &PTable, NumericTable *permutedColumns)
+{
+    const size_t n = dataTable.getNumberOfColumns();
+    const size_t m = dataTable.getNumberOfRows();
+
+    const size_t nBlocks = getNumberOfBlocks(m, n);
+    if(nBlocks < 2)
+    {
+        PivotedQRKernel<defaultDense, algorithmFPType, cpu> kernel;
+        return kernel.compute(dataTable, QTable, RTable, PTable, permutedColumns);
+    }
+
+    const size_t blockSize = m / nBlocks;
+    const size_t ldStack = nBlocks * n;
+
+    TArray<DAAL_INT, cpu> jpvtPtr(n);
+    DAAL_INT *jpvt = jpvtPtr.get();
+    DAAL_CHECK_MALLOC(jpvt);
+    Status s = initPivots<algorithmFPType, cpu>(n, permutedColumns, jpvt);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    TArray<algorithmFPType, cpu> rStackTPtr(ldStack * n);
+    algorithmFPType *rStackT = rStackTPtr.get();
+    TArray<algorithmFPType, cpu> q2Ptr(nBlocks * n * n);
+    algorithmFPType *q2 = q2Ptr.get();
+    DAAL_CHECK_MALLOC(rStackT && q2);
+
+    /* Step 1: QR decomposition of each block of rows, Q_k is stored in the output Q */
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](int k)
+    {
+        const size_t startRow = k * blockSize;
+        const size_t nRows    = (k + 1 == nBlocks ? m - startRow : blockSize);
+
+        TArrayScalable<algorithmFPType, cpu> aTPtr(nRows * n);
+        TArrayScalable<algorithmFPType, cpu> rTPtr(n * n);
+        algorithmFPType *aT = aTPtr.get();
+        algorithmFPType *rT = rTPtr.get();
+        DAAL_CHECK_MALLOC_THR(aT && rT);
+
+        {
+            ReadRows<algorithmFPType, cpu> blockA(const_cast<NumericTable &>(dataTable), startRow, nRows);
+            DAAL_CHECK_BLOCK_STATUS_THR(blockA);
+            const algorithmFPType *a = blockA.get();
+            for(size_t i = 0; i < n; i++)
+            {
+                for(size_t j = 0; j < nRows; j++)
+                {
+                    aT[i * nRows + j] = a[i + j * n];
+                }
+            }
+        }
+
+        const int errorId = qr::internal::compute_QR_on_one_node_seq<algorithmFPType, cpu>(
+                                (DAAL_INT)nRows, (DAAL_INT)n, aT, (DAAL_INT)nRows, rT, (DAAL_INT)n);
+        DAAL_CHECK_THR(!errorId, ErrorPivotedQRInternal);
+
+        WriteOnlyRows<algorithmFPType, cpu> blockQ(QTable, startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(blockQ);
+        algorithmFPType *q = blockQ.get();
+        for(size_t i = 0; i < n; i++)
+        {
+            for(size_t j = 0; j < nRows; j++)
+            {
+                q[i + j * n] = aT[i * nRows + j];
+            }
+        }
+
+        for(size_t j = 0; j < n; j++)
+        {
+            algorithmFPType *rStackCol = rStackT + j * ldStack + k * n;
+            for(size_t i = 0; i <= j; i++)
+            {
+                rStackCol[i] = rT[j * n + i];
+            }
+            for(size_t i = j + 1; i < n; i++)
+            {
+                rStackCol[i] = 0.0;
+            }
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    /* Step 2: pivoted QR decomposition of the stacked R factors */
+    {
+        WriteOnlyRows<algorithmFPType, cpu> blockR(RTable, 0, n);
+        DAAL_CHECK_BLOCK_STATUS(blockR);
+        s = computeStackedRPivotedQR<algorithmFPType, cpu>(nBlocks, n, rStackT, q2, blockR.get(), jpvt);
+        DAAL_CHECK_STATUS_VAR(s);
+    }
+
+    /* Step 3: Q = diag(Q_1, ..., Q_nBlocks) * Q2 */
+    daal::threader_for(nBlocks, nBlocks, [&](int k)
+    {
+        const size_t startRow = k * blockSize;
+        const size_t nRows    = (k + 1 == nBlocks ? m - startRow : blockSize);
+
+        TArrayScalable<algorithmFPType, cpu> q1Ptr(nRows * n);
+        algorithmFPType *q1 = q1Ptr.get();
+        DAAL_CHECK_MALLOC_THR(q1);
+
+        WriteRows<algorithmFPType, cpu> blockQ(QTable, startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(blockQ);
+        algorithmFPType *q = blockQ.get();
+        for(size_t i = 0; i < nRows * n; i++)
+        {
+            q1[i] = q[i];
+        }
+        multiplyQBlocks<algorithmFPType, cpu>((DAAL_INT)nRows, (DAAL_INT)n, q1, q2 + k * n * n, q);
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    return writePivots<algorithmFPType, cpu>(n, jpvt, PTable);
+}
+
+} // namespace internal
+} // namespace pivoted_qr
+} // namespace algorithms
+} // namespace daal
+
+#endif
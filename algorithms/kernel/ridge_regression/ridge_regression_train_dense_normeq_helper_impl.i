@@ -49,6 +49,7 @@
 #define __RIDGE_REGRESSION_TRAIN_DENSE_NORMEQ_HELPER_IMPL_I__
 
 #include "ridge_regression_train_kernel.h"
+#include "service_batched_cholesky.h"
 
 namespace daal
 {
@@ -85,11 +86,29 @@ Status KernelHelper<algorithmFPType, cpu>::computeBetasImpl(DAAL_INT p, const al
             ErrorRidgeRegressionInternal);
         DAAL_CHECK_STATUS_VAR(st);
     }
+    else if ((size_t)p <= algorithms::internal::smallCholeskyMaxDim)
+    {
+        /* Systems with different ridge parameters are small and independent, they are solved in parallel */
+        const size_t aSize = p * p;
+        TArray<algorithmFPType, cpu> aBatch(aSize * ny);
+        DAAL_CHECK_MALLOC(aBatch.get());
+        for (DAAL_INT j = 0; j < ny; j++)
+        {
+            algorithmFPType *aj = aBatch.get() + j * aSize;
+            daal::services::daal_memcpy_s(aj, aSize * sizeof(algorithmFPType), a, aSize * sizeof(algorithmFPType));
+            for(DAAL_INT i = 0, idx = 0; i < pToFix; i++, idx += (p + 1))
+            {
+                aj[idx] += ridge[j];
+            }
+        }
+        const Status batchStatus = algorithms::internal::SmallCholesky<algorithmFPType, cpu>::computeBatch(ny, p, aBatch.get(), 1, b);
+        DAAL_CHECK(batchStatus.ok(), ErrorNormEqSystemSolutionFailed);
+    }
     else
     {
         algorithmFPType * bPtr = b;
         const size_t aSizeInBytes = p * p * sizeof(algorithmFPType);
-        for (DAAL_INT j = 0; j < ny; j++, bPtr += (pToFix + 1))
+        for (DAAL_INT j = 0; j < ny; j++, bPtr += p)
         {
             daal::services::daal_memcpy_s(aCopy, aSizeInBytes, a, aSizeInBytes);
             for(DAAL_INT i = 0, idx = 0; i < pToFix; i++, idx += (p + 1))
@@ -99,7 +118,7 @@ Status KernelHelper<algorithmFPType, cpu>::computeBetasImpl(DAAL_INT p, const al
 
             DAAL_INT one(1);
 
-            st |= FinalizeKernel<algorithmFPType, cpu>::solveSystem(p, aCopy, one, b,
+            st |= FinalizeKernel<algorithmFPType, cpu>::solveSystem(p, aCopy, one, bPtr,
                 ErrorRidgeRegressionInternal);
             DAAL_CHECK_STATUS_VAR(st);
         }
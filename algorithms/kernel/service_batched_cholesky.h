@@ -0,0 +1,234 @@
+/* file: service_batched_cholesky.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Cholesky decomposition and triangular solves for batches of small
+//  symmetric positive-definite matrices.
+//--
+*/
+
+#ifndef __SERVICE_BATCHED_CHOLESKY_H__
+#define __SERVICE_BATCHED_CHOLESKY_H__
+
+#include "daal_defines.h"
+#include "service_defines.h"
+#include "service_math.h"
+#include "service_lapack.h"
+#include "threading.h"
+#include "service_error_handling.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace internal
+{
+
+using namespace daal::internal;
+
+/* Largest order of the matrix processed by the register-blocked kernel, larger matrices are passed to LAPACK */
+const size_t smallCholeskyMaxDim = 64;
+
+/* Number of columns of the factor computed together by the register-blocked kernel */
+const size_t smallCholeskyBlockSize = 4;
+
+/*
+ * Cholesky decomposition A = L*L' of small symmetric positive-definite matrices.
+ * Matrices are stored by rows, only the lower triangle of A is referenced and it is overwritten by L.
+ * This is the same layout LAPACK potrf produces with uplo = 'U' for the same array,
+ * so the methods are drop-in replacements of xxpotrf and xxpotrs calls.
+ * All methods are sequential and are intended to be called from parallel regions.
+ */
+template <typename algorithmFPType, CpuType cpu>
+class SmallCholesky
+{
+public:
+    /* Returns 0 on success or the order of the leading minor that is not positive definite */
+    static DAAL_INT factorize(size_t n, algorithmFPType *a)
+    {
+        if(n > smallCholeskyMaxDim)
+        {
+            char uplo = 'U';
+            DAAL_INT dim = (DAAL_INT)n;
+            DAAL_INT info = 0;
+            Lapack<algorithmFPType, cpu>::xxpotrf(&uplo, &dim, a, &dim, &info);
+            return info;
+        }
+
+        for(size_t i = 0; i < n; i++)
+        {
+            algorithmFPType *li = a + i * n;
+
+            /* Off-diagonal elements of the i-th row, four columns at a time to reuse li[k] from registers */
+            size_t j = 0;
+            for(; j + smallCholeskyBlockSize <= i; j += smallCholeskyBlockSize)
+            {
+                const algorithmFPType *lj0 = a + j * n;
+                const algorithmFPType *lj1 = lj0 + n;
+                const algorithmFPType *lj2 = lj1 + n;
+                const algorithmFPType *lj3 = lj2 + n;
+                algorithmFPType s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for(size_t k = 0; k < j; k++)
+                {
+                    s0 += li[k] * lj0[k];
+                    s1 += li[k] * lj1[k];
+                    s2 += li[k] * lj2[k];
+                    s3 += li[k] * lj3[k];
+                }
+                li[j]     = (li[j] - s0) / lj0[j];
+                li[j + 1] = (li[j + 1] - s1 - li[j] * lj1[j]) / lj1[j + 1];
+                li[j + 2] = (li[j + 2] - s2 - li[j] * lj2[j] - li[j + 1] * lj2[j + 1]) / lj2[j + 2];
+                li[j + 3] = (li[j + 3] - s3 - li[j] * lj3[j] - li[j + 1] * lj3[j + 1] - li[j + 2] * lj3[j + 2]) / lj3[j + 3];
+            }
+            for(; j < i; j++)
+            {
+                const algorithmFPType *lj = a + j * n;
+                li[j] = (li[j] - dot(j, li, lj)) / lj[j];
+            }
+
+            const algorithmFPType d = li[i] - dot(i, li, li);
+            if(!(d > 0))
+                return (DAAL_INT)(i + 1);
+            li[i] = Math<algorithmFPType, cpu>::sSqrt(d);
+        }
+        return 0;
+    }
+
+    /* Solves L*L' * x = b for nRhs right-hand sides stored contiguously, the solutions overwrite b */
+    static DAAL_INT solve(size_t n, size_t nRhs, const algorithmFPType *l, algorithmFPType *b)
+    {
+        if(n > smallCholeskyMaxDim)
+        {
+            char uplo = 'U';
+            DAAL_INT dim = (DAAL_INT)n;
+            DAAL_INT nb = (DAAL_INT)nRhs;
+            DAAL_INT info = 0;
+            Lapack<algorithmFPType, cpu>::xxpotrs(&uplo, &dim, &nb, const_cast<algorithmFPType *>(l), &dim, b, &dim, &info);
+            return info;
+        }
+
+        for(size_t r = 0; r < nRhs; r++)
+        {
+            algorithmFPType *x = b + r * n;
+
+            /* L * y = b */
+            for(size_t i = 0; i < n; i++)
+            {
+                const algorithmFPType *li = l + i * n;
+                x[i] = (x[i] - dot(i, li, x)) / li[i];
+            }
+
+            /* L' * x = y, row i of L updates the rest of the right-hand side once x[i] is known */
+            for(size_t i = n; i-- > 0;)
+            {
+                const algorithmFPType *li = l + i * n;
+                const algorithmFPType xi = x[i] / li[i];
+                x[i] = xi;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for(size_t k = 0; k < i; k++)
+                {
+                    x[k] -= li[k] * xi;
+                }
+            }
+        }
+        return 0;
+    }
+
+    /* Factorizes the matrix and solves the system if the factorization succeeds */
+    static DAAL_INT factorizeAndSolve(size_t n, size_t nRhs, algorithmFPType *a, algorithmFPType *b)
+    {
+        const DAAL_INT info = factorize(n, a);
+        return info ? info : solve(n, nRhs, a, b);
+    }
+
+    /*
+     * Factorizes nMatrices n x n matrices stored one after another in a and, if b is not null,
+     * solves the systems for nRhs right-hand sides per matrix stored one after another in b.
+     * Matrices are processed in parallel.
+     */
+    static services::Status computeBatch(size_t nMatrices, size_t n, algorithmFPType *a, size_t nRhs, algorithmFPType *b)
+    {
+        const size_t matrixSize = n * n;
+        const size_t rhsSize    = n * nRhs;
+
+        SafeStatus safeStat;
+        daal::threader_for(nMatrices, nMatrices, [ &, a, b ](size_t iMatrix)
+        {
+            algorithmFPType *ai = a + iMatrix * matrixSize;
+            DAAL_INT info = factorize(n, ai);
+            if(info == 0 && b)
+                info = solve(n, nRhs, ai, b + iMatrix * rhsSize);
+            if(info == 0)
+                return;
+
+            services::ErrorPtr e = services::Error::create(info > 0 ? services::ErrorInputMatrixHasNonPositiveMinor :
+                                                                      services::ErrorCholeskyInternal,
+                                                           services::ElementInCollection, (int)iMatrix);
+            if(info > 0)
+                e->addIntDetail(services::Minor, (int)info);
+            safeStat.add(e);
+        });
+        return safeStat.detach();
+    }
+
+protected:
+    static algorithmFPType dot(size_t n, const algorithmFPType *x, const algorithmFPType *y)
+    {
+        algorithmFPType s = 0;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for(size_t k = 0; k < n; k++)
+        {
+            s += x[k] * y[k];
+        }
+        return s;
+    }
+};
+
+} // namespace internal
+} // namespace algorithms
+} // namespace daal
+
+#endif
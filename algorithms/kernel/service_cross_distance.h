@@ -0,0 +1,351 @@
+/* file: service_cross_distance.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of cosine and correlation distances between rows of two data sets
+//  computed by tiles, with the result stored as a full matrix or as k nearest rows.
+//--
+*/
+
+#ifndef __SERVICE_CROSS_DISTANCE_H__
+#define __SERVICE_CROSS_DISTANCE_H__
+
+#include "daal_defines.h"
+#include "service_math.h"
+#include "service_blas.h"
+#include "threading.h"
+#include "service_error_handling.h"
+#include "service_numeric_table.h"
+#include "service_heap.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace internal
+{
+
+using namespace daal::internal;
+
+const size_t crossDistanceBlockSize = 128;
+
+/* Element of the heap of the nearest rows, the heap keeps the farthest of them on the top */
+template <typename algorithmFPType>
+struct NearestRow
+{
+    algorithmFPType distance;
+    int index;
+
+    bool operator < (const NearestRow &other) const
+    {
+        return (distance < other.distance || (distance == other.distance && index < other.index));
+    }
+};
+
+/**
+ *  \brief Computes the means and the inverse norms of the rows of the table.
+ *  The norms are computed for the rows centered by their means if isCentered is set, and
+ *  for the raw rows with zero means otherwise. Zero norms give zero inverse norms
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status computeRowNorms(const NumericTable *table, bool isCentered, algorithmFPType *means, algorithmFPType *invNorms)
+{
+    const size_t p = table->getNumberOfColumns();
+    const size_t n = table->getNumberOfRows();
+    const size_t nBlocks = n / crossDistanceBlockSize + !!(n % crossDistanceBlockSize);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [ =, &safeStat ](size_t iBlock)
+    {
+        const size_t shift     = iBlock * crossDistanceBlockSize;
+        const size_t blockSize = (iBlock == nBlocks - 1 ? n - shift : crossDistanceBlockSize);
+
+        ReadRows<algorithmFPType, cpu> block(*const_cast<NumericTable *>(table), shift, blockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(block)
+        const algorithmFPType *x = block.get();
+
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            const algorithmFPType *row = x + i * p;
+            algorithmFPType mean = (algorithmFPType)0.0;
+            if (isCentered)
+            {
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < p; j++)
+                {
+                    mean += row[j];
+                }
+                mean /= (algorithmFPType)p;
+            }
+
+            algorithmFPType sumSq = (algorithmFPType)0.0;
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; j++)
+            {
+                sumSq += (row[j] - mean) * (row[j] - mean);
+            }
+
+            means[shift + i]    = mean;
+            invNorms[shift + i] = (sumSq > (algorithmFPType)0.0 ?
+                                   (algorithmFPType)1.0 / daal::internal::Math<algorithmFPType, cpu>::sSqrt(sumSq) : (algorithmFPType)0.0);
+        }
+    } );
+    return safeStat.detach();
+}
+
+/**
+ *  \brief Computes the tile of distances between blockSize1 rows of x1 and blockSize2 rows of x2.
+ *  Distances are stored in dist as a blockSize1 x blockSize2 matrix in row-major order
+ */
+template <typename algorithmFPType, CpuType cpu>
+void computeDistanceTile(size_t p, size_t blockSize1, const algorithmFPType *x1, const algorithmFPType *means1, const algorithmFPType *invNorms1,
+                         size_t blockSize2, const algorithmFPType *x2, const algorithmFPType *means2, const algorithmFPType *invNorms2,
+                         bool isCentered, algorithmFPType *dist)
+{
+    algorithmFPType alpha = 1.0, beta = 0.0;
+    char transa = 'T', transb = 'N';
+    DAAL_INT m = (DAAL_INT)blockSize2, k = (DAAL_INT)p, nn = (DAAL_INT)blockSize1;
+    DAAL_INT lda = k, ldb = k, ldc = m;
+
+    /* dist = x1 * x2^t */
+    Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &m, &nn, &k, &alpha, x2, &lda, x1, &ldb, &beta, dist, &ldc);
+
+    /* (x1 - mean1) * (x2 - mean2)^t = x1 * x2^t - p * mean1 * mean2 */
+    const algorithmFPType shift = (isCentered ? (algorithmFPType)p : (algorithmFPType)0.0);
+    for (size_t i = 0; i < blockSize1; i++)
+    {
+        const algorithmFPType shift1 = shift * means1[i];
+        const algorithmFPType invNorm1 = invNorms1[i];
+        algorithmFPType *d = dist + i * blockSize2;
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < blockSize2; j++)
+        {
+            d[j] = (algorithmFPType)1.0 - (d[j] - shift1 * means2[j]) * invNorm1 * invNorms2[j];
+        }
+    }
+}
+
+/**
+ *  \brief Computes the full matrix of distances between the rows of xTable and the rows of yTable.
+ *  Row blocks of xTable are processed in parallel, each of them against all row blocks of yTable
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status crossDistanceFull(const NumericTable *xTable, const NumericTable *yTable, bool isCentered, NumericTable *rTable)
+{
+    const size_t p  = xTable->getNumberOfColumns();
+    const size_t nX = xTable->getNumberOfRows();
+    const size_t nY = yTable->getNumberOfRows();
+
+    TArray<algorithmFPType, cpu> statistics(2 * (nX + nY));
+    DAAL_CHECK_MALLOC(statistics.get());
+    algorithmFPType *meansX = statistics.get();
+    algorithmFPType *invNormsX = meansX + nX;
+    algorithmFPType *meansY = invNormsX + nX;
+    algorithmFPType *invNormsY = meansY + nY;
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, (computeRowNorms<algorithmFPType, cpu>(xTable, isCentered, meansX, invNormsX)));
+    DAAL_CHECK_STATUS(s, (computeRowNorms<algorithmFPType, cpu>(yTable, isCentered, meansY, invNormsY)));
+
+    const size_t nBlocksX = nX / crossDistanceBlockSize + !!(nX % crossDistanceBlockSize);
+    const size_t nBlocksY = nY / crossDistanceBlockSize + !!(nY % crossDistanceBlockSize);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocksX, nBlocksX, [ =, &safeStat ](size_t k1)
+    {
+        const size_t shift1 = k1 * crossDistanceBlockSize;
+        const size_t blockSize1 = (k1 == nBlocksX - 1 ? nX - shift1 : crossDistanceBlockSize);
+
+        ReadRows<algorithmFPType, cpu> xBlock(*const_cast<NumericTable *>(xTable), shift1, blockSize1);
+        DAAL_CHECK_BLOCK_STATUS_THR(xBlock)
+        const algorithmFPType *x = xBlock.get();
+
+        WriteOnlyRows<algorithmFPType, cpu> rBlock(rTable, shift1, blockSize1);
+        DAAL_CHECK_BLOCK_STATUS_THR(rBlock)
+        algorithmFPType *r = rBlock.get();
+
+        TArray<algorithmFPType, cpu> tile(crossDistanceBlockSize * crossDistanceBlockSize);
+        DAAL_CHECK_MALLOC_THR(tile.get());
+        algorithmFPType *buf = tile.get();
+
+        for (size_t k2 = 0; k2 < nBlocksY; k2++)
+        {
+            const size_t shift2 = k2 * crossDistanceBlockSize;
+            const size_t blockSize2 = (k2 == nBlocksY - 1 ? nY - shift2 : crossDistanceBlockSize);
+
+            ReadRows<algorithmFPType, cpu> yBlock(*const_cast<NumericTable *>(yTable), shift2, blockSize2);
+            DAAL_CHECK_BLOCK_STATUS_THR(yBlock)
+
+            computeDistanceTile<algorithmFPType, cpu>(p, blockSize1, x, meansX + shift1, invNormsX + shift1,
+                                                      blockSize2, yBlock.get(), meansY + shift2, invNormsY + shift2, isCentered, buf);
+
+            for (size_t i = 0; i < blockSize1; i++)
+            {
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < blockSize2; j++)
+                {
+                    r[i * nY + shift2 + j] = buf[i * blockSize2 + j];
+                }
+            }
+        }
+    } );
+    return safeStat.detach();
+}
+
+/**
+ *  \brief Computes k nearest rows of yTable for each row of xTable and the distances to them, sorted by distance.
+ *  If yTable is NULL, the rows of xTable are compared with each other and each row is excluded from its own neighbors.
+ *  Distance tiles are reduced into per-row heaps of size k right after they are computed, so only O(nX * k) memory
+ *  is used in addition to one tile per thread
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status crossDistanceTopK(const NumericTable *xTable, const NumericTable *yTable, bool isCentered, size_t k,
+                                   NumericTable *indicesTable, NumericTable *distancesTable)
+{
+    const bool isSelf = (yTable == NULL);
+    if (isSelf) { yTable = xTable; }
+
+    const size_t p  = xTable->getNumberOfColumns();
+    const size_t nX = xTable->getNumberOfRows();
+    const size_t nY = yTable->getNumberOfRows();
+
+    TArray<algorithmFPType, cpu> statistics(isSelf ? 2 * nX : 2 * (nX + nY));
+    DAAL_CHECK_MALLOC(statistics.get());
+    algorithmFPType *meansX = statistics.get();
+    algorithmFPType *invNormsX = meansX + nX;
+    algorithmFPType *meansY = (isSelf ? meansX : invNormsX + nX);
+    algorithmFPType *invNormsY = (isSelf ? invNormsX : meansY + nY);
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, (computeRowNorms<algorithmFPType, cpu>(xTable, isCentered, meansX, invNormsX)));
+    if (!isSelf)
+    {
+        DAAL_CHECK_STATUS(s, (computeRowNorms<algorithmFPType, cpu>(yTable, isCentered, meansY, invNormsY)));
+    }
+
+    const size_t nBlocksX = nX / crossDistanceBlockSize + !!(nX % crossDistanceBlockSize);
+    const size_t nBlocksY = nY / crossDistanceBlockSize + !!(nY % crossDistanceBlockSize);
+
+    typedef NearestRow<algorithmFPType> Row;
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocksX, nBlocksX, [ =, &safeStat ](size_t k1)
+    {
+        const size_t shift1 = k1 * crossDistanceBlockSize;
+        const size_t blockSize1 = (k1 == nBlocksX - 1 ? nX - shift1 : crossDistanceBlockSize);
+
+        ReadRows<algorithmFPType, cpu> xBlock(*const_cast<NumericTable *>(xTable), shift1, blockSize1);
+        DAAL_CHECK_BLOCK_STATUS_THR(xBlock)
+        const algorithmFPType *x = xBlock.get();
+
+        TArray<Row, cpu> heaps(blockSize1 * k);
+        DAAL_CHECK_MALLOC_THR(heaps.get());
+        size_t counts[crossDistanceBlockSize] = { 0 };
+        TArray<algorithmFPType, cpu> tile(crossDistanceBlockSize * crossDistanceBlockSize);
+        DAAL_CHECK_MALLOC_THR(tile.get());
+        algorithmFPType *buf = tile.get();
+
+        for (size_t k2 = 0; k2 < nBlocksY; k2++)
+        {
+            const size_t shift2 = k2 * crossDistanceBlockSize;
+            const size_t blockSize2 = (k2 == nBlocksY - 1 ? nY - shift2 : crossDistanceBlockSize);
+
+            ReadRows<algorithmFPType, cpu> yBlock(*const_cast<NumericTable *>(yTable), shift2, blockSize2);
+            DAAL_CHECK_BLOCK_STATUS_THR(yBlock)
+
+            computeDistanceTile<algorithmFPType, cpu>(p, blockSize1, x, meansX + shift1, invNormsX + shift1,
+                                                      blockSize2, yBlock.get(), meansY + shift2, invNormsY + shift2, isCentered, buf);
+
+            for (size_t i = 0; i < blockSize1; i++)
+            {
+                Row *heap = heaps.get() + i * k;
+                for (size_t j = 0; j < blockSize2; j++)
+                {
+                    if (isSelf && shift1 + i == shift2 + j) { continue; }
+
+                    Row candidate;
+                    candidate.distance = buf[i * blockSize2 + j];
+                    candidate.index    = (int)(shift2 + j);
+
+                    if (counts[i] < k)
+                    {
+                        heap[counts[i]++] = candidate;
+                        if (counts[i] == k) { makeMaxHeap<cpu>(heap, heap + k); }
+                    }
+                    else if (candidate < heap[0])
+                    {
+                        heap[0] = candidate;
+                        internalAdjustMaxHeap<cpu>(heap, heap + k, k, (size_t)0);
+                    }
+                }
+            }
+        }
+
+        WriteOnlyRows<int, cpu> indicesBlock(indicesTable, shift1, blockSize1);
+        DAAL_CHECK_BLOCK_STATUS_THR(indicesBlock)
+        WriteOnlyRows<algorithmFPType, cpu> distancesBlock(distancesTable, shift1, blockSize1);
+        DAAL_CHECK_BLOCK_STATUS_THR(distancesBlock)
+        int *indices = indicesBlock.get();
+        algorithmFPType *distances = distancesBlock.get();
+
+        for (size_t i = 0; i < blockSize1; i++)
+        {
+            Row *heap = heaps.get() + i * k;
+            for (size_t last = k; last > 1; last--)
+            {
+                popMaxHeap<cpu>(heap, heap + last);
+            }
+            for (size_t j = 0; j < k; j++)
+            {
+                indices[i * k + j]   = heap[j].index;
+                distances[i * k + j] = heap[j].distance;
+            }
+        }
+    } );
+    return safeStat.detach();
+}
+
+} // namespace internal
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -152,6 +152,65 @@ void qSort(size_t n, algorithmDataType *x)
     }
 }
 
+/**
+ * \brief Quick select function that partially reorders array x, so that x[k] is the element
+ *        at position k of the sorted array, the elements before it are not greater than it
+ *        and the elements after it are not less than it
+ *
+ * \param n[in]     Length of input arrays
+ * \param x[in,out] Array to reorder
+ * \param k[in]     Position of the element to select, k < n
+ * \return Element at position k of the sorted array
+ */
+template <typename algorithmDataType, CpuType cpu>
+algorithmDataType qSelect(size_t n, algorithmDataType *x, size_t k)
+{
+    size_t l = 0, ir = n - 1;
+    for(;;)
+    {
+        if(ir <= l + 1)
+        {
+            if(ir == l + 1 && x[ir] < x[l])
+            {
+                daal::services::internal::swap<cpu, algorithmDataType>(x[l], x[ir]);
+            }
+            return x[k];
+        }
+
+        const size_t mid = (l + ir) >> 1;
+        daal::services::internal::swap<cpu, algorithmDataType>(x[mid], x[l + 1]);
+        if(x[l] > x[ir])
+        {
+            daal::services::internal::swap<cpu, algorithmDataType>(x[l], x[ir]);
+        }
+        if(x[l + 1] > x[ir])
+        {
+            daal::services::internal::swap<cpu, algorithmDataType>(x[l + 1], x[ir]);
+        }
+        if(x[l] > x[l + 1])
+        {
+            daal::services::internal::swap<cpu, algorithmDataType>(x[l], x[l + 1]);
+        }
+
+        /* x[l] <= a <= x[ir] are the sentinels of the partitioning, so l + 1 <= j < i <= ir */
+        size_t i = l + 1;
+        size_t j = ir;
+        const algorithmDataType a = x[l + 1];
+        for(;;)
+        {
+            while(x[++i] < a);
+            while(x[--j] > a);
+            if(j < i) { break; }
+            daal::services::internal::swap<cpu, algorithmDataType>(x[i], x[j]);
+        }
+        x[l + 1] = x[j];
+        x[j] = a;
+
+        if(j >= k) { ir = j - 1; }
+        if(j <= k) { l = i; }
+    }
+}
+
 /**
  * \brief Quick sort function that sorts array x
  *
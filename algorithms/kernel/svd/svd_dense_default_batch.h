@@ -71,7 +71,27 @@ template <typename algorithmFPType>
 DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
 {
     const Input *in = static_cast<const Input *>(input);
-    return allocateImpl<algorithmFPType>(in->get(data)->getNumberOfColumns(), in->get(data)->getNumberOfRows());
+    const size_t nFeatures = in->get(data)->getNumberOfColumns();
+    const size_t nVectors  = in->get(data)->getNumberOfRows();
+    if(method != randomizedDense)
+    {
+        return allocateImpl<algorithmFPType>(nFeatures, nVectors);
+    }
+
+    /* The randomized method returns the leading nComponents singular triplets only */
+    const Parameter *svdPar = static_cast<const Parameter *>(parameter);
+    const size_t nComponents = svdPar->nComponents;
+    Status st;
+    set(singularValues, HomogenNumericTable<algorithmFPType>::create(nComponents, 1, NumericTable::doAllocate, &st));
+    if(svdPar->rightSingularMatrix == requiredInPackedForm)
+    {
+        set(rightSingularMatrix, HomogenNumericTable<algorithmFPType>::create(nFeatures, nComponents, NumericTable::doAllocate, &st));
+    }
+    if(svdPar->leftSingularMatrix == requiredInPackedForm)
+    {
+        set(leftSingularMatrix, HomogenNumericTable<algorithmFPType>::create(nComponents, nVectors, NumericTable::doAllocate, &st));
+    }
+    return st;
 }
 
 /**
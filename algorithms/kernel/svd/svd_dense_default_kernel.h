@@ -82,6 +82,17 @@ public:
 
 };
 
+/**
+ *  \brief Randomized range finder kernel, computes the leading nComponents singular triplets
+ */
+template<typename algorithmFPType, CpuType cpu>
+class SVDBatchKernel<algorithmFPType, daal::algorithms::svd::randomizedDense, cpu> : public Kernel
+{
+public:
+    Status compute(const size_t na, const NumericTable *const *a,
+                 const size_t nr, NumericTable *r[], const daal::algorithms::Parameter *par = 0);
+};
+
 template<typename algorithmFPType, daal::algorithms::svd::Method method, CpuType cpu>
 class SVDOnlineKernel : public Kernel
 {
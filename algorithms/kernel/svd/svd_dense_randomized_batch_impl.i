@@ -0,0 +1,98 @@
+/* file: svd_dense_randomized_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the randomized SVD batch kernel
+//--
+*/
+
+#ifndef __SVD_DENSE_RANDOMIZED_BATCH_IMPL_I__
+#define __SVD_DENSE_RANDOMIZED_BATCH_IMPL_I__
+
+#include "svd_dense_randomized_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svd
+{
+namespace internal
+{
+
+/**
+ *  \brief Kernel for the randomized SVD calculation
+ */
+template <typename algorithmFPType, CpuType cpu>
+Status SVDBatchKernel<algorithmFPType, randomizedDense, cpu>::compute(const size_t na, const NumericTable *const *a,
+                                                                      const size_t nr, NumericTable *r[], const daal::algorithms::Parameter *par)
+{
+    const svd::Parameter *svdPar = static_cast<const svd::Parameter *>(par);
+    DAAL_CHECK(svdPar, ErrorNullParameterNotSupported);
+
+    NumericTable *ntA = const_cast<NumericTable *>(a[0]);
+    const size_t nComponents = svdPar->nComponents;
+
+    WriteOnlyRows<algorithmFPType, cpu> sigmaBlock(r[0], 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(sigmaBlock);
+
+    WriteOnlyRows<algorithmFPType, cpu> vtBlock;
+    algorithmFPType *vt = 0;
+    if (svdPar->rightSingularMatrix == requiredInPackedForm)
+    {
+        vtBlock.set(r[2], 0, nComponents);
+        DAAL_CHECK_BLOCK_STATUS(vtBlock);
+        vt = vtBlock.get();
+    }
+
+    NumericTable *ntU = (svdPar->leftSingularMatrix == requiredInPackedForm ? r[1] : 0);
+
+    RandomizedSVD<algorithmFPType, cpu> randomizedSvd(*ntA);
+    return randomizedSvd.compute(nComponents, svdPar->nPowerIterations, svdPar->seed, sigmaBlock.get(), vt, ntU);
+}
+
+} // namespace daal::internal
+}
+}
+} // namespace daal
+
+#endif
@@ -0,0 +1,457 @@
+/* file: svd_dense_randomized_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the randomized range finder used to compute
+//  the leading singular triplets of a tall or wide matrix
+//--
+*/
+
+#ifndef __SVD_DENSE_RANDOMIZED_IMPL_I__
+#define __SVD_DENSE_RANDOMIZED_IMPL_I__
+
+#include "service_memory.h"
+#include "service_defines.h"
+#include "service_numeric_table.h"
+#include "service_error_handling.h"
+#include "service_blas.h"
+#include "service_rng.h"
+#include "threading.h"
+
+#include "svd_dense_default_impl.i"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svd
+{
+namespace internal
+{
+
+/* Number of rows of the input matrix processed by one thread in one pass over the data */
+const size_t randomizedRowsInBlock = 256;
+
+/* Number of columns added to the random sketch over the requested rank */
+const size_t randomizedOversampling = 10;
+
+/**
+ *  \brief Returns the number of columns l of the random sketch: nComponents plus oversampling,
+ *         but not more than the smallest dimension of the matrix
+ */
+inline size_t getRandomizedSketchSize(size_t nComponents, size_t nVectors, size_t nFeatures)
+{
+    size_t l = nComponents + randomizedOversampling;
+    if (l > nVectors)  { l = nVectors;  }
+    if (l > nFeatures) { l = nFeatures; }
+    return l;
+}
+
+/**
+ *  \brief Fills p x l column-major matrix with independent standard normal numbers.
+ *         The matrix depends on the seed only, so it is the same on all nodes
+ */
+template <typename algorithmFPType, CpuType cpu>
+Status generateGaussianTestMatrix(size_t p, size_t l, size_t seed, algorithmFPType *omega)
+{
+    daal::internal::BaseRNGs<cpu> brng((unsigned int)seed);
+    daal::internal::RNGs<algorithmFPType, cpu> rng;
+    DAAL_CHECK(!rng.gaussian(p * l, omega, brng, (algorithmFPType)0.0, (algorithmFPType)1.0), ErrorIncorrectErrorcodeFromGenerator);
+    return Status();
+}
+
+/**
+ *  \brief Computes the leading singular triplets of the matrix X = (A - 1 * mean') * diag(invScale)
+ *         with the randomized range finder:
+ *           Y = X * Omega,  Q = qr(Y),  [Q = qr(X * qr(X' * Q))] nPowerIterations times,
+ *           Z = X' * Q = W * S * V',  singular values of X are S, right singular vectors are W,
+ *           left singular vectors are Q * V.
+ *         A is never copied or modified: centering and scaling are applied to the small sketches.
+ *         Products with A are computed by blocks of rows in parallel, each product is one pass over A
+ */
+template <typename algorithmFPType, CpuType cpu>
+class RandomizedSVD
+{
+public:
+    /**
+     * \param[in] data      Matrix A of size n x p
+     * \param[in] mean      Optional array of size p subtracted from each row of A
+     * \param[in] invScale  Optional array of size p each column of the centered matrix is multiplied by
+     */
+    RandomizedSVD(NumericTable &data, const algorithmFPType *mean = 0, const algorithmFPType *invScale = 0) :
+        _data(data), _mean(mean), _invScale(invScale),
+        _nVectors(data.getNumberOfRows()), _nFeatures(data.getNumberOfColumns()),
+        _nBlocks(_nVectors / randomizedRowsInBlock + !!(_nVectors % randomizedRowsInBlock)) {}
+
+    /**
+     * \param[in]  nComponents       Number of singular triplets k to compute
+     * \param[in]  nPowerIterations  Number of power iterations
+     * \param[in]  seed              Seed of the Gaussian test matrix
+     * \param[out] sigma             Array of size k for the singular values in descending order
+     * \param[out] vt                Optional k x p row-major array for the right singular vectors
+     * \param[out] leftSingularMatrix Optional n x k table for the left singular vectors
+     */
+    Status compute(size_t nComponents, size_t nPowerIterations, size_t seed,
+                   algorithmFPType *sigma, algorithmFPType *vt, NumericTable *leftSingularMatrix)
+    {
+        const size_t n = _nVectors;
+        const size_t p = _nFeatures;
+        const size_t l = getRandomizedSketchSize(nComponents, n, p);
+        DAAL_CHECK(nComponents <= l, ErrorIncorrectParameter);
+
+        TArray<algorithmFPType, cpu> omegaPtr(p * l);
+        TArray<algorithmFPType, cpu> yPtr(n * l);
+        TArray<algorithmFPType, cpu> rPtr(l * l);
+        algorithmFPType *omega = omegaPtr.get();
+        algorithmFPType *y     = yPtr.get();
+        algorithmFPType *r     = rPtr.get();
+        DAAL_CHECK(omega && y && r, ErrorMemoryAllocationFailed);
+
+        Status s;
+        DAAL_CHECK_STATUS(s, (generateGaussianTestMatrix<algorithmFPType, cpu>(p, l, seed, omega)));
+
+        /* Range of X: Q = qr(X * Omega) */
+        DAAL_CHECK_STATUS(s, multiply(omega, l, y));
+        DAAL_CHECK_STATUS(s, (compute_QR_on_one_node<algorithmFPType, cpu>(n, l, y, n, r, l)));
+
+        for (size_t it = 0; it < nPowerIterations; it++)
+        {
+            DAAL_CHECK_STATUS(s, multiplyTransposed(y, l, omega));
+            DAAL_CHECK_STATUS(s, (compute_QR_on_one_node<algorithmFPType, cpu>(p, l, omega, p, r, l)));
+            DAAL_CHECK_STATUS(s, multiply(omega, l, y));
+            DAAL_CHECK_STATUS(s, (compute_QR_on_one_node<algorithmFPType, cpu>(n, l, y, n, r, l)));
+        }
+
+        /* Z = X' * Q is the transposed projection of X onto the range, Z = W * S * V' */
+        DAAL_CHECK_STATUS(s, multiplyTransposed(y, l, omega));
+
+        TArray<algorithmFPType, cpu> sPtr(l);
+        TArray<algorithmFPType, cpu> wPtr(p * l);
+        TArray<algorithmFPType, cpu> smallVtPtr(l * l);
+        algorithmFPType *sv      = sPtr.get();
+        algorithmFPType *w       = wPtr.get();
+        algorithmFPType *smallVt = smallVtPtr.get();
+        DAAL_CHECK(sv && w && smallVt, ErrorMemoryAllocationFailed);
+
+        DAAL_CHECK_STATUS(s, (compute_svd_on_one_node<algorithmFPType, cpu>(p, l, omega, p, sv, w, p, smallVt, l)));
+
+        for (size_t j = 0; j < nComponents; j++)
+        {
+            sigma[j] = sv[j];
+        }
+
+        if (vt)
+        {
+            /* Column j of the column-major W is the j-th right singular vector */
+            for (size_t j = 0; j < nComponents; j++)
+            {
+                const algorithmFPType *wj = w + j * p;
+                algorithmFPType *vtj = vt + j * p;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < p; i++)
+                {
+                    vtj[i] = wj[i];
+                }
+            }
+        }
+
+        if (leftSingularMatrix)
+        {
+            DAAL_CHECK_STATUS(s, computeLeftSingularVectors(y, smallVt, l, nComponents, *leftSingularMatrix));
+        }
+        return s;
+    }
+
+protected:
+    /**
+     * Computes Y = X * Omega
+     * \param[in]  omega  p x l column-major matrix
+     * \param[out] y      n x l column-major matrix
+     */
+    Status multiply(const algorithmFPType *omega, size_t l, algorithmFPType *y)
+    {
+        const size_t n = _nVectors;
+        const size_t p = _nFeatures;
+
+        /* X * Omega = A * (D * Omega) - 1 * (mean' * D * Omega) */
+        TArray<algorithmFPType, cpu> scaledOmegaPtr(_invScale ? p * l : 0);
+        const algorithmFPType *scaledOmega = omega;
+        if (_invScale)
+        {
+            algorithmFPType *so = scaledOmegaPtr.get();
+            DAAL_CHECK(so, ErrorMemoryAllocationFailed);
+            for (size_t j = 0; j < l; j++)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < p; i++)
+                {
+                    so[j * p + i] = omega[j * p + i] * _invScale[i];
+                }
+            }
+            scaledOmega = so;
+        }
+
+        TArrayCalloc<algorithmFPType, cpu> shiftPtr(l);
+        algorithmFPType *shift = shiftPtr.get();
+        DAAL_CHECK(shift, ErrorMemoryAllocationFailed);
+        if (_mean)
+        {
+            for (size_t j = 0; j < l; j++)
+            {
+                algorithmFPType sum = 0;
+                for (size_t i = 0; i < p; i++)
+                {
+                    sum += _mean[i] * scaledOmega[j * p + i];
+                }
+                shift[j] = sum;
+            }
+        }
+
+        const algorithmFPType *mean = _mean;
+        NumericTable &data = _data;
+        const size_t nBlocks = _nBlocks;
+
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [ =, &data, &safeStat ](size_t iBlock)
+        {
+            const size_t startRow = iBlock * randomizedRowsInBlock;
+            const size_t nRows = (iBlock == nBlocks - 1) ? n - startRow : randomizedRowsInBlock;
+
+            ReadRows<algorithmFPType, cpu> dataRows(data, startRow, nRows);
+            DAAL_CHECK_BLOCK_STATUS_THR(dataRows);
+
+            const char transa = 't';
+            const char transb = 'n';
+            const algorithmFPType one  = 1.0;
+            const algorithmFPType zero = 0.0;
+            DAAL_INT m   = (DAAL_INT)nRows;
+            DAAL_INT nl  = (DAAL_INT)l;
+            DAAL_INT k   = (DAAL_INT)p;
+            DAAL_INT ldy = (DAAL_INT)n;
+
+            algorithmFPType *yBlock = y + startRow;
+            Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &m, &nl, &k, &one, dataRows.get(), &k, scaledOmega, &k, &zero, yBlock, &ldy);
+
+            if (mean)
+            {
+                for (size_t j = 0; j < l; j++)
+                {
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t i = 0; i < nRows; i++)
+                    {
+                        yBlock[j * n + i] -= shift[j];
+                    }
+                }
+            }
+        });
+        return safeStat.detach();
+    }
+
+    /**
+     * Computes Z = X' * Q
+     * \param[in]  q  n x l column-major matrix
+     * \param[out] z  p x l column-major matrix
+     */
+    Status multiplyTransposed(const algorithmFPType *q, size_t l, algorithmFPType *z)
+    {
+        const size_t n = _nVectors;
+        const size_t p = _nFeatures;
+        const size_t nBlocks = _nBlocks;
+        const size_t nLocal = p * l + l;
+        NumericTable &data = _data;
+
+        /* Each thread accumulates A_b' * Q_b and the column sums of Q_b of its blocks */
+        daal::tls<algorithmFPType *> tlsZ([ = ]()
+        {
+            return service_scalable_calloc<algorithmFPType, cpu>(nLocal);
+        });
+
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [ =, &tlsZ, &data, &safeStat ](size_t iBlock)
+        {
+            const size_t startRow = iBlock * randomizedRowsInBlock;
+            const size_t nRows = (iBlock == nBlocks - 1) ? n - startRow : randomizedRowsInBlock;
+
+            algorithmFPType *localZ = tlsZ.local();
+            DAAL_CHECK_MALLOC_THR(localZ);
+
+            ReadRows<algorithmFPType, cpu> dataRows(data, startRow, nRows);
+            DAAL_CHECK_BLOCK_STATUS_THR(dataRows);
+
+            const char transa = 'n';
+            const char transb = 'n';
+            const algorithmFPType one = 1.0;
+            DAAL_INT m   = (DAAL_INT)p;
+            DAAL_INT nl  = (DAAL_INT)l;
+            DAAL_INT k   = (DAAL_INT)nRows;
+            DAAL_INT lda = (DAAL_INT)p;
+            DAAL_INT ldq = (DAAL_INT)n;
+
+            const algorithmFPType *qBlock = q + startRow;
+            Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &m, &nl, &k, &one, dataRows.get(), &lda, qBlock, &ldq, &one, localZ, &lda);
+
+            algorithmFPType *localColSums = localZ + p * l;
+            for (size_t j = 0; j < l; j++)
+            {
+                algorithmFPType sum = 0;
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nRows; i++)
+                {
+                    sum += qBlock[j * n + i];
+                }
+                localColSums[j] += sum;
+            }
+        });
+
+        TArrayCalloc<algorithmFPType, cpu> sumPtr(nLocal);
+        algorithmFPType *sum = sumPtr.get();
+
+        tlsZ.reduce([ = ](algorithmFPType *localZ)
+        {
+            if (!localZ) { return; }
+            if (sum)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nLocal; i++)
+                {
+                    sum[i] += localZ[i];
+                }
+            }
+            service_scalable_free<algorithmFPType, cpu>(localZ);
+        });
+        DAAL_CHECK_SAFE_STATUS();
+        DAAL_CHECK(sum, ErrorMemoryAllocationFailed);
+
+        /* X' * Q = D * (A' * Q - mean * (1' * Q)) */
+        const algorithmFPType *colSums = sum + p * l;
+        for (size_t j = 0; j < l; j++)
+        {
+            const algorithmFPType *sj = sum + j * p;
+            algorithmFPType *zj = z + j * p;
+            if (_mean)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < p; i++)
+                {
+                    zj[i] = sj[i] - _mean[i] * colSums[j];
+                }
+            }
+            else
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < p; i++)
+                {
+                    zj[i] = sj[i];
+                }
+            }
+            if (_invScale)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < p; i++)
+                {
+                    zj[i] *= _invScale[i];
+                }
+            }
+        }
+        return Status();
+    }
+
+    /**
+     * Writes U = Q * V for the first nComponents columns of V by blocks of rows
+     * \param[in] q        n x l column-major orthonormal basis of the range
+     * \param[in] smallVt  l x l column-major matrix V' from the SVD of Z
+     */
+    Status computeLeftSingularVectors(const algorithmFPType *q, const algorithmFPType *smallVt, size_t l, size_t nComponents,
+                                      NumericTable &leftSingularMatrix)
+    {
+        const size_t n = _nVectors;
+        const size_t nBlocks = _nBlocks;
+
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [ =, &leftSingularMatrix, &safeStat ](size_t iBlock)
+        {
+            const size_t startRow = iBlock * randomizedRowsInBlock;
+            const size_t nRows = (iBlock == nBlocks - 1) ? n - startRow : randomizedRowsInBlock;
+
+            WriteOnlyRows<algorithmFPType, cpu> uRows(leftSingularMatrix, startRow, nRows);
+            DAAL_CHECK_BLOCK_STATUS_THR(uRows);
+
+            /* Row-major U block (nRows x k) is the column-major k x nRows matrix V_k' * Q_b' */
+            const char transa = 'n';
+            const char transb = 't';
+            const algorithmFPType one  = 1.0;
+            const algorithmFPType zero = 0.0;
+            DAAL_INT m   = (DAAL_INT)nComponents;
+            DAAL_INT nr  = (DAAL_INT)nRows;
+            DAAL_INT k   = (DAAL_INT)l;
+            DAAL_INT ldq = (DAAL_INT)n;
+
+            Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &m, &nr, &k, &one, smallVt, &k, q + startRow, &ldq, &zero, uRows.get(), &m);
+        });
+        return safeStat.detach();
+    }
+
+    NumericTable &_data;
+    const algorithmFPType *_mean;
+    const algorithmFPType *_invScale;
+    const size_t _nVectors;
+    const size_t _nFeatures;
+    const size_t _nBlocks;
+};
+
+} // namespace daal::internal
+}
+}
+} // namespace daal
+
+#endif
@@ -129,7 +129,18 @@ Status Input::check(const daal::algorithms::Parameter *parameter, int method) co
     Status s = checkNumericTable(dataTable.get(), dataStr());
     if(!s) { return s; }
 
-    DAAL_CHECK_EX(dataTable->getNumberOfColumns() <= dataTable->getNumberOfRows(), ErrorIncorrectNumberOfRows, ArgumentName, dataStr());
+    const size_t nFeatures = dataTable->getNumberOfColumns();
+    const size_t nVectors  = dataTable->getNumberOfRows();
+    if(method == randomizedDense)
+    {
+        const Parameter *svdPar = static_cast<const Parameter *>(parameter);
+        DAAL_CHECK(svdPar, ErrorNullParameterNotSupported);
+        const size_t maxComponents = (nFeatures < nVectors ? nFeatures : nVectors);
+        DAAL_CHECK_EX(svdPar->nComponents > 0 && svdPar->nComponents <= maxComponents, ErrorIncorrectParameter, ParameterName, nComponentsStr());
+        return Status();
+    }
+
+    DAAL_CHECK_EX(nFeatures <= nVectors, ErrorIncorrectNumberOfRows, ArgumentName, dataStr());
     return Status();
 }
 
@@ -0,0 +1,151 @@
+/* file: cholesky_batched_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of Cholesky decomposition of a batch of matrices
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-CHOLESKY_BATCHED_BATCH"></a>
+ * \example cholesky_batched_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+const size_t nMatrices = 4;  /* Number of matrices in the batch */
+const size_t k         = 5;  /* Size of each matrix */
+const size_t nRhs      = 2;  /* Number of right-hand sides for each matrix */
+
+int main(int argc, char *argv[])
+{
+    /* Generate a batch of symmetric positive-definite matrices A = M * M' + k * I and the right-hand sides */
+    Collection<size_t> matricesDims;
+    matricesDims.push_back(nMatrices);
+    matricesDims.push_back(k);
+    matricesDims.push_back(k);
+    SharedPtr<HomogenTensor<> > matrices(new HomogenTensor<>(matricesDims, Tensor::doAllocate, 0.0f));
+
+    Collection<size_t> rhsDims;
+    rhsDims.push_back(nMatrices);
+    rhsDims.push_back(nRhs);
+    rhsDims.push_back(k);
+    SharedPtr<HomogenTensor<> > rightHandSides(new HomogenTensor<>(rhsDims, Tensor::doAllocate, 0.0f));
+
+    DAAL_DATA_TYPE *a = matrices->getArray();
+    DAAL_DATA_TYPE *b = rightHandSides->getArray();
+    DAAL_DATA_TYPE m[k * k];
+
+    srand(777);
+    for (size_t n = 0; n < nMatrices; n++)
+    {
+        for (size_t i = 0; i < k * k; i++)
+        {
+            m[i] = (DAAL_DATA_TYPE)rand() / RAND_MAX;
+        }
+        for (size_t i = 0; i < k; i++)
+        {
+            for (size_t j = 0; j < k; j++)
+            {
+                DAAL_DATA_TYPE sum = (i == j ? (DAAL_DATA_TYPE)k : 0);
+                for (size_t l = 0; l < k; l++)
+                {
+                    sum += m[i * k + l] * m[j * k + l];
+                }
+                a[(n * k + i) * k + j] = sum;
+            }
+        }
+        for (size_t i = 0; i < nRhs * k; i++)
+        {
+            b[n * nRhs * k + i] = (DAAL_DATA_TYPE)rand() / RAND_MAX;
+        }
+    }
+
+    /* Create an algorithm to compute Cholesky decompositions of the batch of matrices */
+    cholesky::Batch<float, cholesky::batchedDense> algorithm;
+
+    /* Set input objects for the algorithm */
+    algorithm.input.set(cholesky::matrices, matrices);
+    algorithm.input.set(cholesky::rightHandSides, rightHandSides);
+
+    /* Compute Cholesky decompositions and solve the linear systems */
+    algorithm.compute();
+
+    /* Get computed Cholesky decompositions and solutions */
+    cholesky::ResultPtr res = algorithm.getResult();
+
+    printTensor3d(res->get(cholesky::choleskyFactors), "Cholesky factors:");
+    printTensor3d(res->get(cholesky::solutions), "Solutions:");
+
+    /* Check the residuals of the linear systems A * x = b */
+    SubtensorDescriptor<DAAL_DATA_TYPE> block;
+    TensorPtr solutions = res->get(cholesky::solutions);
+    solutions->getSubtensor(0, 0, 0, nMatrices, readOnly, block);
+    const DAAL_DATA_TYPE *x = block.getPtr();
+
+    DAAL_DATA_TYPE maxResidual = 0;
+    for (size_t n = 0; n < nMatrices; n++)
+    {
+        for (size_t r = 0; r < nRhs; r++)
+        {
+            for (size_t i = 0; i < k; i++)
+            {
+                DAAL_DATA_TYPE residual = -b[(n * nRhs + r) * k + i];
+                for (size_t j = 0; j < k; j++)
+                {
+                    residual += a[(n * k + i) * k + j] * x[(n * nRhs + r) * k + j];
+                }
+                if (residual < 0) { residual = -residual; }
+                if (residual > maxResidual) { maxResidual = residual; }
+            }
+        }
+    }
+    solutions->releaseSubtensor(block);
+
+    std::cout << "Maximal residual of the linear systems: " << maxResidual << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,162 @@
+/* file: conv2d_layer_algorithms_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+
+/*
+!  Content:
+!    C++ example of the algorithms of the forward two-dimensional convolution layer.
+!    Compares the throughput and the results of the deep neural network library primitive,
+!    the blocked direct convolution and the Winograd convolution
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-CONVOLUTION2D_LAYER_ALGORITHMS_BATCH"></a>
+ * \example conv2d_layer_algorithms_dense_batch.cpp
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::neural_networks::layers;
+using namespace daal::data_management;
+using namespace daal::services;
+
+const size_t batchSize = 16;
+const size_t nChannels = 64;
+const size_t imageSize = 56;
+const size_t nKernels  = 64;
+const size_t nIterations = 10;
+
+/* Computes the forward two-dimensional convolution layer with the given algorithm */
+TensorPtr runConvolution(convolution2d::Algorithm algorithm, const char *name, const TensorPtr &data,
+                         TensorPtr &weights, TensorPtr &biases)
+{
+    convolution2d::forward::Batch<> convolution2dLayerForward;
+    convolution2dLayerForward.parameter.nKernels    = nKernels;
+    convolution2dLayerForward.parameter.kernelSizes = convolution2d::KernelSizes(3, 3);
+    convolution2dLayerForward.parameter.strides     = convolution2d::Strides(1, 1);
+    convolution2dLayerForward.parameter.paddings    = convolution2d::Paddings(1, 1);
+    convolution2dLayerForward.parameter.algorithm   = algorithm;
+    convolution2dLayerForward.input.set(forward::data, data);
+
+    /* Use the weights and biases initialized by the first computation */
+    if (weights)
+    {
+        convolution2dLayerForward.input.set(forward::weights, weights);
+        convolution2dLayerForward.input.set(forward::biases, biases);
+        convolution2dLayerForward.parameter.weightsAndBiasesInitialized = true;
+    }
+
+    /* The first computation allocates the result and initializes the algorithm */
+    convolution2dLayerForward.compute();
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (size_t i = 0; i < nIterations; i++)
+    {
+        convolution2dLayerForward.compute();
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    cout << name << ":" << endl;
+    cout << "    Time per batch, ms:   " << 1000.0 * seconds / nIterations << endl;
+    cout << "    Images per s:         " << batchSize * nIterations / seconds << endl;
+
+    convolution2d::forward::ResultPtr forwardResult = convolution2dLayerForward.getResult();
+    weights = convolution2dLayerForward.input.get(forward::weights);
+    biases  = convolution2dLayerForward.input.get(forward::biases);
+    return forwardResult->get(forward::value);
+}
+
+/* Computes the maximal absolute difference between two tensors of the same size */
+float maxDifference(const TensorPtr &first, const TensorPtr &second)
+{
+    const size_t nRows = first->getDimensionSize(0);
+    SubtensorDescriptor<float> firstBlock, secondBlock;
+    first->getSubtensor(0, 0, 0, nRows, readOnly, firstBlock);
+    second->getSubtensor(0, 0, 0, nRows, readOnly, secondBlock);
+
+    float difference = 0.0f;
+    const float *x = firstBlock.getPtr();
+    const float *y = secondBlock.getPtr();
+    for (size_t i = 0; i < firstBlock.getSize(); i++)
+    {
+        difference = max(difference, fabs(x[i] - y[i]));
+    }
+
+    first->releaseSubtensor(firstBlock);
+    second->releaseSubtensor(secondBlock);
+    return difference;
+}
+
+int main(int argc, char *argv[])
+{
+    /* Create collection of dimension sizes of the input data tensor */
+    Collection<size_t> inDims;
+    inDims.push_back(batchSize);
+    inDims.push_back(nChannels);
+    inDims.push_back(imageSize);
+    inDims.push_back(imageSize);
+    TensorPtr tensorData = TensorPtr(new HomogenTensor<>(inDims, Tensor::doAllocate));
+
+    SubtensorDescriptor<float> dataBlock;
+    tensorData->getSubtensor(0, 0, 0, batchSize, writeOnly, dataBlock);
+    float *data = dataBlock.getPtr();
+    srand(777);
+    for (size_t i = 0; i < dataBlock.getSize(); i++)
+    {
+        data[i] = 2.0f * rand() / RAND_MAX - 1.0f;
+    }
+    tensorData->releaseSubtensor(dataBlock);
+
+    TensorPtr weights, biases;
+    TensorPtr dnnValue      = runConvolution(convolution2d::dnnAlgorithm,      "Deep neural network primitive", tensorData, weights, biases);
+    TensorPtr directValue   = runConvolution(convolution2d::directAlgorithm,   "Blocked direct convolution",    tensorData, weights, biases);
+    TensorPtr winogradValue = runConvolution(convolution2d::winogradAlgorithm, "Winograd F(2x2, 3x3)",          tensorData, weights, biases);
+
+    cout << "Maximal difference from the primitive result:" << endl;
+    cout << "    Blocked direct convolution: " << maxDifference(dnnValue, directValue)   << endl;
+    cout << "    Winograd F(2x2, 3x3):       " << maxDifference(dnnValue, winogradValue) << endl;
+
+    return 0;
+}
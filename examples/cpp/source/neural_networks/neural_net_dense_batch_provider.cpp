@@ -0,0 +1,171 @@
+/* file: neural_net_dense_batch_provider.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of neural network training with the samples streamed from a data source
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-NEURAL_NETWORK_BATCH_PROVIDER"></a>
+ * \example neural_net_dense_batch_provider.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include "neural_net_dense_batch.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::neural_networks;
+using namespace daal::data_management;
+using namespace daal::services;
+
+/* Input data set parameters */
+string trainDatasetFile     = "../data/batch/neural_network_train.csv";
+string trainGroundTruthFile = "../data/batch/neural_network_train_ground_truth.csv";
+string testDatasetFile      = "../data/batch/neural_network_test.csv";
+string testGroundTruthFile  = "../data/batch/neural_network_test_ground_truth.csv";
+
+const size_t nFeatures = 20;
+const size_t batchSize = 10;
+const size_t nEpochIterations = 600;
+
+prediction::ModelPtr predictionModel;
+prediction::ResultPtr predictionResult;
+
+void trainModel();
+void testModel();
+void printResults();
+
+int main()
+{
+    trainModel();
+
+    testModel();
+
+    printResults();
+
+    return 0;
+}
+
+void trainModel()
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to read the training data set and its ground truth
+       from .csv files block by block */
+    FileDataSource<CSVFeatureManager> trainDataSource(trainDatasetFile, DataSource::doAllocateNumericTable,
+                                                      DataSource::doDictionaryFromContext);
+    FileDataSource<CSVFeatureManager> trainGroundTruthSource(trainGroundTruthFile, DataSource::doAllocateNumericTable,
+                                                             DataSource::doDictionaryFromContext);
+
+    /* Create a provider that converts the rows of the data sources into the training samples and their ground truth */
+    Collection<size_t> sampleDimensions;
+    sampleDimensions.push_back(nFeatures);
+    Collection<size_t> groundTruthDimensions;
+    groundTruthDimensions.push_back(1);
+    training::BatchProviderPtr provider(new training::DataSourceBatchProvider<float>(trainDataSource, sampleDimensions,
+                                                                                     trainGroundTruthSource, groundTruthDimensions));
+
+    SharedPtr<optimization_solver::sgd::Batch<> > sgdAlgorithm(new optimization_solver::sgd::Batch<>());
+    float learningRate = 0.001f;
+    sgdAlgorithm->parameter.learningRateSequence = NumericTablePtr(new HomogenNumericTable<>(1, 1, NumericTable::doAllocate, learningRate));
+    /* Set the batch size for the neural network training */
+    sgdAlgorithm->parameter.batchSize = batchSize;
+    /* The training stops at the end of the data set if it comes before the last iteration */
+    sgdAlgorithm->parameter.nIterations = nEpochIterations;
+
+    /* Create an algorithm to train neural network */
+    training::Batch<> net(sgdAlgorithm);
+
+    /* Load the next batches in the background and shuffle the samples within windows of 100 samples */
+    net.parameter.nPrefetchedBatches = 4;
+    net.parameter.shuffleBufferSize = 100;
+
+    /* Configure the neural network */
+    training::TopologyPtr topology = configureNet();
+
+    Collection<size_t> oneBatchDimensions;
+    oneBatchDimensions.push_back(batchSize);
+    oneBatchDimensions.push_back(nFeatures);
+    net.initialize(oneBatchDimensions, *topology);
+
+    /* Pass the provider of the training samples to the algorithm in place of the training data set */
+    net.input.set(training::batchProvider, provider);
+
+    /* Run the neural network training */
+    net.compute();
+
+    /* Retrieve training and prediction models of the neural network */
+    training::ModelPtr trainingModel = net.getResult()->get(training::model);
+    predictionModel = trainingModel->getPredictionModel<float>();
+}
+
+void testModel()
+{
+    /* Read testing data set from a .csv file and create a tensor to store input data */
+    TensorPtr predictionData = readTensorFromCSV(testDatasetFile);
+
+    /* Create an algorithm to compute the neural network predictions */
+    prediction::Batch<> net;
+
+    net.parameter.batchSize = predictionData->getDimensionSize(0);
+
+    /* Set input objects for the prediction neural network */
+    net.input.set(prediction::model, predictionModel);
+    net.input.set(prediction::data, predictionData);
+
+    /* Run the neural network prediction */
+    net.compute();
+
+    /* Print results of the neural network prediction */
+    predictionResult = net.getResult();
+}
+
+void printResults()
+{
+    /* Read testing ground truth from a .csv file and create a tensor to store the data */
+    TensorPtr predictionGroundTruth = readTensorFromCSV(testGroundTruthFile);
+
+    printTensors<int, float>(predictionGroundTruth, predictionResult->get(prediction::prediction),
+                             "Ground truth", "Neural network predictions: each class probability",
+                             "Neural network classification results (first 20 observations):", 20);
+}
@@ -0,0 +1,163 @@
+/* file: sgd_hogwild_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the asynchronous Stochastic gradient descent algorithm.
+!    Compares the convergence and the throughput of the hogwild and mini-batch methods
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-SGD_HOGWILD_BATCH"></a>
+ * \example sgd_hogwild_dense_batch.cpp
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+const size_t nVectors = 100000;
+const size_t nFeatures = 20;
+const size_t nIterations = 20000;
+const size_t batchSize = 32;
+const size_t maxStaleness = 16;
+const float  learningRate = 0.05f;
+
+/* Generates the data set of the linear regression with noise */
+void generateData(NumericTablePtr &data, NumericTablePtr &dependentVariables)
+{
+    data = NumericTablePtr(new HomogenNumericTable<>(nFeatures, nVectors, NumericTable::doAllocate));
+    dependentVariables = NumericTablePtr(new HomogenNumericTable<>(1, nVectors, NumericTable::doAllocate));
+
+    BlockDescriptor<float> dataBlock, dependentVariablesBlock;
+    data->getBlockOfRows(0, nVectors, writeOnly, dataBlock);
+    dependentVariables->getBlockOfRows(0, nVectors, writeOnly, dependentVariablesBlock);
+    float *x = dataBlock.getBlockPtr();
+    float *y = dependentVariablesBlock.getBlockPtr();
+
+    srand(777);
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        y[i] = 1.0f + 0.01f * (2.0f * rand() / RAND_MAX - 1.0f);
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            x[i * nFeatures + j] = 2.0f * rand() / RAND_MAX - 1.0f;
+            y[i] += x[i * nFeatures + j] * (float)(j + 1) / nFeatures;
+        }
+    }
+
+    data->releaseBlockOfRows(dataBlock);
+    dependentVariables->releaseBlockOfRows(dependentVariablesBlock);
+}
+
+/* Computes the value of the objective function at the given point */
+float computeValue(const services::SharedPtr<optimization_solver::mse::Batch<> > &function, const NumericTablePtr &argument)
+{
+    services::SharedPtr<optimization_solver::mse::Batch<> > valueFunction = function->clone();
+    valueFunction->input.set(optimization_solver::mse::argument, argument);
+    valueFunction->parameter.resultsToCompute = optimization_solver::objective_function::value;
+    valueFunction->compute();
+
+    NumericTablePtr value = valueFunction->getResult()->get(optimization_solver::objective_function::valueIdx);
+    BlockDescriptor<float> block;
+    value->getBlockOfRows(0, 1, readOnly, block);
+    float result = block.getBlockPtr()[0];
+    value->releaseBlockOfRows(block);
+    return result;
+}
+
+template <optimization_solver::sgd::Method method>
+void runSolver(optimization_solver::sgd::Batch<float, method> &algorithm,
+               const services::SharedPtr<optimization_solver::mse::Batch<> > &function, const char *name)
+{
+    algorithm.input.set(optimization_solver::iterative_solver::inputArgument,
+                        NumericTablePtr(new HomogenNumericTable<>(1, nFeatures + 1, NumericTable::doAllocate, 0.0f)));
+    algorithm.parameter.learningRateSequence = NumericTablePtr(new HomogenNumericTable<>(1, 1, NumericTable::doAllocate, learningRate));
+    algorithm.parameter.nIterations = nIterations;
+    algorithm.parameter.batchSize = batchSize;
+    algorithm.parameter.accuracyThreshold = 0.0;
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    algorithm.compute();
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    NumericTablePtr minimum = algorithm.getResult()->get(optimization_solver::iterative_solver::minimum);
+    NumericTablePtr nIterationsPerformed = algorithm.getResult()->get(optimization_solver::iterative_solver::nIterations);
+    BlockDescriptor<int> block;
+    nIterationsPerformed->getBlockOfRows(0, 1, readOnly, block);
+    int nPerformed = block.getBlockPtr()[0];
+    nIterationsPerformed->releaseBlockOfRows(block);
+
+    cout << name << ":" << endl;
+    cout << "    Iterations performed: " << nPerformed << endl;
+    cout << "    Time, s:              " << seconds << endl;
+    cout << "    Iterations per s:     " << nPerformed / seconds << endl;
+    cout << "    Objective value:      " << computeValue(function, minimum) << endl;
+}
+
+int main(int argc, char *argv[])
+{
+    NumericTablePtr data, dependentVariables;
+    generateData(data, dependentVariables);
+
+    services::SharedPtr<optimization_solver::mse::Batch<> > mseObjectiveFunction(new optimization_solver::mse::Batch<>(nVectors));
+    mseObjectiveFunction->input.set(optimization_solver::mse::data, data);
+    mseObjectiveFunction->input.set(optimization_solver::mse::dependentVariables, dependentVariables);
+
+    /* Create objects to compute the Stochastic gradient descent result using the mini-batch method */
+    optimization_solver::sgd::Batch<float, optimization_solver::sgd::miniBatch> sgdMiniBatchAlgorithm(mseObjectiveFunction);
+    sgdMiniBatchAlgorithm.parameter.innerNIterations = 1;
+    sgdMiniBatchAlgorithm.parameter.conservativeSequence = NumericTablePtr(new HomogenNumericTable<>(1, 1, NumericTable::doAllocate, 0.0f));
+    runSolver(sgdMiniBatchAlgorithm, mseObjectiveFunction, "Mini-batch");
+
+    /* Create objects to compute the Stochastic gradient descent result using the hogwild method */
+    optimization_solver::sgd::Batch<float, optimization_solver::sgd::hogwild> sgdHogwildAlgorithm(mseObjectiveFunction);
+    sgdHogwildAlgorithm.parameter.maxStaleness = maxStaleness;
+    runSolver(sgdHogwildAlgorithm, mseObjectiveFunction, "Hogwild");
+
+    return 0;
+}
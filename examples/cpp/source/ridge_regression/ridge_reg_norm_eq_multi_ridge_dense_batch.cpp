@@ -0,0 +1,162 @@
+/* file: ridge_reg_norm_eq_multi_ridge_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of ridge regression with a separate ridge parameter for each
+!    dependent variable in the batch processing mode.
+!
+!    The program trains one ridge regression model without the intercept term
+!    on a generated data set with more than 64 features and compares its
+!    coefficients with the models trained separately for each dependent variable.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-RIDGE_REGRESSION_NORM_EQ_MULTI_RIDGE_BATCH"></a>
+ * \example ridge_reg_norm_eq_multi_ridge_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms::ridge_regression;
+
+const size_t nFeatures           = 80;    /* Number of features in the training data set */
+const size_t nObservations       = 1000;  /* Number of observations in the training data set */
+const size_t nDependentVariables = 3;     /* Number of dependent variables that correspond to each observation */
+
+const double ridges[nDependentVariables] = { 1.0, 10.0, 100.0 };
+
+NumericTablePtr trainModel(const NumericTablePtr &data, const NumericTablePtr &dependentVariables,
+                           const NumericTablePtr &ridgeParameters);
+
+int main(int argc, char *argv[])
+{
+    /* Generate the training data set and dependent variables */
+    SharedPtr<HomogenNumericTable<> > data(new HomogenNumericTable<>(nFeatures, nObservations, NumericTable::doAllocate));
+    SharedPtr<HomogenNumericTable<> > dependentVariables(new HomogenNumericTable<>(nDependentVariables, nObservations,
+                                                                                   NumericTable::doAllocate));
+    DAAL_DATA_TYPE *x = data->getArray();
+    DAAL_DATA_TYPE *y = dependentVariables->getArray();
+
+    srand(777);
+    for (size_t i = 0; i < nObservations; i++)
+    {
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            x[i * nFeatures + j] = (DAAL_DATA_TYPE)rand() / RAND_MAX - 0.5;
+        }
+        for (size_t k = 0; k < nDependentVariables; k++)
+        {
+            DAAL_DATA_TYPE value = (DAAL_DATA_TYPE)rand() / RAND_MAX * 0.01;
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                value += x[i * nFeatures + j] * (DAAL_DATA_TYPE)((j + k) % 7) * 0.5;
+            }
+            y[i * nDependentVariables + k] = value;
+        }
+    }
+
+    /* Train one model with a separate ridge parameter for each dependent variable */
+    SharedPtr<HomogenNumericTable<double> > ridgeParameters(
+        new HomogenNumericTable<double>(nDependentVariables, 1, NumericTable::doAllocate));
+    for (size_t k = 0; k < nDependentVariables; k++)
+    {
+        ridgeParameters->getArray()[k] = ridges[k];
+    }
+    NumericTablePtr beta = trainModel(data, dependentVariables, ridgeParameters);
+    printNumericTable(beta, "Ridge Regression coefficients:", nDependentVariables, 10);
+
+    BlockDescriptor<> betaBlock;
+    beta->getBlockOfRows(0, nDependentVariables, readOnly, betaBlock);
+    const DAAL_DATA_TYPE *betaArray = betaBlock.getBlockPtr();
+
+    /* Train the models for each dependent variable separately and compare the coefficients */
+    DAAL_DATA_TYPE maxDifference = 0;
+    for (size_t k = 0; k < nDependentVariables; k++)
+    {
+        SharedPtr<HomogenNumericTable<> > singleDependentVariable(new HomogenNumericTable<>(1, nObservations, NumericTable::doAllocate));
+        for (size_t i = 0; i < nObservations; i++)
+        {
+            singleDependentVariable->getArray()[i] = y[i * nDependentVariables + k];
+        }
+        NumericTablePtr singleRidgeParameter(new HomogenNumericTable<double>(1, 1, NumericTable::doAllocate, ridges[k]));
+        NumericTablePtr singleBeta = trainModel(data, singleDependentVariable, singleRidgeParameter);
+
+        BlockDescriptor<> singleBetaBlock;
+        singleBeta->getBlockOfRows(0, 1, readOnly, singleBetaBlock);
+        const DAAL_DATA_TYPE *singleBetaArray = singleBetaBlock.getBlockPtr();
+        for (size_t j = 0; j < nFeatures + 1; j++)
+        {
+            DAAL_DATA_TYPE difference = betaArray[k * (nFeatures + 1) + j] - singleBetaArray[j];
+            if (difference < 0) { difference = -difference; }
+            if (difference > maxDifference) { maxDifference = difference; }
+        }
+        singleBeta->releaseBlockOfRows(singleBetaBlock);
+    }
+    beta->releaseBlockOfRows(betaBlock);
+
+    std::cout << "Maximal difference with the separately trained models: " << maxDifference << std::endl;
+
+    return 0;
+}
+
+NumericTablePtr trainModel(const NumericTablePtr &data, const NumericTablePtr &dependentVariables,
+                           const NumericTablePtr &ridgeParameters)
+{
+    /* Create an algorithm object to train the ridge regression model with the normal equations method */
+    training::Batch<> algorithm;
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(training::data, data);
+    algorithm.input.set(training::dependentVariables, dependentVariables);
+
+    /* Train the model without the intercept term */
+    algorithm.parameter.interceptFlag   = false;
+    algorithm.parameter.ridgeParameters = ridgeParameters;
+
+    /* Build the ridge regression model */
+    algorithm.compute();
+
+    return algorithm.getResult()->get(training::model)->getBeta();
+}
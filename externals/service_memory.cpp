@@ -47,6 +47,383 @@
 
 #include "service_memory.h"
 #include "service_service.h"
+#include "service_threading.h"
+#include "daal_atomic_int.h"
+
+namespace
+{
+
+/* Header stored in front of every pooled block. Its size keeps the user memory aligned by the default alignment */
+struct PooledBlockHeader
+{
+    size_t sizeClass;
+    PooledBlockHeader *next;
+};
+
+const size_t pooledHeaderSize      = daal::DAAL_MALLOC_DEFAULT_ALIGNMENT;
+const size_t pooledMinClassLog2    = 8;     /* 256 bytes */
+const size_t pooledMaxClassLog2    = 26;    /* 64 megabytes */
+const size_t pooledNSubClasses     = 4;     /* Classes between two powers of two, a block is at most 25% larger than requested */
+const size_t pooledNClasses        = (pooledMaxClassLog2 - pooledMinClassLog2) * pooledNSubClasses + 1;
+const size_t pooledNoClass         = (size_t)-1;
+const size_t pooledDefaultLimit    = 256 * 1024 * 1024;
+const size_t pooledBudgetNChunks   = 64;    /* The thread caches reserve the limit of the pool in 1/64 parts */
+
+size_t getClassSize(size_t sizeClass)
+{
+    if(sizeClass == 0) { return ((size_t)1 << pooledMinClassLog2); }
+    const size_t base = ((size_t)1 << (pooledMinClassLog2 + (sizeClass - 1) / pooledNSubClasses));
+    return base + ((sizeClass - 1) % pooledNSubClasses + 1) * (base / pooledNSubClasses);
+}
+
+size_t getSizeClass(size_t size)
+{
+    if(size <= getClassSize(0)) { return 0; }
+
+    /* 2^log2 < size <= 2^(log2 + 1) */
+    size_t log2 = pooledMinClassLog2;
+    while(((size_t)1 << (log2 + 1)) < size) { log2++; }
+    if(log2 >= pooledMaxClassLog2) { return pooledNoClass; }
+
+    const size_t base = ((size_t)1 << log2);
+    const size_t step = base / pooledNSubClasses;
+    return (log2 - pooledMinClassLog2) * pooledNSubClasses + (size - base + step - 1) / step;
+}
+
+void *toUserPtr(PooledBlockHeader *header) { return (char *)header + pooledHeaderSize; }
+
+void freeBlocks(PooledBlockHeader *header)
+{
+    while(header)
+    {
+        PooledBlockHeader *next = header->next;
+        daal::internal::Service<>::serv_free(header);
+        header = next;
+    }
+}
+
+/* Budget of the bytes cached by all the threads. The threads reserve the budget in chunks,
+ * so the lock of the budget is taken only when a thread cache grows or shrinks by a chunk */
+class PoolBudget
+{
+public:
+    PoolBudget(size_t limit) : _limit(limit), _reservedBytes(0) {}
+
+    /* Reserves at least minBytes and at least one chunk if it is left, returns 0 if less than minBytes is left.
+     * Returns the current size of the chunk in chunkSize */
+    size_t reserve(size_t minBytes, size_t &chunkSize)
+    {
+        daal::AutoLock lock(_mutex);
+        chunkSize = getChunkSize();
+        const size_t available = (_limit > _reservedBytes ? _limit - _reservedBytes : 0);
+        if(available < minBytes) { return 0; }
+        const size_t preferred = (minBytes > chunkSize ? minBytes : chunkSize);
+        const size_t reserved = (available < preferred ? available : preferred);
+        _reservedBytes += reserved;
+        return reserved;
+    }
+
+    void unreserve(size_t bytes)
+    {
+        daal::AutoLock lock(_mutex);
+        _reservedBytes -= bytes;
+    }
+
+    void setLimit(size_t limit)
+    {
+        daal::AutoLock lock(_mutex);
+        _limit = limit;
+    }
+
+    size_t getLimit()
+    {
+        daal::AutoLock lock(_mutex);
+        return _limit;
+    }
+
+private:
+    /* Size of the part of the budget reserved by a thread cache at once */
+    size_t getChunkSize() const
+    {
+        const size_t chunk = _limit / pooledBudgetNChunks;
+        return (chunk > getClassSize(0) ? chunk : getClassSize(0));
+    }
+
+    daal::Mutex _mutex;
+    size_t _limit;
+    size_t _reservedBytes;
+};
+
+/* Blocks cached by one thread. Only the owner thread takes blocks from the cache and returns blocks to it,
+ * so the lock of the cache is contended only when the pool is released, trimmed or queried.
+ * The cache holds a part of the budget of the pool that covers its blocks */
+class ThreadBlockCache
+{
+public:
+    ThreadBlockCache(PoolBudget &budget) : next(NULL), _budget(budget), _reservedBytes(0), _chunkSize(0), _nAllocations(0), _nReuses(0),
+        _nDeallocations(0), _nCachedBlocks(0), _cachedBytes(0)
+    {
+        for(size_t i = 0; i < pooledNClasses; i++)
+        {
+            _freeLists[i] = NULL;
+        }
+    }
+
+    ~ThreadBlockCache() { trim(0); }
+
+    PooledBlockHeader *pop(size_t sizeClass)
+    {
+        daal::AutoLock lock(_mutex);
+        _nAllocations++;
+        PooledBlockHeader *header = _freeLists[sizeClass];
+        if(header)
+        {
+            _freeLists[sizeClass] = header->next;
+            _nReuses++;
+            _nCachedBlocks--;
+            _cachedBytes -= getClassSize(sizeClass);
+
+            /* Give the unused budget back so that the other threads can cache their blocks */
+            if(_reservedBytes - _cachedBytes > 2 * _chunkSize)
+            {
+                const size_t unused = _reservedBytes - _cachedBytes - _chunkSize;
+                _budget.unreserve(unused);
+                _reservedBytes -= unused;
+            }
+        }
+        return header;
+    }
+
+    bool push(PooledBlockHeader *header)
+    {
+        const size_t classSize = getClassSize(header->sizeClass);
+        daal::AutoLock lock(_mutex);
+        _nDeallocations++;
+        if(_cachedBytes + classSize > _reservedBytes)
+        {
+            const size_t reserved = _budget.reserve(_cachedBytes + classSize - _reservedBytes, _chunkSize);
+            if(reserved == 0) { return false; }
+            _reservedBytes += reserved;
+        }
+
+        header->next = _freeLists[header->sizeClass];
+        _freeLists[header->sizeClass] = header;
+        _nCachedBlocks++;
+        _cachedBytes += classSize;
+        return true;
+    }
+
+    /* Frees the blocks of the largest classes until the cache holds at most bytesToKeep bytes
+     * and returns the budget that does not cover the remaining blocks */
+    void trim(size_t bytesToKeep)
+    {
+        PooledBlockHeader *released = NULL;
+        {
+            daal::AutoLock lock(_mutex);
+            for(size_t i = pooledNClasses; i > 0 && _cachedBytes > bytesToKeep; i--)
+            {
+                const size_t classSize = getClassSize(i - 1);
+                while(_freeLists[i - 1] && _cachedBytes > bytesToKeep)
+                {
+                    PooledBlockHeader *header = _freeLists[i - 1];
+                    _freeLists[i - 1] = header->next;
+                    header->next = released;
+                    released = header;
+                    _nCachedBlocks--;
+                    _cachedBytes -= classSize;
+                }
+            }
+            _budget.unreserve(_reservedBytes - _cachedBytes);
+            _reservedBytes = _cachedBytes;
+        }
+        freeBlocks(released);
+    }
+
+    void addStatistics(size_t &nAllocations, size_t &nReuses, size_t &nDeallocations, size_t &nCachedBlocks, size_t &cachedBytes)
+    {
+        daal::AutoLock lock(_mutex);
+        nAllocations   += _nAllocations;
+        nReuses        += _nReuses;
+        nDeallocations += _nDeallocations;
+        nCachedBlocks  += _nCachedBlocks;
+        cachedBytes    += _cachedBytes;
+    }
+
+    ThreadBlockCache *next;     /* Next cache in the list of the pool, guarded by the mutex of the pool */
+
+private:
+    daal::Mutex _mutex;
+    PoolBudget &_budget;
+    PooledBlockHeader *_freeLists[pooledNClasses];
+    size_t _reservedBytes;
+    size_t _chunkSize;          /* Size of the chunk of the budget at the last reservation */
+    size_t _nAllocations;
+    size_t _nReuses;
+    size_t _nDeallocations;
+    size_t _nCachedBlocks;
+    size_t _cachedBytes;
+};
+
+class BlockMemoryPool;
+BlockMemoryPool &getBlockMemoryPool();
+
+/* Owner of the cache of the calling thread. The cache is released when the thread exits */
+struct ThreadBlockCacheHolder
+{
+    ThreadBlockCacheHolder() : cache(NULL) {}
+    ~ThreadBlockCacheHolder();
+    ThreadBlockCache *cache;
+};
+
+/* Pool of the blocks cached by every thread. The limit of the pool applies to the blocks of all the threads.
+ * A block freed by a thread other than the one that allocated it goes to the cache of the freeing thread.
+ * The pool is disabled until it is enabled by Environment::enableMemoryPool() */
+class BlockMemoryPool
+{
+public:
+    BlockMemoryPool() : _enabled(0), _budget(pooledDefaultLimit), _caches(NULL), _nRetiredAllocations(0), _nRetiredReuses(0),
+        _nRetiredDeallocations(0)
+    {}
+
+    void *allocate(size_t size)
+    {
+        const size_t sizeClass = (_enabled.get() ? getSizeClass(size) : pooledNoClass);
+        if(sizeClass != pooledNoClass)
+        {
+            ThreadBlockCache *cache = getThreadCache();
+            PooledBlockHeader *header = (cache ? cache->pop(sizeClass) : NULL);
+            if(header) { return toUserPtr(header); }
+        }
+
+        const size_t allocSize = (sizeClass != pooledNoClass ? getClassSize(sizeClass) : size);
+        PooledBlockHeader *header = (PooledBlockHeader *)daal::internal::Service<>::serv_malloc(allocSize + pooledHeaderSize,
+                                    daal::DAAL_MALLOC_DEFAULT_ALIGNMENT);
+        if(!header) { return NULL; }
+        header->sizeClass = sizeClass;
+        header->next = NULL;
+        return toUserPtr(header);
+    }
+
+    void deallocate(void *ptr)
+    {
+        if(!ptr) { return; }
+        PooledBlockHeader *header = (PooledBlockHeader *)((char *)ptr - pooledHeaderSize);
+        if(header->sizeClass != pooledNoClass && _enabled.get())
+        {
+            ThreadBlockCache *cache = getThreadCache();
+            if(cache && cache->push(header)) { return; }
+        }
+        daal::internal::Service<>::serv_free(header);
+    }
+
+    void enable(bool enableFlag)
+    {
+        _enabled.set(enableFlag ? 1 : 0);
+        if(!enableFlag) { release(); }
+    }
+
+    bool isEnabled() const { return (_enabled.get() != 0); }
+
+    void setLimit(size_t limit)
+    {
+        daal::AutoLock lock(_mutex);
+        const size_t oldLimit = _budget.getLimit();
+        _budget.setLimit(limit);
+        if(limit >= oldLimit) { return; }
+
+        /* Shrink every cache in proportion to the new limit */
+        for(ThreadBlockCache *cache = _caches; cache; cache = cache->next)
+        {
+            size_t nAllocations = 0, nReuses = 0, nDeallocations = 0, nCachedBlocks = 0, cachedBytes = 0;
+            cache->addStatistics(nAllocations, nReuses, nDeallocations, nCachedBlocks, cachedBytes);
+            cache->trim(oldLimit ? (size_t)((double)cachedBytes * limit / oldLimit) : 0);
+        }
+    }
+
+    void release()
+    {
+        daal::AutoLock lock(_mutex);
+        for(ThreadBlockCache *cache = _caches; cache; cache = cache->next)
+        {
+            cache->trim(0);
+        }
+    }
+
+    void getStatistics(size_t &nAllocations, size_t &nReuses, size_t &nDeallocations, size_t &nCachedBlocks, size_t &cachedBytes)
+    {
+        nCachedBlocks = cachedBytes = 0;
+        daal::AutoLock lock(_mutex);
+        nAllocations   = _nRetiredAllocations;
+        nReuses        = _nRetiredReuses;
+        nDeallocations = _nRetiredDeallocations;
+        for(ThreadBlockCache *cache = _caches; cache; cache = cache->next)
+        {
+            cache->addStatistics(nAllocations, nReuses, nDeallocations, nCachedBlocks, cachedBytes);
+        }
+    }
+
+    /* Called from the thread that owns the cache when the thread exits */
+    void removeThreadCache(ThreadBlockCache *cache)
+    {
+        {
+            daal::AutoLock lock(_mutex);
+            for(ThreadBlockCache **link = &_caches; *link; link = &(*link)->next)
+            {
+                if(*link == cache)
+                {
+                    *link = cache->next;
+                    break;
+                }
+            }
+            size_t nCachedBlocks = 0, cachedBytes = 0;
+            cache->addStatistics(_nRetiredAllocations, _nRetiredReuses, _nRetiredDeallocations, nCachedBlocks, cachedBytes);
+        }
+        delete cache;
+    }
+
+private:
+    ThreadBlockCache *getThreadCache()
+    {
+        static thread_local ThreadBlockCacheHolder holder;
+        if(!holder.cache) { holder.cache = createThreadCache(); }
+        return holder.cache;
+    }
+
+    /* Called once for every thread on its first pooled allocation or deallocation */
+    ThreadBlockCache *createThreadCache()
+    {
+        daal::AutoLock lock(_mutex);
+        ThreadBlockCache *cache = new ThreadBlockCache(_budget);
+        if(cache)
+        {
+            cache->next = _caches;
+            _caches = cache;
+        }
+        return cache;
+    }
+
+    daal::services::Atomic<int> _enabled;
+    daal::Mutex _mutex;                         /* Guards the list of the thread caches and the retired statistics */
+    PoolBudget _budget;
+    ThreadBlockCache *_caches;
+    size_t _nRetiredAllocations;                /* Statistics of the caches of the exited threads */
+    size_t _nRetiredReuses;
+    size_t _nRetiredDeallocations;
+};
+
+ThreadBlockCacheHolder::~ThreadBlockCacheHolder()
+{
+    if(cache) { getBlockMemoryPool().removeThreadCache(cache); }
+}
+
+/* The pool is never destroyed: blocks owned by static objects can be returned to it during program termination */
+BlockMemoryPool &getBlockMemoryPool()
+{
+    static BlockMemoryPool *pool = new BlockMemoryPool();
+    return *pool;
+}
+
+} // namespace
 
 void *daal::services::daal_malloc(size_t size, size_t alignment)
 {
@@ -79,3 +456,39 @@ void daal::services::daal_memcpy_s(void *dest, size_t destSize, const void *src,
         daal::internal::Service<>::serv_memcpy_s(&dstChar[nBlocks * BLOCKSIZE], sizeOfLastBlock, &srcChar[nBlocks * BLOCKSIZE], sizeOfLastBlock);
     }
 }
+
+void *daal::services::daal_pooled_malloc(size_t size)
+{
+    return getBlockMemoryPool().allocate(size);
+}
+
+void daal::services::daal_pooled_free(void *ptr)
+{
+    getBlockMemoryPool().deallocate(ptr);
+}
+
+void daal::services::internal::enableMemoryPool(bool enableFlag)
+{
+    getBlockMemoryPool().enable(enableFlag);
+}
+
+bool daal::services::internal::isMemoryPoolEnabled()
+{
+    return getBlockMemoryPool().isEnabled();
+}
+
+void daal::services::internal::setMemoryPoolLimit(size_t limitInBytes)
+{
+    getBlockMemoryPool().setLimit(limitInBytes);
+}
+
+void daal::services::internal::releaseMemoryPool()
+{
+    getBlockMemoryPool().release();
+}
+
+void daal::services::internal::getMemoryPoolStatistics(size_t &nAllocations, size_t &nReuses, size_t &nDeallocations,
+                                                       size_t &nCachedBlocks, size_t &cachedBytes)
+{
+    getBlockMemoryPool().getStatistics(nAllocations, nReuses, nDeallocations, nCachedBlocks, cachedBytes);
+}
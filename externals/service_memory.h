@@ -97,6 +97,45 @@ void service_free(T * ptr)
 }
 
 
+template<typename T, CpuType cpu>
+T *service_pooled_malloc(size_t size)
+{
+    return (T *)daal::services::daal_pooled_malloc(size * sizeof(T));
+}
+
+template<typename T, CpuType cpu>
+T *service_pooled_calloc(size_t size)
+{
+    T *ptr = (T *)daal::services::daal_pooled_malloc(size * sizeof(T));
+    if( ptr == NULL ) { return NULL; }
+
+    char *cptr = (char *)ptr;
+    size_t sizeInBytes = size * sizeof(T);
+
+    for (size_t i = 0; i < sizeInBytes; i++)
+    {
+        cptr[i] = '\0';
+    }
+
+    return ptr;
+}
+
+template<typename T, CpuType cpu>
+void service_pooled_free(T * ptr)
+{
+    daal::services::daal_pooled_free(ptr);
+
+    return;
+}
+
+/* Control of the pool of reusable memory blocks behind daal_pooled_malloc */
+void enableMemoryPool(bool enableFlag);
+bool isMemoryPoolEnabled();
+void setMemoryPoolLimit(size_t limitInBytes);
+void releaseMemoryPool();
+void getMemoryPoolStatistics(size_t &nAllocations, size_t &nReuses, size_t &nDeallocations, size_t &nCachedBlocks, size_t &cachedBytes);
+
+
 template<typename T, CpuType cpu>
 T *service_scalable_calloc(size_t size, size_t alignment = 64)
 {
@@ -91,6 +91,30 @@ public:
     virtual services::Status compute() DAAL_C11_OVERRIDE;
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__CHOLESKY__BATCHCONTAINER_ALGORITHMFPTYPE_BATCHEDDENSE_CPU"></a>
+ * \brief Provides methods to run implementations of the Cholesky decomposition algorithm for a batch of small matrices.
+ *        This class is associated with daal::algorithms::cholesky::Batch class.
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the Cholesky decomposition algorithm, double or float
+ */
+template<typename algorithmFPType, CpuType cpu>
+class DAAL_EXPORT BatchContainer<algorithmFPType, batchedDense, cpu> : public daal::algorithms::AnalysisContainerIface<batch>
+{
+public:
+    /**
+     * Constructs a container for the Cholesky decomposition algorithm with a specified environment
+     * \param[in] daalEnv   Environment object
+     */
+    BatchContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    ~BatchContainer();
+    /**
+     * Computes the result of the Cholesky decomposition algorithm in the batch processing mode
+     */
+    virtual services::Status compute() DAAL_C11_OVERRIDE;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__CHOLESKY__BATCH"></a>
  * \brief Computes Cholesky decomposition in the batch processing mode.
@@ -51,6 +51,7 @@
 #include "algorithms/algorithm.h"
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/homogen_tensor.h"
 #include "services/daal_defines.h"
 
 namespace daal
@@ -74,7 +75,9 @@ namespace cholesky
  */
 enum Method
 {
-    defaultDense = 0       /*!< Default: performance-oriented method. */
+    defaultDense = 0,      /*!< Default: performance-oriented method. */
+    batchedDense = 1       /*!< Decomposition of a batch of small matrices stored in a tensor, with optional solution
+                                of the linear systems */
 };
 
 /**
@@ -87,6 +90,18 @@ enum InputId
     lastInputId = data
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__CHOLESKY__BATCHEDINPUTID"></a>
+ * Available identifiers of input objects for the Cholesky algorithm that uses the batchedDense method
+ */
+enum BatchedInputId
+{
+    matrices = lastInputId + 1,  /*!< %Input tensor of size nMatrices x k x k that contains symmetric positive-definite matrices */
+    rightHandSides,              /*!< Optional input tensor of size nMatrices x nRhs x k that contains right-hand sides
+                                      of the linear systems */
+    lastBatchedInputId = rightHandSides
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__CHOLESKY__RESULTID"></a>
  * Available identifiers of results for the Cholesky algorithm
@@ -97,6 +112,19 @@ enum ResultId
     lastResultId = choleskyFactor
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__CHOLESKY__BATCHEDRESULTID"></a>
+ * Available identifiers of results for the Cholesky algorithm that uses the batchedDense method
+ */
+enum BatchedResultId
+{
+    choleskyFactors = lastResultId + 1,  /*!< Tensor of size nMatrices x k x k. Contains the lower triangle matrices L
+                                              of the decompositions */
+    solutions,                           /*!< Tensor of size nMatrices x nRhs x k. Contains solutions of the linear systems,
+                                              computed if the right-hand sides are provided */
+    lastBatchedResultId = solutions
+};
+
 /**
  * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
  */
@@ -128,6 +156,20 @@ public:
      */
     void set(InputId id, const data_management::NumericTablePtr &ptr);
 
+    /**
+     * Returns input tensor of the Cholesky algorithm
+     * \param[in] id    Identifier of the input tensor
+     * \return          %Input tensor that corresponds to the given identifier
+     */
+    data_management::TensorPtr get(BatchedInputId id) const;
+
+    /**
+     * Sets input tensor for the Cholesky algorithm
+     * \param[in] id    Identifier of the input object
+     * \param[in] ptr   Pointer to the object
+     */
+    void set(BatchedInputId id, const data_management::TensorPtr &ptr);
+
     /**
      * Checks parameters of the Cholesky algorithm
      * \param[in] par     %Parameter of algorithm
@@ -175,6 +217,20 @@ public:
      */
     void set(ResultId id, const data_management::NumericTablePtr &ptr);
 
+    /**
+     * Returns result tensor of the Cholesky algorithm
+     * \param[in] id   Identifier of the result
+     * \return         Final result that corresponds to the given identifier
+     */
+    data_management::TensorPtr get(BatchedResultId id) const;
+
+    /**
+     * Sets the result tensor of the Cholesky algorithm
+     * \param[in] id    Identifier of the result
+     * \param[in] ptr   Pointer to the result
+     */
+    void set(BatchedResultId id, const data_management::TensorPtr &ptr);
+
     /**
      * Checks the result of the Cholesky algorithm
      * \param[in] input   %Input of algorithm
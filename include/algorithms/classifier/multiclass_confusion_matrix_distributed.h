@@ -0,0 +1,317 @@
+/* file: multiclass_confusion_matrix_distributed.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Interface for the multi-class confusion matrix algorithm in the distributed processing mode
+//--
+*/
+
+#ifndef __MULTICLASS_CONFUSION_MATRIX_DISTRIBUTED_H__
+#define __MULTICLASS_CONFUSION_MATRIX_DISTRIBUTED_H__
+
+#include "algorithms/algorithm.h"
+#include "algorithms/classifier/multiclass_confusion_matrix_types.h"
+#include "algorithms/classifier/multiclass_confusion_matrix_online.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace classifier
+{
+namespace quality_metric
+{
+namespace multiclass_confusion_matrix
+{
+
+namespace interface1
+{
+/**
+ * @defgroup quality_metric_multiclass_distributed Distributed
+ * @ingroup quality_metric_multiclass
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__CLASSIFIER__QUALITY_METRIC__MULTICLASS_CONFUSION_MATRIX__DISTRIBUTEDCONTAINER"></a>
+ * \brief Class containing methods to compute the confusion matrix for the multi-class classifier
+ *        in the distributed processing mode
+ * \tparam step             Step of distributed processing, \ref ComputeStep
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the multi-class confusion matrix, double or float
+ * \tparam method           Method for computing the multi-class confusion matrix, \ref Method
+ */
+template<ComputeStep step, typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT DistributedContainer
+{};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__CLASSIFIER__QUALITY_METRIC__MULTICLASS_CONFUSION_MATRIX__DISTRIBUTEDCONTAINER_STEP2MASTER_ALGORITHMFPTYPE_METHOD_CPU"></a>
+ * \brief Class containing methods to compute the confusion matrix for the multi-class classifier
+ *        in the second step of the distributed processing mode
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT DistributedContainer<step2Master, algorithmFPType, method, cpu> :
+    public daal::algorithms::AnalysisContainerIface<distributed>
+{
+public:
+    /**
+     * Constructs a container for the multi-class confusion matrix algorithm with a specified environment
+     * in the second step of the distributed processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    DistributedContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    virtual ~DistributedContainer();
+    /**
+     * Merges the partial confusion matrices computed on local nodes
+     */
+    virtual services::Status compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes the confusion matrix and the quality metrics from the merged partial confusion matrix
+     */
+    virtual services::Status finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__CLASSIFIER__QUALITY_METRIC__MULTICLASS_CONFUSION_MATRIX__DISTRIBUTED"></a>
+ * \brief Computes the confusion matrix for a multi-class classifier in the distributed processing mode.
+ * \tparam step             Step of distributed processing, \ref ComputeStep
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the multi-class confusion matrix, double or float
+ * \tparam method           Method for computing the multi-class confusion matrix, \ref Method
+ *
+ * \par Enumerations
+ *      - \ref Method               Method for computing the multi-class confusion matrix
+ *      - \ref InputId              Identifiers of input objects for the multi-class confusion matrix algorithm
+ *      - \ref MasterInputId        Identifiers of input objects on the master node
+ *      - \ref PartialResultId      Identifiers of partial results of the multi-class confusion matrix algorithm
+ *      - \ref ResultId             Result identifiers for the multi-class confusion matrix algorithm
+ */
+template<ComputeStep step, typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class DAAL_EXPORT Distributed {};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__CLASSIFIER__QUALITY_METRIC__MULTICLASS_CONFUSION_MATRIX__DISTRIBUTED_STEP1LOCAL_ALGORITHMFPTYPE_METHOD"></a>
+ * \brief Accumulates the partial confusion matrix on a local node in the first step of the distributed processing mode
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the multi-class confusion matrix, double or float
+ * \tparam method           Method for computing the multi-class confusion matrix, \ref Method
+ */
+template<typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step1Local, algorithmFPType, method> : public Online<algorithmFPType, method>
+{
+public:
+    /**
+     * Default constructor
+     * \param[in] nClasses  Number of classes
+     */
+    Distributed(size_t nClasses = 2) : Online<algorithmFPType, method>(nClasses)
+    {}
+
+    /**
+     * Constructs a confusion matrix algorithm by copying input objects and parameters
+     * of another confusion matrix algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step1Local, algorithmFPType, method> &other) : Online<algorithmFPType, method>(other)
+    {}
+
+    /**
+     * Returns a pointer to the newly allocated confusion matrix algorithm with a copy of input objects
+     * and parameters of this confusion matrix algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step1Local, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step1Local, algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Distributed<step1Local, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step1Local, algorithmFPType, method>(*this);
+    }
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__CLASSIFIER__QUALITY_METRIC__MULTICLASS_CONFUSION_MATRIX__DISTRIBUTED_STEP2MASTER_ALGORITHMFPTYPE_METHOD"></a>
+ * \brief Merges the partial confusion matrices and computes the quality metrics on the master node
+ *        in the second step of the distributed processing mode
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the multi-class confusion matrix, double or float
+ * \tparam method           Method for computing the multi-class confusion matrix, \ref Method
+ */
+template<typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step2Master, algorithmFPType, method> : public daal::algorithms::Analysis<distributed>
+{
+public:
+    DistributedInput<step2Master> input;    /*!< %Input objects of the algorithm */
+    Parameter parameter;                    /*!< Parameters of the algorithm */
+
+    /**
+     * Default constructor
+     * \param[in] nClasses  Number of classes
+     */
+    Distributed(size_t nClasses = 2) : parameter(nClasses)
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs a confusion matrix algorithm by copying input objects and parameters
+     * of another confusion matrix algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step2Master, algorithmFPType, method> &other) : input(other.input), parameter(other.parameter)
+    {
+        initialize();
+    }
+
+    /**
+     * Returns the method of the algorithm
+     * \return Method of the algorithm
+     */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int) method; }
+
+    /**
+     * Returns the structure that contains results of the multi-class confusion matrix algorithm
+     * \return Structure that contains results of the multi-class confusion matrix algorithm
+     */
+    ResultPtr getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Registers user-allocated memory to store results of the multi-class confusion matrix algorithm
+     * \param[in] result  Structure to store results of the multi-class confusion matrix algorithm
+     */
+    services::Status setResult(const ResultPtr& result)
+    {
+        DAAL_CHECK(result, services::ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns the structure that contains the merged partial results of the multi-class confusion matrix algorithm
+     * \return Structure that contains the merged partial results
+     */
+    PartialResultPtr getPartialResult()
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Registers user-allocated memory to store the merged partial results of the multi-class confusion matrix algorithm
+     * \param[in] partialResult  Structure to store the merged partial results
+     * \param[in] initFlag       Flag that specifies whether the partial results are initialized
+     */
+    services::Status setPartialResult(const PartialResultPtr& partialResult, bool initFlag = false)
+    {
+        DAAL_CHECK(partialResult, services::ErrorNullPartialResult)
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+        setInitFlag(initFlag);
+        return services::Status();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated confusion matrix algorithm with a copy of input objects
+     * and parameters of this confusion matrix algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step2Master, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step2Master, algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Distributed<step2Master, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step2Master, algorithmFPType, method>(*this);
+    }
+
+    virtual services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _result->allocate<algorithmFPType>(_pres, &parameter, (int) method);
+        _res = _result.get();
+        return s;
+    }
+
+    virtual services::Status allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _partialResult->allocate<algorithmFPType>(&input, &parameter, (int) method);
+        _pres = _partialResult.get();
+        return s;
+    }
+
+    virtual services::Status initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _partialResult->initialize<algorithmFPType>(&input, &parameter, (int) method);
+        _pres = _partialResult.get();
+        return s;
+    }
+
+    void initialize()
+    {
+        Analysis<distributed>::_ac = new __DAAL_ALGORITHM_CONTAINER(distributed, DistributedContainer, step2Master, algorithmFPType, method)(&_env);
+        _in = &input;
+        _par = &parameter;
+        _result.reset(new Result());
+        _partialResult.reset(new PartialResult());
+    }
+
+private:
+    PartialResultPtr _partialResult;
+    ResultPtr _result;
+};
+/** @} */
+} // namespace interface1
+using interface1::DistributedContainer;
+using interface1::Distributed;
+
+}
+}
+}
+}
+}
+#endif
@@ -50,6 +50,7 @@
 
 #include "algorithms/algorithm.h"
 #include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/data_collection.h"
 
 namespace daal
 {
@@ -99,11 +100,32 @@ enum InputId
  */
 enum ResultId
 {
-    confusionMatrix,        /*!< Confusion matrix */
+    confusionMatrix,        /*!< Confusion matrix, the counts are stored in double precision for any floating-point type */
     multiClassMetrics,        /*!< Table that contains quality metrics (precision, recall, etc.) for binary classifiers */
     lastResultId = multiClassMetrics
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__CLASSIFIER__QUALITY_METRIC__MULTICLASS_CONFUSION_MATRIX__PARTIALRESULTID"></a>
+ * Available identifiers of partial results of the confusion matrix algorithm
+ * in the online and distributed processing modes
+ */
+enum PartialResultId
+{
+    partialConfusionMatrix,     /*!< Confusion matrix accumulated over the processed blocks of labels */
+    lastPartialResultId = partialConfusionMatrix
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__CLASSIFIER__QUALITY_METRIC__MULTICLASS_CONFUSION_MATRIX__MASTERINPUTID"></a>
+ * Available identifiers of input objects of the confusion matrix algorithm on the master node
+ */
+enum MasterInputId
+{
+    partialResults,         /*!< Collection of partial results computed on local nodes */
+    lastMasterInputId = partialResults
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__CLASSIFIER__QUALITY_METRIC__MULTICLASS_CONFUSION_MATRIX__MULTICLASSMETRICSID"></a>
  * Available values stored in a numeric table corresponding to the ResultId::binaryMatrix index
@@ -214,6 +236,15 @@ public:
     template<typename algorithmFPType>
     DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
 
+    /**
+     * Allocates memory for storing the computed quality metric from the partial result
+     * \param[in] partialResult Pointer to the partial result structure
+     * \param[in] parameter     Pointer to the parameter structure
+     * \param[in] method        Computation method of the algorithm
+     */
+    template<typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method);
+
     /**
      * Checks the correctness of the Result object
      * \param[in] input     Pointer to the input structure
@@ -222,6 +253,14 @@ public:
      */
     services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
 
+    /**
+     * Checks the correctness of the Result object computed from the partial result
+     * \param[in] partialResult Pointer to the partial result structure
+     * \param[in] parameter     Pointer to the structure of the algorithm parameters
+     * \param[in] method        Computation method
+     */
+    services::Status check(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
 protected:
     /** \private */
     template<typename Archive, bool onDeserialize>
@@ -231,12 +270,138 @@ protected:
     }
 };
 typedef services::SharedPtr<Result> ResultPtr;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__CLASSIFIER__QUALITY_METRIC__MULTICLASS_CONFUSION_MATRIX__PARTIALRESULT"></a>
+ * \brief Partial results obtained with the compute() method of the multi-class confusion matrix algorithm
+ *        in the online and distributed processing modes.
+ *        Partial results computed on different blocks of labels are merged by summation
+ */
+class DAAL_EXPORT PartialResult : public daal::algorithms::PartialResult
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(PartialResult);
+    PartialResult();
+    virtual ~PartialResult() {}
+
+    /**
+     * Returns the partial result of the multi-class confusion matrix algorithm
+     * \param[in] id    Identifier of the partial result, \ref PartialResultId
+     * \return          Partial result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(PartialResultId id) const;
+
+    /**
+     * Sets the partial result of the multi-class confusion matrix algorithm
+     * \param[in] id    Identifier of the partial result, \ref PartialResultId
+     * \param[in] value Pointer to the partial result
+     */
+    void set(PartialResultId id, const data_management::NumericTablePtr &value);
+
+    /**
+     * Allocates memory for storing partial results of the multi-class confusion matrix algorithm.
+     * The counts are stored in double precision to be exact for any practical number of observations
+     * \param[in] input     Pointer to the input structure
+     * \param[in] parameter Pointer to the parameter structure
+     * \param[in] method    Computation method of the algorithm
+     */
+    template<typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Initializes partial results of the multi-class confusion matrix algorithm with zeros
+     * \param[in] input     Pointer to the input structure
+     * \param[in] parameter Pointer to the parameter structure
+     * \param[in] method    Computation method of the algorithm
+     */
+    template<typename algorithmFPType>
+    DAAL_EXPORT services::Status initialize(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Checks the correctness of the PartialResult object
+     * \param[in] input     Pointer to the input structure
+     * \param[in] parameter Pointer to the structure of the algorithm parameters
+     * \param[in] method    Computation method
+     */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks the correctness of the PartialResult object
+     * \param[in] parameter Pointer to the structure of the algorithm parameters
+     * \param[in] method    Computation method
+     */
+    services::Status check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<PartialResult> PartialResultPtr;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__CLASSIFIER__QUALITY_METRIC__MULTICLASS_CONFUSION_MATRIX__DISTRIBUTEDINPUT"></a>
+ * \brief %Input objects of the multi-class confusion matrix algorithm in the distributed processing mode
+ *
+ * \tparam step             Step of distributed processing, \ref ComputeStep
+ */
+template<ComputeStep step>
+class DAAL_EXPORT DistributedInput
+{};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__CLASSIFIER__QUALITY_METRIC__MULTICLASS_CONFUSION_MATRIX__DISTRIBUTEDINPUT_STEP2MASTER"></a>
+ * \brief %Input objects of the multi-class confusion matrix algorithm on the master node
+ */
+template<>
+class DAAL_EXPORT DistributedInput<step2Master> : public daal::algorithms::Input
+{
+public:
+    DistributedInput();
+    DistributedInput(const DistributedInput& other) : daal::algorithms::Input(other) {}
+
+    virtual ~DistributedInput() {}
+
+    /**
+     * Adds a partial result to the collection of input objects of the algorithm on the master node
+     * \param[in] id            Identifier of the input object, \ref MasterInputId
+     * \param[in] partialResult Partial result computed on a local node
+     */
+    void add(MasterInputId id, const PartialResultPtr &partialResult);
+
+    /**
+     * Sets the input object of the algorithm on the master node
+     * \param[in] id    Identifier of the input object, \ref MasterInputId
+     * \param[in] ptr   Pointer to the collection of partial results
+     */
+    void set(MasterInputId id, const data_management::DataCollectionPtr &ptr);
+
+    /**
+     * Returns the collection of input objects of the algorithm on the master node
+     * \param[in] id    Identifier of the input object, \ref MasterInputId
+     * \return          Collection of partial results
+     */
+    data_management::DataCollectionPtr get(MasterInputId id) const;
+
+    /**
+     * Checks the correctness of the input objects on the master node
+     * \param[in] parameter Pointer to the structure of the algorithm parameters
+     * \param[in] method    Computation method
+     */
+    services::Status check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+};
 } // namespace interface1
 using interface1::Parameter;
 using interface1::Input;
 using interface1::InputPtr;
 using interface1::Result;
 using interface1::ResultPtr;
+using interface1::PartialResult;
+using interface1::PartialResultPtr;
+using interface1::DistributedInput;
 
 } // namespace daal::algorithms::classifier::quality_metric::multiclass_confusion_matrix
 /** @} */
@@ -76,11 +76,12 @@ enum Method
                                      Works with all types of numeric tables */
     sumDense        = 2,        /*!< Precomputed sum: implementation of moments computation algorithm in the case of a precomputed sum.
                                      Works with all types of numeric tables */
-    fastCSR         = 3,        /*!< Fast: performance-oriented method. Works with Compressed Sparse Rows (CSR) numeric tables */
+    fastCSR         = 3,        /*!< Fast: performance-oriented method. Works with Compressed Sparse Rows (CSR) numeric tables.
+                                     Also supports BSR numeric tables and CSC numeric tables, which are converted into the CSR layout */
     singlePassCSR   = 4,        /*!< Single-pass: implementation of the single-pass algorithm proposed by D.H.D. West.
-                                     Works with CSR numeric tables */
+                                     Works with CSR, CSC and BSR numeric tables */
     sumCSR          = 5         /*!< Precomputed sum: implementation of the algorithm in the case of a precomputed sum.
-                                     Works with CSR numeric tables */
+                                     Works with CSR, CSC and BSR numeric tables */
 };
 
 /**
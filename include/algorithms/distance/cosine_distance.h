@@ -122,7 +122,7 @@ public:
      * \param[in] other An algorithm to be used as the source to initialize the input objects
      *                  and parameters of the algorithm
      */
-    Batch(const Batch<algorithmFPType, method> &other) : input(other.input)
+    Batch(const Batch<algorithmFPType, method> &other) : parameter(other.parameter), input(other.input)
     {
         initialize();
     }
@@ -172,7 +172,7 @@ protected:
 
     virtual services::Status allocateResult() DAAL_C11_OVERRIDE
     {
-        services::Status s = _result->allocate<algorithmFPType>(&input, NULL, (int) method);
+        services::Status s = _result->allocate<algorithmFPType>(&input, &parameter, (int) method);
         _res = _result.get();
         return s;
     }
@@ -181,10 +181,12 @@ protected:
     {
         Analysis<batch>::_ac = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
         _in = &input;
+        _par = &parameter;
         _result.reset(new Result());
     }
 
 public:
+    Parameter parameter; /*!< Parameters of the algorithm */
     Input input;         /*!< %Input objects of the algorithm */
 
 private:
@@ -86,7 +86,8 @@ enum Method
 enum InputId
 {
     data,            /*!< %Input data table */
-    lastInputId = data
+    secondData,      /*!< Optional input data table, distances are computed between the rows of data and the rows of this table if it is set */
+    lastInputId = secondData
 };
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__COSINE_DISTANCE__RESULTID"></a>
@@ -95,7 +96,9 @@ enum InputId
 enum ResultId
 {
     cosineDistance,           /*!< Table to store the result.*/
-    lastResultId = cosineDistance
+    nearestIndices,           /*!< Table to store the indices of the k nearest rows for each row of the input data */
+    nearestDistances,         /*!< Table to store the distances to the k nearest rows for each row of the input data */
+    lastResultId = nearestDistances
 };
 
 /**
@@ -103,6 +106,27 @@ enum ResultId
  */
 namespace interface1
 {
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__COSINE_DISTANCE__PARAMETER"></a>
+ * \brief Parameters of the cosine distance algorithm
+ *
+ * \snippet distance/cosine_distance_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
+{
+    /**
+     *  Constructs parameters of the cosine distance algorithm
+     *  \param[in] k   Number of nearest rows to compute for each row of the input data
+     */
+    Parameter(size_t k = 0);
+
+    size_t k;   /*!< Number of nearest rows to compute for each row of the input data.
+                     The nearest rows are searched in secondData if it is set, and among the other rows of data otherwise.
+                     If k is 0, the full matrix of distances is computed */
+};
+/* [Parameter source code] */
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__COSINE_DISTANCE__INPUT"></a>
  * \brief %Input objects for the cosine distance algorithm
@@ -191,6 +215,7 @@ protected:
 typedef services::SharedPtr<Result> ResultPtr;
 /** @} */
 } // namespace interface1
+using interface1::Parameter;
 using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
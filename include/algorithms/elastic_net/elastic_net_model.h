@@ -0,0 +1,147 @@
+/* file: elastic_net_model.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the class defining the elastic net regression model
+//--
+*/
+
+#ifndef __ELASTIC_NET_MODEL_H__
+#define __ELASTIC_NET_MODEL_H__
+
+#include "data_management/data/numeric_table.h"
+#include "algorithms/linear_model/linear_model_model.h"
+
+namespace daal
+{
+namespace algorithms
+{
+/**
+ * @defgroup elastic_net Elastic Net Regression
+ * \copydoc daal::algorithms::elastic_net
+ * @ingroup linear_model
+ */
+/**
+ * \brief Contains classes of the elastic net regression algorithm. The lasso regression is
+ *        the elastic net regression with zero L2 regularization coefficient
+ */
+namespace elastic_net
+{
+
+/**
+ * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * @ingroup elastic_net
+ * @{
+ */
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__ELASTIC_NET__PARAMETER"></a>
+ * \brief Parameters for the elastic net regression algorithm
+ *
+ * \snippet elastic_net/elastic_net_model.h Parameter source code
+ */
+/* [Parameter source code] */
+struct Parameter : public linear_model::Parameter
+{
+};
+/* [Parameter source code] */
+
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__ELASTIC_NET__TRAINPARAMETER"></a>
+ * \brief Parameters for elastic net regression model-based training.
+ *        The coefficients minimize 1/(2n) |y - beta_0 - X beta|^2 + penaltyL1 * |beta|_1 + penaltyL2 * |beta|_2^2
+ *        for each dependent variable; the features are not standardized
+ *
+ * \snippet elastic_net/elastic_net_model.h TrainParameter source code
+ */
+/* [TrainParameter source code] */
+struct DAAL_EXPORT TrainParameter : public Parameter
+{
+    TrainParameter();
+
+    services::Status check() const DAAL_C11_OVERRIDE;
+
+    double penaltyL1;           /*!< L1 regularization coefficient */
+    double penaltyL2;           /*!< L2 regularization coefficient */
+    size_t nPenalties;          /*!< Number of points of the regularization path. The L1 regularization coefficient decreases geometrically
+                                     from the smallest value that gives zero coefficients to penaltyL1, the coefficients for each point are
+                                     computed starting from the coefficients for the previous point */
+    size_t nIterations;         /*!< Maximal number of passes of the coordinate descent over the coefficients for each point of the path */
+    double accuracyThreshold;   /*!< Accuracy of the coordinate descent */
+    bool   screeningFlag;       /*!< Flag that indicates whether the strong rules are used to discard the features */
+};
+/* [TrainParameter source code] */
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__ELASTIC_NET__MODEL"></a>
+ * \brief %Model trained with the elastic net regression algorithm
+ *
+ * \par References
+ *      - \ref training::interface1::Batch "training::Batch" class
+ *      - \ref prediction::interface1::Batch "prediction::Batch" class
+ */
+class DAAL_EXPORT Model : public linear_model::Model
+{
+public:
+    DECLARE_MODEL(Model, linear_model::Model);
+
+    virtual ~Model() {}
+};
+typedef services::SharedPtr<Model> ModelPtr;
+typedef services::SharedPtr<const Model> ModelConstPtr;
+/** @} */
+} // namespace interface1
+
+using interface1::Parameter;
+using interface1::TrainParameter;
+using interface1::Model;
+using interface1::ModelPtr;
+using interface1::ModelConstPtr;
+
+} // namespace elastic_net
+} // namespace algorithms
+} // namespace daal
+
+#endif
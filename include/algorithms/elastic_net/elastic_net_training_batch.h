@@ -0,0 +1,197 @@
+/* file: elastic_net_training_batch.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for elastic net regression model-based training in the batch processing mode
+//--
+*/
+
+#ifndef __ELASTIC_NET_TRAINING_BATCH_H__
+#define __ELASTIC_NET_TRAINING_BATCH_H__
+
+#include "algorithms/algorithm.h"
+#include "services/daal_defines.h"
+#include "services/daal_memory.h"
+#include "algorithms/elastic_net/elastic_net_training_types.h"
+#include "algorithms/elastic_net/elastic_net_model.h"
+#include "algorithms/linear_model/linear_model_training_batch.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace elastic_net
+{
+namespace training
+{
+namespace interface1
+{
+/**
+ * @defgroup elastic_net_batch Batch
+ * @ingroup elastic_net_training
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__ELASTIC_NET__TRAINING__BATCHCONTAINER"></a>
+ * \brief Class containing methods for coordinate descent elastic net regression model-based training using algorithmFPType precision arithmetic
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT BatchContainer : public TrainingContainerIface<batch>
+{
+public:
+    /**
+     * Constructs a container for elastic net regression model-based training with a specified environment in the batch processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    BatchContainer(daal::services::Environment::env *daalEnv);
+
+    /** Default destructor */
+    ~BatchContainer();
+
+    /**
+     * Computes the result of elastic net regression model-based training in the batch processing mode
+     *
+     * \return Status of computations
+     */
+    services::Status compute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__ELASTIC_NET__TRAINING__BATCH"></a>
+ * \brief Provides methods for elastic net regression model-based training in the batch processing mode
+ * <!-- \n<a href="DAAL-REF-ELASTICNET-ALGORITHM">Elastic net regression algorithm description and usage models</a> -->
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for elastic net regression model-based training, double or float
+ * \tparam method           Elastic net regression training method, \ref Method
+ *
+ * \par Enumerations
+ *      - \ref Method  Computation methods
+ *
+ * \par References
+ *      - \ref elastic_net::interface1::Model "elastic_net::Model" class
+ *      - \ref prediction::interface1::Batch "prediction::Batch" class
+ */
+template<typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class DAAL_EXPORT Batch : public linear_model::training::Batch
+{
+public:
+    Input input; /*!< %Input data structure */
+    TrainParameter parameter; /*!< %Training \ref interface1::Parameter "parameters" */
+
+    /** Default constructor */
+    Batch()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs an elastic net regression training algorithm by copying input objects
+     * and parameters of another elastic net regression training algorithm in the batch processing mode
+     * \param[in] other Algorithm to use as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Batch(const Batch<algorithmFPType, method> &other) : input(other.input), parameter(other.parameter)
+    {
+        initialize();
+    }
+
+    ~Batch() {}
+
+    virtual regression::training::Input* getInput() DAAL_C11_OVERRIDE { return &input; }
+
+    /**
+     * Returns the method of the algorithm
+     * \return Method of the algorithm
+     */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Returns the structure that contains the result of elastic net regression model-based training
+     * \return Structure that contains the result of elastic net regression model-based training
+     */
+    ResultPtr getResult() { return Result::cast(_result); }
+
+    /**
+     * Returns a pointer to a newly allocated elastic net regression training algorithm
+     * with a copy of the input objects and parameters for this elastic net regression training algorithm
+     * in the batch processing mode
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Batch<algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+
+    virtual Batch<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Batch<algorithmFPType, method>(*this);
+    }
+
+    services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = getResult()->template allocate<algorithmFPType>(&input, &parameter, method);
+        _res = _result.get();
+        return s;
+    }
+
+    void initialize()
+    {
+        _ac  = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
+        _in = &input;
+        _par = &parameter;
+        _result.reset(new Result());
+    }
+};
+/** @} */
+} // namespace interface1
+
+using interface1::BatchContainer;
+using interface1::Batch;
+
+} // namespace training
+} // namespace elastic_net
+} // namespace algorithms
+} // namespace daal
+
+#endif
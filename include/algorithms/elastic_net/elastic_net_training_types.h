@@ -0,0 +1,227 @@
+/* file: elastic_net_training_types.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the elastic net regression algorithm interface
+//--
+*/
+
+#ifndef __ELASTIC_NET_TRAINING_TYPES_H__
+#define __ELASTIC_NET_TRAINING_TYPES_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "algorithms/elastic_net/elastic_net_model.h"
+#include "algorithms/linear_model/linear_model_training_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace elastic_net
+{
+/**
+ * @defgroup elastic_net_training Training
+ * \copydoc daal::algorithms::elastic_net::training
+ * @ingroup elastic_net
+ * @{
+ */
+/**
+ * \brief Contains a class for elastic net regression model-based training
+ */
+namespace training
+{
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__ELASTIC_NET__TRAINING__METHOD"></a>
+ * \brief Computation methods for elastic net regression model-based training
+ */
+enum Method
+{
+    defaultDense = 0,           /*!< Coordinate descent method */
+    coordinateDescent = 0       /*!< Coordinate descent method */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__ELASTIC_NET__TRAINING__INPUTID"></a>
+ * \brief Available identifiers of input objects for elastic net regression model-based training
+ */
+enum InputId
+{
+    data               = linear_model::training::data,               /*!< %Input data table, dense or CSR */
+    dependentVariables = linear_model::training::dependentVariables, /*!< Values of the dependent variable for the input data */
+    lastInputId = dependentVariables
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__ELASTIC_NET__TRAINING__RESULTID"></a>
+ * \brief Available identifiers of the result of elastic net regression model-based training
+ */
+enum ResultId
+{
+    model = linear_model::training::model,  /*!< Elastic net regression model */
+    lastResultId = model
+};
+
+/**
+ * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__ELASTIC_NET__TRAINING__INPUT"></a>
+ * \brief %Input objects for elastic net regression model-based training
+ */
+class DAAL_EXPORT Input : public linear_model::training::Input
+{
+public:
+    /** Default constructor */
+    Input();
+    Input(const Input& other);
+
+    virtual ~Input() {}
+
+    /**
+     * Returns an input object for elastic net regression model-based training
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(InputId id) const;
+
+    /**
+     * Sets an input object for elastic net regression model-based training
+     * \param[in] id      Identifier of the input object
+     * \param[in] value   Pointer to the object
+     */
+    void set(InputId id, const data_management::NumericTablePtr &value);
+
+    /**
+     * Returns the number of columns in the input data set
+     * \return Number of columns in the input data set
+     */
+    size_t getNumberOfFeatures() const;
+
+    /**
+    * Returns the number of dependent variables
+    * \return Number of dependent variables
+    */
+    size_t getNumberOfDependentVariables() const;
+
+    /**
+    * Checks an input object for the elastic net regression algorithm
+    * \param[in] par     Algorithm parameter
+    * \param[in] method  Computation method
+    *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__ELASTIC_NET__TRAINING__RESULT"></a>
+ * \brief Provides methods to access the result obtained with the compute() method
+ *        of elastic net regression model-based training
+ */
+class DAAL_EXPORT Result : public linear_model::training::Result
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(Result);
+    Result();
+
+    /**
+     * Returns the result of elastic net regression model-based training
+     * \param[in] id    Identifier of the result
+     * \return          Result that corresponds to the given identifier
+     */
+    elastic_net::ModelPtr get(ResultId id) const;
+
+    /**
+     * Sets the result of elastic net regression model-based training
+     * \param[in] id      Identifier of the result
+     * \param[in] value   Result
+     */
+    void set(ResultId id, const elastic_net::ModelPtr &value);
+
+    /**
+     * Allocates memory to store the result of elastic net regression model-based training
+     * \param[in] input Pointer to an object containing the input data
+     * \param[in] parameter %Parameter of elastic net regression model-based training
+     * \param[in] method Computation method for the algorithm
+     *
+     * \return Status of computations
+     */
+    template<typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const Parameter *parameter, const int method);
+
+    /**
+     * Checks the result of elastic net regression model-based training
+     * \param[in] input   %Input object for the algorithm
+     * \param[in] par     %Parameter of the algorithm
+     * \param[in] method  Computation method
+     *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<Result> ResultPtr;
+typedef services::SharedPtr<const Result> ResultConstPtr;
+} // namespace interface1
+
+using interface1::Input;
+using interface1::Result;
+using interface1::ResultPtr;
+using interface1::ResultConstPtr;
+
+} // namespace training
+} // namespace elastic_net
+/** @} */
+} // namespace algorithms
+} // namespace daal
+
+#endif
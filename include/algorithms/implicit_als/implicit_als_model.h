@@ -70,6 +70,17 @@ namespace implicit_als
 /**
  * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
  */
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__IMPLICIT_ALS__LINEARSOLVERID"></a>
+ * Available methods to solve the systems of normal equations for the rows of factors
+ */
+enum LinearSolverId
+{
+    cholesky          = 0,  /*!< Default: the system is formed explicitly and solved with the Cholesky decomposition, O(nFactors^3) per row */
+    conjugateGradient = 1   /*!< A few iterations of the conjugate gradient method started from the factors of the previous iteration,
+                                 the matrix of the system is not formed, O(nFactors^2 * nCGIterations) per row */
+};
+
 namespace interface1
 {
 /**
@@ -92,7 +103,7 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     Parameter(size_t nFactors = 10, size_t maxIterations = 5, double alpha = 40.0, double lambda = 0.01,
               double preferenceThreshold = 0.0) :
         nFactors(nFactors), maxIterations(maxIterations), alpha(alpha), lambda(lambda),
-        preferenceThreshold(preferenceThreshold)
+        preferenceThreshold(preferenceThreshold), linearSolver(cholesky), nCGIterations(3)
     {}
 
     size_t nFactors;            /*!< Number of factors */
@@ -100,6 +111,8 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     double alpha;               /*!< Confidence parameter of the implicit ALS training algorithm */
     double lambda;              /*!< Regularization parameter */
     double preferenceThreshold; /*!< Threshold used to define preference values */
+    LinearSolverId linearSolver; /*!< Method to solve the systems of normal equations for the rows of factors */
+    size_t nCGIterations;       /*!< Number of iterations of the conjugate gradient method per row of factors */
 
     services::Status check() const DAAL_C11_OVERRIDE;
 };
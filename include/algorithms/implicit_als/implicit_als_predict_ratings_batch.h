@@ -111,7 +111,7 @@ class Batch : public daal::algorithms::Prediction
 {
 public:
     Input input;            /*!< Input objects for the algorithm */
-    Parameter parameter;    /*!< \ref implicit_als::interface1::Parameter "Parameters" of the ratings prediction algorithm */
+    Parameter parameter;    /*!< \ref interface1::Parameter "Parameters" of the ratings prediction algorithm */
 
     /**
      * Default constructor
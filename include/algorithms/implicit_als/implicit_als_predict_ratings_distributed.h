@@ -121,7 +121,7 @@ public:
  *      - \ref Method       Computation methods
  *
  * \par References
- *      - \ref implicit_als::interface1::Parameter "implicit_als::Parameter" class
+ *      - \ref interface1::Parameter "Parameter" class
  *      - \ref Distributed class
  */
 template<ComputeStep step, typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
@@ -146,7 +146,7 @@ class Distributed<step1Local, algorithmFPType, method> : public daal::algorithms
 {
 public:
     DistributedInput<step1Local> input;             /*!< %Input data structure */
-    Parameter parameter;                            /*!< \ref implicit_als::interface1::Parameter "Parameters" of the algorithm */
+    Parameter parameter;                            /*!< \ref interface1::Parameter "Parameters" of the algorithm */
 
     /**
      * Default constructor
@@ -83,7 +83,8 @@ namespace ratings
 enum Method
 {
     defaultDense = 0,       /*!< Default: predicts ratings based on the ALS model and input data in the dense format */
-    allUsersAllItems = 0    /*!< Predicts ratings for all users and items based on the ALS model and input data in the dense format */
+    allUsersAllItems = 0,   /*!< Predicts ratings for all users and items based on the ALS model and input data in the dense format */
+    topItems = 1            /*!< Finds the items with the highest predicted ratings for every user */
 };
 
 /**
@@ -111,6 +112,19 @@ enum PartialModelInputId
     lastPartialModelInputId = itemsPartialModel
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__IMPLICIT_ALS__PREDICTION__RATINGS__NUMERICTABLEINPUTID"></a>
+ * Available identifiers of input numeric tables for the rating prediction stage
+ * of the implicit ALS algorithm
+ */
+enum NumericTableInputId
+{
+    knownRatings = lastPartialModelInputId + 1,    /*!< Optional %input numeric table in the CSR format with the ratings
+                                                        already known for the users. Used by the topItems method
+                                                        to exclude these items from the recommendations */
+    lastNumericTableInputId = knownRatings
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__IMPLICIT_ALS__PREDICTION__RATINGS__PARTIALRESULTID"></a>
  * Available identifiers of input PartialModel objects for the rating prediction stage
@@ -129,7 +143,9 @@ enum PartialResultId
 enum ResultId
 {
     prediction,         /*!< Numeric table with the predicted ratings */
-    lastResultId = prediction
+    recommendedItems,   /*!< Numeric table with the indices of the items with the highest predicted ratings.
+                             Computed by the topItems method only */
+    lastResultId = recommendedItems
 };
 
 /**
@@ -138,6 +154,28 @@ enum ResultId
 namespace interface1
 {
 
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__IMPLICIT_ALS__PREDICTION__RATINGS__PARAMETER"></a>
+ * \brief Parameters of the compute() method of the rating prediction stage of the implicit ALS algorithm
+ *
+ * \snippet implicit_als/implicit_als_predict_ratings_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public implicit_als::Parameter
+{
+    /**
+     * Constructs parameters of the rating prediction stage of the implicit ALS algorithm
+     * \param[in] nFactors     Number of factors
+     * \param[in] nTopItems    Number of items to recommend to every user with the topItems method
+     */
+    Parameter(size_t nFactors = 10, size_t nTopItems = 10) : implicit_als::Parameter(nFactors), nTopItems(nTopItems) {}
+
+    size_t nTopItems;           /*!< Number of items with the highest predicted ratings to return for every user */
+
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+/* [Parameter source code] */
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__IMPLICIT_ALS__PREDICTION__RATINGS__INPUTIFACE"></a>
  * \brief %Input interface for the rating prediction stage of the implicit ALS algorithm
@@ -187,6 +225,20 @@ public:
      */
     void set(ModelInputId id, const ModelPtr &ptr);
 
+    /**
+     * Returns an input numeric table for the rating prediction stage of the implicit ALS algorithm
+     * \param[in] id    Identifier of the input numeric table
+     * \return          Input numeric table that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(NumericTableInputId id) const;
+
+    /**
+     * Sets an input numeric table for the rating prediction stage of the implicit ALS algorithm
+     * \param[in] id    Identifier of the input numeric table
+     * \param[in] ptr   Pointer to the input numeric table
+     */
+    void set(NumericTableInputId id, const data_management::NumericTablePtr &ptr);
+
     /**
      * Returns the number of rows in the input numeric table
      * \return Number of rows in the input numeric table
@@ -245,6 +297,20 @@ public:
      */
     void set(PartialModelInputId id, const PartialModelPtr &ptr);
 
+    /**
+     * Returns an input numeric table for the rating prediction stage of the implicit ALS algorithm
+     * \param[in] id    Identifier of the input numeric table
+     * \return          Input numeric table that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(NumericTableInputId id) const;
+
+    /**
+     * Sets an input numeric table for the rating prediction stage of the implicit ALS algorithm
+     * \param[in] id    Identifier of the input numeric table
+     * \param[in] ptr   Pointer to the new input numeric table
+     */
+    void set(NumericTableInputId id, const data_management::NumericTablePtr &ptr);
+
     /**
      * Returns the number of rows in the input numeric table
      * \return Number of rows in the input numeric table
@@ -375,6 +441,7 @@ protected:
 typedef services::SharedPtr<PartialResult> PartialResultPtr;
 
 } // interface1
+using interface1::Parameter;
 using interface1::InputIface;
 using interface1::Input;
 using interface1::DistributedInput;
@@ -211,7 +211,10 @@ enum Step4LocalNumericTableInputId
     partialData = lastStep4LocalPartialModelsInputId + 1, /*!< Pointer to the CSR numeric table that holds a block of either users or items from the input data set */
     inputOfStep4FromStep2,                            /*!< Pointer to the nFactors x nFactors numeric table computed in the second step
                                                           of the distributed processing mode */
-    lastStep4LocalNumericTableInputId = inputOfStep4FromStep2
+    partialFactors,                                   /*!< Optional. Pointer to the numeric table with the factors of the rows of partialData
+                                                          computed in the previous iteration. Used as the starting point of the conjugate
+                                                          gradient method */
+    lastStep4LocalNumericTableInputId = partialFactors
 };
 
 /**
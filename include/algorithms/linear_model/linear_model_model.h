@@ -134,6 +134,20 @@ public:
      * \return Table that contains regression coefficients
      */
     virtual data_management::NumericTablePtr getBeta() = 0;
+
+    /**
+     * Stores the regression coefficients in the compressed sparse row format: the table returned by getBeta()
+     * is replaced with the CSR numeric table that keeps the indices and the values of the non-zero coefficients
+     * of each response. Prediction with the compact model costs O(number of non-zero coefficients) per observation
+     * for dense input data. The compact model cannot be updated by further training, the training algorithms
+     * return an error for it. The default implementation returns ErrorMethodNotSupported
+     * \param[in] zeroThreshold  Coefficients with the absolute value not greater than zeroThreshold are dropped
+     * \return Status of computations
+     */
+    virtual services::Status compactBeta(double zeroThreshold = 0.0)
+    {
+        return services::Status(services::ErrorMethodNotSupported);
+    }
 };
 
 typedef services::SharedPtr<Model> ModelPtr;
@@ -76,11 +76,12 @@ enum Method
                                      Supports all types of numeric tables */
     sumDense        = 2,        /*!< Precomputed sum: implementation of %moments computation algorithm in the case of a precomputed sum.
                                      Supports all types of numeric tables */
-    fastCSR         = 3,        /*!< Fast: performance-oriented method. Works with Compressed Sparse Rows(CSR) numeric tables */
+    fastCSR         = 3,        /*!< Fast: performance-oriented method. Works with Compressed Sparse Rows(CSR) numeric tables.
+                                     Also supports CSC and BSR numeric tables, moments are computed on the columns of the data */
     singlePassCSR   = 4,        /*!< Single-pass: implementation of the single-pass algorithm proposed by D.H.D. West.
-                                     Supports CSR numeric tables */
+                                     Supports CSR, CSC and BSR numeric tables */
     sumCSR          = 5         /*!< Precomputed sum: implementation of the algorithm in the case of a precomputed sum.
-                                     Supports CSR numeric tables */
+                                     Supports CSR, CSC and BSR numeric tables */
 };
 
 /**
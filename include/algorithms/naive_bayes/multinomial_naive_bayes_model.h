@@ -100,6 +100,11 @@ struct DAAL_EXPORT Parameter : public classifier::Parameter
 };
 /* [Parameter source code] */
 
+/**
+ * \private
+ * Tables of logarithms of probabilities the prediction builds from a model and caches in it
+ */
+class AuxTableCache;
 
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__MULTINOMIAL_NAIVE_BAYES__MODEL"></a>
@@ -114,7 +119,7 @@ public:
      * Empty constructor for deserialization
      * \DAAL_DEPRECATED_USE{ Model::create }
      */
-    Model() {}
+    Model();
 
     /**
      * Constructs multinomial naive Bayes model
@@ -163,10 +168,27 @@ public:
      */
     size_t getNumberOfFeatures() const DAAL_C11_OVERRIDE { return (_logTheta ?_logTheta->getNumberOfColumns() : 0); }
 
+    /**
+     *  Sets the number of features in the dataset was used on the training stage.
+     *  Called by the training after the model tables are updated, invalidates the tables cached by the prediction
+     *  \param[in]  nFeatures  Number of features in the dataset was used on the training stage
+     */
+    void setNFeatures(size_t nFeatures) DAAL_C11_OVERRIDE;
+
+    /**
+     * \private
+     * Returns the tables the prediction caches in the model. The tables are not serialized
+     *  \return Tables cached in the model
+     */
+    AuxTableCache *getAuxTableCache() { return _auxTableCache.get(); }
+
 protected:
     data_management::NumericTablePtr _logP;
     data_management::NumericTablePtr _logTheta;
     data_management::NumericTablePtr _auxTable;
+    services::SharedPtr<AuxTableCache> _auxTableCache;
+
+    void resetAuxTableCache();
 
     template<typename modelFPType>
     DAAL_EXPORT Model(size_t nFeatures, const Parameter &parameter, modelFPType dummy, services::Status &st);
@@ -181,6 +203,9 @@ protected:
         arch->setSharedPtrObj(_logTheta);
         arch->setSharedPtrObj(_auxTable);
 
+        if (onDeserialize)
+            resetAuxTableCache();
+
         return st;
     }
 };
@@ -229,9 +254,15 @@ public:
         return _nObservations;
     }
 
+    /**
+     *  Sets the number of observations the model is trained on.
+     *  Called by the training after the counters are updated, invalidates the tables cached by the prediction
+     *  \param[in]  nObservations  Number of observations
+     */
     void setNObservations( size_t nObservations )
     {
         _nObservations = nObservations;
+        resetAuxTableCache();
     }
 
     /**
@@ -258,17 +289,29 @@ public:
         _classSize->assign((int)0);
         _classGroupSum->assign((int)0);
         _nObservations = 0;
+        resetAuxTableCache();
         return services::Status();
     }
 
     data_management::NumericTablePtr getClassSize()     { return _classSize;     }
     data_management::NumericTablePtr getClassGroupSum() { return _classGroupSum; }
 
+    /**
+     * \private
+     * Returns the tables the prediction computes from the counters of the partial model and caches in it.
+     * The tables are not serialized
+     *  \return Tables cached in the model
+     */
+    AuxTableCache *getAuxTableCache() { return _auxTableCache.get(); }
+
 protected:
     data_management::NumericTablePtr _classSize;
     data_management::NumericTablePtr _classGroupSum;
+    services::SharedPtr<AuxTableCache> _auxTableCache;
     size_t _nObservations;
 
+    void resetAuxTableCache();
+
     template<typename modelFPType>
     DAAL_EXPORT PartialModel(size_t nFeatures, const Parameter &parameter,
                              modelFPType dummy, services::Status &st);
@@ -283,6 +326,9 @@ protected:
         arch->setSharedPtrObj(_classSize);
         arch->setSharedPtrObj(_classGroupSum);
 
+        if (onDeserialize)
+            resetAuxTableCache();
+
         return st;
     }
 };
@@ -293,6 +339,7 @@ using interface1::Model;
 using interface1::ModelPtr;
 using interface1::PartialModel;
 using interface1::PartialModelPtr;
+using interface1::AuxTableCache;
 
 } // namespace multinomial_naive_bayes
 /** @} */
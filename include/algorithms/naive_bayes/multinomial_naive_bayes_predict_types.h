@@ -127,6 +127,15 @@ public:
      */
     void set(classifier::prediction::ModelInputId id, const multinomial_naive_bayes::ModelPtr &ptr);
 
+    /**
+     * Sets the input partial model trained in the online or distributed processing mode
+     * in the prediction stage of the multinomial naive Bayes algorithm.
+     * The prediction is computed without finalizing the training
+     * \param[in] id    Identifier of the input object
+     * \param[in] ptr   Pointer to the input object
+     */
+    void set(classifier::prediction::ModelInputId id, const multinomial_naive_bayes::PartialModelPtr &ptr);
+
     /**
      * Checks the correctness of the input object
      * \param[in] parameter Pointer to the structure of the algorithm parameters
@@ -129,7 +129,7 @@ class Batch : public layers::backward::LayerIfaceImpl
 {
 public:
     typedef layers::backward::LayerIfaceImpl super;
-    Parameter &parameter; /*!< \ref interface1::Parameter "Parameters" of the layer */
+    Parameter &parameter; /*!< \ref interface2::Parameter "Parameters" of the layer */
     Input input;          /*!< %Input objects of the layer */
 
     /** Default constructor */
@@ -135,7 +135,7 @@ class Batch : public layers::forward::LayerIfaceImpl
 {
 public:
     typedef layers::forward::LayerIfaceImpl super;
-    Parameter &parameter; /*!< \ref interface1::Parameter "Parameters" of the layer */
+    Parameter &parameter; /*!< \ref interface2::Parameter "Parameters" of the layer */
     Input input;          /*!< %Input objects of the layer */
 
     /** Default constructor */
@@ -79,6 +79,19 @@ enum Method
     defaultDense = 0,    /*!< Default: performance-oriented method. */
 };
 
+/**
+ * Available algorithms to compute the 2D convolution layer.
+ * The backward layer uses the blocked direct convolution for both directAlgorithm and winogradAlgorithm
+ */
+enum Algorithm
+{
+    automaticAlgorithm = 0, /*!< Convolution primitive of the deep neural network library.
+                                 The blocked direct convolution is used if the primitive is not available */
+    dnnAlgorithm       = 1, /*!< Convolution primitive of the deep neural network library */
+    directAlgorithm    = 2, /*!< Blocked direct convolution */
+    winogradAlgorithm  = 3  /*!< Winograd F(2x2, 3x3) convolution. Applicable to 3x3 kernels with unit strides */
+};
+
 /**
  * Available identifiers of results of the forward 2D convolution layer
  * and input objects for the backward 2D convolution layer
@@ -176,7 +189,29 @@ public:
 };
 
 } // namespace interface1
-using interface1::Parameter;
+
+/**
+ * \brief Contains version 2.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface2
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__NEURAL_NETWORKS__LAYERS__CONVOLUTION2D__PARAMETER"></a>
+ * \brief 2D convolution layer parameters
+ */
+class DAAL_EXPORT Parameter: public interface1::Parameter
+{
+public:
+    /**
+     *  Default constructor
+     */
+    Parameter();
+
+    Algorithm algorithm;     /*!< Algorithm to compute the forward and backward 2D convolution layer */
+};
+
+} // namespace interface2
+using interface2::Parameter;
 
 } // namespace convolution2d
 /** @} */
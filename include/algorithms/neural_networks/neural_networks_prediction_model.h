@@ -92,13 +92,68 @@ public:
      * Constructs the parameters of neural network prediction algorithm
      * \param[in] batchSize_                Size of the batch to be processed by the neural network
      * \param[in] allocateWeightsAndBiases_ Flag that idicates if weights and biases are allocated or not
+     * \param[in] reuseLayerResults_        Flag that indicates if the memory of the layer results is shared between the layers
+     * \param[in] fuseLayers_               Flag that indicates if the batch normalization layers are folded into the preceding layers
      */
-    Parameter(size_t batchSize_ = 1, bool allocateWeightsAndBiases_ = false) :
-        batchSize(batchSize_), allocateWeightsAndBiases(allocateWeightsAndBiases_)
+    Parameter(size_t batchSize_ = 1, bool allocateWeightsAndBiases_ = false, bool reuseLayerResults_ = false, bool fuseLayers_ = false) :
+        batchSize(batchSize_), allocateWeightsAndBiases(allocateWeightsAndBiases_), reuseLayerResults(reuseLayerResults_),
+        fuseLayers(fuseLayers_), calibrate(false), pipelineDepth(1), parallelBranches(false)
     {}
 
     size_t batchSize; /*!< Size of the batch to be processed by the neural network. */
     bool allocateWeightsAndBiases;
+    bool reuseLayerResults; /*!< If true, the results of the layers that are not the last layers of the network
+                                 share memory according to their lifetimes and are not available after the prediction */
+    bool fuseLayers;        /*!< If true, the batch normalization layer that follows the convolution or fully-connected layer
+                                 is folded into the weights and biases of that layer and is not computed on the prediction stage */
+    bool calibrate;         /*!< If true, the layers are computed with floating-point data and the maximal absolute values
+                                 of the inputs of the fully-connected and convolution layers are accumulated in the model
+                                 to be used for the quantization of these layers */
+    size_t pipelineDepth;   /*!< Number of batches processed by the neural network at the same time.
+                                 If greater than one, the batches of the input are distributed among the copies of the layers
+                                 that share weights and biases, and are computed concurrently */
+    bool parallelBranches;  /*!< If true, the layers that do not depend on each other, such as the branches
+                                 between the split and concat layers, are computed concurrently */
+};
+
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__NEURAL_NETWORKS__PREDICTION__FUSEDLAYERS"></a>
+ * \brief Describes the batch normalization layer folded into the weights and biases of the preceding layer
+ */
+struct FusedLayers
+{
+    /**
+     * Constructs the description of the fused layers
+     * \param[in] layerIndex_         Index of the convolution or fully-connected layer
+     * \param[in] normalizationIndex_ Index of the batch normalization layer
+     */
+    FusedLayers(size_t layerIndex_ = 0, size_t normalizationIndex_ = 0) :
+        layerIndex(layerIndex_), normalizationIndex(normalizationIndex_) {}
+
+    size_t layerIndex;                  /*!< Index of the convolution or fully-connected layer */
+    size_t normalizationIndex;          /*!< Index of the batch normalization layer that is not computed on the prediction stage */
+    data_management::TensorPtr weights; /*!< Weights of the layer before folding. The layer uses the folded copy of them */
+    data_management::TensorPtr biases;  /*!< Biases of the layer before folding. The layer uses the folded copy of them */
+};
+
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__NEURAL_NETWORKS__PREDICTION__LAYERQUANTIZATION"></a>
+ * \brief Describes the computation of the layer with 8-bit integer inputs and weights on the prediction stage
+ */
+struct LayerQuantization
+{
+    /**
+     * Constructs the description of the layer quantization
+     * \param[in] enabled_    Flag that indicates if the layer is computed with 8-bit integer inputs and weights
+     * \param[in] inputRange_ Maximal absolute value of the layer input
+     */
+    LayerQuantization(bool enabled_ = false, double inputRange_ = 0.0) :
+        enabled(enabled_), inputRange(inputRange_) {}
+
+    bool enabled;      /*!< If true, the fully-connected or convolution layer is computed with 8-bit integer inputs and weights.
+                            Other layers and the layers with zero input range are computed with floating-point data */
+    double inputRange; /*!< Maximal absolute value of the layer input. The inputs are scaled to [-127, 127] using this value.
+                            Collected on the prediction stage with the calibrate flag set */
 };
 
 /**
@@ -215,7 +270,17 @@ public:
         Parameter defaultParameter;
         const Parameter *par = (parameter ? static_cast<const Parameter *>(parameter) : &defaultParameter);
 
-        if (_allocatedBatchSize == par->batchSize) { return services::Status(); }
+        const size_t nReplicas = (par->pipelineDepth > 1 ? par->pipelineDepth - 1 : 0);
+        const bool reuseLayerResults = par->reuseLayerResults && nReplicas == 0 && !par->parallelBranches;
+        if (_allocatedBatchSize == par->batchSize && _replicas.size() == nReplicas &&
+            _allocatedReuseLayerResults == reuseLayerResults && _allocatedFuseLayers == par->fuseLayers) { return services::Status(); }
+
+        /* Results planned or bypassed for the previous configuration are not valid for the new one */
+        if (_allocatedBatchSize != 0 &&
+            (_allocatedReuseLayerResults != reuseLayerResults || _allocatedFuseLayers != par->fuseLayers))
+        {
+            resetLayerResults();
+        }
 
         size_t nLayers = _forwardLayers->size();
 
@@ -227,16 +292,37 @@ public:
             _forwardLayers->get(i)->getLayerInput()->eraseInputData();
         }
 
-        for (size_t i = 0; i < nLayers; i++)
+        if (par->fuseLayers && _fusedLayers.size() == 0)
+        {
+            s |= fuseLayers<modelFPType>();
+        }
+        else if (!par->fuseLayers && _fusedLayers.size() != 0)
+        {
+            unfuseLayers();
+        }
+
+        /* Memory of the results is shared according to the sequential order of the layers */
+        if (reuseLayerResults)
         {
-            s |= connectForwardLayers(i);
+            s |= planLayerResults<modelFPType>();
+        }
+        else
+        {
+            for (size_t i = 0; i < nLayers; i++)
+            {
+                s |= bypassFusedLayer(i);
+                s |= connectForwardLayers(i);
+            }
         }
         if(!s) return s;
 
         bool checkWeightsAndBiasesAlloc = true;
         s |= createWeightsAndBiases<modelFPType>(checkWeightsAndBiasesAlloc);
+        s |= createFusedWeightsAndBiases<modelFPType>();
 
         _allocatedBatchSize = par->batchSize;
+        _allocatedReuseLayerResults = reuseLayerResults;
+        _allocatedFuseLayers = par->fuseLayers;
 
         for(size_t i = 0; i < nLayers; i++)
         {
@@ -258,6 +344,8 @@ public:
                 }
             }
         }
+
+        s |= createReplicas<modelFPType>(nReplicas);
         return s;
     }
 
@@ -295,8 +383,79 @@ public:
         return _forwardLayers->get(index);
     }
 
+    /**
+     * Returns the list of the batch normalization layers folded into the preceding layers
+     * \return List of the fused layers
+     */
+    const services::Collection<FusedLayers> &getFusedLayers() const
+    {
+        return _fusedLayers;
+    }
+
+    /**
+     * Checks if the layer with certain index in the network is folded into the preceding layer
+     * \param[in] index  Index of the layer in the network
+     * \return True if the layer is not computed on the prediction stage
+     */
+    bool isLayerFused(size_t index) const
+    {
+        for (size_t i = 0; i < _fusedLayers.size(); i++)
+        {
+            if (_fusedLayers[i].normalizationIndex == index) { return true; }
+        }
+        return false;
+    }
+
+    /**
+     * Returns the number of the copies of the layers used to compute the batches concurrently
+     * \return Number of the copies of the layers
+     */
+    size_t getNumberOfReplicas() const
+    {
+        return _replicas.size();
+    }
+
+    /**
+     * Returns the copy of the list of forward stages of the layers used to compute the batches concurrently
+     * \param[in] index  Index of the copy
+     * \return Copy of the list of forward stages of the layers
+     */
+    const neural_networks::ForwardLayersPtr getReplicaLayers(size_t index) const
+    {
+        return _replicas[index];
+    }
+
+    /**
+     * Sets the quantization of the layer with certain index in the network
+     * \param[in] index         Index of the layer in the network
+     * \param[in] quantization  Description of the layer quantization
+     */
+    void setLayerQuantization(size_t index, const LayerQuantization &quantization)
+    {
+        while (_quantization.size() <= index)
+        {
+            _quantization.push_back(LayerQuantization());
+        }
+        _quantization[index] = quantization;
+    }
+
+    /**
+     * Returns the quantization of the layer with certain index in the network
+     * \param[in] index  Index of the layer in the network
+     * \return Description of the layer quantization
+     */
+    LayerQuantization getLayerQuantization(size_t index) const
+    {
+        return (index < _quantization.size() ? _quantization[index] : LayerQuantization());
+    }
+
 protected:
     size_t _allocatedBatchSize;  /** Batch size that was used during the model allocation */
+    bool _allocatedReuseLayerResults; /** True if the results of the layers share memory since the model allocation */
+    bool _allocatedFuseLayers;        /** True if the batch normalization layers were folded during the model allocation */
+    services::Collection<FusedLayers> _fusedLayers; /*!< Batch normalization layers folded into the preceding layers */
+    services::Collection<LayerQuantization> _quantization; /*!< Quantization of the layers */
+    services::Collection<neural_networks::ForwardLayersPtr> _replicas; /*!< Copies of the layers that share weights and biases */
 
     Model(services::Status &st);
 
@@ -311,6 +470,85 @@ protected:
 
     Model(const prediction::Topology &topology, services::Status &st);
 
+    /**
+     * Allocates the results of the layers in the memory arenas shared by the layers
+     * with non-overlapping lifetimes of the results and connects the layers with each other
+     */
+    template<typename modelFPType>
+    DAAL_EXPORT services::Status planLayerResults();
+
+    /**
+     * Finds the batch normalization layers that can be folded into the preceding convolution or fully-connected layers
+     */
+    template<typename modelFPType>
+    DAAL_EXPORT services::Status fuseLayers();
+
+    /**
+     * Replaces the weights and biases of the layers with the fused batch normalization by the tensors that store the folded values
+     */
+    template<typename modelFPType>
+    DAAL_EXPORT services::Status createFusedWeightsAndBiases();
+
+    /**
+     * Creates the copies of the forward layers that share weights and biases with the layers of the model
+     * and allocates their results
+     */
+    template<typename modelFPType>
+    DAAL_EXPORT services::Status createReplicas(size_t nReplicas);
+
+    /**
+     * Sets the value of the fused batch normalization layer to the value of the preceding layer
+     */
+    services::Status bypassFusedLayer(size_t layerId)
+    {
+        using namespace layers;
+        for (size_t i = 0; i < _fusedLayers.size(); i++)
+        {
+            if (_fusedLayers[i].normalizationIndex != layerId) { continue; }
+
+            forward::ResultPtr layerResult = _forwardLayers->get(_fusedLayers[i].layerIndex)->getLayerResult();
+            DAAL_CHECK(layerResult, services::ErrorNullResult);
+            _forwardLayers->get(layerId)->getLayerResult()->set(forward::value, layerResult->get(forward::value));
+        }
+        return services::Status();
+    }
+
+    /**
+     * Restores the original weights and biases of the layers with the fused batch normalization
+     * and makes the batch normalization layers computed again
+     */
+    void unfuseLayers()
+    {
+        using namespace layers;
+        for (size_t i = 0; i < _fusedLayers.size(); i++)
+        {
+            const FusedLayers &fused = _fusedLayers[i];
+            if (!fused.weights) { continue; }
+
+            forward::Input *input = _forwardLayers->get(fused.layerIndex)->getLayerInput();
+            input->set(forward::weights, fused.weights);
+            input->set(forward::biases,  fused.biases);
+        }
+        _fusedLayers.clear();
+    }
+
+    /**
+     * Releases the results of the layers so that they are allocated again
+     * instead of referring to the shared memory or to the results of other layers
+     */
+    void resetLayerResults()
+    {
+        using namespace layers;
+        for (size_t i = 0; i < _forwardLayers->size(); i++)
+        {
+            forward::ResultPtr layerResult = _forwardLayers->get(i)->getLayerResult();
+            if (layerResult && layerResult->getLayout() == tensorResult)
+            {
+                layerResult->set(forward::value, data_management::TensorPtr());
+            }
+        }
+    }
+
     /** \private */
     template<typename Archive, bool onDeserialize>
     services::Status serialImpl(Archive *arch)
@@ -337,6 +575,8 @@ typedef services::SharedPtr<Model> ModelPtr;
 using interface1::Model;
 using interface1::ModelPtr;
 using interface1::Parameter;
+using interface1::FusedLayers;
+using interface1::LayerQuantization;
 } // namespace prediction
 } // namespace neural_networks
 } // namespace algorithms
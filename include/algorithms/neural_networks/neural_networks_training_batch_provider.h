@@ -0,0 +1,319 @@
+/* file: neural_networks_training_batch_provider.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the providers of the training batches for the neural network training algorithm.
+//--
+*/
+
+#ifndef __NEURAL_NETWORKS_TRAINING_BATCH_PROVIDER_H__
+#define __NEURAL_NETWORKS_TRAINING_BATCH_PROVIDER_H__
+
+#include "data_management/data/tensor.h"
+#include "data_management/data/data_serialize.h"
+#include "data_management/data/data_collection.h"
+#include "data_management/data_source/data_source.h"
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace neural_networks
+{
+namespace training
+{
+namespace interface1
+{
+/**
+ * @ingroup neural_networks_training
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__NEURAL_NETWORKS__TRAINING__BATCHPROVIDER"></a>
+ * \brief Abstract class that supplies the training samples to the neural network training algorithm
+ *        as a stream, so that the training data set is not materialized in one tensor.
+ *
+ * The training algorithm calls loadSamples() from a background task to fill the next batches
+ * while the neural network processes the current one. The calls are never concurrent.
+ * The background task shares the threads with the computations of the neural network,
+ * so the loading overlaps the training only if more than one thread is available.
+ * Derive from this class to read the samples from a custom storage.
+ */
+class DAAL_EXPORT BatchProvider : public data_management::SerializationIface
+{
+public:
+    virtual ~BatchProvider() {}
+
+    /**
+     * Returns the sizes of the dimensions of one sample of the training data
+     * \return Sizes of the dimensions of the sample without the dimension of the samples
+     */
+    virtual services::Collection<size_t> getSampleDimensions() = 0;
+
+    /**
+     * Returns the number of the ground-truth tensors of one sample
+     * \return Number of the ground-truth tensors, one per last layer of the neural network
+     */
+    virtual size_t getNumberOfGroundTruths() { return 1; }
+
+    /**
+     * Returns the key of the ground-truth tensor in the collection of the ground-truth tensors
+     * \param[in] index Index of the ground-truth tensor
+     * \return Key of the ground-truth tensor, the index of the last layer of the neural network
+     *         or any key if the neural network has one last layer
+     */
+    virtual size_t getGroundTruthKey(size_t index) { return index; }
+
+    /**
+     * Returns the sizes of the dimensions of one sample of the ground-truth tensor
+     * \param[in] index Index of the ground-truth tensor
+     * \return Sizes of the dimensions of the sample without the dimension of the samples
+     */
+    virtual services::Collection<size_t> getGroundTruthDimensions(size_t index) = 0;
+
+    /**
+     * Loads the next samples of the training data set into the first rows of the tensors
+     * \param[in]  nSamples    Number of samples to load
+     * \param[out] data        Tensor to store the training data, the size of its first dimension is nSamples
+     * \param[out] groundTruth Collection of the tensors to store the ground truth, with the keys returned by getGroundTruthKey()
+     * \param[out] nLoaded     Number of loaded samples. The value less than nSamples indicates the end of the data set
+     * \return Status of the load
+     */
+    virtual services::Status loadSamples(size_t nSamples, data_management::Tensor &data,
+                                         data_management::KeyValueDataCollection &groundTruth, size_t &nLoaded) = 0;
+
+    /**
+     * Batch providers are not serialized
+     */
+    int getSerializationTag() const DAAL_C11_OVERRIDE { return 0; }
+
+protected:
+    services::Status serializeImpl(data_management::interface1::InputDataArchive *archive) DAAL_C11_OVERRIDE
+    {
+        return services::Status(services::ErrorMethodNotSupported);
+    }
+
+    services::Status deserializeImpl(const data_management::interface1::OutputDataArchive *archive) DAAL_C11_OVERRIDE
+    {
+        return services::Status(services::ErrorMethodNotSupported);
+    }
+};
+typedef services::SharedPtr<BatchProvider> BatchProviderPtr;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__NEURAL_NETWORKS__TRAINING__DATASOURCEBATCHPROVIDER"></a>
+ * \brief Provider of the training samples that reads them from data sources.
+ *        The training data and each ground truth are read from separate data sources,
+ *        the i-th rows of all the data sources belong to the same sample
+ *
+ * \tparam algorithmFPType  Data type used to copy the samples, double or float
+ */
+template<typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE>
+class DataSourceBatchProvider : public BatchProvider
+{
+public:
+    /**
+     * Constructs the provider of the training samples for the neural network with one last layer
+     * \param[in] dataSource            Data source to read the training data from
+     * \param[in] sampleDimensions      Sizes of the dimensions of one sample of the training data
+     * \param[in] groundTruthSource     Data source to read the ground truth from
+     * \param[in] groundTruthDimensions Sizes of the dimensions of one sample of the ground truth
+     *
+     * The data sources must not be accessed directly while the training algorithm uses the provider
+     */
+    DataSourceBatchProvider(data_management::DataSource &dataSource, const services::Collection<size_t> &sampleDimensions,
+                            data_management::DataSource &groundTruthSource, const services::Collection<size_t> &groundTruthDimensions) :
+        _dataSource(dataSource), _sampleDimensions(sampleDimensions)
+    {
+        _groundTruthSources.push_back(&groundTruthSource);
+        _groundTruthDimensions.push_back(groundTruthDimensions);
+        _groundTruthKeys.push_back(0);
+    }
+
+    /**
+     * Constructs the provider of the training samples for the neural network with several last layers
+     * \param[in] dataSource            Data source to read the training data from
+     * \param[in] sampleDimensions      Sizes of the dimensions of one sample of the training data
+     * \param[in] groundTruthSources    Data sources to read the ground truths from
+     * \param[in] groundTruthDimensions Sizes of the dimensions of one sample of each ground truth
+     * \param[in] groundTruthKeys       Indices of the last layers the ground truths correspond to
+     *
+     * The data sources must not be accessed directly while the training algorithm uses the provider
+     */
+    DataSourceBatchProvider(data_management::DataSource &dataSource, const services::Collection<size_t> &sampleDimensions,
+                            const services::Collection<data_management::DataSource *> &groundTruthSources,
+                            const services::Collection<services::Collection<size_t> > &groundTruthDimensions,
+                            const services::Collection<size_t> &groundTruthKeys) :
+        _dataSource(dataSource), _sampleDimensions(sampleDimensions), _groundTruthSources(groundTruthSources),
+        _groundTruthDimensions(groundTruthDimensions), _groundTruthKeys(groundTruthKeys)
+    {}
+
+    virtual ~DataSourceBatchProvider() {}
+
+    services::Collection<size_t> getSampleDimensions() DAAL_C11_OVERRIDE { return _sampleDimensions; }
+
+    size_t getNumberOfGroundTruths() DAAL_C11_OVERRIDE { return _groundTruthDimensions.size(); }
+
+    size_t getGroundTruthKey(size_t index) DAAL_C11_OVERRIDE { return _groundTruthKeys[index]; }
+
+    services::Collection<size_t> getGroundTruthDimensions(size_t index) DAAL_C11_OVERRIDE { return _groundTruthDimensions[index]; }
+
+    services::Status loadSamples(size_t nSamples, data_management::Tensor &data,
+                                 data_management::KeyValueDataCollection &groundTruth, size_t &nLoaded) DAAL_C11_OVERRIDE
+    {
+        using namespace data_management;
+
+        const size_t nGroundTruths = _groundTruthDimensions.size();
+        if(_groundTruthKeys.size() != nGroundTruths || _groundTruthSources.size() != nGroundTruths)
+            return services::Status(services::ErrorIncorrectNumberOfElementsInInputCollection);
+
+        services::Status s;
+        nLoaded = 0;
+        size_t nRows = 0;
+        s |= loadBlock(_dataSource, nSamples, _sampleDimensions, data, nRows);
+
+        const KeyValueDataCollection &groundTruthTensors = groundTruth;
+        for(size_t i = 0; i < nGroundTruths && s; i++)
+        {
+            if(!_groundTruthSources[i])
+                return services::Status(services::ErrorNullInput);
+
+            TensorPtr groundTruthTensor = Tensor::cast(groundTruthTensors[_groundTruthKeys[i]]);
+            if(!groundTruthTensor)
+                return services::Status(services::ErrorNullTensor);
+
+            size_t nGroundTruthRows = 0;
+            s |= loadBlock(*_groundTruthSources[i], nSamples, _groundTruthDimensions[i], *groundTruthTensor, nGroundTruthRows);
+            if(s && nGroundTruthRows != nRows)
+                s |= services::Status(services::ErrorInconsistentNumberOfRows);
+        }
+        if(s)
+            nLoaded = nRows;
+        return s;
+    }
+
+private:
+    /* Loads up to nSamples rows of the data source into the first samples of the tensor */
+    static services::Status loadBlock(data_management::DataSource &source, size_t nSamples,
+                                      const services::Collection<size_t> &sampleDimensions, data_management::Tensor &tensor, size_t &nRows)
+    {
+        using namespace data_management;
+
+        nRows = source.loadDataBlock(nSamples);
+        services::Status s = source.status();
+        if(!s || nRows == 0)
+            return s;
+
+        NumericTablePtr table = source.getNumericTable();
+        if(!table)
+            return services::Status(services::ErrorNullInput);
+        if(table->getNumberOfColumns() != getSize(sampleDimensions))
+            return services::Status(services::ErrorIncorrectNumberOfFeatures);
+
+        BlockDescriptor<algorithmFPType> rows;
+        s |= table->getBlockOfRows(0, nRows, readOnly, rows);
+        if(s)
+            s |= copyRows(rows.getBlockPtr(), nRows, sampleDimensions, tensor);
+        table->releaseBlockOfRows(rows);
+        return s;
+    }
+
+    static size_t getSize(const services::Collection<size_t> &dimensions)
+    {
+        size_t size = 1;
+        for(size_t i = 0; i < dimensions.size(); i++)
+        {
+            size *= dimensions[i];
+        }
+        return size;
+    }
+
+    /* Copies the rows into the first nRows samples of the tensor */
+    static services::Status copyRows(const algorithmFPType *rows, size_t nRows,
+                                     const services::Collection<size_t> &sampleDimensions, data_management::Tensor &tensor)
+    {
+        using namespace data_management;
+
+        const services::Collection<size_t> &dims = tensor.getDimensions();
+        if(dims.size() != sampleDimensions.size() + 1)
+            return services::Status(services::ErrorIncorrectNumberOfDimensionsInTensor);
+        if(dims[0] < nRows)
+            return services::Status(services::ErrorIncorrectSizeOfDimensionInTensor);
+        for(size_t i = 0; i < sampleDimensions.size(); i++)
+        {
+            if(dims[i + 1] != sampleDimensions[i])
+                return services::Status(services::ErrorIncorrectSizeOfDimensionInTensor);
+        }
+
+        const size_t size = nRows * getSize(sampleDimensions);
+        SubtensorDescriptor<algorithmFPType> block;
+        services::Status s = tensor.getSubtensor(0, 0, 0, nRows, writeOnly, block);
+        if(s)
+        {
+            algorithmFPType *dst = block.getPtr();
+            for(size_t i = 0; i < size; i++)
+            {
+                dst[i] = rows[i];
+            }
+        }
+        tensor.releaseSubtensor(block);
+        return s;
+    }
+
+    data_management::DataSource &_dataSource;
+    services::Collection<size_t> _sampleDimensions;
+    services::Collection<data_management::DataSource *> _groundTruthSources;
+    services::Collection<services::Collection<size_t> > _groundTruthDimensions;
+    services::Collection<size_t> _groundTruthKeys;
+};
+/** @} */
+} // namespace interface1
+using interface1::BatchProvider;
+using interface1::BatchProviderPtr;
+using interface1::DataSourceBatchProvider;
+
+} // namespace training
+} // namespace neural_networks
+} // namespace algorithms
+} // namespace daal
+#endif
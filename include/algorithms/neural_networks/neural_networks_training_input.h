@@ -56,6 +56,7 @@
 #include "services/daal_defines.h"
 #include "algorithms/neural_networks/neural_networks_training_model.h"
 #include "algorithms/neural_networks/neural_networks_training_partial_result.h"
+#include "algorithms/neural_networks/neural_networks_training_batch_provider.h"
 
 namespace daal
 {
@@ -103,6 +104,17 @@ enum Step1LocalInputId
     lastStep1LocalInputId = inputModel
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__NEURAL_NETWORKS__TRAINING__INPUTBATCHPROVIDERID"></a>
+ * \brief Available identifiers of the providers of the training samples for the neural network model based training
+ */
+enum InputBatchProviderId
+{
+    batchProvider = lastStep1LocalInputId + 1,   /*!< Provider of the training samples used in place of the training data set
+                                                      and the ground-truth results in the batch processing mode */
+    lastInputBatchProviderId = batchProvider
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__NEURAL_NETWORKS__TRAINING__STEP2MASTERINPUTID"></a>
  * \brief Partial results from the previous steps in the distributed processing mode required by the second distributed step of the algorithm
@@ -126,7 +138,7 @@ namespace interface1
 class DAAL_EXPORT Input : public daal::algorithms::Input
 {
 public:
-    Input(size_t nElements = lastInputCollectionId + 1);
+    Input(size_t nElements = lastInputBatchProviderId + 1);
     Input(const Input& other);
 
     virtual ~Input() {}
@@ -153,6 +165,13 @@ public:
      */
     data_management::TensorPtr get(InputCollectionId id, size_t key) const;
 
+    /**
+     * Returns the provider of the training samples for the neural network training algorithm
+     * \param[in] id    Identifier of the provider
+     * \return          Provider that corresponds to the given identifier
+     */
+    BatchProviderPtr get(InputBatchProviderId id) const;
+
     /**
      * Sets %input object for the neural network training algorithm
      * \param[in] id      Identifier of the %input object
@@ -175,6 +194,14 @@ public:
      */
     void add(InputCollectionId id, size_t key, const data_management::TensorPtr &value);
 
+    /**
+     * Sets the provider of the training samples for the neural network training algorithm.
+     * The samples are loaded in the background into the batches of the size of the optimization solver batch
+     * \param[in] id      Identifier of the provider
+     * \param[in] value   Pointer to the provider
+     */
+    void set(InputBatchProviderId id, const BatchProviderPtr &value);
+
     /**
      * Checks %input object for the neural network algorithm
      * \param[in] par     Algorithm %parameter
@@ -204,7 +231,7 @@ template<>
 class DAAL_EXPORT DistributedInput<step1Local> : public Input
 {
 public:
-    DistributedInput(size_t nElements = lastStep1LocalInputId + 1);
+    DistributedInput(size_t nElements = lastInputBatchProviderId + 1);
     DistributedInput(const DistributedInput& other);
 
     virtual ~DistributedInput() {};
@@ -93,10 +93,17 @@ public:
     Parameter(const services::SharedPtr<optimization_solver::iterative_solver::Batch > &optimizationSolver_ = services::SharedPtr<optimization_solver::iterative_solver::Batch>(),
               engines::EnginePtr engine_ = engines::mt19937::Batch<DAAL_ALGORITHM_FP_TYPE>::create()) :
                                                                                                        optimizationSolver(optimizationSolver_),
-                                                                                                       engine(engine_) {}
+                                                                                                       engine(engine_), nReplicas(1),
+                                                                                                       nPrefetchedBatches(2), shuffleBufferSize(0) {}
 
     services::SharedPtr<optimization_solver::iterative_solver::Batch>  optimizationSolver; /*!< Optimization solver used in the neural network*/
-    engines::EnginePtr engine;                                                             /*!< Engine to be used for weights and biases initialization */
+    engines::EnginePtr engine;                                                             /*!< Engine to be used for weights and biases initialization
+                                                                                                and for shuffling of the samples supplied by the batch provider */
+    size_t nReplicas;   /*!< Number of the copies of the neural network that compute the derivatives concurrently,
+                             each on its equal part of the batch. The batch size must be divisible by the number of the copies */
+    size_t nPrefetchedBatches; /*!< Number of batches loaded from the batch provider in the background, at least 2 */
+    size_t shuffleBufferSize;  /*!< Number of samples from the batch provider that are shuffled together before they are split
+                                    into batches. Rounded up to a multiple of the batch size. 0 disables shuffling */
 };
 
 /**
@@ -120,7 +127,8 @@ public:
     Model(const Model &model) :
         ModelImpl(model),
         _backwardLayers(model.getBackwardLayers()),
-        _storeWeightDerivativesInTable(model._storeWeightDerivativesInTable)
+        _storeWeightDerivativesInTable(model._storeWeightDerivativesInTable),
+        _replicas(model._replicas)
     {}
 
     /** \brief Destructor */
@@ -181,16 +189,44 @@ public:
             }
         }
 
-        allocate<modelFPType>(sampleSize, parameter);
+        /* Each copy of the neural network processes its part of the batch */
+        const size_t nReplicas = (parameter.nReplicas > 1 ? parameter.nReplicas : 1);
+        DAAL_CHECK(sampleSize.size() > 0 && sampleSize[0] % nReplicas == 0, services::ErrorIncorrectParameter);
+        Collection<size_t> replicaSampleSize = sampleSize;
+        replicaSampleSize[0] /= nReplicas;
+
+        allocate<modelFPType>(replicaSampleSize, parameter);
 
         for(size_t i = 0; i < nLayers; i++)
         {
             getForwardLayer(i)->enableResetOnCompute(false);
             getBackwardLayer(i)->enableResetOnCompute(false);
         }
+
+        st |= createReplicas<modelFPType>(replicaSampleSize, topology, parameter, nReplicas - 1);
         return st;
     }
 
+    /**
+     * Returns the number of the copies of the neural network that compute the derivatives concurrently with this model
+     * \return Number of the copies of the neural network
+     */
+    size_t getNumberOfReplicas() const
+    {
+        return _replicas.size();
+    }
+
+    /**
+     * Returns the copy of the neural network that computes the derivatives concurrently with this model.
+     * The weights and biases of the copy are updated from this model on each iteration of the training
+     * \param[in] index  Index of the copy
+     * \return Copy of the neural network
+     */
+    const services::SharedPtr<Model> getReplica(size_t index) const
+    {
+        return _replicas[index];
+    }
+
     /**
      * Returns list of forward layers
      * \return          List of forward layers
@@ -394,6 +430,13 @@ protected:
     /** \brief Constructor */
     Model(services::Status &st);
 
+    /**
+     * Creates the copies of the neural network that compute the derivatives concurrently with this model
+     */
+    template<typename modelFPType>
+    DAAL_EXPORT services::Status createReplicas(const services::Collection<size_t> &sampleSize, const Topology &topology,
+                                                const Parameter &parameter, size_t nReplicas);
+
     /** \private */
     template<typename Archive, bool onDeserialize>
     services::Status serialImpl(Archive *arch)
@@ -657,6 +700,7 @@ private:
 
     bool _storeWeightDerivativesInTable;    /*!< Flag. True if weights and biases derivatives of all the layers are stored in one numeric table */
     LearnableParametersIfacePtr _weightsAndBiasesDerivatives;
+    services::Collection<services::SharedPtr<Model> > _replicas; /*!< Copies of the neural network that compute the derivatives concurrently */
 };
 
 typedef services::SharedPtr<Model> ModelPtr;
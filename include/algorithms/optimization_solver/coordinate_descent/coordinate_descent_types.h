@@ -0,0 +1,152 @@
+/* file: coordinate_descent_types.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the Coordinate descent algorithm types.
+//--
+*/
+
+#ifndef __COORDINATE_DESCENT_TYPES_H__
+#define __COORDINATE_DESCENT_TYPES_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/optimization_solver/iterative_solver/iterative_solver_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+/**
+ * @defgroup coordinate_descent Coordinate Descent Algorithm
+ * \copydoc daal::algorithms::optimization_solver::coordinate_descent
+ * @ingroup optimization_solver
+ * @{
+ */
+/**
+ * \brief Contains classes for computing the Coordinate descent
+ */
+namespace coordinate_descent
+{
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__OPTIMIZATION_SOLVER__COORDINATE_DESCENT__METHOD"></a>
+ * Available methods for computing the Coordinate descent
+ */
+enum Method
+{
+    defaultDense = 0, /*!< Default: cyclic coordinate descent with covariance updates */
+};
+
+/**
+ * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__OPTIMIZATION_SOLVER__COORDINATE_DESCENT__PARAMETER"></a>
+ * \brief %Parameter class for the Coordinate descent algorithm.
+ *        The algorithm minimizes the Mean squared error objective function with the elastic net penalty
+ *        penaltyL1 * |theta|_1 + penaltyL2 * |theta|_2^2 applied to all the components of the argument but the intercept term theta_0.
+ *        All the terms of the objective function are used; the batch indices of the function are ignored
+ *
+ * \snippet optimization_solver/coordinate_descent/coordinate_descent_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public optimization_solver::iterative_solver::Parameter
+{
+    /**
+     * Constructs the parameter of the Coordinate descent algorithm
+     * \param[in] function_           Objective function represented as sum of functions, the Mean squared error objective function
+     * \param[in] nIterations_        Maximal number of passes over the coordinates of the argument
+     * \param[in] accuracyThreshold_  Accuracy of the algorithm. The algorithm terminates when the largest change of the objective function
+     *                                caused by the update of one coordinate in a pass is less than this value
+     * \param[in] penaltyL1_          L1 regularization coefficient
+     * \param[in] penaltyL2_          L2 regularization coefficient
+     */
+    Parameter(
+        const sum_of_functions::BatchPtr &function_,
+        size_t nIterations_ = 1000,
+        double accuracyThreshold_ = 1.0e-07,
+        double penaltyL1_ = 0.0,
+        double penaltyL2_ = 0.0
+    );
+
+    virtual ~Parameter() {}
+
+    /**
+     * Checks the correctness of the parameter
+     *
+     * \return Status of computations
+     */
+    virtual services::Status check() const DAAL_C11_OVERRIDE;
+
+    double penaltyL1;           /*!< L1 regularization coefficient */
+    double penaltyL2;           /*!< L2 regularization coefficient */
+    double previousPenaltyL1;   /*!< L1 regularization coefficient the input argument was computed for on the regularization path.
+                                     Used by the screening rules; if zero, the largest absolute value of the gradient at the input argument is used */
+    bool   interceptFlag;       /*!< Flag that indicates whether the intercept term theta_0 is optimized. If false, theta_0 keeps its input value */
+    bool   screeningFlag;       /*!< Flag that indicates whether the strong rules are used to discard the coordinates that are likely
+                                     to be zero at the minimum. Discarded coordinates are checked for the optimality conditions at the end */
+};
+/* [Parameter source code] */
+
+typedef iterative_solver::Input Input;
+typedef iterative_solver::Result Result;
+typedef iterative_solver::ResultPtr ResultPtr;
+
+} // namespace interface1
+using interface1::Parameter;
+using interface1::Input;
+using interface1::Result;
+using interface1::ResultPtr;
+
+} // namespace coordinate_descent
+/** @} */
+} // namespace optimization_solver
+} // namespace algorithm
+} // namespace daal
+#endif
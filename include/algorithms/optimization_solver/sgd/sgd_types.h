@@ -81,7 +81,9 @@ enum Method
 {
     defaultDense = 0, /*!< Default: Required gradient is computed using only one term of objective function */
     miniBatch = 1,    /*!< Required gradient is computed using batchSize terms of objective function  */
-    momentum = 2      /*!< Required gradient is computed using batchSize terms of objective function, perform momentum update rule  */
+    momentum = 2,     /*!< Required gradient is computed using batchSize terms of objective function, perform momentum update rule  */
+    hogwild = 3       /*!< Required gradient is computed using batchSize terms of objective function by several threads that
+                           update the shared argument asynchronously without locks */
 };
 
 /**
@@ -300,6 +302,54 @@ struct DAAL_EXPORT Parameter<momentum> : public BaseParameter
 /* [ParameterMomentum source code] */
 /** @} */
 
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__OPTIMIZATION_SOLVER__SGD__PARAMETER_HOGWILD"></a>
+ * \brief %Parameter for the asynchronous Stochastic gradient descent algorithm
+ *
+ * \snippet optimization_solver/sgd/sgd_types.h ParameterHogwild source code
+ */
+/* [ParameterHogwild source code] */
+template<>
+struct DAAL_EXPORT Parameter<hogwild> : public BaseParameter
+{
+    /**
+     * Constructs the parameter class of the asynchronous Stochastic gradient descent algorithm
+     * \param[in] function             Objective function represented as sum of functions
+     * \param[in] nIterations          Maximal number of iterations of the algorithm, shared by all the threads
+     * \param[in] accuracyThreshold    Accuracy of the algorithm. The algorithm terminates when this accuracy is achieved
+     * \param[in] batchIndices         Numeric table that represents 32 bit integer indices of terms in the objective function. If no indices
+                                       are provided, each thread generates random indices with its own generator.
+     * \param[in] batchSize            Number of batch indices to compute the stochastic gradient
+     * \param[in] maxStaleness         Maximal number of the updates of the argument applied by other threads while the gradient
+                                       is computed. The gradients that are more stale are discarded
+     * \param[in] learningRateSequence Numeric table that contains values of the learning rate sequence
+     * \param[in] seed                 Seed for random generation of 32 bit integer indices of terms in the objective function. \DAAL_DEPRECATED_USE{ engine }
+     */
+    Parameter(
+        const sum_of_functions::BatchPtr &function,
+        size_t nIterations = 100,
+        double accuracyThreshold = 1.0e-05,
+        data_management::NumericTablePtr batchIndices = data_management::NumericTablePtr(),
+        size_t batchSize = 128,
+        size_t maxStaleness = 16,
+        data_management::NumericTablePtr learningRateSequence = data_management::NumericTablePtr(
+                    new data_management::HomogenNumericTable<double>(
+                        1, 1, data_management::NumericTableIface::doAllocate, 1.0)),
+        size_t seed = 777 );
+
+    /**
+     * Checks the correctness of the parameter
+     *
+     * \return Status of computations
+     */
+    virtual services::Status check() const;
+
+    virtual ~Parameter() {}
+
+    size_t maxStaleness;     /*!< Maximal number of the updates applied by other threads while the gradient is computed */
+};
+/* [ParameterHogwild source code] */
+
 /**
 * <a name="DAAL-STRUCT-ALGORITHMS__OPTIMIZATION_SOLVER__SGD__INPUT"></a>
 * \brief %Input for the Stochastic gradient descent algorithm
@@ -0,0 +1,392 @@
+/* file: outlier_detection_bacon_distributed.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the BACON outlier detection algorithm
+//  in the distributed processing mode
+//--
+*/
+
+#ifndef __OUTLIER_DETECTION_BACON_DISTRIBUTED_H__
+#define __OUTLIER_DETECTION_BACON_DISTRIBUTED_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/outlier_detection/outlier_detection_bacon_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace bacon_outlier_detection
+{
+
+namespace interface1
+{
+/**
+ * @defgroup bacon_outlier_detection_distributed Distributed
+ * @ingroup bacon_outlier_detection
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__BACON_OUTLIER_DETECTION__DISTRIBUTEDCONTAINER"></a>
+ * \brief Provides methods to run implementations of the BACON outlier detection algorithm.
+ *        This class is associated with the daal::algorithms::bacon_outlier_detection::Distributed class
+ *        and supports the methods of the BACON outlier detection in the distributed processing mode
+ *
+ * \tparam step             Step of the distributed processing mode, \ref ComputeStep
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the BACON outlier detection, double or float
+ * \tparam method           Computation method of the algorithm, \ref daal::algorithms::bacon_outlier_detection::Method
+ */
+template<ComputeStep step, typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT DistributedContainer;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__BACON_OUTLIER_DETECTION__DISTRIBUTEDCONTAINER_STEP1LOCAL_ALGORITHMFPTYPE_METHOD_CPU"></a>
+ * \brief Class containing computation methods for the BACON outlier detection algorithm
+ *        in the first step of the distributed processing mode
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT DistributedContainer<step1Local, algorithmFPType, method, cpu> : public
+    daal::algorithms::AnalysisContainerIface<distributed>
+{
+public:
+    /**
+     * Constructs a container for the BACON outlier detection algorithm with a specified environment
+     * in the first step of the distributed processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    DistributedContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    virtual ~DistributedContainer();
+    /**
+     * Computes the Mahalanobis distances of the local observations to the current basic subset,
+     * selects the local part of the next basic subset and computes its partial moments
+     *
+     * \return Status of computations
+     */
+    virtual services::Status compute() DAAL_C11_OVERRIDE;
+    /**
+     * Does nothing: the first step of the distributed processing mode produces partial results only
+     *
+     * \return Status of computations
+     */
+    virtual services::Status finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__BACON_OUTLIER_DETECTION__DISTRIBUTEDCONTAINER_STEP2MASTER_ALGORITHMFPTYPE_METHOD_CPU"></a>
+ * \brief Class containing computation methods for the BACON outlier detection algorithm
+ *        in the second step of the distributed processing mode
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT DistributedContainer<step2Master, algorithmFPType, method, cpu> : public
+    daal::algorithms::AnalysisContainerIface<distributed>
+{
+public:
+    /**
+     * Constructs a container for the BACON outlier detection algorithm with a specified environment
+     * in the second step of the distributed processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    DistributedContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    virtual ~DistributedContainer();
+    /**
+     * Merges partial moments computed on local nodes and updates the basic subset statistics
+     *
+     * \return Status of computations
+     */
+    virtual services::Status compute() DAAL_C11_OVERRIDE;
+    /**
+     * Does nothing: the second step of the distributed processing mode produces partial results only
+     *
+     * \return Status of computations
+     */
+    virtual services::Status finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__BACON_OUTLIER_DETECTION__DISTRIBUTED"></a>
+ * \brief Computes the BACON outlier detection in the distributed processing mode.
+ *        Every iteration of the algorithm runs the first step on each local node and the second step on the master node.
+ *        The iterations stop when the convergenceFlag computed on the master node is set;
+ *        the partialWeights computed on the local nodes in the last iteration are the outlier detection results.
+ *        Only the baconMahalanobis initialization method is supported in this mode
+ * <!-- \n<a href="DAAL-REF-BACON_OUTLIER_DETECTION-ALGORITHM">BACON outlier detection algorithm description and usage models</a> -->
+ *
+ * \tparam step             Step of the distributed processing mode, \ref ComputeStep
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the BACON outlier detection, double or float
+ * \tparam method           BACON outlier detection computation method, \ref daal::algorithms::bacon_outlier_detection::Method
+ *
+ * \par Enumerations
+ *      - \ref Method                       Computation methods for the BACON outlier detection
+ *      - \ref InputId                      Identifiers of input objects for the BACON outlier detection
+ *      - \ref Step1LocalInputId            Identifiers of optional input objects in the first step
+ *      - \ref PartialResultId              Identifiers of partial results in the first step
+ *      - \ref MasterInputId                Identifiers of input objects in the second step
+ *      - \ref DistributedPartialResultId   Identifiers of partial results in the second step
+ */
+template<ComputeStep step, typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class DAAL_EXPORT Distributed {};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__BACON_OUTLIER_DETECTION__DISTRIBUTED_STEP1LOCAL_ALGORITHMFPTYPE_METHOD"></a>
+ * \brief Computes the BACON outlier detection in the first step of the distributed processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the BACON outlier detection, double or float
+ * \tparam method           BACON outlier detection computation method, \ref daal::algorithms::bacon_outlier_detection::Method
+ */
+template<typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step1Local, algorithmFPType, method> : public daal::algorithms::Analysis<distributed>
+{
+public:
+    /** Default constructor */
+    Distributed() : parameter(baconMahalanobis)
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs an algorithm for computing BACON outlier detection by copying input objects and parameters
+     * of another algorithm for computing BACON outlier detection
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step1Local, algorithmFPType, method> &other) : input(other.input), parameter(other.parameter)
+    {
+        initialize();
+    }
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int) method; }
+
+    /**
+     * Returns the structure that contains computed partial results
+     * \return Structure that contains computed partial results
+     */
+    PartialResultPtr getPartialResult()
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Registers user-allocated memory to store partial results of the BACON outlier detection algorithm
+     * \param[in] partialResult  Structure for storing partial results of the BACON outlier detection algorithm
+     *
+     * \return Status of computations
+     */
+    services::Status setPartialResult(const PartialResultPtr& partialResult)
+    {
+        DAAL_CHECK(partialResult, services::ErrorNullPartialResult);
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated algorithm for computing BACON outlier detection
+     * with a copy of input objects and parameters of this algorithm for computing BACON outlier detection
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step1Local, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step1Local, algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Distributed<step1Local, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step1Local, algorithmFPType, method>(*this);
+    }
+
+    virtual services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        return services::Status();
+    }
+
+    virtual services::Status allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _partialResult->allocate<algorithmFPType>(&input, &parameter, (int) method);
+        _pres = _partialResult.get();
+        return s;
+    }
+
+    virtual services::Status initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        return services::Status();
+    }
+
+    void initialize()
+    {
+        Analysis<distributed>::_ac = new __DAAL_ALGORITHM_CONTAINER(distributed, DistributedContainer, step1Local, algorithmFPType, method)(&_env);
+        _in = &input;
+        _par = &parameter;
+        _partialResult.reset(new PartialResult());
+    }
+
+public:
+    DistributedStep1LocalInput input;   /*!< %Input object */
+    Parameter parameter;                /*!< Algorithm parameters */
+
+private:
+    PartialResultPtr _partialResult;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__BACON_OUTLIER_DETECTION__DISTRIBUTED_STEP2MASTER_ALGORITHMFPTYPE_METHOD"></a>
+ * \brief Computes the BACON outlier detection in the second step of the distributed processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the BACON outlier detection, double or float
+ * \tparam method           BACON outlier detection computation method, \ref daal::algorithms::bacon_outlier_detection::Method
+ */
+template<typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step2Master, algorithmFPType, method> : public daal::algorithms::Analysis<distributed>
+{
+public:
+    /** Default constructor */
+    Distributed() : parameter(baconMahalanobis)
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs an algorithm for computing BACON outlier detection by copying input objects and parameters
+     * of another algorithm for computing BACON outlier detection
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step2Master, algorithmFPType, method> &other) : input(other.input), parameter(other.parameter)
+    {
+        initialize();
+    }
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int) method; }
+
+    /**
+     * Returns the structure that contains computed partial results
+     * \return Structure that contains computed partial results
+     */
+    DistributedPartialResultPtr getPartialResult()
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Registers user-allocated memory to store partial results of the BACON outlier detection algorithm
+     * \param[in] partialResult  Structure for storing partial results of the BACON outlier detection algorithm
+     *
+     * \return Status of computations
+     */
+    services::Status setPartialResult(const DistributedPartialResultPtr& partialResult)
+    {
+        DAAL_CHECK(partialResult, services::ErrorNullPartialResult);
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated algorithm for computing BACON outlier detection
+     * with a copy of input objects and parameters of this algorithm for computing BACON outlier detection
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step2Master, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step2Master, algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Distributed<step2Master, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step2Master, algorithmFPType, method>(*this);
+    }
+
+    virtual services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        return services::Status();
+    }
+
+    virtual services::Status allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _partialResult->allocate<algorithmFPType>(&input, &parameter, (int) method);
+        _pres = _partialResult.get();
+        return s;
+    }
+
+    virtual services::Status initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        return services::Status();
+    }
+
+    void initialize()
+    {
+        Analysis<distributed>::_ac = new __DAAL_ALGORITHM_CONTAINER(distributed, DistributedContainer, step2Master, algorithmFPType, method)(&_env);
+        _in = &input;
+        _par = &parameter;
+        _partialResult.reset(new DistributedPartialResult());
+    }
+
+public:
+    DistributedStep2MasterInput input;  /*!< %Input object */
+    Parameter parameter;                /*!< Algorithm parameters */
+
+private:
+    DistributedPartialResultPtr _partialResult;
+};
+/** @} */
+} // namespace interface1
+using interface1::DistributedContainer;
+using interface1::Distributed;
+
+} // namespace bacon_outlier_detection
+} // namespace algorithm
+} // namespace daal
+#endif
@@ -50,6 +50,7 @@
 
 #include "algorithms/algorithm.h"
 #include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/data_collection.h"
 
 namespace daal
 {
@@ -81,7 +82,7 @@ enum Method
  */
 enum InitializationMethod
 {
-    baconMedian = 0,            /*!< Median-based method */
+    baconMedian = 0,            /*!< Median-based method. Supported in the batch processing mode only */
     baconMahalanobis = 1        /*!< Mahalanobis distance-based method */
 };
 
@@ -103,6 +104,72 @@ enum ResultId
     weights = 0 /*!< Outlier detection results */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__BACON_OUTLIER_DETECTION__STEP1LOCALINPUTID"></a>
+ * Available identifiers of optional input objects for the BACON outlier detection algorithm
+ * in the first step of the distributed processing mode
+ */
+enum Step1LocalInputId
+{
+    inputBasicSubsetMean = 1,       /*!< Mean of the current basic subset, 1 x p table */
+    inputBasicSubsetCovariance = 2, /*!< Variance-covariance matrix of the current basic subset, p x p table */
+    inputBasicSubsetThreshold = 3,  /*!< Threshold on the Mahalanobis distance that defines the next basic subset, 1 x 1 table */
+    lastStep1LocalInputId = inputBasicSubsetThreshold
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__BACON_OUTLIER_DETECTION__PARTIALRESULTID"></a>
+ * Available identifiers of partial results of the BACON outlier detection algorithm
+ * in the first step of the distributed processing mode
+ */
+enum PartialResultId
+{
+    nObservations = 0,          /*!< Number of observations processed on the local node */
+    nSubsetObservations = 1,    /*!< Number of local observations that belong to the basic subset */
+    partialSum = 2,             /*!< Sums of the local observations that belong to the basic subset, shifted by partialShift */
+    partialCrossProduct = 3,    /*!< Cross-product matrix of the local observations that belong to the basic subset,
+                                     shifted by partialShift */
+    partialWeights = 4,         /*!< Local basic subset indicators: 1 for observations in the basic subset, 0 otherwise */
+    partialShift = 5,           /*!< Vector the local observations are shifted by before the sums and the cross-product are computed */
+    lastPartialResultId = partialShift
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__BACON_OUTLIER_DETECTION__MASTERINPUTID"></a>
+ * Available identifiers of input objects for the BACON outlier detection algorithm
+ * in the second step of the distributed processing mode
+ */
+enum MasterInputId
+{
+    partialResults = 0  /*!< Collection of partial results computed on local nodes */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__BACON_OUTLIER_DETECTION__MASTERNUMERICTABLEINPUTID"></a>
+ * Available identifiers of optional numeric table input objects for the BACON outlier detection algorithm
+ * in the second step of the distributed processing mode
+ */
+enum MasterNumericTableInputId
+{
+    inputBasicSubsetSize = 1,   /*!< Size of the basic subset computed on the previous iteration, 1 x 1 table */
+    lastMasterNumericTableInputId = inputBasicSubsetSize
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__BACON_OUTLIER_DETECTION__DISTRIBUTEDPARTIALRESULTID"></a>
+ * Available identifiers of partial results of the BACON outlier detection algorithm
+ * in the second step of the distributed processing mode
+ */
+enum DistributedPartialResultId
+{
+    basicSubsetMean = 0,        /*!< Mean of the basic subset */
+    basicSubsetCovariance = 1,  /*!< Variance-covariance matrix of the basic subset */
+    basicSubsetThreshold = 2,   /*!< Threshold on the Mahalanobis distance that defines the next basic subset */
+    basicSubsetSize = 3,        /*!< Number of observations in the basic subset */
+    convergenceFlag = 4,        /*!< 1 if the size of the basic subset has converged, 0 otherwise */
+    lastDistributedPartialResultId = convergenceFlag
+};
+
 /**
  * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
  */
@@ -121,7 +188,8 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     Parameter(InitializationMethod initMethod = baconMedian,
               double alpha = 0.05, double toleranceToConverge = 0.005);
 
-    InitializationMethod initMethod;   /*!< Initialization method, \ref InitializationMethod */
+    InitializationMethod initMethod;   /*!< Initialization method, \ref InitializationMethod.
+                                            The distributed processing mode supports baconMahalanobis only */
     double alpha;                           /*!< One-tailed probability that defines the \f$(1 - \alpha)\f$ quantile
                                                  of the \f$\chi^2\f$ distribution with \f$p\f$ degrees of freedom.
                                                  Recommended value: \f$\alpha / n\f$, where n is the number of observations. */
@@ -165,6 +233,9 @@ public:
      * \return Status of computations
     */
     services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    Input(size_t nElements);
 };
 
 /**
@@ -225,12 +296,251 @@ protected:
 };
 typedef services::SharedPtr<Result> ResultPtr;
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__BACON_OUTLIER_DETECTION__DISTRIBUTEDSTEP1LOCALINPUT"></a>
+ * \brief %Input objects for the BACON outlier detection algorithm in the first step of the distributed processing mode.
+ *        The basic subset inputs are optional: if they are not set, all the local observations form the basic subset
+ */
+class DAAL_EXPORT DistributedStep1LocalInput : public Input
+{
+public:
+    DistributedStep1LocalInput();
+    DistributedStep1LocalInput(const DistributedStep1LocalInput& other);
+
+    virtual ~DistributedStep1LocalInput() {}
+
+    using Input::get;
+    using Input::set;
+
+    /**
+     * Returns input object for the BACON outlier detection algorithm in the first step of the distributed processing mode
+     * \param[in] id    Identifier of the %input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(Step1LocalInputId id) const;
+
+    /**
+     * Sets input object for the BACON outlier detection algorithm in the first step of the distributed processing mode
+     * \param[in] id    Identifier of the %input object
+     * \param[in] ptr   Pointer to the input object
+     */
+    void set(Step1LocalInputId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Checks input object for the BACON outlier detection algorithm in the first step of the distributed processing mode
+     * \param[in] par     Algorithm parameters
+     * \param[in] method  Computation method for the algorithm
+     *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__BACON_OUTLIER_DETECTION__PARTIALRESULT"></a>
+ * \brief Partial results obtained with the compute() method of the BACON outlier detection algorithm
+ *        in the first step of the distributed processing mode
+ */
+class DAAL_EXPORT PartialResult : public daal::algorithms::PartialResult
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(PartialResult);
+    PartialResult();
+
+    virtual ~PartialResult() {};
+
+    /**
+     * Allocates memory to store partial results of the BACON outlier detection algorithm
+     * \tparam algorithmFPType  Data type to use for storing results, double or float
+     * \param[in] input      Pointer to %Input objects of the algorithm
+     * \param[in] parameter  Pointer to the parameters of the algorithm
+     * \param[in] method     Computation method
+     *
+     * \return Status of computations
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Returns partial result of the BACON outlier detection algorithm
+     * \param[in] id   Identifier of the partial result
+     * \return         Partial result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(PartialResultId id) const;
+
+    /**
+     * Sets partial result of the BACON outlier detection algorithm
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the partial result
+     */
+    void set(PartialResultId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Returns the number of features in the partial result
+     * \return Number of features
+     */
+    size_t getNumberOfFeatures() const;
+
+    /**
+     * Checks partial results of the BACON outlier detection algorithm
+     * \param[in] input   Pointer to %Input objects of the algorithm
+     * \param[in] par     Pointer to the parameters of the algorithm
+     * \param[in] method  Computation method
+     *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks partial results of the BACON outlier detection algorithm
+     * \param[in] par     Pointer to the parameters of the algorithm
+     * \param[in] method  Computation method
+     *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<PartialResult> PartialResultPtr;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__BACON_OUTLIER_DETECTION__DISTRIBUTEDSTEP2MASTERINPUT"></a>
+ * \brief %Input objects for the BACON outlier detection algorithm in the second step of the distributed processing mode
+ */
+class DAAL_EXPORT DistributedStep2MasterInput : public daal::algorithms::Input
+{
+public:
+    DistributedStep2MasterInput();
+    DistributedStep2MasterInput(const DistributedStep2MasterInput& other);
+
+    virtual ~DistributedStep2MasterInput() {}
+
+    /**
+     * Returns an input object for the BACON outlier detection algorithm in the second step of the distributed processing mode
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(MasterInputId id) const;
+
+    /**
+     * Returns an optional input object for the BACON outlier detection algorithm in the second step of the distributed processing mode
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(MasterNumericTableInputId id) const;
+
+    /**
+     * Sets an input object for the BACON outlier detection algorithm in the second step of the distributed processing mode
+     * \param[in] id    Identifier of the input object
+     * \param[in] ptr   Pointer to the object
+     */
+    void set(MasterInputId id, const data_management::DataCollectionPtr &ptr);
+
+    /**
+     * Sets an optional input object for the BACON outlier detection algorithm in the second step of the distributed processing mode
+     * \param[in] id    Identifier of the input object
+     * \param[in] ptr   Pointer to the object
+     */
+    void set(MasterNumericTableInputId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Adds partial results computed on local nodes to the input for the BACON outlier detection algorithm
+     * in the second step of the distributed processing mode
+     * \param[in] id    Identifier of the input object
+     * \param[in] value Pointer to the object
+     */
+    void add(MasterInputId id, const PartialResultPtr &value);
+
+    /**
+     * Checks an input object for the BACON outlier detection algorithm in the second step of the distributed processing mode
+     * \param[in] par     Algorithm parameter
+     * \param[in] method  Computation method
+     *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__BACON_OUTLIER_DETECTION__DISTRIBUTEDPARTIALRESULT"></a>
+ * \brief Partial results obtained with the compute() method of the BACON outlier detection algorithm
+ *        in the second step of the distributed processing mode.
+ *        The basic subset mean, covariance and threshold are the inputs of the first step on the next iteration
+ */
+class DAAL_EXPORT DistributedPartialResult : public daal::algorithms::PartialResult
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(DistributedPartialResult);
+    DistributedPartialResult();
+
+    virtual ~DistributedPartialResult() {};
+
+    /**
+     * Allocates memory to store partial results of the BACON outlier detection algorithm
+     * in the second step of the distributed processing mode
+     * \tparam algorithmFPType  Data type to use for storing results, double or float
+     * \param[in] input      Pointer to %Input objects of the algorithm
+     * \param[in] parameter  Pointer to the parameters of the algorithm
+     * \param[in] method     Computation method
+     *
+     * \return Status of computations
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Returns partial result of the BACON outlier detection algorithm
+     * \param[in] id   Identifier of the partial result
+     * \return         Partial result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(DistributedPartialResultId id) const;
+
+    /**
+     * Sets partial result of the BACON outlier detection algorithm
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the partial result
+     */
+    void set(DistributedPartialResultId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Checks partial results of the BACON outlier detection algorithm in the second step of the distributed processing mode
+     * \param[in] input   Pointer to %Input objects of the algorithm
+     * \param[in] par     Pointer to the parameters of the algorithm
+     * \param[in] method  Computation method
+     *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<DistributedPartialResult> DistributedPartialResultPtr;
+
 /** @} */
 } // namespace interface1
 using interface1::Parameter;
 using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
+using interface1::DistributedStep1LocalInput;
+using interface1::PartialResult;
+using interface1::PartialResultPtr;
+using interface1::DistributedStep2MasterInput;
+using interface1::DistributedPartialResult;
+using interface1::DistributedPartialResultPtr;
 
 } // namespace bacon_outlier_detection
 } // namespace algorithm
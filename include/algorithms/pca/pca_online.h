@@ -129,6 +129,33 @@ public:
     services::Status finalizeCompute() DAAL_C11_OVERRIDE;
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PCA__ONLINECONTAINER_ALGORITHMFPTYPE_RANDOMIZEDDENSE_CPU"></a>
+ * \brief Class containing methods to compute the results of the PCA algorithm
+ */
+template<typename algorithmFPType, CpuType cpu>
+class DAAL_EXPORT OnlineContainer<algorithmFPType, randomizedDense, cpu> : public AnalysisContainerIface<online>
+{
+public:
+    /**
+     * Constructs a container for the PCA algorithm with a specified environment
+     * in the online processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    OnlineContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    ~OnlineContainer();
+
+    /**
+     * Computes a partial result of the PCA algorithm in the online processing mode
+     */
+    services::Status compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes the result of the PCA algorithm in the online processing mode
+     */
+    services::Status finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__PCA__ONLINE"></a>
  * \brief Computes the results of the PCA algorithm
@@ -398,6 +425,137 @@ protected:
         _result.reset(new Result());
     }
 };
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PCA__ONLINE_ALGORITHMFPTYPE_RANDOMIZEDDENSE"></a>
+ * \brief Computes the results of the PCA randomized algorithm
+ * <!-- \n<a href="DAAL-REF-PCA-ALGORITHM">PCA algorithm description and usage models</a> -->
+ *
+ * The data blocks are processed in a single pass, so the power iterations of the batch method are not applied
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the PCA algorithm, double or float
+ */
+template<typename algorithmFPType>
+class DAAL_EXPORT Online<algorithmFPType, randomizedDense> : public Analysis<online>
+{
+public:
+    /** Default constructor */
+    Online()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs a PCA algorithm by copying input objects and parameters of another PCA algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Online(const Online<algorithmFPType, randomizedDense> &other) : input(other.input), parameter(other.parameter)
+    {
+        initialize();
+    }
+
+    ~Online() {}
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    int getMethod() const DAAL_C11_OVERRIDE { return(int)randomizedDense; }
+
+    /**
+     * Registers user-allocated  memory to store the results of the PCA algorithm
+     * \param[in] partialResult    Structure for storing partial result of the PCA algorithm
+     */
+    services::Status setPartialResult(const services::SharedPtr<PartialResult<randomizedDense> >& partialResult)
+    {
+        DAAL_CHECK(partialResult, services::ErrorNullPartialResult);
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+        return services::Status();
+    }
+
+    /**
+     * Registers user-allocated memory to store the results of the PCA algorithm
+     * \param[in] res    Structure to store the results of the PCA algorithm
+     */
+    services::Status setResult(const ResultPtr& res)
+    {
+        DAAL_CHECK(res, services::ErrorNullResult)
+        _result = res;
+        _res = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns the structure that contains partial results of the PCA algorithm
+     * \return Structure that contains partial results of the PCA algorithm
+     */
+    services::SharedPtr<PartialResult<randomizedDense> > getPartialResult()
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Returns structure that contains the results of the PCA algorithm
+     * \return Structure that contains the results of the PCA algorithm
+     */
+    ResultPtr getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Returns a pointer to the newly allocated PCA algorithm
+     * with a copy of input objects and parameters of this PCA algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Online<algorithmFPType, randomizedDense> > clone() const
+    {
+        return services::SharedPtr<Online<algorithmFPType, randomizedDense> >(cloneImpl());
+    }
+
+    Input input; /*!< Input data structure */
+    OnlineParameter<algorithmFPType, randomizedDense> parameter; /*!< Parameters */
+
+protected:
+    services::SharedPtr<PartialResult<randomizedDense> > _partialResult;
+    ResultPtr _result;
+
+    virtual Online<algorithmFPType, randomizedDense> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Online<algorithmFPType, randomizedDense>(*this);
+    }
+
+    services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _result->allocate<algorithmFPType>(_pres, &parameter, randomizedDense);
+        _res = _result.get();
+        return s;
+    }
+
+    services::Status allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _partialResult->allocate<algorithmFPType>(&input, &parameter, randomizedDense);
+        _pres = _partialResult.get();
+        return s;
+    }
+
+    services::Status initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _partialResult->initialize<algorithmFPType>(&input, &parameter, randomizedDense);
+        _pres = _partialResult.get();
+        return s;
+    }
+
+    void initialize()
+    {
+        _ac  = new __DAAL_ALGORITHM_CONTAINER(online, OnlineContainer, algorithmFPType, randomizedDense)(&_env);
+        _in = &input;
+        _par = &parameter;
+        _partialResult.reset(new PartialResult<randomizedDense>());
+        _result.reset(new Result());
+    }
+};
 /** @} */
 } // namespace interface1
 using interface1::OnlineContainer;
@@ -80,7 +80,9 @@ enum Method
 {
     correlationDense = 0, /*!< PCA Correlation method */
     defaultDense = 0, /*!< PCA Default method */
-    svdDense = 1 /*!< PCA SVD method */
+    svdDense = 1, /*!< PCA SVD method */
+    randomizedDense = 2 /*!< PCA randomized method that computes the leading nComponents principal components
+                             with a randomized range finder */
 };
 
 /**
@@ -148,6 +150,19 @@ enum PartialSVDCollectionResultId
     lastPartialSVDCollectionResultId = distributedInputs
 };
 
+/**
+    * <a name="DAAL-ENUM-ALGORITHMS__PCA__PARTIALRANDOMIZEDRESULTID"></a>
+    * Available identifiers of partial results of the PCA randomized algorithm
+    */
+enum PartialRandomizedResultId
+{
+    nObservationsRandomized, /* Number of processed observations */
+    sumRandomized,           /* Feature sums of the processed data */
+    sumSquaresRandomized,    /* Feature sums of squares of the processed data */
+    sketchRandomized,        /* Transposed random sketch (X'X * Omega)' of the cross-product of the processed data */
+    lastPartialRandomizedResultId = sketchRandomized
+};
+
 /**
     * <a name="DAAL-ENUM-ALGORITHMS__PCA__RESULTID"></a>
     * Available identifiers of the results of the PCA algorithm
@@ -471,6 +486,84 @@ protected:
     }
 };
 
+/**
+    * <a name="DAAL-CLASS-PCA__PARTIALRESULT"></a>
+    * \brief Provides methods to access partial results obtained with the compute() method of the PCA randomized algorithm
+    *        in the online or distributed processing mode
+    */
+template<> class DAAL_EXPORT PartialResult<daal::algorithms::pca::randomizedDense> : public PartialResultBase
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(PartialResult<daal::algorithms::pca::randomizedDense>);
+    PartialResult();
+
+    /**
+        * Gets partial results of the PCA randomized algorithm
+        * \param[in] id    Identifier of the input object
+        * \return          Input object that corresponds to the given identifier
+        */
+    data_management::NumericTablePtr get(PartialRandomizedResultId id) const;
+
+    virtual size_t getNFeatures() const DAAL_C11_OVERRIDE;
+
+    /**
+        * Sets partial result of the PCA randomized algorithm
+        * \param[in] id      Identifier of the result
+        * \param[in] value   Pointer to the object
+        */
+    void set(const PartialRandomizedResultId id, const data_management::NumericTablePtr &value);
+
+    virtual ~PartialResult() {};
+
+    /**
+    * Checks partial results of the PCA randomized algorithm
+    * \param[in] input      %Input object of the algorithm
+    * \param[in] parameter  Algorithm %parameter
+    * \param[in] method     Computation method
+    * \return Errors detected while checking
+    */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+    * Checks partial results of the PCA randomized algorithm
+    * \param[in] par        Algorithm %parameter
+    * \param[in] method     Computation method
+    * \return Errors detected while checking
+    */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+        * Allocates memory to store partial results of the PCA randomized algorithm
+        * \param[in] input     Pointer to an object containing input data
+        * \param[in] parameter Pointer to the structure of algorithm parameters
+        * \param[in] method    Computation method
+        * \return Status of allocation
+        */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+        * Initializes memory to store partial results of the PCA randomized algorithm
+        * \param[in] input     Pointer to an object containing input data
+        * \param[in] parameter Pointer to the structure of algorithm parameters
+        * \param[in] method    Computation method
+        * \return Status of initialization
+        */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status initialize(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+protected:
+
+    services::Status checkImpl(size_t nFeatures) const;
+
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+
 /**
     * <a name="DAAL-CLASS-ALGORITHMS__PCA__BASEPARAMETER"></a>
     * \brief Class that specifies the common parameters of the PCA algorithm
@@ -531,6 +624,33 @@ public:
     services::Status check() const DAAL_C11_OVERRIDE;
 };
 
+/**
+    * <a name="DAAL-CLASS-ALGORITHMS__PCA__ONLINEPARAMETER_ALGORITHMFPTYPE_RANDOMIZEDDENSE"></a>
+    * \brief Class that specifies the parameters of the PCA randomized algorithm in the online computing mode.
+    *        The data is processed in a single pass: each block updates the sketch X'X * Omega with the Gaussian
+    *        matrix Omega generated from the seed, so the blocks and the nodes must use the same parameters
+    */
+template<typename algorithmFPType>
+class DAAL_EXPORT OnlineParameter<algorithmFPType, randomizedDense> : public BaseParameter<algorithmFPType, randomizedDense>
+{
+public:
+    /**
+     * Constructs PCA parameters
+     * \param[in] nComponents  Number of principal components to compute
+     * \param[in] seed         Seed of the Gaussian test matrix
+     */
+    OnlineParameter(size_t nComponents = 1, size_t seed = 777);
+
+    size_t nComponents; /*!< Number of principal components to compute */
+    size_t seed;        /*!< Seed of the Gaussian test matrix */
+
+    /**
+    * Checks online parameter of the PCA randomized algorithm
+    * \return Errors detected while checking
+    */
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
 /**
     * <a name="DAAL-CLASS-ALGORITHMS__PCA__DISTRIBUTEDPARAMETER"></a>
     * \brief Class that specifies the parameters of the PCA algorithm in the distributed computing mode
@@ -560,6 +680,23 @@ public:
     services::Status check() const DAAL_C11_OVERRIDE;
 };
 
+/**
+    * <a name="DAAL-CLASS-ALGORITHMS__PCA__DISTRIBUTEDPARAMETER_STEP2MASTER_ALGORITHMFPTYPE_RANDOMIZEDDENSE"></a>
+    * \brief Class that specifies the parameters of the PCA randomized algorithm in the distributed computing mode.
+    *        The parameters must be equal to the parameters of the algorithms on local nodes
+    */
+template<typename algorithmFPType>
+class DAAL_EXPORT DistributedParameter<step2Master, algorithmFPType, randomizedDense> : public OnlineParameter<algorithmFPType, randomizedDense>
+{
+public:
+    /**
+     * Constructs PCA parameters
+     * \param[in] nComponents  Number of principal components to compute
+     * \param[in] seed         Seed of the Gaussian test matrix
+     */
+    DistributedParameter(size_t nComponents = 1, size_t seed = 777);
+};
+
 /**
     * <a name="DAAL-CLASS-ALGORITHMS__PCA__DISTRIBUTEDINPUT"></a>
     * \brief Input objects for the PCA algorithm in the distributed processing mode
@@ -671,6 +808,58 @@ public:
     size_t getNFeatures() const DAAL_C11_OVERRIDE;
 };
 
+/**
+    * <a name="DAAL-CLASS-ALGORITHMS__PCA__DISTRIBUTED_INPUT"></a>
+    * \brief Input objects of the PCA randomized algorithm in the distributed processing mode
+    */
+template<> class DAAL_EXPORT DistributedInput<randomizedDense> : public InputIface
+{
+public:
+    DistributedInput();
+    DistributedInput(const DistributedInput& other);
+
+    /**
+        * Sets input objects for the PCA on the second step in the distributed processing mode
+        * \param[in] id    Identifier of the input object
+        * \param[in] ptr   Input object that corresponds to the given identifier
+        */
+    void set(Step2MasterInputId id, const data_management::DataCollectionPtr &ptr);
+
+    /**
+        * Gets input objects for the PCA algorithm on the second step in the distributed processing mode
+        * \param[in] id    Identifier of the input object
+        * \return          Input object that corresponds to the given identifier
+        */
+    data_management::DataCollectionPtr get(Step2MasterInputId id) const;
+
+    /**
+        * Adds input objects of the PCA algorithm on the second step in the distributed processing mode
+        * \param[in] id      Identifier of the input object
+        * \param[in] value   Pointer to the input object
+        */
+    void add(Step2MasterInputId id, const services::SharedPtr<PartialResult<randomizedDense> > &value);
+
+    /**
+        * Retrieves specific partial result from the input objects of the PCA algorithm on the second step in the distributed processing mode
+        * \param[in] id      Identifier of the partial result
+        */
+    services::SharedPtr<PartialResult<randomizedDense> > getPartialResult(size_t id) const;
+
+    /**
+    * Checks the input of the PCA algorithm
+    * \param[in] parameter Algorithm %parameter
+    * \param[in] method    Computation  method
+    * \return Errors detected while checking
+    */
+    services::Status check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+        * Returns the number of columns in the input data set
+        * \return Number of columns in the input data set
+        */
+    size_t getNFeatures() const DAAL_C11_OVERRIDE;
+};
+
 } // namespace interface1
 
 namespace interface2
@@ -746,6 +935,34 @@ public:
 };
 
 
+/**
+* <a name="DAAL-CLASS-ALGORITHMS__PCA__BATCHPARAMETER_ALGORITHMFPTYPE_RANDOMIZEDDENSE"></a>
+* \brief Class that specifies the parameters of the PCA randomized algorithm in the batch computing mode.
+*        The method computes nComponents leading principal components of the correlation matrix
+*        without forming the matrix, nComponents must be positive
+*/
+template<typename algorithmFPType>
+class DAAL_EXPORT BatchParameter<algorithmFPType, randomizedDense> : public BaseBatchParameter
+{
+public:
+    /**
+     * Constructs PCA parameters
+     * \param[in] nPowerIterations  Number of power iterations
+     * \param[in] seed              Seed of the Gaussian test matrix
+     */
+    BatchParameter(size_t nPowerIterations = 2, size_t seed = 777);
+
+    size_t nPowerIterations; /*!< Number of power iterations. Each iteration costs two passes over the data
+                                  and improves the accuracy when the eigenvalues decay slowly */
+    size_t seed;             /*!< Seed of the Gaussian test matrix */
+
+    /**
+    * Checks batch parameter of the PCA randomized algorithm
+    * \return Errors detected while checking
+    */
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
 /**
     * <a name="DAAL-CLASS-ALGORITHMS__PCA__RESULT"></a>
     * \brief Provides methods to access results obtained with the PCA algorithm
@@ -0,0 +1,347 @@
+/* file: pivoted_qr_distributed.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the pivoted QR decomposition algorithm
+//  in the distributed processing mode
+//--
+*/
+
+#ifndef __PIVOTED_QR_DISTRIBUTED_H__
+#define __PIVOTED_QR_DISTRIBUTED_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/qr/qr_distributed.h"
+#include "algorithms/pivoted_qr/pivoted_qr_types.h"
+#include "algorithms/pivoted_qr/pivoted_qr_online.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pivoted_qr
+{
+
+namespace interface1
+{
+/**
+ * @defgroup pivoted_qr_distributed Distributed
+ * @ingroup pivoted_qr
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PIVOTED_QR__DISTRIBUTEDCONTAINER"></a>
+ * \brief Provides methods to run implementations of the pivoted QR decomposition algorithm in the distributed processing mode
+ *
+ * \tparam step             Step of the algorithm in the distributed processing mode, \ref ComputeStep
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the pivoted QR, double or float
+ * \tparam method           Pivoted QR computation method, \ref daal::algorithms::pivoted_qr::Method
+ *
+ */
+template<ComputeStep step, typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT DistributedContainer
+{};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PIVOTED_QR__DISTRIBUTEDCONTAINER_STEP2MASTER_ALGORITHMFPTYPE_METHOD_CPU"></a>
+ * \brief Provides methods to run implementations of the second step of the pivoted QR decomposition algorithm
+ *        in the distributed processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the pivoted QR, double or float
+ * \tparam method           Pivoted QR computation method, \ref daal::algorithms::pivoted_qr::Method
+ *
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT DistributedContainer<step2Master, algorithmFPType, method, cpu> :
+    public daal::algorithms::AnalysisContainerIface<distributed>
+{
+public:
+    /**
+     * Constructs a container for the pivoted QR decomposition algorithm with a specified environment
+     * in the second step of the distributed processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    DistributedContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    virtual ~DistributedContainer();
+    /**
+     * Computes a partial result of the pivoted QR decomposition algorithm in the second step
+     * of the distributed processing mode
+     */
+    virtual services::Status compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes the result of the pivoted QR decomposition algorithm in the second step
+     * of the distributed processing mode
+     */
+    virtual services::Status finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PIVOTED_QR__DISTRIBUTED"></a>
+ * \brief Computes the results of the pivoted QR decomposition algorithm in the distributed processing mode
+ * <!-- \n<a href="DAAL-REF-PIVOTED_QR-ALGORITHM">Pivoted QR algorithm description and usage models</a> -->
+ *
+ * \tparam step             Step of the algorithm in the distributed processing mode, \ref ComputeStep
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the pivoted QR algorithm, double or float
+ * \tparam method           Computation method, only tsqrDense is supported, \ref daal::algorithms::pivoted_qr::Method
+ */
+template<ComputeStep step, typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = tsqrDense>
+class DAAL_EXPORT Distributed : public daal::algorithms::Analysis<distributed> {};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PIVOTED_QR__DISTRIBUTED_STEP1LOCAL_ALGORITHMFPTYPE_METHOD"></a>
+ * \brief Computes the results of the pivoted QR decomposition algorithm on the first step in the distributed processing mode.
+ *        The local nodes compute the QR decomposition of their blocks of rows, this step is the same as in the online mode.
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the pivoted QR algorithm, double or float
+ * \tparam method           Computation method, \ref daal::algorithms::pivoted_qr::Method
+ */
+template<typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step1Local, algorithmFPType, method> : public Online<algorithmFPType, method>
+{
+public:
+    /** Default constructor */
+    Distributed() : Online<algorithmFPType, method>() {}
+
+    /**
+     * Constructs a pivoted QR decomposition algorithm by copying input objects and parameters
+     * of another pivoted QR decomposition algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step1Local, algorithmFPType, method> &other) :
+        Online<algorithmFPType, method>(other)
+    {}
+
+    /**
+     * Returns a pointer to the newly allocated pivoted QR decomposition algorithm
+     * with a copy of input objects and parameters of this pivoted QR decomposition algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step1Local, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step1Local, algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Distributed<step1Local, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step1Local, algorithmFPType, method>(*this);
+    }
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PIVOTED_QR__DISTRIBUTED_STEP2MASTER_ALGORITHMFPTYPE_METHOD"></a>
+ * \brief Computes the results of the pivoted QR decomposition algorithm on the second step in the distributed processing mode.
+ *        The master node computes the pivoted QR decomposition of the stacked R factors received from the local nodes.
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the pivoted QR algorithm, double or float
+ * \tparam method           Computation method, \ref daal::algorithms::pivoted_qr::Method
+ */
+template<typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step2Master, algorithmFPType, method> : public daal::algorithms::Analysis<distributed>
+{
+public:
+    typedef qr::DistributedStep2Input Input;
+
+    Input     input;     /*!< Input data structure */
+    Parameter parameter; /*!< Pivoted QR parameters structure */
+
+    /** Default constructor */
+    Distributed()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs a pivoted QR decomposition algorithm by copying input objects and parameters
+     * of another pivoted QR decomposition algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step2Master, algorithmFPType, method> &other) : input(other.input), parameter(other.parameter)
+    {
+        initialize();
+    }
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Returns the structure that contains the R matrix and the permutation matrix
+     * \return Structure that contains the R matrix and the permutation matrix
+     */
+    ResultPtr getResult()
+    {
+        return _partialResult->get(finalResultFromStep2Master);
+    }
+
+    /**
+     * Returns the structure that contains partial results of the pivoted QR decomposition algorithm
+     * \return Structure that contains partial results of the pivoted QR decomposition algorithm
+     */
+    DistributedPartialResultPtr getPartialResult()
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Sets structure to store partial results of the pivoted QR decomposition algorithm
+     * \param[in] partialRes  Structure to store partial results of the pivoted QR decomposition algorithm
+     */
+    services::Status setPartialResult(const DistributedPartialResultPtr& partialRes)
+    {
+        DAAL_CHECK(partialRes, services::ErrorNullPartialResult);
+        DAAL_CHECK(partialRes->get(finalResultFromStep2Master), services::ErrorNullResult)
+        _partialResult = partialRes;
+        _pres = _partialResult.get();
+        return services::Status();
+    }
+
+    services::Status checkFinalizeComputeParams() DAAL_C11_OVERRIDE
+    {
+        if(_partialResult)
+        {
+            return _partialResult->check(_par, method);
+        }
+        return services::Status(services::ErrorNullResult);
+    }
+
+    /**
+     * Returns a pointer to the newly allocated pivoted QR decomposition algorithm
+     * with a copy of input objects and parameters of this pivoted QR decomposition algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step2Master, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step2Master, algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Distributed<step2Master, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step2Master, algorithmFPType, method>(*this);
+    }
+
+    virtual services::Status allocateResult() DAAL_C11_OVERRIDE { return services::Status(); }
+
+    virtual services::Status allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult.reset(new DistributedPartialResult());
+        services::Status s = _partialResult->allocate<algorithmFPType>(_in, 0, 0);
+        _pres = _partialResult.get();
+        return s;
+    }
+
+    virtual services::Status initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        _pres = _partialResult.get();
+        return services::Status();
+    }
+
+    void initialize()
+    {
+        Analysis<distributed>::_ac = new __DAAL_ALGORITHM_CONTAINER(distributed, DistributedContainer, step2Master, algorithmFPType, method)(&_env);
+        _in   = &input;
+        _par  = &parameter;
+    }
+
+private:
+    DistributedPartialResultPtr _partialResult;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PIVOTED_QR__DISTRIBUTED_STEP3LOCAL_ALGORITHMFPTYPE_METHOD"></a>
+ * \brief Computes the results of the pivoted QR decomposition algorithm on the third step in the distributed processing mode.
+ *        The local nodes multiply their Q factors by the blocks of the Q factor of the stacked R factors,
+ *        this step is the same as in the QR decomposition algorithm.
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the pivoted QR algorithm, double or float
+ * \tparam method           Computation method, \ref daal::algorithms::pivoted_qr::Method
+ */
+template<typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step3Local, algorithmFPType, method> : public qr::Distributed<step3Local, algorithmFPType, qr::defaultDense>
+{
+public:
+    typedef qr::Distributed<step3Local, algorithmFPType, qr::defaultDense> super;
+
+    /** Default constructor */
+    Distributed() : super() {}
+
+    /**
+     * Constructs a pivoted QR decomposition algorithm by copying input objects and parameters
+     * of another pivoted QR decomposition algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step3Local, algorithmFPType, method> &other) : super(other) {}
+
+    /**
+     * Returns a pointer to the newly allocated pivoted QR decomposition algorithm
+     * with a copy of input objects and parameters of this pivoted QR decomposition algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step3Local, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step3Local, algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Distributed<step3Local, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step3Local, algorithmFPType, method>(*this);
+    }
+};
+/** @} */
+} // namespace interface1
+using interface1::DistributedContainer;
+using interface1::Distributed;
+
+} // namespace daal::algorithms::pivoted_qr
+}
+} // namespace daal
+#endif
@@ -53,6 +53,7 @@
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/homogen_numeric_table.h"
 #include "services/daal_defines.h"
+#include "algorithms/qr/qr_types.h"
 
 namespace daal
 {
@@ -73,7 +74,9 @@ namespace pivoted_qr
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default method */
+    defaultDense = 0, /*!< Default method */
+    tsqrDense    = 1  /*!< Parallel QR decomposition of row blocks of the tall-skinny matrix
+                           followed by the pivoted QR decomposition of the stacked R factors */
 };
 
 /**
@@ -98,6 +101,29 @@ enum ResultId
     lastResultId = permutationMatrix
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__PIVOTED_QR__DISTRIBUTEDPARTIALRESULTCOLLECTIONID"></a>
+ * Available types of partial results of the second step of the pivoted QR algorithm stored in DataCollection object
+ * in the distributed processing mode
+ */
+enum DistributedPartialResultCollectionId
+{
+    outputOfStep2ForStep3,    /*!< Partial results of the pivoted QR algorithm to be transferred to the third step
+                                   in the distributed processing mode */
+    lastDistributedPartialResultCollectionId = outputOfStep2ForStep3
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__PIVOTED_QR__DISTRIBUTEDPARTIALRESULTID"></a>
+ * Available types of partial results of the second step of the pivoted QR algorithm stored in Result object
+ * in the distributed processing mode
+ */
+enum DistributedPartialResultId
+{
+    finalResultFromStep2Master = lastDistributedPartialResultCollectionId + 1, /*!< Result object with R matrix and permutation matrix */
+    lastDistributedPartialResultId = finalResultFromStep2Master
+};
+
 /**
  * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
  */
@@ -174,6 +200,24 @@ public:
     template <typename algorithmFPType>
     DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
 
+    /**
+     * Allocates memory for storing final results of the pivoted QR algorithm in the online processing mode
+     * \param[in] partialResult  Pointer to partial result
+     * \param[in] parameter      Pointer to parameter
+     * \param[in] method         Computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Allocates memory for storing final results of the pivoted QR algorithm
+     * \tparam     algorithmFPType  Data type to be used for storage in resulting HomogenNumericTable
+     * \param[in]  nFeatures  Number of columns in the input data set
+     * \param[in]  nVectors   Number of rows in the input data set, matrix Q is not allocated if it is zero
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocateImpl(size_t nFeatures, size_t nVectors);
+
     /**
      * Returns result of the pivoted QR algorithm
      * \param[in] id    Identifier of the result
@@ -196,7 +240,17 @@ public:
     */
     virtual services::Status check(const daal::algorithms::Input *in, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
 
+    /**
+    * Checks the correctness of the result object in the online processing mode
+    * \param[in] pres   Pointer to the partial result
+    * \param[in] par    Pointer to the structure of the algorithm parameters
+    * \param[in] method Computation method
+    */
+    virtual services::Status check(const daal::algorithms::PartialResult *pres, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
 protected:
+    services::Status checkImpl(size_t nFeatures, size_t nVectors) const;
+
     /** \private */
     template<typename Archive, bool onDeserialize>
     services::Status serialImpl(Archive *arch)
@@ -206,12 +260,104 @@ protected:
 };
 typedef services::SharedPtr<Result> ResultPtr;
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PIVOTED_QR__DISTRIBUTEDPARTIALRESULT"></a>
+ * \brief Provides methods to access partial results obtained with the compute() method of the
+ *        second step of the pivoted QR algorithm in the distributed processing mode
+ */
+class DAAL_EXPORT DistributedPartialResult : public daal::algorithms::PartialResult
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(DistributedPartialResult);
+    /** Default constructor */
+    DistributedPartialResult();
+    /** Default destructor */
+    virtual ~DistributedPartialResult() {}
+
+    /**
+     * Allocates memory for storing partial results of the pivoted QR algorithm
+     * \param[in] input      Pointer to input object
+     * \param[in] parameter  Pointer to parameter
+     * \param[in] method     Computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Allocates memory for storing partial results of the pivoted QR algorithm based on known structure of partial results
+     * from the first steps of the algorithm in the distributed processing mode.
+     * KeyValueDataCollection under outputOfStep2ForStep3 is structured the same as KeyValueDataCollection under
+     * qr::inputOfStep2FromStep1 id of the algorithm input
+     * \tparam     algorithmFPType  Data type to be used for storage in resulting HomogenNumericTable
+     * \param[in]  inCollection     KeyValueDataCollection of all partial results from the first steps of the algorithm
+     * \param[out] nBlocks          Number of blocks of the input data set
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status setPartialResultStorage(data_management::KeyValueDataCollection *inCollection, size_t &nBlocks);
+
+    /**
+     * Returns partial result of the pivoted QR algorithm.
+     * KeyValueDataCollection under outputOfStep2ForStep3 id is structured the same as KeyValueDataCollection under
+     * qr::inputOfStep2FromStep1 id of the algorithm input
+     * \param[in] id    Identifier of the partial result
+     * \return          Partial result that corresponds to the given identifier
+     */
+    data_management::KeyValueDataCollectionPtr get(DistributedPartialResultCollectionId id) const;
+
+    /**
+     * Returns the result of the pivoted QR algorithm with the matrix R and the permutation matrix calculated
+     * \param[in] id    Identifier of the result
+     * \return          Result that corresponds to the given identifier
+     */
+    ResultPtr get(DistributedPartialResultId id) const;
+
+    /**
+     * Sets KeyValueDataCollection to store partial result of the pivoted QR algorithm
+     * \param[in] id    Identifier of partial result
+     * \param[in] value Pointer to the KeyValueDataCollection object
+     */
+    void set(DistributedPartialResultCollectionId id, const data_management::KeyValueDataCollectionPtr &value);
+
+    /**
+     * Sets Result object to store the result of the pivoted QR algorithm
+     * \param[in] id    Identifier of the result
+     * \param[in] value Pointer to the Result object
+     */
+    void set(DistributedPartialResultId id, const ResultPtr &value);
+
+    /**
+    * Checks partial results of the algorithm
+    * \param[in] parameter Pointer to parameters
+    * \param[in] method    Computation method
+    */
+    virtual services::Status check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+      * Checks partial results of the algorithm
+      * \param[in] input      Pointer to input objects
+      * \param[in] parameter  Pointer to parameters
+      * \param[in] method     Computation method
+      */
+    virtual services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<DistributedPartialResult> DistributedPartialResultPtr;
+
 /** @} */
 } // namespace interface1
 using interface1::Parameter;
 using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
+using interface1::DistributedPartialResult;
+using interface1::DistributedPartialResultPtr;
 
 } // namespace daal::algorithms::pivoted_qr
 } // namespace daal::algorithms
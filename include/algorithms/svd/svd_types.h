@@ -72,7 +72,8 @@ namespace svd
  */
 enum Method
 {
-    defaultDense    = 0 /*!< Default method */
+    defaultDense    = 0, /*!< Default method */
+    randomizedDense = 1  /*!< Randomized range finder method that computes the leading nComponents singular triplets */
 };
 
 /**
@@ -190,13 +191,23 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
      *  Default constructor
      *  \param[in] _leftSingularMatrix  Format of the matrix of left singular vectors
      *  \param[in] _rightSingularMatrix Format of the matrix of right singular vectors
+     *  \param[in] _nComponents         Number of leading singular triplets computed by the randomizedDense method
+     *  \param[in] _nPowerIterations    Number of power iterations of the randomizedDense method
+     *  \param[in] _seed                Seed of the random sketch of the randomizedDense method
      */
     Parameter(SVDResultFormat _leftSingularMatrix  = requiredInPackedForm,
-              SVDResultFormat _rightSingularMatrix = requiredInPackedForm) :
-        leftSingularMatrix(_leftSingularMatrix), rightSingularMatrix(_rightSingularMatrix) {}
+              SVDResultFormat _rightSingularMatrix = requiredInPackedForm,
+              size_t _nComponents = 0, size_t _nPowerIterations = 2, size_t _seed = 777) :
+        leftSingularMatrix(_leftSingularMatrix), rightSingularMatrix(_rightSingularMatrix),
+        nComponents(_nComponents), nPowerIterations(_nPowerIterations), seed(_seed) {}
 
     SVDResultFormat leftSingularMatrix;  /*!< Format of the matrix of left singular vectors  >*/
     SVDResultFormat rightSingularMatrix; /*!< Format of the matrix of right singular vectors >*/
+    size_t nComponents;                  /*!< Number of leading singular triplets to compute, used by the randomizedDense method only >*/
+    size_t nPowerIterations;             /*!< Number of power (subspace) iterations of the randomizedDense method.
+                                              Each iteration costs two passes over the data and improves accuracy
+                                              when the singular values decay slowly >*/
+    size_t seed;                         /*!< Seed of the Gaussian test matrix of the randomizedDense method >*/
 };
 
 /**
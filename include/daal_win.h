@@ -72,9 +72,13 @@
 #include "data_management/data_source/data_source.h"
 #include "data_management/data_source/data_source_utils.h"
 #include "data_management/data_source/file_data_source.h"
+#include "data_management/data_source/prefetching_data_source.h"
+#include "data_management/data_source/arrow_file_data_source.h"
 #include "data_management/data_source/string_data_source.h"
 #include "data_management/data/aos_numeric_table.h"
 #include "data_management/data/csr_numeric_table.h"
+#include "data_management/data/csc_numeric_table.h"
+#include "data_management/data/bsr_numeric_table.h"
 #include "data_management/data/data_archive.h"
 #include "services/collection.h"
 #include "data_management/data/data_block.h"
@@ -98,6 +102,8 @@
 #include "algorithms/classifier/classifier_predict_types.h"
 #include "algorithms/classifier/classifier_predict.h"
 #include "algorithms/classifier/classifier_model.h"
+#include "algorithms/classifier/multiclass_confusion_matrix_online.h"
+#include "algorithms/classifier/multiclass_confusion_matrix_distributed.h"
 #include "algorithms/kmeans/kmeans_types.h"
 #include "algorithms/kmeans/kmeans_batch.h"
 #include "algorithms/kmeans/kmeans_distributed.h"
@@ -181,6 +187,7 @@
 #include "algorithms/outlier_detection/outlier_detection_univariate.h"
 #include "algorithms/outlier_detection/outlier_detection_bacon_types.h"
 #include "algorithms/outlier_detection/outlier_detection_bacon.h"
+#include "algorithms/outlier_detection/outlier_detection_bacon_distributed.h"
 #include "algorithms/multi_class_classifier/multi_class_classifier_model.h"
 #include "algorithms/multi_class_classifier/multi_class_classifier_train.h"
 #include "algorithms/multi_class_classifier/multi_class_classifier_predict.h"
@@ -213,6 +220,8 @@
 #include "algorithms/qr/qr_distributed.h"
 #include "algorithms/pivoted_qr/pivoted_qr_types.h"
 #include "algorithms/pivoted_qr/pivoted_qr_batch.h"
+#include "algorithms/pivoted_qr/pivoted_qr_online.h"
+#include "algorithms/pivoted_qr/pivoted_qr_distributed.h"
 #include "algorithms/boosting/boosting_model.h"
 #include "algorithms/boosting/boosting_predict.h"
 #include "algorithms/boosting/boosting_training_batch.h"
@@ -241,6 +250,7 @@
 #include "algorithms/neural_networks/neural_networks_training.h"
 #include "algorithms/neural_networks/neural_networks_prediction.h"
 #include "algorithms/neural_networks/neural_networks_training_model.h"
+#include "algorithms/neural_networks/neural_networks_training_batch_provider.h"
 #include "algorithms/neural_networks/neural_networks_training_distributed.h"
 #include "algorithms/neural_networks/neural_networks_prediction_model.h"
 #include "algorithms/neural_networks/neural_networks_types.h"
@@ -338,6 +348,10 @@
 #include "algorithms/optimization_solver/objective_function/sum_of_functions_types.h"
 #include "algorithms/optimization_solver/objective_function/mse_batch.h"
 #include "algorithms/optimization_solver/objective_function/mse_types.h"
+#include "algorithms/optimization_solver/objective_function/logistic_loss_batch.h"
+#include "algorithms/optimization_solver/objective_function/logistic_loss_types.h"
+#include "algorithms/optimization_solver/objective_function/cross_entropy_loss_batch.h"
+#include "algorithms/optimization_solver/objective_function/cross_entropy_loss_types.h"
 #include "algorithms/optimization_solver/optimization_solver_batch.h"
 #include "algorithms/optimization_solver/sgd/sgd_batch.h"
 #include "algorithms/optimization_solver/sgd/sgd_types.h"
@@ -345,6 +359,8 @@
 #include "algorithms/optimization_solver/lbfgs/lbfgs_types.h"
 #include "algorithms/optimization_solver/adagrad/adagrad_batch.h"
 #include "algorithms/optimization_solver/adagrad/adagrad_types.h"
+#include "algorithms/optimization_solver/coordinate_descent/coordinate_descent_batch.h"
+#include "algorithms/optimization_solver/coordinate_descent/coordinate_descent_types.h"
 #include "algorithms/normalization/zscore.h"
 #include "algorithms/normalization/zscore_types.h"
 #include "algorithms/normalization/minmax.h"
@@ -355,6 +371,9 @@
 #include "algorithms/ridge_regression/ridge_regression_training_batch.h"
 #include "algorithms/ridge_regression/ridge_regression_training_online.h"
 #include "algorithms/ridge_regression/ridge_regression_training_distributed.h"
+#include "algorithms/elastic_net/elastic_net_model.h"
+#include "algorithms/elastic_net/elastic_net_training_batch.h"
+#include "algorithms/elastic_net/elastic_net_predict.h"
 #include "algorithms/neural_networks/layers/lcn/lcn_layer.h"
 #include "algorithms/neural_networks/layers/lcn/lcn_layer_types.h"
 #include "algorithms/k_nearest_neighbors/kdtree_knn_classification_model.h"
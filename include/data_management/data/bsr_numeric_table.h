@@ -0,0 +1,660 @@
+/* file: bsr_numeric_table.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of a blocked compressed sparse row (BSR) numeric table.
+//--
+*/
+
+#ifndef __BSR_NUMERIC_TABLE_H__
+#define __BSR_NUMERIC_TABLE_H__
+
+#include "services/base.h"
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/csr_numeric_table.h"
+#include "data_management/data/data_serialize.h"
+
+namespace daal
+{
+namespace data_management
+{
+
+namespace interface1
+{
+/**
+ * @ingroup numeric_tables
+ * @{
+ */
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__BSRNUMERICTABLE"></a>
+ *  \brief Class that provides methods to access data stored in the blocked CSR (BSR) layout.
+ *  The table is split into dense blocks of blockRowSize x blockColumnSize values, and the non-zero blocks
+ *  are stored in the CSR layout of the matrix of blocks. Values of each block are stored row by row.
+ *  The blocks at the right and bottom borders of the table may exceed the table, their values outside of the table are ignored.
+ *
+ *  Sparse blocks of rows are returned in the CSR layout, so the table can be used in place of the CSR numeric table.
+ *  Every stored value of a block row is included in the CSR block, including the zeros inside non-zero blocks
+ */
+class DAAL_EXPORT BSRNumericTable : public NumericTable, public CSRNumericTableIface
+{
+public:
+    DECLARE_SERIALIZABLE_TAG();
+    DECLARE_SERIALIZABLE_IMPL();
+
+    DAAL_CAST_OPERATOR(BSRNumericTable)
+
+    /**
+     *  Constructor for an empty BSR Numeric Table
+     */
+    BSRNumericTable(): NumericTable(0, 0, DictionaryIface::equal), _blockRowSize(1), _blockColumnSize(1)
+    {
+        _layout = bsrArray;
+    }
+
+    /**
+     *  Constructs BSR numeric table with user-allocated memory
+     *  \tparam   DataType          Type of values in the numeric table
+     *  \param[in]    ptr               Array of values of the non-zero blocks, blockRowSize * blockColumnSize values per block
+     *  \param[in]    blockColIndices   Array of one-based column indices of the non-zero blocks in the matrix of blocks
+     *  \param[in]    blockRowOffsets   Array of row offsets of the matrix of blocks. Size of the array is
+     *                                  ceil(nRows / blockRowSize) + 1. The first element is 1.
+     *                                  The last element is the number of non-zero blocks + 1
+     *  \param[in]    nColumns          Number of columns in the corresponding dense table
+     *  \param[in]    nRows             Number of rows in the corresponding dense table
+     *  \param[in]    blockRowSize      Number of rows in a block
+     *  \param[in]    blockColumnSize   Number of columns in a block
+     *  \param[out]   stat              Status of the numeric table construction
+     *  \return BSR numeric table with user-allocated memory
+     */
+    template<typename DataType>
+    static services::SharedPtr<BSRNumericTable> create(const services::SharedPtr<DataType>& ptr,
+                                                       const services::SharedPtr<size_t>& blockColIndices,
+                                                       const services::SharedPtr<size_t>& blockRowOffsets,
+                                                       size_t nColumns, size_t nRows,
+                                                       size_t blockRowSize, size_t blockColumnSize,
+                                                       services::Status *stat = NULL)
+    {
+        DAAL_DEFAULT_CREATE_IMPL_EX(BSRNumericTable, ptr, blockColIndices, blockRowOffsets, nColumns, nRows,
+                                    blockRowSize, blockColumnSize);
+    }
+
+    /**
+     *  Constructs BSR numeric table that holds the same data as the CSR numeric table.
+     *  The conversion runs in parallel over the rows of blocks. Blocks within every row of blocks are sorted by columns
+     *  \param[in]    csrTable          CSR numeric table with float, double or int values and one-based indexing
+     *  \param[in]    blockRowSize      Number of rows in a block
+     *  \param[in]    blockColumnSize   Number of columns in a block
+     *  \param[out]   stat              Status of the numeric table construction
+     *  \return BSR numeric table with the data of csrTable
+     */
+    static services::SharedPtr<BSRNumericTable> create(CSRNumericTable &csrTable, size_t blockRowSize, size_t blockColumnSize,
+                                                       services::Status *stat = NULL);
+
+    virtual ~BSRNumericTable()
+    {
+        freeDataMemoryImpl();
+    }
+
+    /**
+     *  Returns pointers to a data set stored in the BSR layout
+     *  \param[out]    ptr               Array of values of the non-zero blocks
+     *  \param[out]    blockColIndices   Array of column indices of the non-zero blocks
+     *  \param[out]    blockRowOffsets   Array of row offsets of the matrix of blocks
+     */
+    template<typename DataType>
+    services::Status getArrays(DataType **ptr, size_t **blockColIndices, size_t **blockRowOffsets) const
+    {
+        if (ptr) { *ptr = (DataType*)_ptr.get(); }
+        if (blockColIndices) { *blockColIndices = _blockColIndices.get(); }
+        if (blockRowOffsets) { *blockRowOffsets = _blockRowOffsets.get(); }
+        return services::Status();
+    }
+
+    /**
+     *  Sets a pointer to a BSR data set
+     *  \param[in]    ptr               Array of values of the non-zero blocks
+     *  \param[in]    blockColIndices   Array of column indices of the non-zero blocks
+     *  \param[in]    blockRowOffsets   Array of row offsets of the matrix of blocks
+     */
+    template<typename DataType>
+    services::Status setArrays(const services::SharedPtr<DataType>& ptr, const services::SharedPtr<size_t>& blockColIndices,
+                               const services::SharedPtr<size_t>& blockRowOffsets)
+    {
+        freeDataMemoryImpl();
+
+        _ptr = services::reinterpretPointerCast<byte, DataType>(ptr);
+        _blockColIndices = blockColIndices;
+        _blockRowOffsets = blockRowOffsets;
+
+        if( ptr && blockColIndices && blockRowOffsets ) { _memStatus  = userAllocated; }
+        return services::Status();
+    }
+
+    /**
+     *  Allocates memory for a data set
+     *  \param[in]    nBlocks      Number of non-zero blocks
+     *  \param[in]    type         Memory type
+     */
+    services::Status allocateDataMemory(size_t nBlocks, daal::MemType type = daal::dram)
+    {
+        freeDataMemoryImpl();
+
+        if( getNumberOfColumns() == 0 )
+            return services::Status(services::ErrorIncorrectNumberOfFeatures);
+
+        NumericTableFeature &f = (*_ddict)[0];
+        const size_t blockSize = _blockRowSize * _blockColumnSize;
+        const size_t nBlockRows = getNumberOfBlockRows();
+
+        _ptr             = services::SharedPtr<byte>  (   (byte*)daal::services::daal_malloc( nBlocks * blockSize * f.typeSize ), services::ServiceDeleter());
+        _blockColIndices = services::SharedPtr<size_t>((size_t *)daal::services::daal_malloc( nBlocks * sizeof(size_t) ), services::ServiceDeleter());
+        _blockRowOffsets = services::SharedPtr<size_t>((size_t *)daal::services::daal_malloc( (nBlockRows + 1) * sizeof(size_t) ), services::ServiceDeleter());
+
+        _memStatus = internallyAllocated;
+
+        if( !_ptr || !_blockColIndices || !_blockRowOffsets )
+        {
+            freeDataMemoryImpl();
+            return services::Status(services::ErrorMemoryAllocationFailed);
+        }
+
+        _blockRowOffsets.get()[0] = 1;
+        return services::Status();
+    }
+
+    /**
+     *  Returns the number of rows in a block
+     *  \return Number of rows in a block
+     */
+    size_t getBlockRowSize() const { return _blockRowSize; }
+
+    /**
+     *  Returns the number of columns in a block
+     *  \return Number of columns in a block
+     */
+    size_t getBlockColumnSize() const { return _blockColumnSize; }
+
+    /**
+     *  Returns the number of rows in the matrix of blocks
+     *  \return Number of rows in the matrix of blocks
+     */
+    size_t getNumberOfBlockRows() const { return (getNumberOfRows() + _blockRowSize - 1) / _blockRowSize; }
+
+    /**
+     *  Returns the number of non-zero blocks
+     *  \return Number of non-zero blocks
+     */
+    size_t getNumberOfBlocks() const
+    {
+        const size_t nBlockRows = getNumberOfBlockRows();
+        if( nBlockRows > 0 && _blockRowOffsets )
+        {
+            return _blockRowOffsets.get()[nBlockRows] - _blockRowOffsets.get()[0];
+        }
+        return 0;
+    }
+
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<double>(vector_idx, vector_num, rwflag, block);
+    }
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<float>(vector_idx, vector_num, rwflag, block);
+    }
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<int>(vector_idx, vector_num, rwflag, block);
+    }
+
+    services::Status releaseBlockOfRows(BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseTBlock<double>(block);
+    }
+    services::Status releaseBlockOfRows(BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseTBlock<float>(block);
+    }
+    services::Status releaseBlockOfRows(BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseTBlock<int>(block);
+    }
+
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                            ReadWriteMode rwflag, BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<double>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                            ReadWriteMode rwflag, BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<float>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                            ReadWriteMode rwflag, BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<int>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseTBlock<double>(block);
+    }
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseTBlock<float>(block);
+    }
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseTBlock<int>(block);
+    }
+
+    services::Status getSparseBlock(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, CSRBlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        return getSparseTBlock<double>(vector_idx, vector_num, rwflag, block);
+    }
+    services::Status getSparseBlock(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, CSRBlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        return getSparseTBlock<float>(vector_idx, vector_num, rwflag, block);
+    }
+    services::Status getSparseBlock(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, CSRBlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        return getSparseTBlock<int>(vector_idx, vector_num, rwflag, block);
+    }
+
+    services::Status releaseSparseBlock(CSRBlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseSparseTBlock<double>(block);
+    }
+    services::Status releaseSparseBlock(CSRBlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseSparseTBlock<float>(block);
+    }
+    services::Status releaseSparseBlock(CSRBlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseSparseTBlock<int>(block);
+    }
+
+    /**
+     *  Returns the number of values in the CSR layout of the table, that is,
+     *  the number of values of the non-zero blocks that lie inside the table
+     */
+    size_t getDataSize() DAAL_C11_OVERRIDE
+    {
+        const size_t nBlockRows = getNumberOfBlockRows();
+        if( !_blockRowOffsets ) { return 0; }
+
+        size_t dataSize = 0;
+        for( size_t bi = 0; bi < nBlockRows; bi++ )
+        {
+            const size_t nBlockRowValues = getBlockRowValuesSize(bi);
+            dataSize += getBlockRowHeight(bi) * nBlockRowValues;
+        }
+        return dataSize;
+    }
+
+protected:
+    NumericTableFeature _defaultFeature;
+
+    services::SharedPtr<byte> _ptr;
+    services::SharedPtr<size_t> _blockColIndices;
+    services::SharedPtr<size_t> _blockRowOffsets;
+    size_t _blockRowSize;
+    size_t _blockColumnSize;
+
+    template<typename DataType>
+    BSRNumericTable(const services::SharedPtr<DataType>& ptr, const services::SharedPtr<size_t>& blockColIndices,
+                    const services::SharedPtr<size_t>& blockRowOffsets, size_t nColumns, size_t nRows,
+                    size_t blockRowSize, size_t blockColumnSize, services::Status &st):
+        NumericTable(nColumns, nRows, DictionaryIface::equal, st), _blockRowSize(blockRowSize), _blockColumnSize(blockColumnSize)
+    {
+        _layout = bsrArray;
+        if( blockRowSize == 0 || blockColumnSize == 0 )
+        {
+            st.add(services::ErrorIncorrectParameter);
+            return;
+        }
+        st |= setArrays<DataType>(ptr, blockColIndices, blockRowOffsets);
+
+        _defaultFeature.setType<DataType>();
+        st |= _ddict->setAllFeatures( _defaultFeature );
+    }
+
+    services::Status allocateDataMemoryImpl(daal::MemType type = daal::dram) DAAL_C11_OVERRIDE
+    {
+        return services::Status(services::ErrorMethodNotSupported);
+    }
+
+    void freeDataMemoryImpl() DAAL_C11_OVERRIDE
+    {
+        _ptr = services::SharedPtr<byte>();
+        _blockColIndices = services::SharedPtr<size_t>();
+        _blockRowOffsets = services::SharedPtr<size_t>();
+
+        _memStatus  = notAllocated;
+    }
+
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl( Archive *arch )
+    {
+        NumericTable::serialImpl<Archive, onDeserialize>( arch );
+
+        arch->set( _blockRowSize );
+        arch->set( _blockColumnSize );
+
+        size_t nBlocks = 0;
+        if( !onDeserialize )
+        {
+            nBlocks = getNumberOfBlocks();
+        }
+        arch->set( nBlocks );
+
+        if( onDeserialize )
+        {
+            allocateDataMemory( nBlocks );
+        }
+
+        if( getNumberOfColumns() > 0 )
+        {
+            NumericTableFeature &f = (*_ddict)[0];
+
+            arch->set( (char *)_ptr.get(), nBlocks * _blockRowSize * _blockColumnSize * f.typeSize );
+            arch->set( _blockColIndices.get(), nBlocks );
+            arch->set( _blockRowOffsets.get(), getNumberOfBlockRows() + 1 );
+        }
+
+        return services::Status();
+    }
+
+    /* Number of rows of the table covered by the row of blocks */
+    size_t getBlockRowHeight(size_t bi) const
+    {
+        const size_t nRows = getNumberOfRows();
+        return ( (bi + 1) * _blockRowSize <= nRows ? _blockRowSize : nRows - bi * _blockRowSize );
+    }
+
+    /* Number of columns of the table covered by the block in the column of blocks */
+    size_t getBlockColumnWidth(size_t bj) const
+    {
+        const size_t nCols = getNumberOfColumns();
+        return ( (bj + 1) * _blockColumnSize <= nCols ? _blockColumnSize : nCols - bj * _blockColumnSize );
+    }
+
+    /* Number of values in one row of the table that are stored in the row of blocks */
+    size_t getBlockRowValuesSize(size_t bi) const
+    {
+        const size_t *offsets = _blockRowOffsets.get();
+        size_t size = 0;
+        for( size_t k = offsets[bi] - 1; k < offsets[bi + 1] - 1; k++ )
+        {
+            size += getBlockColumnWidth(_blockColIndices.get()[k] - 1);
+        }
+        return size;
+    }
+
+    /* Pointer to the values of the row of the block */
+    byte *getBlockRowPtr(size_t k, size_t r) const
+    {
+        NumericTableFeature &f = (*_ddict)[0];
+        return _ptr.get() + (k * _blockRowSize * _blockColumnSize + r * _blockColumnSize) * f.typeSize;
+    }
+
+    template <typename T>
+    void readValues( size_t n, const byte *src, T *dst ) const
+    {
+        NumericTableFeature &f = (*_ddict)[0];
+        if( data_feature_utils::getIndexNumType<T>() == f.indexType )
+        {
+            for( size_t i = 0; i < n; i++ ) { dst[i] = ((const T *)src)[i]; }
+        }
+        else
+        {
+            data_feature_utils::getVectorUpCast(f.indexType, data_feature_utils::getInternalNumType<T>())( n, const_cast<byte *>(src), dst );
+        }
+    }
+
+    template <typename T>
+    void writeValues( size_t n, const T *src, byte *dst ) const
+    {
+        NumericTableFeature &f = (*_ddict)[0];
+        if( data_feature_utils::getIndexNumType<T>() == f.indexType )
+        {
+            for( size_t i = 0; i < n; i++ ) { ((T *)dst)[i] = src[i]; }
+        }
+        else
+        {
+            data_feature_utils::getVectorDownCast(f.indexType, data_feature_utils::getInternalNumType<T>())( n, const_cast<T *>(src), dst );
+        }
+    }
+
+    template <typename T>
+    services::Status getTBlock(size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T> &block)
+    {
+        size_t ncols = getNumberOfColumns();
+        size_t nobs  = getNumberOfRows();
+        block.setDetails( 0, idx, rwFlag );
+
+        if (idx >= nobs)
+        {
+            block.resizeBuffer( ncols, 0 );
+            return services::Status();
+        }
+
+        nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+
+        if( !block.resizeBuffer( ncols, nrows ) )
+            return services::Status(services::ErrorMemoryAllocationFailed);
+
+        const size_t *offsets = _blockRowOffsets.get();
+        const size_t *blockCols = _blockColIndices.get();
+        T *buffer = block.getBlockPtr();
+
+        for( size_t i = 0; i < ncols * nrows; i++ ) { buffer[i] = (T)0; }
+
+        for( size_t i = idx; i < idx + nrows; i++ )
+        {
+            const size_t bi = i / _blockRowSize;
+            const size_t r  = i % _blockRowSize;
+            for( size_t k = offsets[bi] - 1; k < offsets[bi + 1] - 1; k++ )
+            {
+                const size_t bj = blockCols[k] - 1;
+                readValues<T>( getBlockColumnWidth(bj), getBlockRowPtr(k, r), buffer + (i - idx) * ncols + bj * _blockColumnSize );
+            }
+        }
+        return services::Status();
+    }
+
+    template <typename T>
+    services::Status getTFeature(size_t feat_idx, size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T> &block)
+    {
+        size_t nobs = getNumberOfRows();
+        block.setDetails( feat_idx, idx, rwFlag );
+
+        if (idx >= nobs)
+        {
+            block.resizeBuffer( 1, 0 );
+            return services::Status();
+        }
+
+        nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+
+        if( !block.resizeBuffer( 1, nrows ) )
+            return services::Status(services::ErrorMemoryAllocationFailed);
+
+        const size_t *offsets = _blockRowOffsets.get();
+        const size_t *blockCols = _blockColIndices.get();
+        const size_t bj = feat_idx / _blockColumnSize;
+        const size_t c  = feat_idx % _blockColumnSize;
+        NumericTableFeature &f = (*_ddict)[0];
+        T *buffer = block.getBlockPtr();
+
+        for( size_t i = 0; i < nrows; i++ ) { buffer[i] = (T)0; }
+
+        for( size_t bi = idx / _blockRowSize; bi * _blockRowSize < idx + nrows; bi++ )
+        {
+            size_t k = offsets[bi] - 1;
+            while( k < offsets[bi + 1] - 1 && blockCols[k] - 1 != bj ) { k++; }
+            if( k == offsets[bi + 1] - 1 ) { continue; }
+
+            for( size_t i = (bi * _blockRowSize > idx ? bi * _blockRowSize : idx); i < (bi + 1) * _blockRowSize && i < idx + nrows; i++ )
+            {
+                readValues<T>( 1, getBlockRowPtr(k, i % _blockRowSize) + c * f.typeSize, buffer + i - idx );
+            }
+        }
+        return services::Status();
+    }
+
+    template <typename T>
+    services::Status releaseTBlock( BlockDescriptor<T> &block )
+    {
+        if (!(block.getRWFlag() & (int)writeOnly))
+            block.reset();
+        return services::Status();
+    }
+
+    template <typename T>
+    services::Status getSparseTBlock( size_t idx, size_t nrows, int rwFlag, CSRBlockDescriptor<T> &block )
+    {
+        size_t ncols = getNumberOfColumns();
+        size_t nobs  = getNumberOfRows();
+        block.setDetails( ncols, idx, rwFlag );
+
+        if (idx >= nobs)
+        {
+            block.resizeValuesBuffer( 0 );
+            return services::Status();
+        }
+
+        nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+
+        if( !block.resizeRowsBuffer(nrows) ) { return services::Status(services::ErrorMemoryAllocationFailed); }
+        size_t *rowOffsets = block.getBlockRowIndicesPtr();
+
+        /* Every row of a row of blocks has the same number of values */
+        rowOffsets[0] = 1;
+        for( size_t i = idx; i < idx + nrows; )
+        {
+            const size_t bi = i / _blockRowSize;
+            const size_t rowSize = getBlockRowValuesSize(bi);
+            for( const size_t end = (bi + 1) * _blockRowSize; i < end && i < idx + nrows; i++ )
+            {
+                rowOffsets[i - idx + 1] = rowOffsets[i - idx] + rowSize;
+            }
+        }
+
+        const size_t nValues = rowOffsets[nrows] - 1;
+        if( !block.resizeValuesBuffer(nValues) ) { return services::Status(services::ErrorMemoryAllocationFailed); }
+        services::SharedPtr<size_t> colIndices((size_t *)daal::services::daal_malloc( (nValues ? nValues : 1) * sizeof(size_t) ), services::ServiceDeleter());
+        if( !colIndices ) { return services::Status(services::ErrorMemoryAllocationFailed); }
+        block.setColumnIndicesPtr( colIndices, nValues );
+
+        const size_t *offsets = _blockRowOffsets.get();
+        const size_t *blockCols = _blockColIndices.get();
+        T *values = block.getBlockValuesPtr();
+        size_t *cols = colIndices.get();
+
+        for( size_t i = idx; i < idx + nrows; i++ )
+        {
+            const size_t bi = i / _blockRowSize;
+            const size_t r  = i % _blockRowSize;
+            size_t pos = rowOffsets[i - idx] - 1;
+            for( size_t k = offsets[bi] - 1; k < offsets[bi + 1] - 1; k++ )
+            {
+                const size_t bj = blockCols[k] - 1;
+                const size_t width = getBlockColumnWidth(bj);
+                readValues<T>( width, getBlockRowPtr(k, r), values + pos );
+                for( size_t c = 0; c < width; c++ )
+                {
+                    cols[pos + c] = bj * _blockColumnSize + c + 1;
+                }
+                pos += width;
+            }
+        }
+        return services::Status();
+    }
+
+    template <typename T>
+    services::Status releaseSparseTBlock(CSRBlockDescriptor<T> &block)
+    {
+        if (block.getRWFlag() & (int)writeOnly)
+        {
+            const size_t idx   = block.getRowsOffset();
+            const size_t nrows = block.getNumberOfRows();
+            const size_t *offsets = _blockRowOffsets.get();
+            const size_t *blockCols = _blockColIndices.get();
+            const size_t *rowOffsets = block.getBlockRowIndicesPtr();
+            const T *values = block.getBlockValuesPtr();
+
+            for( size_t i = idx; i < idx + nrows; i++ )
+            {
+                const size_t bi = i / _blockRowSize;
+                const size_t r  = i % _blockRowSize;
+                size_t pos = rowOffsets[i - idx] - 1;
+                for( size_t k = offsets[bi] - 1; k < offsets[bi + 1] - 1; k++ )
+                {
+                    const size_t width = getBlockColumnWidth(blockCols[k] - 1);
+                    writeValues<T>( width, values + pos, getBlockRowPtr(k, r) );
+                    pos += width;
+                }
+            }
+        }
+        block.reset();
+        return services::Status();
+    }
+
+    virtual services::Status setNumberOfColumnsImpl(size_t ncol) DAAL_C11_OVERRIDE
+    {
+        _ddict->setNumberOfFeatures( ncol );
+        _ddict->setAllFeatures( _defaultFeature );
+        return services::Status();
+    }
+};
+typedef services::SharedPtr<BSRNumericTable> BSRNumericTablePtr;
+/** @} */
+} // namespace interface1
+using interface1::BSRNumericTable;
+using interface1::BSRNumericTablePtr;
+
+}
+} // namespace daal
+#endif
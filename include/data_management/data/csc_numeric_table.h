@@ -0,0 +1,609 @@
+/* file: csc_numeric_table.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of a compressed sparse column (CSC) numeric table.
+//--
+*/
+
+#ifndef __CSC_NUMERIC_TABLE_H__
+#define __CSC_NUMERIC_TABLE_H__
+
+#include "services/base.h"
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/csr_numeric_table.h"
+#include "data_management/data/data_serialize.h"
+
+namespace daal
+{
+namespace data_management
+{
+
+namespace interface1
+{
+/**
+ * @ingroup numeric_tables
+ * @{
+ */
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__CSCNUMERICTABLEIFACE"></a>
+ *  \brief Abstract class that defines the interface of CSC numeric tables.
+ *  Sparse blocks of columns are returned in the CSR layout of the transposed table:
+ *  i-th row of the block holds i-th column of the requested range,
+ *  and column indices of the block are row indices of the table
+ */
+class CSCNumericTableIface
+{
+public:
+    virtual ~CSCNumericTableIface() {}
+
+    /**
+     *  Returns number of elements in values array.
+     *
+     *  \return Number of elements in values array.
+     */
+    virtual size_t getDataSize() = 0;
+
+    /**
+     *  Gets a block of feature columns in the CSR layout of the transposed table.
+     *
+     *  \param[in] feature_idx      Index of the first column to include into the block.
+     *  \param[in] feature_num      Number of columns in the block.
+     *  \param[in] rwflag           Flag specifying read/write access to the block of feature columns.
+     *  \param[out] block           The block of feature values.
+     */
+    virtual services::Status getSparseColumnBlock(size_t feature_idx, size_t feature_num, ReadWriteMode rwflag, CSRBlockDescriptor<double> &block) = 0;
+
+    /**
+     *  Gets a block of feature columns in the CSR layout of the transposed table.
+     *
+     *  \param[in] feature_idx      Index of the first column to include into the block.
+     *  \param[in] feature_num      Number of columns in the block.
+     *  \param[in] rwflag           Flag specifying read/write access to the block of feature columns.
+     *  \param[out] block           The block of feature values.
+     */
+    virtual services::Status getSparseColumnBlock(size_t feature_idx, size_t feature_num, ReadWriteMode rwflag, CSRBlockDescriptor<float> &block) = 0;
+
+    /**
+     *  Gets a block of feature columns in the CSR layout of the transposed table.
+     *
+     *  \param[in] feature_idx      Index of the first column to include into the block.
+     *  \param[in] feature_num      Number of columns in the block.
+     *  \param[in] rwflag           Flag specifying read/write access to the block of feature columns.
+     *  \param[out] block           The block of feature values.
+     */
+    virtual services::Status getSparseColumnBlock(size_t feature_idx, size_t feature_num, ReadWriteMode rwflag, CSRBlockDescriptor<int> &block) = 0;
+
+    /**
+     *  Releases a block of feature columns in the CSR layout of the transposed table.
+     *  \param[in] block           The block of feature values.
+     */
+    virtual services::Status releaseSparseColumnBlock(CSRBlockDescriptor<double> &block) = 0;
+
+    /**
+     *  Releases a block of feature columns in the CSR layout of the transposed table.
+     *  \param[in] block           The block of feature values.
+     */
+    virtual services::Status releaseSparseColumnBlock(CSRBlockDescriptor<float> &block) = 0;
+
+    /**
+     *  Releases a block of feature columns in the CSR layout of the transposed table.
+     *  \param[in] block           The block of feature values.
+     */
+    virtual services::Status releaseSparseColumnBlock(CSRBlockDescriptor<int> &block) = 0;
+};
+
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__CSCNUMERICTABLE"></a>
+ *  \brief Class that provides methods to access data stored in the CSC layout.
+ *  The layout gives direct access to the columns of sparse data and is the transposed counterpart of the CSR layout
+ */
+class DAAL_EXPORT CSCNumericTable : public NumericTable, public CSCNumericTableIface
+{
+public:
+    DECLARE_SERIALIZABLE_TAG();
+    DECLARE_SERIALIZABLE_IMPL();
+
+    DAAL_CAST_OPERATOR(CSCNumericTable)
+
+    /**
+     *  Constructor for an empty CSC Numeric Table
+     */
+    CSCNumericTable(): NumericTable(0, 0, DictionaryIface::equal)
+    {
+        _layout = cscArray;
+    }
+
+    /**
+     *  Constructs CSC numeric table with user-allocated memory
+     *  \tparam   DataType        Type of values in the numeric table
+     *  \param[in]    ptr         Array of values in the CSC layout. Let ptr_size denote the size of an array ptr
+     *  \param[in]    rowIndices  Array of one-based row indices in the CSC layout
+     *  \param[in]    colOffsets  Array of column offsets in the CSC layout. Size of the array is ncol+1. The first element is 1.
+     *                            The last element is ptr_size+1
+     *  \param[in]    nColumns    Number of columns in the corresponding dense table
+     *  \param[in]    nRows       Number of rows in the corresponding dense table
+     *  \param[out]   stat        Status of the numeric table construction
+     *  \return CSC numeric table with user-allocated memory
+     */
+    template<typename DataType>
+    static services::SharedPtr<CSCNumericTable> create(const services::SharedPtr<DataType>& ptr,
+                                                       const services::SharedPtr<size_t>& rowIndices,
+                                                       const services::SharedPtr<size_t>& colOffsets,
+                                                       size_t nColumns, size_t nRows,
+                                                       services::Status *stat = NULL)
+    {
+        DAAL_DEFAULT_CREATE_IMPL_EX(CSCNumericTable, ptr, rowIndices, colOffsets, nColumns, nRows);
+    }
+
+    /**
+     *  Constructs CSC numeric table that holds the same data as the CSR numeric table.
+     *  The conversion runs in parallel and keeps row indices within every column sorted
+     *  \param[in]    csrTable    CSR numeric table with float, double or int values and one-based indexing
+     *  \param[out]   stat        Status of the numeric table construction
+     *  \return CSC numeric table with the data of csrTable
+     */
+    static services::SharedPtr<CSCNumericTable> create(CSRNumericTable &csrTable, services::Status *stat = NULL);
+
+    virtual ~CSCNumericTable()
+    {
+        freeDataMemoryImpl();
+    }
+
+    /**
+     *  Returns pointers to a data set stored in the CSC layout
+     *  \param[out]    ptr         Array of values in the CSC layout
+     *  \param[out]    rowIndices  Array of row indices in the CSC layout
+     *  \param[out]    colOffsets  Array of column offsets in the CSC layout
+     */
+    template<typename DataType>
+    services::Status getArrays(DataType **ptr, size_t **rowIndices, size_t **colOffsets) const
+    {
+        if (ptr) { *ptr = (DataType*)_ptr.get(); }
+        if (rowIndices) { *rowIndices = _rowIndices.get(); }
+        if (colOffsets) { *colOffsets = _colOffsets.get(); }
+        return services::Status();
+    }
+
+    /**
+     *  Sets a pointer to a CSC data set
+     *  \param[in]    ptr         Array of values in the CSC layout
+     *  \param[in]    rowIndices  Array of row indices in the CSC layout
+     *  \param[in]    colOffsets  Array of column offsets in the CSC layout
+     */
+    template<typename DataType>
+    services::Status setArrays(const services::SharedPtr<DataType>& ptr, const services::SharedPtr<size_t>& rowIndices,
+                               const services::SharedPtr<size_t>& colOffsets)
+    {
+        freeDataMemoryImpl();
+
+        _ptr = services::reinterpretPointerCast<byte, DataType>(ptr);
+        _rowIndices = rowIndices;
+        _colOffsets = colOffsets;
+
+        if( ptr && rowIndices && colOffsets ) { _memStatus  = userAllocated; }
+        return services::Status();
+    }
+
+    /**
+     *  Allocates memory for a data set
+     *  \param[in]    dataSize     Number of non-zero values
+     *  \param[in]    type         Memory type
+     */
+    services::Status allocateDataMemory(size_t dataSize, daal::MemType type = daal::dram)
+    {
+        freeDataMemoryImpl();
+
+        size_t ncol = getNumberOfColumns();
+
+        if( ncol == 0 )
+            return services::Status(services::ErrorIncorrectNumberOfFeatures);
+
+        NumericTableFeature &f = (*_ddict)[0];
+
+        _ptr        = services::SharedPtr<byte>  (   (byte*)daal::services::daal_malloc( dataSize   * f.typeSize     ), services::ServiceDeleter());
+        _rowIndices = services::SharedPtr<size_t>((size_t *)daal::services::daal_malloc( dataSize   * sizeof(size_t) ), services::ServiceDeleter());
+        _colOffsets = services::SharedPtr<size_t>((size_t *)daal::services::daal_malloc( (ncol + 1) * sizeof(size_t) ), services::ServiceDeleter());
+
+        _memStatus = internallyAllocated;
+
+        if( !_ptr || !_rowIndices || !_colOffsets )
+        {
+            freeDataMemoryImpl();
+            return services::Status(services::ErrorMemoryAllocationFailed);
+        }
+
+        _colOffsets.get()[0] = 1;
+        return services::Status();
+    }
+
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<double>(vector_idx, vector_num, rwflag, block);
+    }
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<float>(vector_idx, vector_num, rwflag, block);
+    }
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<int>(vector_idx, vector_num, rwflag, block);
+    }
+
+    services::Status releaseBlockOfRows(BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseTBlock<double>(block);
+    }
+    services::Status releaseBlockOfRows(BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseTBlock<float>(block);
+    }
+    services::Status releaseBlockOfRows(BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseTBlock<int>(block);
+    }
+
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                            ReadWriteMode rwflag, BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<double>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                            ReadWriteMode rwflag, BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<float>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                            ReadWriteMode rwflag, BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<int>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseTBlock<double>(block);
+    }
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseTBlock<float>(block);
+    }
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseTBlock<int>(block);
+    }
+
+    services::Status getSparseColumnBlock(size_t feature_idx, size_t feature_num, ReadWriteMode rwflag, CSRBlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        return getSparseTBlock<double>(feature_idx, feature_num, rwflag, block);
+    }
+    services::Status getSparseColumnBlock(size_t feature_idx, size_t feature_num, ReadWriteMode rwflag, CSRBlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        return getSparseTBlock<float>(feature_idx, feature_num, rwflag, block);
+    }
+    services::Status getSparseColumnBlock(size_t feature_idx, size_t feature_num, ReadWriteMode rwflag, CSRBlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        return getSparseTBlock<int>(feature_idx, feature_num, rwflag, block);
+    }
+
+    services::Status releaseSparseColumnBlock(CSRBlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseSparseTBlock<double>(block);
+    }
+    services::Status releaseSparseColumnBlock(CSRBlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseSparseTBlock<float>(block);
+    }
+    services::Status releaseSparseColumnBlock(CSRBlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseSparseTBlock<int>(block);
+    }
+
+    size_t getDataSize() DAAL_C11_OVERRIDE
+    {
+        size_t nfeat = getNumberOfColumns();
+        if( nfeat > 0 && _colOffsets )
+        {
+            return _colOffsets.get()[nfeat] - _colOffsets.get()[0];
+        }
+        return 0;
+    }
+
+protected:
+    NumericTableFeature _defaultFeature;
+
+    services::SharedPtr<byte> _ptr;
+    services::SharedPtr<size_t> _rowIndices;
+    services::SharedPtr<size_t> _colOffsets;
+
+    template<typename DataType>
+    CSCNumericTable(const services::SharedPtr<DataType>& ptr, const services::SharedPtr<size_t>& rowIndices, const services::SharedPtr<size_t>& colOffsets,
+                    size_t nColumns, size_t nRows, services::Status &st):
+        NumericTable(nColumns, nRows, DictionaryIface::equal, st)
+    {
+        _layout = cscArray;
+        st |= setArrays<DataType>(ptr, rowIndices, colOffsets);
+
+        _defaultFeature.setType<DataType>();
+        st |= _ddict->setAllFeatures( _defaultFeature );
+    }
+
+    services::Status allocateDataMemoryImpl(daal::MemType type = daal::dram) DAAL_C11_OVERRIDE
+    {
+        return services::Status(services::ErrorMethodNotSupported);
+    }
+
+    void freeDataMemoryImpl() DAAL_C11_OVERRIDE
+    {
+        _ptr = services::SharedPtr<byte>();
+        _rowIndices = services::SharedPtr<size_t>();
+        _colOffsets = services::SharedPtr<size_t>();
+
+        _memStatus  = notAllocated;
+    }
+
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl( Archive *arch )
+    {
+        NumericTable::serialImpl<Archive, onDeserialize>( arch );
+
+        size_t dataSize = 0;
+        if( !onDeserialize )
+        {
+            dataSize = getDataSize();
+        }
+        arch->set( dataSize );
+
+        if( onDeserialize )
+        {
+            allocateDataMemory( dataSize );
+        }
+
+        size_t nfeat = getNumberOfColumns();
+
+        if( nfeat > 0 )
+        {
+            NumericTableFeature &f = (*_ddict)[0];
+
+            arch->set( (char *)_ptr.get(), dataSize * f.typeSize );
+            arch->set( _rowIndices.get(), dataSize );
+            arch->set( _colOffsets.get(), nfeat + 1 );
+        }
+
+        return services::Status();
+    }
+
+    /* Returns the position of the first value of the column with row index not less than rowIdx */
+    size_t findRowInColumn(size_t colIdx, size_t rowIdx) const
+    {
+        const size_t *rowIndices = _rowIndices.get();
+        size_t first = _colOffsets.get()[colIdx] - 1;
+        size_t last  = _colOffsets.get()[colIdx + 1] - 1;
+        while( first < last )
+        {
+            const size_t middle = first + (last - first) / 2;
+            if( rowIndices[middle] - 1 < rowIdx ) { first = middle + 1; }
+            else { last = middle; }
+        }
+        return first;
+    }
+
+    template <typename T>
+    void copyValue( const NumericTableFeature &f, size_t pos, T *dst ) const
+    {
+        if( data_feature_utils::getIndexNumType<T>() == f.indexType )
+        {
+            *dst = ((T *)_ptr.get())[pos];
+        }
+        else
+        {
+            data_feature_utils::getVectorUpCast(f.indexType, data_feature_utils::getInternalNumType<T>())
+            ( 1, _ptr.get() + pos * f.typeSize, dst );
+        }
+    }
+
+    template <typename T>
+    services::Status getTBlock(size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T> &block)
+    {
+        size_t ncols = getNumberOfColumns();
+        size_t nobs  = getNumberOfRows();
+        block.setDetails( 0, idx, rwFlag );
+
+        if (idx >= nobs)
+        {
+            block.resizeBuffer( ncols, 0 );
+            return services::Status();
+        }
+
+        nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+
+        if( !block.resizeBuffer( ncols, nrows ) )
+            return services::Status(services::ErrorMemoryAllocationFailed);
+
+        NumericTableFeature &f = (*_ddict)[0];
+        const size_t *rowIndices = _rowIndices.get();
+        T *buffer = block.getBlockPtr();
+
+        for( size_t i = 0; i < ncols * nrows; i++ ) { buffer[i] = (T)0; }
+
+        for( size_t j = 0; j < ncols; j++ )
+        {
+            const size_t colEnd = _colOffsets.get()[j + 1] - 1;
+            for( size_t k = findRowInColumn(j, idx); k < colEnd && rowIndices[k] - 1 < idx + nrows; k++ )
+            {
+                copyValue<T>(f, k, buffer + (rowIndices[k] - 1 - idx) * ncols + j);
+            }
+        }
+        return services::Status();
+    }
+
+    template <typename T>
+    services::Status getTFeature(size_t feat_idx, size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T> &block)
+    {
+        size_t nobs = getNumberOfRows();
+        block.setDetails( feat_idx, idx, rwFlag );
+
+        if (idx >= nobs)
+        {
+            block.resizeBuffer( 1, 0 );
+            return services::Status();
+        }
+
+        nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+
+        if( !block.resizeBuffer( 1, nrows ) )
+            return services::Status(services::ErrorMemoryAllocationFailed);
+
+        NumericTableFeature &f = (*_ddict)[0];
+        const size_t *rowIndices = _rowIndices.get();
+        T *buffer = block.getBlockPtr();
+
+        for( size_t i = 0; i < nrows; i++ ) { buffer[i] = (T)0; }
+
+        const size_t colEnd = _colOffsets.get()[feat_idx + 1] - 1;
+        for( size_t k = findRowInColumn(feat_idx, idx); k < colEnd && rowIndices[k] - 1 < idx + nrows; k++ )
+        {
+            copyValue<T>(f, k, buffer + rowIndices[k] - 1 - idx);
+        }
+        return services::Status();
+    }
+
+    template <typename T>
+    services::Status releaseTBlock( BlockDescriptor<T> &block )
+    {
+        if (!(block.getRWFlag() & (int)writeOnly))
+            block.reset();
+        return services::Status();
+    }
+
+    template <typename T>
+    services::Status getSparseTBlock( size_t idx, size_t ncols, int rwFlag, CSRBlockDescriptor<T> &block )
+    {
+        size_t nfeat = getNumberOfColumns();
+        size_t nobs  = getNumberOfRows();
+        block.setDetails( nobs, idx, rwFlag );
+        size_t *colOffsets = _colOffsets.get();
+
+        if (idx >= nfeat)
+        {
+            block.resizeValuesBuffer( 0 );
+            return services::Status();
+        }
+
+        ncols = ( idx + ncols < nfeat ) ? ncols : nfeat - idx;
+
+        NumericTableFeature &f = (*_ddict)[0];
+
+        size_t nValues = colOffsets[idx + ncols] - colOffsets[idx];
+
+        if( data_feature_utils::getIndexNumType<T>() == f.indexType )
+        {
+            block.setValuesPtr(&_ptr, _ptr.get() + (colOffsets[idx] - 1) * f.typeSize, nValues);
+        }
+        else
+        {
+            if( !block.resizeValuesBuffer(nValues) ) { return services::Status(services::ErrorMemoryAllocationFailed); }
+
+            data_feature_utils::getVectorUpCast(f.indexType, data_feature_utils::getInternalNumType<T>())
+            ( nValues, _ptr.get() + (colOffsets[idx] - 1) * f.typeSize, block.getBlockValuesPtr() );
+        }
+
+        services::SharedPtr<size_t> shiftedRows(_rowIndices, _rowIndices.get() + (colOffsets[idx] - 1));
+        block.setColumnIndicesPtr( shiftedRows, nValues );
+
+        if( idx == 0 )
+        {
+            block.setRowIndicesPtr( _colOffsets, ncols );
+        }
+        else
+        {
+            if( !block.resizeRowsBuffer(ncols) ) { return services::Status(services::ErrorMemoryAllocationFailed); }
+
+            size_t *col_offsets = block.getBlockRowIndicesSharedPtr().get();
+
+            for(size_t i = 0; i < ncols + 1; i++)
+            {
+                col_offsets[i] = colOffsets[idx + i] - colOffsets[idx] + 1;
+            }
+        }
+        return services::Status();
+    }
+
+    template <typename T>
+    services::Status releaseSparseTBlock(CSRBlockDescriptor<T> &block)
+    {
+        if (block.getRWFlag() & (int)writeOnly)
+        {
+            NumericTableFeature &f = (*_ddict)[0];
+            if (f.indexType != data_feature_utils::getIndexNumType<T>())
+            {
+                size_t ncols = block.getNumberOfRows();
+                size_t idx   = block.getRowsOffset();
+                size_t nValues = _colOffsets.get()[idx + ncols] - _colOffsets.get()[idx];
+
+                data_feature_utils::getVectorDownCast(f.indexType, data_feature_utils::getInternalNumType<T>())
+                        (nValues, block.getBlockValuesPtr(), _ptr.get() + (_colOffsets.get()[idx] - 1) * f.typeSize);
+            }
+        }
+        block.reset();
+        return services::Status();
+    }
+
+    virtual services::Status setNumberOfColumnsImpl(size_t ncol) DAAL_C11_OVERRIDE
+    {
+        _ddict->setNumberOfFeatures( ncol );
+        _ddict->setAllFeatures( _defaultFeature );
+        return services::Status();
+    }
+};
+typedef services::SharedPtr<CSCNumericTableIface> CSCNumericTableIfacePtr;
+typedef services::SharedPtr<CSCNumericTable> CSCNumericTablePtr;
+/** @} */
+} // namespace interface1
+using interface1::CSCNumericTableIface;
+using interface1::CSCNumericTableIfacePtr;
+using interface1::CSCNumericTable;
+using interface1::CSCNumericTablePtr;
+
+}
+} // namespace daal
+#endif
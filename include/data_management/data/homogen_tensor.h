@@ -411,7 +411,7 @@ public:
         {
             return services::Status(services::ErrorNullParameterNotSupported);
         }
-        _ptr = ptr;
+        _ptr = services::reinterpretPointerCast<byte, DataType>(ptr);
         _memStatus = userAllocated;
         return s;
     }
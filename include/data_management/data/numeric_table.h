@@ -167,7 +167,8 @@ public:
     }
 
     /**
-     *  Allocates memory of (nColumns * nRows + auxMemorySize) size
+     *  Allocates memory of (nColumns * nRows + auxMemorySize) size.
+     *  The memory is taken from the pool of reusable blocks if the pool is enabled, see daal_pooled_malloc
      *  \param[in] nColumns      Number of columns
      *  \param[in] nRows         Number of rows
      *  \param[in] auxMemorySize Memory size
@@ -184,7 +185,7 @@ public:
         if ( newSize  > _capacity )
         {
             freeBuffer();
-            _buffer = services::SharedPtr<DataType>((DataType *)daal::services::daal_malloc(newSize), services::ServiceDeleter());
+            _buffer = services::SharedPtr<DataType>((DataType *)daal::services::daal_pooled_malloc(newSize), services::PooledServiceDeleter());
             if ( _buffer != 0 )
             {
                 _capacity = newSize;
@@ -354,6 +355,8 @@ public:
         soa                         = 1,    // 1
         aos                         = 2,    // 2
         csrArray                    = 1 << 4,
+        cscArray                    = 1 << 5,
+        bsrArray                    = 1 << 6,
         upperPackedSymmetricMatrix  = 1 << 8,
         lowerPackedSymmetricMatrix  = 2 << 8,
         upperPackedTriangularMatrix = 1 << 7,
@@ -460,6 +463,8 @@ using interface1::BlockDescriptor;
 using interface1::NumericTableIface;
 
 const int packed_mask = (int)NumericTableIface::csrArray                   |
+                        (int)NumericTableIface::cscArray                   |
+                        (int)NumericTableIface::bsrArray                   |
                         (int)NumericTableIface::upperPackedSymmetricMatrix |
                         (int)NumericTableIface::lowerPackedSymmetricMatrix |
                         (int)NumericTableIface::upperPackedTriangularMatrix |
@@ -0,0 +1,813 @@
+/* file: arrow_file_data_source.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the data source that reads columnar data from Arrow IPC files.
+//--
+*/
+
+#ifndef __ARROW_FILE_DATA_SOURCE_H__
+#define __ARROW_FILE_DATA_SOURCE_H__
+
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string>
+#if !defined(_MSC_VER)
+#include <sys/types.h>
+#endif
+
+#include "services/daal_memory.h"
+#include "data_management/data_source/data_source.h"
+#include "data_management/data/soa_numeric_table.h"
+
+namespace daal
+{
+namespace data_management
+{
+
+namespace interface1
+{
+/**
+ * @ingroup data_sources
+ * @{
+ */
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__ARROWFILEDATASOURCE"></a>
+ *  \brief Specifies methods to access columnar data stored in files of the Arrow IPC file format (Feather V2).
+ *
+ *  Data is loaded into a SOANumericTable one record batch at a time. Every column of the table is an array that
+ *  holds the values of the column buffer read from the file, so no parsing or conversion is done for columns of
+ *  integer and floating-point types. Only the buffers of the projected columns and of the selected record batches
+ *  are read from the file. Null values are replaced with NaN for floating-point columns and with 0 for other columns,
+ *  boolean columns are unpacked into int columns.
+ *  Dictionary-encoded columns cannot be loaded and are skipped by the default projection.
+ *  Files with compressed buffers or big-endian data are not supported.
+ */
+class ArrowFileDataSource : public DataSource
+{
+public:
+    /**
+     *  Main constructor for an Arrow File Data Source
+     *  \param[in]  fileName                        Name of the file that stores data
+     *  \param[in]  doAllocateNumericTable          Flag that specifies whether a Numeric Table
+     *                                              associated with the Data Source is allocated inside the Data Source
+     *  \param[in]  doCreateDictionaryFromContext   Flag that specifies whether a Data %Dictionary
+     *                                              is created from the schema of the file
+     */
+    ArrowFileDataSource(const std::string &fileName,
+                        DataSourceIface::NumericTableAllocationFlag doAllocateNumericTable    = DataSource::notAllocateNumericTable,
+                        DataSourceIface::DictionaryCreationFlag doCreateDictionaryFromContext = DataSource::notDictionaryFromContext) :
+        DataSource(), _file(NULL), _fileSize(0), _nextBatch(0), _batchRows(0), _batchPos(0)
+    {
+        _autoNumericTableFlag = doAllocateNumericTable;
+        _autoDictionaryFlag   = doCreateDictionaryFromContext;
+
+    #if (defined(_MSC_VER)&&(_MSC_VER >= 1400))
+        errno_t error = fopen_s( &_file, fileName.c_str(), "rb" );
+        if(error != 0 || !_file)
+            _file = NULL;
+    #else
+        _file = fopen( fileName.c_str(), "rb" );
+    #endif
+        if( !_file )
+        {
+            this->_status.add(services::throwIfPossible(services::Status(services::ErrorOnFileOpen)));
+            return;
+        }
+
+        services::Status s = readFooter();
+        if(!s)
+            this->_status.add(services::throwIfPossible(s));
+    }
+
+    virtual ~ArrowFileDataSource()
+    {
+        if( _file )
+            fclose( _file );
+    }
+
+    /**
+     *  Returns the number of fields in the schema of the file
+     *  \return Number of fields
+     */
+    size_t getNumberOfFields() const { return _fields.size(); }
+
+    /**
+     *  Returns the name of a field in the schema of the file
+     *  \param[in] idx  Index of the field
+     *  \return Name of the field
+     */
+    std::string getFieldName(size_t idx) const { return (idx < _fields.size() ? _fields[idx].name : std::string()); }
+
+    /**
+     *  Returns the number of record batches in the file
+     *  \return Number of record batches
+     */
+    size_t getNumberOfRecordBatches() const { return _batches.size(); }
+
+    /**
+     *  Sets the fields of the file that are loaded into the numeric table.
+     *  By default all fields of integer, floating-point and boolean types are loaded
+     *  \param[in] fields   Indices of the fields in the schema of the file
+     */
+    services::Status setColumnProjection(const services::Collection<size_t> &fields)
+    {
+        if( _dict )
+            return services::throwIfPossible(services::Status(services::ErrorDictionaryAlreadyAvailable));
+
+        for(size_t i = 0; i < fields.size(); i++)
+        {
+            if( fields[i] >= _fields.size() )
+                return services::throwIfPossible(services::Status(services::ErrorIncorrectParameter));
+            if( !_fields[fields[i]].isLoadable )
+                return services::throwIfPossible(services::Status(services::ErrorArrowTypeUnsupported));
+        }
+        _projection = fields;
+        return services::Status();
+    }
+
+    /**
+     *  Sets the record batches to load and the order of loading, other record batches are skipped without reading.
+     *  By default all record batches are loaded in the order of the file
+     *  \param[in] batches  Indices of the record batches
+     */
+    services::Status selectRecordBatches(const services::Collection<size_t> &batches)
+    {
+        for(size_t i = 0; i < batches.size(); i++)
+        {
+            if( batches[i] >= _batches.size() )
+                return services::throwIfPossible(services::Status(services::ErrorIncorrectParameter));
+        }
+        _selectedBatches = batches;
+        _nextBatch = 0;
+        _batchRows = _batchPos = 0;
+        return services::Status();
+    }
+
+    services::Status createDictionaryFromContext() DAAL_C11_OVERRIDE
+    {
+        if( _dict )
+            return services::throwIfPossible(services::Status(services::ErrorDictionaryAlreadyAvailable));
+        if( !_file )
+            return services::throwIfPossible(services::Status(services::ErrorOnFileOpen));
+
+        setDefaultProjection();
+
+        services::Status s;
+        _dict = DataSourceDictionary::create(&s);
+        if(!s) return services::throwIfPossible(s);
+
+        const size_t nColumns = _projection.size();
+        _dict->setNumberOfFeatures(nColumns);
+        for(size_t i = 0; i < nColumns; i++)
+        {
+            const FieldInfo &field = _fields[_projection[i]];
+            DataSourceFeature &feature = (*_dict)[i];
+            setFeatureType(feature.ntFeature, field.ntType);
+            feature.setFeatureName(field.name);
+        }
+        return s;
+    }
+
+    DataSourceIface::DataSourceStatus getStatus() DAAL_C11_OVERRIDE
+    {
+        if( !_file )
+            return DataSourceIface::notReady;
+        return (_batchPos < _batchRows || _nextBatch < getNumberOfSelectedBatches() ? DataSourceIface::readyForLoad
+                                                                                     : DataSourceIface::endOfData);
+    }
+
+    /**
+     *  Returns the number of rows of the current record batch that are not loaded yet
+     *  \return Number of rows
+     */
+    size_t getNumberOfAvailableRows() DAAL_C11_OVERRIDE
+    {
+        return _batchRows - _batchPos;
+    }
+
+    services::Status allocateNumericTable() DAAL_C11_OVERRIDE
+    {
+        if( _spnt )
+            return services::throwIfPossible(services::Status(services::ErrorNumericTableAlreadyAllocated));
+
+        services::Status s = checkDictionary();
+        if(!s) return s;
+
+        _spnt = SOANumericTable::create(getNumericTableNumberOfColumns(), 0, DictionaryIface::notEqual, &s);
+        return s;
+    }
+
+    void freeNumericTable() DAAL_C11_OVERRIDE
+    {
+        _spnt = NumericTablePtr();
+    }
+
+    using DataSource::loadDataBlock;
+
+    /**
+     *  Loads the rows of the current record batch that are not loaded yet, or the next record batch
+     *  \param[in] nt  SOANumericTable without allocated memory for the columns
+     *  \return Number of loaded rows
+     */
+    size_t loadDataBlock(NumericTable *nt) DAAL_C11_OVERRIDE
+    {
+        return loadDataBlock((size_t)-1, nt);
+    }
+
+    /**
+     *  Loads up to maxRows rows of the current record batch, or of the next record batch.
+     *  Blocks never span record batches, so fewer rows may be loaded at the end of a record batch
+     *  \param[in] maxRows Maximum number of rows to load
+     *  \param[in] nt      SOANumericTable without allocated memory for the columns
+     *  \return Number of loaded rows
+     */
+    size_t loadDataBlock(size_t maxRows, NumericTable *nt) DAAL_C11_OVERRIDE
+    {
+        services::Status s = checkDictionary();
+        setDefaultProjection();
+        SOANumericTable *soaTable = dynamic_cast<SOANumericTable *>(nt);
+        if( s && !soaTable )
+            s.add(services::ErrorIncorrectTypeOfInputNumericTable);
+        if( s && soaTable->getNumberOfColumns() != _projection.size() )
+            s.add(services::ErrorIncorrectNumberOfFeatures);
+        if( s && _batchPos == _batchRows )
+            s.add(readNextBatch());
+        if(!s)
+        {
+            this->_status.add(services::throwIfPossible(s));
+            return 0;
+        }
+
+        const size_t nRows = (maxRows < _batchRows - _batchPos ? maxRows : _batchRows - _batchPos);
+        const size_t nColumns = _projection.size();
+
+        for(size_t j = 0; j < nColumns && s; j++)
+        {
+            const size_t typeSize = (*_dict)[j].ntFeature.typeSize;
+            services::SharedPtr<byte> column(_columns[j], _columns[j].get() + _batchPos * typeSize);
+            s |= setColumnArray(*soaTable, j, column, _fields[_projection[j]].ntType);
+        }
+        if( s )
+        {
+            for(size_t j = 0; j < nColumns; j++)
+            {
+                soaTable->getDictionarySharedPtr()->setFeature((*_dict)[j].ntFeature, j);
+            }
+            s |= soaTable->resize(nRows);
+        }
+        if(!s)
+        {
+            this->_status.add(services::throwIfPossible(s));
+            return 0;
+        }
+
+        _batchPos += nRows;
+        return nRows;
+    }
+
+    size_t getNumericTableNumberOfColumns() DAAL_C11_OVERRIDE
+    {
+        return getNumberOfColumns();
+    }
+
+protected:
+    /* Types of the Arrow schema */
+    enum ArrowTypeId
+    {
+        arrowNull = 1, arrowInt = 2, arrowFloatingPoint = 3, arrowBinary = 4, arrowUtf8 = 5, arrowBool = 6, arrowDecimal = 7,
+        arrowDate = 8, arrowTime = 9, arrowTimestamp = 10, arrowInterval = 11, arrowList = 12, arrowStruct = 13, arrowUnion = 14,
+        arrowFixedSizeBinary = 15, arrowFixedSizeList = 16, arrowMap = 17, arrowDuration = 18, arrowLargeBinary = 19,
+        arrowLargeUtf8 = 20, arrowLargeList = 21
+    };
+
+    enum { recordBatchMessage = 3 };
+
+    struct FieldInfo
+    {
+        FieldInfo() : ntType(data_feature_utils::DAAL_OTHER_T), isBool(false), isLoadable(false), node(0), buffer(0) {}
+        std::string name;
+        data_feature_utils::IndexNumType ntType;
+        bool isBool;
+        bool isLoadable;
+        size_t node;     /* Index of the field node in the record batches */
+        size_t buffer;   /* Index of the validity buffer in the record batches, the data buffer follows it */
+    };
+
+    struct BlockInfo
+    {
+        BlockInfo() : offset(0), metaDataLength(0), bodyLength(0) {}
+        DAAL_INT64 offset;
+        DAAL_INT64 metaDataLength;
+        DAAL_INT64 bodyLength;
+    };
+
+    /* Read-only view of a table of the FlatBuffers format that stores the metadata of Arrow IPC files */
+    struct FlatTable
+    {
+        FlatTable() : buf(NULL), size(0), pos(0), vtable(0), vtableSize(0) {}
+
+        static bool read(const byte *b, size_t bSize, size_t tablePos, FlatTable &t)
+        {
+            if( tablePos + 4 > bSize ) { return false; }
+            int soffset;
+            memcpy(&soffset, b + tablePos, 4);
+            const DAAL_INT64 vtablePos = (DAAL_INT64)tablePos - soffset;
+            if( vtablePos < 0 || (size_t)vtablePos + 4 > bSize ) { return false; }
+            unsigned short vtSize;
+            memcpy(&vtSize, b + vtablePos, 2);
+            if( (size_t)vtablePos + vtSize > bSize ) { return false; }
+            t.buf = b; t.size = bSize; t.pos = tablePos; t.vtable = (size_t)vtablePos; t.vtableSize = vtSize;
+            return true;
+        }
+
+        static bool root(const byte *b, size_t bSize, FlatTable &t)
+        {
+            if( bSize < 4 ) { return false; }
+            unsigned int offset;
+            memcpy(&offset, b, 4);
+            return read(b, bSize, offset, t);
+        }
+
+        /* Returns the position of a field, 0 if the field is absent */
+        size_t field(size_t id) const
+        {
+            const size_t entry = 4 + 2 * id;
+            if( entry + 2 > vtableSize ) { return 0; }
+            unsigned short offset;
+            memcpy(&offset, buf + vtable + entry, 2);
+            return (offset && pos + offset < size ? pos + offset : 0);
+        }
+
+        template<typename T>
+        T scalar(size_t id, T defaultValue) const
+        {
+            const size_t p = field(id);
+            if( !p || p + sizeof(T) > size ) { return defaultValue; }
+            T value;
+            memcpy(&value, buf + p, sizeof(T));
+            return value;
+        }
+
+        /* Returns the position of an object referenced by a field, 0 if the field is absent */
+        size_t reference(size_t id) const
+        {
+            const size_t p = field(id);
+            if( !p || p + 4 > size ) { return 0; }
+            unsigned int offset;
+            memcpy(&offset, buf + p, 4);
+            return (p + offset + 4 <= size ? p + offset : 0);
+        }
+
+        bool table(size_t id, FlatTable &t) const
+        {
+            const size_t p = reference(id);
+            return (p && read(buf, size, p, t));
+        }
+
+        /* Gets the position of the first element and the number of elements of a vector field */
+        bool vector(size_t id, size_t elementSize, size_t &start, size_t &length) const
+        {
+            const size_t p = reference(id);
+            if( !p ) { return false; }
+            unsigned int n;
+            memcpy(&n, buf + p, 4);
+            start  = p + 4;
+            length = n;
+            return (start + (size_t)n * elementSize <= size);
+        }
+
+        bool tableAt(size_t start, size_t idx, FlatTable &t) const
+        {
+            const size_t p = start + 4 * idx;
+            unsigned int offset;
+            memcpy(&offset, buf + p, 4);
+            return read(buf, size, p + offset, t);
+        }
+
+        std::string string(size_t id) const
+        {
+            size_t start, length;
+            if( !vector(id, 1, start, length) ) { return std::string(); }
+            return std::string((const char *)buf + start, length);
+        }
+
+        const byte *buf;
+        size_t size;
+        size_t pos;
+        size_t vtable;
+        size_t vtableSize;
+    };
+
+    template<typename T>
+    static T readValue(const byte *ptr)
+    {
+        T value;
+        memcpy(&value, ptr, sizeof(T));
+        return value;
+    }
+
+    void setDefaultProjection()
+    {
+        if( _projection.size() ) { return; }
+        for(size_t i = 0; i < _fields.size(); i++)
+        {
+            if( _fields[i].isLoadable ) { _projection.push_back(i); }
+        }
+    }
+
+    size_t getNumberOfSelectedBatches() const
+    {
+        return (_selectedBatches.size() ? _selectedBatches.size() : _batches.size());
+    }
+
+    /* Offsets are 64-bit: fseek() takes a long, which is 32-bit on Windows and on 32-bit POSIX systems */
+    bool seek(DAAL_INT64 offset)
+    {
+    #if defined(_MSC_VER)
+        return (_fseeki64(_file, offset, SEEK_SET) == 0);
+    #else
+        /* off_t is 32-bit on 32-bit systems built without _FILE_OFFSET_BITS=64, the offset must not be truncated */
+        if( (DAAL_INT64)(off_t)offset != offset ) { return false; }
+        return (fseeko(_file, (off_t)offset, SEEK_SET) == 0);
+    #endif
+    }
+
+    services::Status readAt(DAAL_INT64 offset, byte *buffer, size_t size)
+    {
+        if( offset < 0 || offset + (DAAL_INT64)size > _fileSize || !seek(offset) || fread(buffer, 1, size, _file) != size )
+            return services::Status(services::ErrorOnFileRead);
+        return services::Status();
+    }
+
+    services::Status readFooter()
+    {
+        /* File layout: "ARROW1" magic padded to 8 bytes, stream of messages, footer, footer length, "ARROW1" */
+        const size_t magicSize = 6;
+        const byte magic[magicSize] = { 'A', 'R', 'R', 'O', 'W', '1' };
+
+    #if defined(_MSC_VER)
+        if( _fseeki64(_file, 0, SEEK_END) != 0 ) { return services::Status(services::ErrorOnFileRead); }
+        _fileSize = _ftelli64(_file);
+    #else
+        if( fseeko(_file, 0, SEEK_END) != 0 ) { return services::Status(services::ErrorOnFileRead); }
+        _fileSize = (DAAL_INT64)ftello(_file);
+    #endif
+        if( _fileSize < 0 ) { return services::Status(services::ErrorOnFileRead); }
+        if( _fileSize < (DAAL_INT64)(2 * magicSize + 6) ) { return services::Status(services::ErrorArrowFileFormat); }
+
+        services::Status s;
+        byte head[magicSize];
+        byte tail[4 + magicSize];
+        DAAL_CHECK_STATUS(s, readAt(0, head, magicSize));
+        DAAL_CHECK_STATUS(s, readAt(_fileSize - (DAAL_INT64)sizeof(tail), tail, sizeof(tail)));
+        if( memcmp(head, magic, magicSize) != 0 || memcmp(tail + 4, magic, magicSize) != 0 )
+        {
+            return services::Status(services::ErrorArrowFileFormat);
+        }
+
+        const int footerSize = readValue<int>(tail);
+        if( footerSize <= 0 || footerSize > _fileSize - (DAAL_INT64)sizeof(tail) - 8 ) { return services::Status(services::ErrorArrowFileFormat); }
+
+        services::SharedPtr<byte> footerPtr((byte *)daal::services::daal_malloc(footerSize), services::ServiceDeleter());
+        if( !footerPtr ) { return services::Status(services::ErrorMemoryAllocationFailed); }
+        byte *footer = footerPtr.get();
+        DAAL_CHECK_STATUS(s, readAt(_fileSize - (DAAL_INT64)sizeof(tail) - footerSize, footer, footerSize));
+
+        /* Footer: version (0), schema (1), dictionaries (2), recordBatches (3) */
+        FlatTable footerTable, schema;
+        if( !FlatTable::root(footer, footerSize, footerTable) || !footerTable.table(1, schema) )
+        {
+            return services::Status(services::ErrorArrowFileFormat);
+        }
+
+        /* Schema: endianness (0), fields (1) */
+        if( schema.scalar<short>(0, 0) != 0 ) { return services::Status(services::ErrorArrowTypeUnsupported); }
+
+        size_t fieldsStart = 0, nFields = 0;
+        if( !schema.vector(1, 4, fieldsStart, nFields) ) { return services::Status(services::ErrorArrowFileFormat); }
+
+        size_t node = 0, buffer = 0;
+        for(size_t i = 0; i < nFields; i++)
+        {
+            FlatTable field;
+            if( !schema.tableAt(fieldsStart, i, field) ) { return services::Status(services::ErrorArrowFileFormat); }
+
+            FieldInfo info;
+            info.name   = field.string(0);
+            info.node   = node;
+            info.buffer = buffer;
+            DAAL_CHECK_STATUS(s, readFieldType(field, info));
+            DAAL_CHECK_STATUS(s, countBuffers(field, node, buffer));
+            _fields.push_back(info);
+        }
+
+        /* Block: offset (long), metaDataLength (int), padding, bodyLength (long) */
+        const size_t blockSize = 24;
+        size_t batchesStart = 0, nBatches = 0;
+        if( footerTable.field(3) && !footerTable.vector(3, blockSize, batchesStart, nBatches) )
+        {
+            return services::Status(services::ErrorArrowFileFormat);
+        }
+        for(size_t i = 0; i < nBatches; i++)
+        {
+            const byte *block = footer + batchesStart + i * blockSize;
+            BlockInfo info;
+            info.offset         = readValue<DAAL_INT64>(block);
+            info.metaDataLength = readValue<int>(block + 8);
+            info.bodyLength     = readValue<DAAL_INT64>(block + 16);
+            _batches.push_back(info);
+        }
+        return s;
+    }
+
+    /* Field: name (0), nullable (1), type_type (2), type (3), dictionary (4), children (5) */
+    services::Status readFieldType(const FlatTable &field, FieldInfo &info)
+    {
+        const unsigned char typeId = field.scalar<unsigned char>(2, 0);
+        FlatTable type;
+        const bool hasType = field.table(3, type);
+        if( field.field(4) ) { return services::Status(); }
+
+        if( typeId == arrowInt && hasType )
+        {
+            /* Int: bitWidth (0), is_signed (1) */
+            const int bitWidth  = type.scalar<int>(0, 0);
+            const bool isSigned = (type.scalar<unsigned char>(1, 0) != 0);
+            switch(bitWidth)
+            {
+            case 8:  info.ntType = (isSigned ? data_feature_utils::DAAL_INT8_S  : data_feature_utils::DAAL_INT8_U ); break;
+            case 16: info.ntType = (isSigned ? data_feature_utils::DAAL_INT16_S : data_feature_utils::DAAL_INT16_U); break;
+            case 32: info.ntType = (isSigned ? data_feature_utils::DAAL_INT32_S : data_feature_utils::DAAL_INT32_U); break;
+            case 64: info.ntType = (isSigned ? data_feature_utils::DAAL_INT64_S : data_feature_utils::DAAL_INT64_U); break;
+            default: return services::Status(services::ErrorArrowFileFormat);
+            }
+        }
+        else if( typeId == arrowFloatingPoint && hasType )
+        {
+            /* FloatingPoint: precision (0): HALF = 0, SINGLE = 1, DOUBLE = 2 */
+            const short precision = type.scalar<short>(0, 0);
+            if( precision == 1 ) { info.ntType = data_feature_utils::DAAL_FLOAT32; }
+            if( precision == 2 ) { info.ntType = data_feature_utils::DAAL_FLOAT64; }
+        }
+        else if( typeId == arrowBool )
+        {
+            info.ntType = data_feature_utils::DAAL_INT32_S;
+            info.isBool = true;
+        }
+        info.isLoadable = (info.ntType != data_feature_utils::DAAL_OTHER_T);
+        return services::Status();
+    }
+
+    /* Counts the field nodes and the buffers that a field and its children take in record batches */
+    services::Status countBuffers(const FlatTable &field, size_t &node, size_t &buffer)
+    {
+        const unsigned char typeId = field.scalar<unsigned char>(2, 0);
+        node++;
+
+        /* A dictionary-encoded field is stored as its integer indices, the values are in the dictionary batches */
+        if( field.field(4) )
+        {
+            buffer += 2;
+            return services::Status();
+        }
+
+        switch(typeId)
+        {
+        case arrowNull: break;
+        case arrowStruct: case arrowFixedSizeList: buffer += 1; break;
+        case arrowBinary: case arrowUtf8: case arrowLargeBinary: case arrowLargeUtf8: buffer += 3; break;
+        case arrowUnion: return services::Status(services::ErrorArrowTypeUnsupported);
+        default: buffer += 2; break;
+        }
+
+        size_t childrenStart = 0, nChildren = 0;
+        if( field.field(5) && !field.vector(5, 4, childrenStart, nChildren) ) { return services::Status(services::ErrorArrowFileFormat); }
+
+        services::Status s;
+        for(size_t i = 0; i < nChildren; i++)
+        {
+            FlatTable child;
+            if( !field.tableAt(childrenStart, i, child) ) { return services::Status(services::ErrorArrowFileFormat); }
+            DAAL_CHECK_STATUS(s, countBuffers(child, node, buffer));
+        }
+        return s;
+    }
+
+    /* Reads the buffers of the projected columns of the next selected record batch */
+    services::Status readNextBatch()
+    {
+        if( _nextBatch >= getNumberOfSelectedBatches() ) { return services::Status(services::ErrorEmptyDataSource); }
+        const BlockInfo &block = _batches[_selectedBatches.size() ? _selectedBatches[_nextBatch] : _nextBatch];
+        _nextBatch++;
+
+        if( block.metaDataLength < 8 || block.metaDataLength > _fileSize ) { return services::Status(services::ErrorArrowFileFormat); }
+
+        services::Status s;
+        services::SharedPtr<byte> metaPtr((byte *)daal::services::daal_malloc((size_t)block.metaDataLength), services::ServiceDeleter());
+        if( !metaPtr ) { return services::Status(services::ErrorMemoryAllocationFailed); }
+        const byte *meta = metaPtr.get();
+        DAAL_CHECK_STATUS(s, readAt(block.offset, metaPtr.get(), (size_t)block.metaDataLength));
+
+        /* Encapsulated message: optional continuation marker, metadata size, Message flatbuffer */
+        size_t prefix = 4;
+        if( readValue<int>(meta) == -1 ) { prefix = 8; }
+        const int messageSize = readValue<int>(meta + prefix - 4);
+        if( messageSize <= 0 || prefix + messageSize > (size_t)block.metaDataLength ) { return services::Status(services::ErrorArrowFileFormat); }
+
+        /* Message: version (0), header_type (1), header (2), bodyLength (3) */
+        FlatTable message, recordBatch;
+        if( !FlatTable::root(meta + prefix, messageSize, message) ||
+            message.scalar<unsigned char>(1, 0) != recordBatchMessage || !message.table(2, recordBatch) )
+        {
+            return services::Status(services::ErrorArrowFileFormat);
+        }
+
+        /* RecordBatch: length (0), nodes (1), buffers (2), compression (3) */
+        if( recordBatch.field(3) ) { return services::Status(services::ErrorArrowTypeUnsupported); }
+
+        const DAAL_INT64 nRows = recordBatch.scalar<DAAL_INT64>(0, 0);
+        size_t nodesStart = 0, nNodes = 0, buffersStart = 0, nBuffers = 0;
+        if( nRows < 0 || !recordBatch.vector(1, 16, nodesStart, nNodes) || !recordBatch.vector(2, 16, buffersStart, nBuffers) )
+        {
+            return services::Status(services::ErrorArrowFileFormat);
+        }
+
+        const byte *messageBuf = meta + prefix;
+        const DAAL_INT64 bodyOffset = block.offset + block.metaDataLength;
+        const size_t nColumns = _projection.size();
+        _columns.clear();
+
+        for(size_t j = 0; j < nColumns; j++)
+        {
+            const FieldInfo &field = _fields[_projection[j]];
+            if( field.node >= nNodes || field.buffer + 1 >= nBuffers ) { return services::Status(services::ErrorArrowFileFormat); }
+
+            /* FieldNode: length, null_count; Buffer: offset, length */
+            const DAAL_INT64 nullCount      = readValue<DAAL_INT64>(messageBuf + nodesStart + 16 * field.node + 8);
+            const DAAL_INT64 validityOffset = readValue<DAAL_INT64>(messageBuf + buffersStart + 16 * field.buffer);
+            const DAAL_INT64 validityLength = readValue<DAAL_INT64>(messageBuf + buffersStart + 16 * field.buffer + 8);
+            const DAAL_INT64 dataOffset     = readValue<DAAL_INT64>(messageBuf + buffersStart + 16 * (field.buffer + 1));
+            const DAAL_INT64 dataLength     = readValue<DAAL_INT64>(messageBuf + buffersStart + 16 * (field.buffer + 1) + 8);
+
+            const size_t typeSize = (*_dict)[j].ntFeature.typeSize;
+            const size_t columnSize = (size_t)nRows * typeSize;
+            const size_t readSize = (size_t)(field.isBool ? (nRows + 7) / 8 : columnSize);
+            if( dataOffset < 0 || dataLength < (DAAL_INT64)readSize || dataOffset + dataLength > block.bodyLength )
+            {
+                return services::Status(services::ErrorArrowFileFormat);
+            }
+
+            services::SharedPtr<byte> column((byte *)daal::services::daal_malloc(columnSize ? columnSize : 1), services::ServiceDeleter());
+            if( !column ) { return services::Status(services::ErrorMemoryAllocationFailed); }
+            DAAL_CHECK_STATUS(s, readAt(bodyOffset + dataOffset, column.get(), readSize));
+
+            if( field.isBool )
+            {
+                /* Unpack the bits from the end, so the packed bytes are not overwritten before they are read */
+                int *values = (int *)column.get();
+                for(size_t i = (size_t)nRows; i > 0; i--)
+                {
+                    values[i - 1] = (column.get()[(i - 1) / 8] >> ((i - 1) % 8)) & 1;
+                }
+            }
+
+            if( nullCount > 0 )
+            {
+                const size_t validitySize = (size_t)(nRows + 7) / 8;
+                if( validityOffset < 0 || validityLength < (DAAL_INT64)validitySize || validityOffset + validityLength > block.bodyLength )
+                {
+                    return services::Status(services::ErrorArrowFileFormat);
+                }
+                services::SharedPtr<byte> validity((byte *)daal::services::daal_malloc(validitySize), services::ServiceDeleter());
+                if( !validity ) { return services::Status(services::ErrorMemoryAllocationFailed); }
+                DAAL_CHECK_STATUS(s, readAt(bodyOffset + validityOffset, validity.get(), validitySize));
+                setNulls(column.get(), validity.get(), (size_t)nRows, field.ntType, typeSize);
+            }
+            _columns.push_back(column);
+        }
+
+        _batchRows = (size_t)nRows;
+        _batchPos  = 0;
+        return s;
+    }
+
+    static void setNulls(byte *column, const byte *validity, size_t nRows, data_feature_utils::IndexNumType type, size_t typeSize)
+    {
+        for(size_t i = 0; i < nRows; i++)
+        {
+            if( (validity[i / 8] >> (i % 8)) & 1 ) { continue; }
+            if( type == data_feature_utils::DAAL_FLOAT32 )
+            {
+                ((float *)column)[i] = std::numeric_limits<float>::quiet_NaN();
+            }
+            else if( type == data_feature_utils::DAAL_FLOAT64 )
+            {
+                ((double *)column)[i] = std::numeric_limits<double>::quiet_NaN();
+            }
+            else
+            {
+                memset(column + i * typeSize, 0, typeSize);
+            }
+        }
+    }
+
+    static void setFeatureType(NumericTableFeature &feature, data_feature_utils::IndexNumType type)
+    {
+        switch(type)
+        {
+        case data_feature_utils::DAAL_FLOAT32: feature.setType<float>();          break;
+        case data_feature_utils::DAAL_FLOAT64: feature.setType<double>();         break;
+        case data_feature_utils::DAAL_INT32_S: feature.setType<int>();            break;
+        case data_feature_utils::DAAL_INT32_U: feature.setType<unsigned int>();   break;
+        case data_feature_utils::DAAL_INT64_S: feature.setType<DAAL_INT64>();     break;
+        case data_feature_utils::DAAL_INT64_U: feature.setType<DAAL_UINT64>();    break;
+        case data_feature_utils::DAAL_INT8_S:  feature.setType<char>();           break;
+        case data_feature_utils::DAAL_INT8_U:  feature.setType<unsigned char>();  break;
+        case data_feature_utils::DAAL_INT16_S: feature.setType<short>();          break;
+        case data_feature_utils::DAAL_INT16_U: feature.setType<unsigned short>(); break;
+        default: break;
+        }
+    }
+
+    static services::Status setColumnArray(SOANumericTable &table, size_t idx, const services::SharedPtr<byte> &column,
+                                           data_feature_utils::IndexNumType type)
+    {
+        using services::reinterpretPointerCast;
+        switch(type)
+        {
+        case data_feature_utils::DAAL_FLOAT32: return table.setArray(reinterpretPointerCast<float, byte>(column), idx);
+        case data_feature_utils::DAAL_FLOAT64: return table.setArray(reinterpretPointerCast<double, byte>(column), idx);
+        case data_feature_utils::DAAL_INT32_S: return table.setArray(reinterpretPointerCast<int, byte>(column), idx);
+        case data_feature_utils::DAAL_INT32_U: return table.setArray(reinterpretPointerCast<unsigned int, byte>(column), idx);
+        case data_feature_utils::DAAL_INT64_S: return table.setArray(reinterpretPointerCast<DAAL_INT64, byte>(column), idx);
+        case data_feature_utils::DAAL_INT64_U: return table.setArray(reinterpretPointerCast<DAAL_UINT64, byte>(column), idx);
+        case data_feature_utils::DAAL_INT8_S:  return table.setArray(reinterpretPointerCast<char, byte>(column), idx);
+        case data_feature_utils::DAAL_INT8_U:  return table.setArray(reinterpretPointerCast<unsigned char, byte>(column), idx);
+        case data_feature_utils::DAAL_INT16_S: return table.setArray(reinterpretPointerCast<short, byte>(column), idx);
+        case data_feature_utils::DAAL_INT16_U: return table.setArray(reinterpretPointerCast<unsigned short, byte>(column), idx);
+        default: return services::Status(services::ErrorArrowTypeUnsupported);
+        }
+    }
+
+protected:
+    FILE *_file;
+    DAAL_INT64 _fileSize;
+
+    services::Collection<FieldInfo> _fields;
+    services::Collection<BlockInfo> _batches;
+    services::Collection<size_t> _projection;
+    services::Collection<size_t> _selectedBatches;
+
+    size_t _nextBatch;                                   /* Position in the list of selected record batches */
+    services::Collection<services::SharedPtr<byte> > _columns; /* Projected columns of the current record batch */
+    size_t _batchRows;
+    size_t _batchPos;
+};
+/** @} */
+} // namespace interface1
+using interface1::ArrowFileDataSource;
+
+}
+}
+#endif
@@ -50,6 +50,7 @@
 
 #include "services/daal_memory.h"
 #include "data_management/data_source/data_source.h"
+#include "data_management/data_source/csv_feature_manager.h"
 #include "data_management/data/data_dictionary.h"
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/homogen_numeric_table.h"
@@ -104,7 +105,9 @@ public:
                   size_t initialMaxRows = 10):
         DataSourceTemplate<DefaultNumericTableType, _summaryStatisticsType>(doAllocateNumericTable, doCreateDictionaryFromContext),
         _rawLineBuffer(NULL),
-        _rawLineLength(0)
+        _rawLineLength(0),
+        _chunkBuffer(NULL),
+        _chunkBufferLen(0)
     {
         _rawLineBufferLen = 1024;
         _rawLineBuffer = (char *)daal::services::daal_malloc(_rawLineBufferLen);
@@ -116,6 +119,7 @@ public:
     ~CsvDataSource()
     {
         daal::services::daal_free( _rawLineBuffer );
+        daal::services::daal_free( _chunkBuffer );
         DataSourceTemplate<DefaultNumericTableType, _summaryStatisticsType>::freeNumericTable();
     }
 
@@ -242,15 +246,57 @@ public:
             return 0;
         }
 
+        /* Lines are parsed in chunks, so the feature manager encodes the categorical values of a chunk column by column */
+        const size_t maxChunkRows = 256;
+        char  *chunkRows[maxChunkRows];
+        size_t chunkRowSizes[maxChunkRows];
+        size_t chunkRowOffsets[maxChunkRows];
+
         size_t j = 0;
-        for(; j < maxRows && !iseof() ; j++ )
+        bool isLastChunk = false;
+        while( j < maxRows && !iseof() && !isLastChunk )
         {
-            s = readLine();
-            if(!s || !_rawLineLength)
+            size_t nChunkRows = 0;
+            size_t chunkSize  = 0;
+            for( ; nChunkRows < maxChunkRows && j + nChunkRows < maxRows && !iseof(); nChunkRows++ )
+            {
+                s = readLine();
+                if(!s || !_rawLineLength)
+                {
+                    isLastChunk = true;
+                    break;
+                }
+                if( !reserveChunkBuffer( chunkSize + _rawLineLength + 1 ) )
+                {
+                    this->_status.add(services::throwIfPossible(services::ErrorMemoryAllocationFailed));
+                    isLastChunk = true;
+                    break;
+                }
+                daal::services::daal_memcpy_s( _chunkBuffer + chunkSize, _chunkBufferLen - chunkSize, _rawLineBuffer, _rawLineLength + 1 );
+                chunkRowOffsets[nChunkRows] = chunkSize;
+                chunkRowSizes[nChunkRows]   = _rawLineLength;
+                chunkSize += _rawLineLength + 1;
+            }
+
+            if( !nChunkRows )
+                break;
+
+            for( size_t k = 0; k < nChunkRows; k++ )
+            {
+                chunkRows[k] = _chunkBuffer + chunkRowOffsets[k];
+            }
+            s = parseRows( featureManager, chunkRows, chunkRowSizes, nChunkRows, nt, rowOffset + j );
+            if(!s)
+            {
+                this->_status.add(services::throwIfPossible(s));
                 break;
-            featureManager.parseRowIn( _rawLineBuffer, _rawLineLength, this->_dict.get(), nt, rowOffset + j );
+            }
 
-            DataSourceTemplate<DefaultNumericTableType, _summaryStatisticsType>::updateStatistics( j, nt, rowOffset );
+            for( size_t k = 0; k < nChunkRows; k++ )
+            {
+                DataSourceTemplate<DefaultNumericTableType, _summaryStatisticsType>::updateStatistics( j + k, nt, rowOffset );
+            }
+            j += nChunkRows;
         }
 
         return rowOffset + j;
@@ -351,11 +397,49 @@ protected:
         return true;
     }
 
+    bool reserveChunkBuffer(size_t size)
+    {
+        if(size <= _chunkBufferLen)
+            return true;
+        size_t newChunkBufferLen = (_chunkBufferLen ? _chunkBufferLen : 65536);
+        while(newChunkBufferLen < size) { newChunkBufferLen *= 2; }
+        char* newChunkBuffer = (char *)daal::services::daal_malloc( newChunkBufferLen );
+        if(newChunkBuffer == 0)
+            return false;
+        if(_chunkBuffer)
+            daal::services::daal_memcpy_s(newChunkBuffer, newChunkBufferLen, _chunkBuffer, _chunkBufferLen);
+        daal::services::daal_free( _chunkBuffer );
+        _chunkBuffer = newChunkBuffer;
+        _chunkBufferLen = newChunkBufferLen;
+        return true;
+    }
+
+    /* Feature managers other than CSVFeatureManager parse the chunk row by row */
+    template<typename OtherFeatureManager>
+    services::Status parseRows(OtherFeatureManager &manager, char **rows, const size_t *rowSizes, size_t nRows,
+                               NumericTable *nt, size_t ntRowIndex)
+    {
+        for( size_t k = 0; k < nRows; k++ )
+        {
+            manager.parseRowIn( rows[k], rowSizes[k], this->_dict.get(), nt, ntRowIndex + k );
+        }
+        return services::Status();
+    }
+
+    services::Status parseRows(CSVFeatureManager &manager, char **rows, const size_t *rowSizes, size_t nRows,
+                               NumericTable *nt, size_t ntRowIndex)
+    {
+        return manager.parseRowsIn( rows, rowSizes, nRows, this->_dict.get(), nt, ntRowIndex );
+    }
+
 protected:
     char *_rawLineBuffer;
     int   _rawLineBufferLen;
     int   _rawLineLength;
 
+    char  *_chunkBuffer;
+    size_t _chunkBufferLen;
+
     bool _contextDictFlag;
 };
 /** @} */
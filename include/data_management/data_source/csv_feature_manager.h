@@ -98,21 +98,15 @@ public:
 
     static void catFunc(const char* word, FeatureAuxData& aux, DAAL_DATA_TYPE* arr)
     {
-        std::string sWord(word);
+        size_t length = 0;
+        while(word[length]) { length++; }
 
         CategoricalFeatureDictionary *catDict = aux.dsFeat->getCategoricalDictionary();
-        CategoricalFeatureDictionary::iterator it = catDict->find( sWord );
+        const int index = catDict->encode( word, length, CategoricalFeatureDictionary::hash(word, length) );
 
-        if( it != catDict->end() )
+        arr[ aux.idx ] = (DAAL_DATA_TYPE)index;
+        if( (size_t)index >= aux.ntFeat->categoryNumber )
         {
-            arr[ aux.idx ] = (DAAL_DATA_TYPE)it->second.first;
-            it->second.second++;
-        }
-        else
-        {
-            int index = (int)(catDict->size());
-            catDict->insert( std::pair<std::string, std::pair<int, int> >( sWord, std::pair<int, int>(index, 1) ) );
-            arr[ aux.idx ] = (DAAL_DATA_TYPE)index;
             aux.ntFeat->categoryNumber = index + 1;
         }
     }
@@ -126,22 +120,14 @@ protected:
 
     static void binFunc(const char* word, FeatureAuxData& aux, DAAL_DATA_TYPE* arr)
     {
-        std::string sWord(word);
+        size_t length = 0;
+        while(word[length]) { length++; }
 
         CategoricalFeatureDictionary *catDict = aux.dsFeat->getCategoricalDictionary();
-        CategoricalFeatureDictionary::iterator it = catDict->find( sWord );
-
-        size_t index = 0;
+        const size_t index = (size_t)catDict->encode( word, length, CategoricalFeatureDictionary::hash(word, length) );
 
-        if( it != catDict->end() )
+        if( index >= aux.ntFeat->categoryNumber )
         {
-            index = it->second.first;
-            it->second.second++;
-        }
-        else
-        {
-            index = catDict->size();
-            catDict->insert( std::pair<std::string, std::pair<int, int> >( sWord, std::pair<int, int>((int)index, 1) ) );
             aux.ntFeat->categoryNumber = index + 1;
         }
 
@@ -441,6 +427,103 @@ public:
         nt->getBlockOfRows( ntRowIndex, 1, writeOnly, block );
         DAAL_DATA_TYPE *row = block.getBlockPtr();
 
+        splitRow( rawRowData, rawDataSize, words );
+
+        for( size_t i = 0; i < dFeatures; i++ )
+        {
+            funcList[i]( words[i], auxVect[i], row );
+        }
+
+        nt->releaseBlockOfRows( block );
+
+        delete[] words;
+    }
+
+    /**
+     *  Parses strings that represent a set of feature vectors and converts them into a numeric representation.
+     *  Values of categorical features are encoded for the whole column at once
+     *  \param[in]  rawRowsData   Array of nRows strings that represent the feature vectors
+     *  \param[in]  rawDataSizes  Array of sizes of the strings
+     *  \param[in]  nRows         Number of feature vectors
+     *  \param[in]  dict          Pointer to the dictionary
+     *  \param[out] nt            Pointer to a Numeric Table to store the result of parsing
+     *  \param[in]  ntRowIndex    Position in the Numeric Table at which to store the first parsed feature vector
+     *  \return Status of the parsing
+     */
+    services::Status parseRowsIn( char **rawRowsData, const size_t *rawDataSizes, size_t nRows, DataSourceDictionary *dict,
+                                  NumericTable *nt, size_t ntRowIndex )
+    {
+        const size_t dFeatures = auxVect.size();
+
+        char const **words       = (char const **)daal::services::daal_malloc( nRows * dFeatures * sizeof(char const *) );
+        char const **columnWords = (char const **)daal::services::daal_malloc( nRows * sizeof(char const *) );
+        int *indices             = (int *)daal::services::daal_malloc( nRows * sizeof(int) );
+
+        services::Status s;
+        if( !words || !columnWords || !indices )
+        {
+            s.add( services::ErrorMemoryAllocationFailed );
+        }
+        else
+        {
+            s = nt->getBlockOfRows( ntRowIndex, nRows, writeOnly, block );
+        }
+
+        if( s )
+        {
+            DAAL_DATA_TYPE *rows = block.getBlockPtr();
+            const size_t rowSize = block.getNumberOfColumns();
+
+            for( size_t j = 0; j < nRows; j++ )
+            {
+                splitRow( rawRowsData[j], rawDataSizes[j], words + j * dFeatures );
+            }
+
+            for( size_t i = 0; i < dFeatures; i++ )
+            {
+                if( funcList[i] == ModifierIface::catFunc )
+                {
+                    for( size_t j = 0; j < nRows; j++ )
+                    {
+                        columnWords[j] = words[j * dFeatures + i];
+                    }
+
+                    auxVect[i].dsFeat->getCategoricalDictionary()->encode( columnWords, nRows, indices );
+
+                    size_t categoryNumber = auxVect[i].ntFeat->categoryNumber;
+                    for( size_t j = 0; j < nRows; j++ )
+                    {
+                        rows[ j * rowSize + auxVect[i].idx ] = (DAAL_DATA_TYPE)indices[j];
+                        if( (size_t)indices[j] >= categoryNumber ) { categoryNumber = indices[j] + 1; }
+                    }
+                    auxVect[i].ntFeat->categoryNumber = categoryNumber;
+                }
+                else
+                {
+                    for( size_t j = 0; j < nRows; j++ )
+                    {
+                        funcList[i]( words[j * dFeatures + i], auxVect[i], rows + j * rowSize );
+                    }
+                }
+            }
+
+            s = nt->releaseBlockOfRows( block );
+        }
+
+        daal::services::daal_free( words );
+        daal::services::daal_free( columnWords );
+        daal::services::daal_free( indices );
+        return s;
+    }
+
+protected:
+    BlockDescriptor<DAAL_DATA_TYPE> block;
+
+    /* Splits a string by the delimiter in place, missing trailing values are set to zero */
+    void splitRow( char *rawRowData, size_t rawDataSize, char const **words )
+    {
+        const size_t dFeatures = auxVect.size();
+
         size_t pos = 0;
         words[ pos ] = rawRowData;
 
@@ -463,20 +546,8 @@ public:
         {
             words[pos] = zeroStr;
         }
-
-        for( size_t i = 0; i < dFeatures; i++ )
-        {
-            funcList[i]( words[i], auxVect[i], row );
-        }
-
-        nt->releaseBlockOfRows( block );
-
-        delete[] words;
     }
 
-protected:
-    BlockDescriptor<DAAL_DATA_TYPE> block;
-
     template<class T>
     bool readNumericDetailed(char *text, T &f)
     {
@@ -63,9 +63,171 @@ namespace interface1
  * @ingroup data_sources
  * @{
  */
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__CATEGORICALFEATUREDICTIONARY"></a>
+ *  \brief Dictionary of the values of a categorical feature. Maps the name of a category to the pair of
+ *  the category index and the number of occurrences of the category.
+ *  The encode() methods look up the categories in an open-addressing hash index that keeps precomputed hashes
+ *  of the names and points to the elements of the map. The index is rebuilt when the number of categories is changed
+ *  through the map interface. Call resetIndex() after erasing categories through the map interface
+ */
 class CategoricalFeatureDictionary : public std::map<std::string, std::pair<int, int> >
 {
 public:
+    typedef std::map<std::string, std::pair<int, int> > super;
+
+    CategoricalFeatureDictionary() : _nIndexed(0) {}
+
+    CategoricalFeatureDictionary(const CategoricalFeatureDictionary &other) : super(other), _nIndexed(0) {}
+
+    CategoricalFeatureDictionary &operator= (const CategoricalFeatureDictionary &other)
+    {
+        super::operator= (other);
+        resetIndex();
+        return *this;
+    }
+
+    /**
+     *  Removes all categories from the hash index, so it is rebuilt by the next call to encode()
+     */
+    void resetIndex()
+    {
+        _slots.clear();
+        _nIndexed = 0;
+    }
+
+    /**
+     *  Computes the hash of the name of a category
+     *  \param[in] key     Name of the category
+     *  \param[in] length  Length of the name
+     *  \return Hash of the name
+     */
+    static size_t hash(const char *key, size_t length)
+    {
+        DAAL_UINT64 h = 14695981039346656037ULL;
+        for(size_t i = 0; i < length; i++)
+        {
+            h = (h ^ (unsigned char)key[i]) * 1099511628211ULL;
+        }
+        return (size_t)(h ^ (h >> 32));
+    }
+
+    /**
+     *  Returns the index of the category and increments the number of its occurrences.
+     *  A category that is not in the dictionary is added with the index equal to the number of categories
+     *  \param[in] key      Name of the category
+     *  \param[in] length   Length of the name
+     *  \param[in] keyHash  Hash of the name computed with hash()
+     *  \return Index of the category
+     */
+    int encode(const char *key, size_t length, size_t keyHash)
+    {
+        if(!_slots.size() || _nIndexed != size()) { rebuildIndex(); }
+
+        const size_t pos = findSlot(key, length, keyHash);
+        if(_slots[pos].entry)
+        {
+            _slots[pos].entry->second.second++;
+            return _slots[pos].entry->second.first;
+        }
+
+        const int index = (int)size();
+        value_type *entry = &*super::insert(value_type(std::string(key, length), std::pair<int, int>(index, 1))).first;
+        addToIndex(pos, entry, keyHash);
+        return index;
+    }
+
+    /**
+     *  Encodes a batch of category names. Hashes of the names are computed before the lookups
+     *  \param[in]  keys      Array of null-terminated names of the categories
+     *  \param[in]  nKeys     Number of names
+     *  \param[out] indices   Array of nKeys indices of the categories
+     */
+    void encode(const char *const *keys, size_t nKeys, int *indices)
+    {
+        const size_t blockSize = 64;
+        size_t lengths[blockSize];
+        size_t hashes[blockSize];
+        for(size_t start = 0; start < nKeys; start += blockSize)
+        {
+            const size_t n = (nKeys - start < blockSize ? nKeys - start : blockSize);
+            for(size_t i = 0; i < n; i++)
+            {
+                const char *key = keys[start + i];
+                size_t length = 0;
+                while(key[length]) { length++; }
+                lengths[i] = length;
+                hashes[i]  = hash(key, length);
+            }
+            for(size_t i = 0; i < n; i++)
+            {
+                indices[start + i] = encode(keys[start + i], lengths[i], hashes[i]);
+            }
+        }
+    }
+
+private:
+    struct Slot
+    {
+        Slot() : hash(0), entry(NULL) {}
+        size_t hash;
+        value_type *entry;  /* Element of the map, NULL for an empty slot */
+    };
+
+    /* Returns the slot of the category or the empty slot to insert it to. The index always has an empty slot */
+    size_t findSlot(const char *key, size_t length, size_t keyHash) const
+    {
+        const size_t mask = _slots.size() - 1;
+        for(size_t pos = keyHash & mask;; pos = (pos + 1) & mask)
+        {
+            const Slot &slot = _slots[pos];
+            if(!slot.entry) { return pos; }
+            if(slot.hash == keyHash)
+            {
+                const std::string &name = slot.entry->first;
+                if(name.size() == length && name.compare(0, length, key, length) == 0) { return pos; }
+            }
+        }
+    }
+
+    void addToIndex(size_t pos, value_type *entry, size_t keyHash)
+    {
+        _slots[pos].hash  = keyHash;
+        _slots[pos].entry = entry;
+        _nIndexed++;
+        if(2 * _nIndexed > _slots.size()) { rehash(2 * _slots.size()); }
+    }
+
+    void rebuildIndex()
+    {
+        resetIndex();
+        rehash(2 * size() + 1);
+        for(iterator it = begin(); it != end(); it++)
+        {
+            const size_t keyHash = hash(it->first.c_str(), it->first.size());
+            addToIndex(findSlot(it->first.c_str(), it->first.size(), keyHash), &*it, keyHash);
+        }
+    }
+
+    void rehash(size_t minSlots)
+    {
+        size_t nSlots = 16;
+        while(nSlots < minSlots) { nSlots *= 2; }
+
+        services::Collection<Slot> slots(nSlots);
+        const size_t mask = nSlots - 1;
+        for(size_t i = 0; i < _slots.size(); i++)
+        {
+            if(!_slots[i].entry) { continue; }
+            size_t pos = _slots[i].hash & mask;
+            while(slots[pos].entry) { pos = (pos + 1) & mask; }
+            slots[pos] = _slots[i];
+        }
+        _slots = slots;
+    }
+
+    services::Collection<Slot> _slots;
+    size_t _nIndexed;   /* Number of the categories in the index */
 };
 
 /**
@@ -92,13 +254,21 @@ public:
      */
     DataSourceFeature &operator= (const DataSourceFeature &f)
     {
-        ntFeature   = f.ntFeature;
+        if(this == &f) { return *this; }
+
+        /* Copy first, so the feature is not changed if the copying fails */
+        char *newName = new char[f.name_length];
+        daal::services::daal_memcpy_s(newName, f.name_length, f.name, f.name_length);
+        CategoricalFeatureDictionary *newDict = (f.cat_dict ? new CategoricalFeatureDictionary(*f.cat_dict) : 0);
 
-        name = new char[f.name_length];
-        daal::services::daal_memcpy_s(name, name_length, f.name, f.name_length);
+        ntFeature = f.ntFeature;
 
+        if(name) { delete[] name; }
+        name        = newName;
         name_length = f.name_length;
-        cat_dict    = 0;
+
+        if(cat_dict) { delete cat_dict; }
+        cat_dict = newDict;
 
         return *this;
     }
@@ -203,7 +373,8 @@ public:
                 /* Make sure that dictionary is allocated */
                 getCategoricalDictionary();
                 /* Make sure that dictionary is empty */
-                cat_dict->empty();
+                cat_dict->clear();
+                cat_dict->resetIndex();
             }
 
             size_t size = cat_dict->size();
@@ -237,7 +408,7 @@ public:
             }
             else
             {
-                typedef CategoricalFeatureDictionary::iterator it_type;
+                typedef CategoricalFeatureDictionary::const_iterator it_type;
 
                 for(it_type it=cat_dict->begin(); it != cat_dict->end(); it++)
                 {
@@ -253,8 +424,9 @@ public:
                 }
             }
         }
-        else
+        else if( onDeserialize && cat_dict )
         {
+            delete cat_dict;
             cat_dict = 0;
         }
 
@@ -0,0 +1,155 @@
+/* file: prefetching_data_source.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the data source that loads data blocks in the background.
+//--
+*/
+
+#ifndef __PREFETCHING_DATA_SOURCE_H__
+#define __PREFETCHING_DATA_SOURCE_H__
+
+#include "data_management/data_source/data_source.h"
+
+namespace daal
+{
+namespace data_management
+{
+
+namespace interface1
+{
+/**
+ * @ingroup data_sources
+ * @{
+ */
+
+class PrefetchingDataSourceImpl;
+
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__PREFETCHINGDATASOURCE"></a>
+ *  \brief Data source that wraps another data source and loads the next blocks of data in the background
+ *  while the caller processes the current block.
+ *
+ *  Blocks are loaded into a ring of nBuffers numeric tables allocated by the wrapped data source, so
+ *  up to nBuffers - 1 blocks are loaded ahead of the caller. The numeric table returned by getNumericTable()
+ *  after loadDataBlock() is reused for subsequent blocks and stays valid until the next call to loadDataBlock().
+ *  Reads of other sizes than the block size copy the rows of the loaded blocks into a separate homogeneous numeric table.
+ *  The wrapped data source must not be accessed directly while the PrefetchingDataSource object exists.
+ */
+class DAAL_EXPORT PrefetchingDataSource : public DataSource
+{
+public:
+    /**
+     *  Main constructor for a Prefetching Data Source
+     *  \param[in]  source      Data source to load the blocks of data from
+     *  \param[in]  blockSize   Number of rows in every block of data
+     *  \param[in]  nBuffers    Number of numeric tables in the ring of buffers, at least 2
+     */
+    PrefetchingDataSource(DataSource &source, size_t blockSize, size_t nBuffers = 2);
+
+    virtual ~PrefetchingDataSource();
+
+    /**
+     *  Allocates the ring of numeric tables and starts loading the first blocks of data in the background
+     */
+    services::Status allocateNumericTable() DAAL_C11_OVERRIDE;
+
+    void freeNumericTable() DAAL_C11_OVERRIDE;
+
+    NumericTablePtr &getNumericTable() DAAL_C11_OVERRIDE
+    {
+        return _spnt;
+    }
+
+    services::Status createDictionaryFromContext() DAAL_C11_OVERRIDE;
+
+    DataSourceIface::DataSourceStatus getStatus() DAAL_C11_OVERRIDE;
+
+    size_t getNumberOfColumns() DAAL_C11_OVERRIDE;
+
+    size_t getNumericTableNumberOfColumns() DAAL_C11_OVERRIDE;
+
+    /**
+     *  Returns the number of rows in the blocks that are loaded and not yet returned by loadDataBlock()
+     *  \return Number of rows
+     */
+    size_t getNumberOfAvailableRows() DAAL_C11_OVERRIDE;
+
+    /**
+     *  Makes the next block of data current and returns the number of rows in it.
+     *  Waits for the block only if it is not loaded yet
+     *  \return Number of rows in the block, 0 if there is no more data
+     */
+    size_t loadDataBlock() DAAL_C11_OVERRIDE;
+
+    /**
+     *  Loads the next rows of data and returns their number. If maxRows is equal to the block size and no rows
+     *  of the current block are left, the next block of data is made current without copying.
+     *  Otherwise the rows are copied from the loaded blocks
+     *  \param[in] maxRows  Maximum number of rows to load
+     *  \return Number of loaded rows, 0 if there is no more data
+     */
+    size_t loadDataBlock(size_t maxRows) DAAL_C11_OVERRIDE;
+
+    using DataSource::loadDataBlock;
+
+    /**
+     *  Returns the number of rows in every block of data
+     *  \return Number of rows in every block of data
+     */
+    size_t getBlockSize() const { return _blockSize; }
+
+private:
+    PrefetchingDataSource(const PrefetchingDataSource &);
+    PrefetchingDataSource &operator = (const PrefetchingDataSource &);
+
+    DataSource &_source;
+    size_t _blockSize;
+    PrefetchingDataSourceImpl *_impl;
+};
+/** @} */
+} // namespace interface1
+using interface1::PrefetchingDataSource;
+
+}
+} // namespace daal
+#endif
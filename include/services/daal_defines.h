@@ -187,6 +187,8 @@ const int SERIALIZATION_DATADICTIONARY_NT_ID
 const int SERIALIZATION_DATADICTIONARY_DS_ID                                                   = 6010;
 const int SERIALIZATION_MATRIX_NT_ID                                                           = 7000;
 const int SERIALIZATION_CSR_NT_ID                                                              = 8000;
+const int SERIALIZATION_CSC_NT_ID                                                              = 8001;
+const int SERIALIZATION_BSR_NT_ID                                                              = 8002;
 const int SERIALIZATION_PACKEDSYMMETRIC_NT_ID                                                  = 11000;
 const int SERIALIZATION_PACKEDTRIANGULAR_NT_ID                                                 = 12000;
 const int SERIALIZATION_MERGE_NT_ID                                                            = 13000;
@@ -212,6 +214,7 @@ const int SERIALIZATION_PCA_PARTIAL_RESULT_CORRELATION_ID
 const int SERIALIZATION_PCA_PARTIAL_RESULT_SVD_ID                                              = 100220;
 const int SERIALIZATION_PCA_TRANSFORM_RESULT_ID                                                = 100230;
 const int SERIALIZATION_PCA_QUALITY_METRIC_RESULT_ID                                           = 100240;
+const int SERIALIZATION_PCA_PARTIAL_RESULT_RANDOMIZED_ID                                       = 100250;
 
 const int SERIALIZATION_STUMP_MODEL_ID                                                         = 100300;
 const int SERIALIZATION_STUMP_TRAINING_RESULT_ID                                               = 100310;
@@ -254,6 +257,7 @@ const int SERIALIZATION_CLASSIFIER_BINARY_CONFUSION_MATRIX_RESULT_ID
 const int SERIALIZATION_CLASSIFIER_MULTICLASS_CONFUSION_MATRIX_RESULT_ID                       = 101420;
 const int SERIALIZATION_CLASSIFIER_PREDICTION_RESULT_ID                                        = 101430;
 const int SERIALIZATION_CLASSIFIER_TRAINING_RESULT_ID                                          = 101440;
+const int SERIALIZATION_CLASSIFIER_MULTICLASS_CONFUSION_MATRIX_PARTIAL_RESULT_ID               = 101450;
 
 const int SERIALIZATION_MOMENTS_PARTIAL_RESULT_ID                                              = 101500;
 const int SERIALIZATION_MOMENTS_RESULT_ID                                                      = 101510;
@@ -287,8 +291,11 @@ const int SERIALIZATION_KERNEL_FUNCTION_RESULT_ID
 const int SERIALIZATION_OUTLIER_DETECTION_MULTIVARIATE_RESULT_ID                               = 102200;
 const int SERIALIZATION_OUTLIER_DETECTION_UNIVARIATE_RESULT_ID                                 = 102210;
 const int SERIALIZATION_OUTLIER_DETECTION_BACON_RESULT_ID                                      = 102220;
+const int SERIALIZATION_OUTLIER_DETECTION_BACON_PARTIAL_RESULT_ID                              = 102230;
+const int SERIALIZATION_OUTLIER_DETECTION_BACON_DISTRIBUTED_PARTIAL_RESULT_ID                  = 102240;
 
 const int SERIALIZATION_PIVOTED_QR_RESULT_ID                                                   = 102300;
+const int SERIALIZATION_PIVOTED_QR_DISTRIBUTED_PARTIAL_RESULT_ID                               = 102310;
 
 const int SERIALIZATION_QR_RESULT_ID                                                           = 102400;
 const int SERIALIZATION_QR_ONLINE_PARTIAL_RESULT_ID                                            = 102410;
@@ -405,6 +412,9 @@ const int SERIALIZATION_RIDGE_REGRESSION_MODELNORMEQ_ID
 const int SERIALIZATION_RIDGE_REGRESSION_PARTIAL_RESULT_ID                                     = 105010;
 const int SERIALIZATION_RIDGE_REGRESSION_TRAINING_RESULT_ID                                    = 105020;
 const int SERIALIZATION_RIDGE_REGRESSION_PREDICTION_RESULT_ID                                  = 105030;
+const int SERIALIZATION_ELASTIC_NET_MODEL_ID                                                   = 105100;
+const int SERIALIZATION_ELASTIC_NET_TRAINING_RESULT_ID                                         = 105110;
+const int SERIALIZATION_ELASTIC_NET_PREDICTION_RESULT_ID                                       = 105120;
 
 const int SERIALIZATION_K_NEAREST_NEIGHBOR_MODEL_ID                                            = 106000;
 const int SERIALIZATION_K_NEAREST_NEIGHBOR_TRAINING_RESULT_ID                                  = 106010;
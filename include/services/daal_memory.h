@@ -84,6 +84,21 @@ DAAL_EXPORT void  daal_free(void *ptr);
  * \param[in]  count              Number of bytes to copy.
  */
 DAAL_EXPORT void  daal_memcpy_s(void *dest, size_t numberOfElements, const void *src, size_t count);
+
+/**
+ * Allocates a block of memory aligned by DAAL_MALLOC_DEFAULT_ALIGNMENT from the pool of reusable blocks.
+ * The pool groups blocks into size classes and serves repeated requests of the same class
+ * without calling the system allocator. If the pool is disabled, the block is taken from the system allocator
+ * \param[in] size      Size of the block of memory in bytes
+ * \return Pointer to the beginning of a newly allocated block of memory
+ */
+DAAL_EXPORT void *daal_pooled_malloc(size_t size);
+
+/**
+ * Returns the space previously allocated by daal_pooled_malloc to the pool of reusable blocks
+ * \param[in] ptr   Pointer to the beginning of a block of memory to deallocate
+ */
+DAAL_EXPORT void  daal_pooled_free(void *ptr);
 /** @} */
 
 DAAL_EXPORT float daal_string_to_float(const char * nptr, char ** endptr);
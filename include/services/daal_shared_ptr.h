@@ -116,6 +116,19 @@ public:
     }
 };
 
+/**
+ * <a name="DAAL-CLASS-SERVICES__POOLEDSERVICEDELETER"></a>
+ * \brief Implementation of DeleterIface to return a pointer to the pool of reusable blocks by the daal_pooled_free function
+ */
+class PooledServiceDeleter : public DeleterIface
+{
+public:
+    void operator() (const void *ptr) DAAL_C11_OVERRIDE
+    {
+        daal::services::daal_pooled_free((void *)ptr);
+    }
+};
+
 /**
  * <a name="DAAL-CLASS-SERVICES__EMPTYDELETER"></a>
  * \brief Implementation of DeleterIface without pointer destroying
@@ -490,6 +503,7 @@ using interface1::DeleterIface;
 using interface1::ObjectDeleter;
 using interface1::EmptyDeleter;
 using interface1::ServiceDeleter;
+using interface1::PooledServiceDeleter;
 using interface1::SharedPtr;
 using interface1::staticPointerCast;
 using interface1::dynamicPointerCast;
@@ -185,6 +185,50 @@ public:
      */
     int setMemoryLimit(MemType type, size_t limit);
 
+    /**
+     * <a name="DAAL-STRUCT-SERVICES__MEMORYPOOLSTATISTICS"></a>
+     * \brief Statistics of the pool of reusable memory blocks used by the block descriptors of numeric tables
+     */
+    struct MemoryPoolStatistics
+    {
+        size_t nAllocations;    /*!< Number of blocks requested from the pool */
+        size_t nReuses;         /*!< Number of requests served by a block cached in the pool */
+        size_t nDeallocations;  /*!< Number of blocks returned to the pool */
+        size_t nCachedBlocks;   /*!< Number of blocks currently cached in the pool */
+        size_t cachedBytes;     /*!< Size in bytes of the blocks currently cached in the pool */
+    };
+
+    /**
+     * Enables or disables reuse of memory blocks by the pool. The pool is disabled by default.
+     * When the pool is disabled, all cached blocks are released and every request is served by the system allocator
+     * \param[in] enableMemoryPoolFlag   Flag to enable the pool
+     */
+    void enableMemoryPool(bool enableMemoryPoolFlag = true);
+
+    /**
+     * Returns the flag that indicates whether the pool of reusable memory blocks is enabled
+     * \return true if the pool is enabled
+     */
+    bool isMemoryPoolEnabled() const;
+
+    /**
+     * Limits the total size of the memory blocks cached in the pool by all the threads.
+     * If the limit is lowered, the cached blocks are released in proportion to the new limit
+     * \param[in] limit  Limit in megabytes
+     */
+    void setMemoryPoolLimit(size_t limit);
+
+    /**
+     * Releases all memory blocks cached in the pool to the system allocator
+     */
+    void releaseMemoryPool();
+
+    /**
+     * Returns statistics of the pool of reusable memory blocks
+     * \return Statistics of the pool
+     */
+    MemoryPoolStatistics getMemoryPoolStatistics() const;
+
 private:
     Environment();
     Environment(const Environment &e);
@@ -394,6 +394,8 @@ enum ErrorID
     ErrorSQLstmtHandle = -90044,                                        /*!< ErrorSQLstmtHandle */
     ErrorOnFileOpen = -90045,                                           /*!< Error on file open */
     ErrorOnFileRead = -90046,                                           /*!< Error on file read */
+    ErrorArrowFileFormat = -90047,                                      /*!< File does not conform to the Arrow IPC file format */
+    ErrorArrowTypeUnsupported = -90048,                                 /*!< Arrow file uses a type or a feature that is not supported */
 
     ErrorKDBNoConnection = -90051,                                      /*!< ErrorKDBNoConnection */
     ErrorKDBWrongCredentials = -90052,                                  /*!< ErrorKDBWrongCredentials */
@@ -256,6 +256,25 @@ static int check_ssse3_features()
     return 1;
 }
 
+int __daal_serv_cpu_feature_avx512_vnni()
+{
+    /*
+    CPUID.(EAX=07H, ECX=0H):ECX.AVX512_VNNI[bit 11]==1
+    */
+    uint32_t avx512_vnni_mask = (1 << 11);
+
+    if ( ! check_avx512_features() )
+    {
+        return 0;
+    }
+    if ( ! check_cpuid(7, 0, 2, avx512_vnni_mask) )
+    {
+        return 0;
+    }
+
+    return 1;
+}
+
 int __daal_serv_cpu_detect(int enable)
 {
     if( (enable&daal::services::Environment::avx512_mic_e1) == daal::services::Environment::avx512_mic_e1 )
@@ -112,6 +112,10 @@
     DECLARE_DAAL_STRING_CONST(sumSquaresSVD                      ) \
     DECLARE_DAAL_STRING_CONST(sumSVD                             ) \
     DECLARE_DAAL_STRING_CONST(sumCorrelation                     ) \
+    DECLARE_DAAL_STRING_CONST(nObservationsRandomized            ) \
+    DECLARE_DAAL_STRING_CONST(sumRandomized                      ) \
+    DECLARE_DAAL_STRING_CONST(sumSquaresRandomized               ) \
+    DECLARE_DAAL_STRING_CONST(sketchRandomized                   ) \
     DECLARE_DAAL_STRING_CONST(auxiliaryData                      ) \
     DECLARE_DAAL_STRING_CONST(nObservations                      ) \
     DECLARE_DAAL_STRING_CONST(partialMinimum                     ) \
@@ -156,6 +160,7 @@
     DECLARE_DAAL_STRING_CONST(newtonRaphsonAccuracyThreshold     ) \
     DECLARE_DAAL_STRING_CONST(newtonRaphsonMaxIterations         ) \
     DECLARE_DAAL_STRING_CONST(degenerateCasesThreshold           ) \
+    DECLARE_DAAL_STRING_CONST(zeroThreshold                      ) \
     DECLARE_DAAL_STRING_CONST(nClasses                           ) \
     DECLARE_DAAL_STRING_CONST(nTrees                             ) \
     DECLARE_DAAL_STRING_CONST(weightsDegenerateCasesThreshold    ) \
@@ -173,6 +178,7 @@
     DECLARE_DAAL_STRING_CONST(classificationCoefficients         ) \
     DECLARE_DAAL_STRING_CONST(beta                               ) \
     DECLARE_DAAL_STRING_CONST(confusionMatrix                    ) \
+    DECLARE_DAAL_STRING_CONST(partialConfusionMatrix             ) \
     DECLARE_DAAL_STRING_CONST(binaryMetrics                      ) \
     DECLARE_DAAL_STRING_CONST(multiClassMetrics                  ) \
     DECLARE_DAAL_STRING_CONST(learningRate                       ) \
@@ -247,6 +253,11 @@
     DECLARE_DAAL_STRING_CONST(featuresPerNode                    ) \
     DECLARE_DAAL_STRING_CONST(lambda                             ) \
     DECLARE_DAAL_STRING_CONST(preferenceThreshold                ) \
+    DECLARE_DAAL_STRING_CONST(nCGIterations                      ) \
+    DECLARE_DAAL_STRING_CONST(partialFactors                     ) \
+    DECLARE_DAAL_STRING_CONST(nTopItems                          ) \
+    DECLARE_DAAL_STRING_CONST(knownRatings                       ) \
+    DECLARE_DAAL_STRING_CONST(recommendedItems                   ) \
     DECLARE_DAAL_STRING_CONST(pyramidHeight                      ) \
     DECLARE_DAAL_STRING_CONST(itemsFactors                       ) \
     DECLARE_DAAL_STRING_CONST(partialModels                      ) \
@@ -274,6 +285,11 @@
     DECLARE_DAAL_STRING_CONST(RTable                             ) \
     DECLARE_DAAL_STRING_CONST(QTYTable                           ) \
     DECLARE_DAAL_STRING_CONST(interceptFlag                      ) \
+    DECLARE_DAAL_STRING_CONST(penaltyL1                          ) \
+    DECLARE_DAAL_STRING_CONST(penaltyL2                          ) \
+    DECLARE_DAAL_STRING_CONST(previousPenaltyL1                  ) \
+    DECLARE_DAAL_STRING_CONST(objectiveFunction                  ) \
+    DECLARE_DAAL_STRING_CONST(nPenalties                         ) \
     DECLARE_DAAL_STRING_CONST(retainRatio                        ) \
     DECLARE_DAAL_STRING_CONST(k                                  ) \
     DECLARE_DAAL_STRING_CONST(kdTreeTable                        ) \
@@ -316,7 +332,24 @@
     DECLARE_DAAL_STRING_CONST(shrinkage                          ) \
     DECLARE_DAAL_STRING_CONST(transformedData                    ) \
     DECLARE_DAAL_STRING_CONST(classSize                          ) \
-    DECLARE_DAAL_STRING_CONST(groupSum                           )
+    DECLARE_DAAL_STRING_CONST(groupSum                           ) \
+    DECLARE_DAAL_STRING_CONST(secondData                         ) \
+    DECLARE_DAAL_STRING_CONST(nearestIndices                     ) \
+    DECLARE_DAAL_STRING_CONST(nearestDistances                   ) \
+    DECLARE_DAAL_STRING_CONST(nSubsetObservations                ) \
+    DECLARE_DAAL_STRING_CONST(partialCrossProduct                ) \
+    DECLARE_DAAL_STRING_CONST(partialWeights                     ) \
+    DECLARE_DAAL_STRING_CONST(partialShift                       ) \
+    DECLARE_DAAL_STRING_CONST(initMethod                         ) \
+    DECLARE_DAAL_STRING_CONST(basicSubsetMean                    ) \
+    DECLARE_DAAL_STRING_CONST(basicSubsetCovariance              ) \
+    DECLARE_DAAL_STRING_CONST(basicSubsetThreshold               ) \
+    DECLARE_DAAL_STRING_CONST(basicSubsetSize                    ) \
+    DECLARE_DAAL_STRING_CONST(convergenceFlag                    ) \
+    DECLARE_DAAL_STRING_CONST(matrices                           ) \
+    DECLARE_DAAL_STRING_CONST(rightHandSides                     ) \
+    DECLARE_DAAL_STRING_CONST(choleskyFactors                    ) \
+    DECLARE_DAAL_STRING_CONST(solutions                          )
 
 
 /**
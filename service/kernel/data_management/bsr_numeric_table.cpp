@@ -0,0 +1,121 @@
+/* file: bsr_numeric_table.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+#include "bsr_numeric_table.h"
+#include "service_sparse_utils.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace interface1
+{
+
+template<typename T>
+static services::SharedPtr<BSRNumericTable> createBSRFromCSR(CSRNumericTable &csrTable, size_t blockRowSize, size_t blockColumnSize,
+                                                             services::Status &st)
+{
+    const size_t nRows = csrTable.getNumberOfRows();
+    const size_t nCols = csrTable.getNumberOfColumns();
+    const size_t nBlockRows = (nRows + blockRowSize - 1) / blockRowSize;
+
+    T *values = NULL;
+    size_t *colIndices = NULL, *rowOffsets = NULL;
+    st |= csrTable.getArrays<T>(&values, &colIndices, &rowOffsets);
+    if (!st) { return services::SharedPtr<BSRNumericTable>(); }
+
+    services::SharedPtr<size_t> blockRowOffsets((size_t *)services::daal_malloc((nBlockRows + 1) * sizeof(size_t)), services::ServiceDeleter());
+    if (!blockRowOffsets)
+    {
+        st.add(services::ErrorMemoryAllocationFailed);
+        return services::SharedPtr<BSRNumericTable>();
+    }
+
+    /* The first pass counts the blocks in every row of blocks */
+    st |= daal::internal::convertCSRToBSR<T>(nRows, nCols, blockRowSize, blockColumnSize, values, colIndices, rowOffsets,
+                                             blockRowOffsets.get(), NULL, NULL);
+    if (!st) { return services::SharedPtr<BSRNumericTable>(); }
+
+    const size_t nBlocks = blockRowOffsets.get()[nBlockRows] - 1;
+    services::SharedPtr<T> blockValues((T *)services::daal_malloc((nBlocks * blockRowSize * blockColumnSize + 1) * sizeof(T)), services::ServiceDeleter());
+    services::SharedPtr<size_t> blockColIndices((size_t *)services::daal_malloc((nBlocks + 1) * sizeof(size_t)), services::ServiceDeleter());
+    if (!blockValues || !blockColIndices)
+    {
+        st.add(services::ErrorMemoryAllocationFailed);
+        return services::SharedPtr<BSRNumericTable>();
+    }
+
+    st |= daal::internal::convertCSRToBSR<T>(nRows, nCols, blockRowSize, blockColumnSize, values, colIndices, rowOffsets,
+                                             blockRowOffsets.get(), blockColIndices.get(), blockValues.get());
+    if (!st) { return services::SharedPtr<BSRNumericTable>(); }
+
+    return BSRNumericTable::create<T>(blockValues, blockColIndices, blockRowOffsets, nCols, nRows, blockRowSize, blockColumnSize, &st);
+}
+
+services::SharedPtr<BSRNumericTable> BSRNumericTable::create(CSRNumericTable &csrTable, size_t blockRowSize, size_t blockColumnSize,
+                                                             services::Status *stat)
+{
+    services::Status defaultSt;
+    services::Status &st = (stat ? *stat : defaultSt);
+
+    if (blockRowSize == 0 || blockColumnSize == 0)
+    {
+        st.add(services::ErrorIncorrectParameter);
+        return services::SharedPtr<BSRNumericTable>();
+    }
+
+    st |= csrTable.check("csrTable");
+    if (!st) { return services::SharedPtr<BSRNumericTable>(); }
+
+    switch ((*csrTable.getDictionarySharedPtr())[0].indexType)
+    {
+    case data_feature_utils::DAAL_FLOAT32: return createBSRFromCSR<float> (csrTable, blockRowSize, blockColumnSize, st);
+    case data_feature_utils::DAAL_FLOAT64: return createBSRFromCSR<double>(csrTable, blockRowSize, blockColumnSize, st);
+    case data_feature_utils::DAAL_INT32_S: return createBSRFromCSR<int>   (csrTable, blockRowSize, blockColumnSize, st);
+    default:
+        st.add(services::ErrorIncorrectTypeOfNumericTable);
+        return services::SharedPtr<BSRNumericTable>();
+    }
+}
+
+}
+}
+}
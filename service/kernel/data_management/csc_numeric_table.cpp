@@ -0,0 +1,102 @@
+/* file: csc_numeric_table.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+#include "csc_numeric_table.h"
+#include "service_sparse_utils.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace interface1
+{
+
+template<typename T>
+static services::SharedPtr<CSCNumericTable> createCSCFromCSR(CSRNumericTable &csrTable, services::Status &st)
+{
+    const size_t nRows = csrTable.getNumberOfRows();
+    const size_t nCols = csrTable.getNumberOfColumns();
+
+    T *values = NULL;
+    size_t *colIndices = NULL, *rowOffsets = NULL;
+    st |= csrTable.getArrays<T>(&values, &colIndices, &rowOffsets);
+    if (!st) { return services::SharedPtr<CSCNumericTable>(); }
+
+    const size_t dataSize = csrTable.getDataSize();
+
+    services::SharedPtr<T> tValues((T *)services::daal_malloc(dataSize * sizeof(T)), services::ServiceDeleter());
+    services::SharedPtr<size_t> rowIndices((size_t *)services::daal_malloc(dataSize * sizeof(size_t)), services::ServiceDeleter());
+    services::SharedPtr<size_t> colOffsets((size_t *)services::daal_malloc((nCols + 1) * sizeof(size_t)), services::ServiceDeleter());
+    if ((dataSize && (!tValues || !rowIndices)) || !colOffsets)
+    {
+        st.add(services::ErrorMemoryAllocationFailed);
+        return services::SharedPtr<CSCNumericTable>();
+    }
+
+    st |= daal::internal::transposeCompressedSparse<T>(nRows, nCols, values, colIndices, rowOffsets,
+                                                       tValues.get(), rowIndices.get(), colOffsets.get());
+    if (!st) { return services::SharedPtr<CSCNumericTable>(); }
+
+    return CSCNumericTable::create<T>(tValues, rowIndices, colOffsets, nCols, nRows, &st);
+}
+
+services::SharedPtr<CSCNumericTable> CSCNumericTable::create(CSRNumericTable &csrTable, services::Status *stat)
+{
+    services::Status defaultSt;
+    services::Status &st = (stat ? *stat : defaultSt);
+
+    st |= csrTable.check("csrTable");
+    if (!st) { return services::SharedPtr<CSCNumericTable>(); }
+
+    switch ((*csrTable.getDictionarySharedPtr())[0].indexType)
+    {
+    case data_feature_utils::DAAL_FLOAT32: return createCSCFromCSR<float> (csrTable, st);
+    case data_feature_utils::DAAL_FLOAT64: return createCSCFromCSR<double>(csrTable, st);
+    case data_feature_utils::DAAL_INT32_S: return createCSCFromCSR<int>   (csrTable, st);
+    default:
+        st.add(services::ErrorIncorrectTypeOfNumericTable);
+        return services::SharedPtr<CSCNumericTable>();
+    }
+}
+
+}
+}
+}
@@ -50,6 +50,8 @@
 #include "aos_numeric_table.h"
 #include "soa_numeric_table.h"
 #include "csr_numeric_table.h"
+#include "csc_numeric_table.h"
+#include "bsr_numeric_table.h"
 #include "merged_numeric_table.h"
 #include "row_merged_numeric_table.h"
 #include "symmetric_matrix.h"
@@ -174,6 +176,8 @@ Factory::Factory() : _impl(nullptr)
     __DAAL_REGISTER_TEMPLATED_OBJECT(Creator, PackedTriangularMatrix, NumericTableIface::lowerPackedTriangularMatrix, );
 
     registerObject(new Creator<CSRNumericTable>());
+    registerObject(new Creator<CSCNumericTable>());
+    registerObject(new Creator<BSRNumericTable>());
     registerObject(new Creator<AOSNumericTable>());
     registerObject(new Creator<SOANumericTable>());
     registerObject(new Creator<MergedNumericTable>());
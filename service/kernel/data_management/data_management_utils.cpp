@@ -47,6 +47,7 @@
 
 #include "data_utils.h"
 #include "service_data_utils.h"
+#include "service_sparse_utils.h"
 #include "daal_kernel_defines.h"
 
 namespace daal
@@ -191,3 +192,99 @@ DAAL_EXPORT data_feature_utils::vectorStrideConvertFuncType getVectorStrideDownC
 }
 }
 }
+
+namespace daal
+{
+namespace internal
+{
+
+template<typename T>
+services::Status transposeCompressedSparse(size_t nRows, size_t nCols, const T *values, const size_t *indices, const size_t *offsets,
+                                           T *tValues, size_t *tIndices, size_t *tOffsets)
+{
+    typedef services::Status (*funcType)(size_t nRows, size_t nCols, const T *values, const size_t *indices, const size_t *offsets,
+                                         T *tValues, size_t *tIndices, size_t *tOffsets);
+    static funcType ptr = 0;
+
+    if(!ptr)
+    {
+        int cpuid = (int)daal::services::Environment::getInstance()->getCpuId();
+
+        switch(cpuid)
+        {
+#ifdef DAAL_KERNEL_AVX512
+            case avx512    : DAAL_KERNEL_AVX512_ONLY_CODE    (ptr = transposeCompressedSparseCpu<T, avx512    >); break;
+#endif
+#ifdef DAAL_KERNEL_AVX512_mic
+            case avx512_mic: DAAL_KERNEL_AVX512_mic_ONLY_CODE(ptr = transposeCompressedSparseCpu<T, avx512_mic>); break;
+#endif
+#ifdef DAAL_KERNEL_AVX2
+            case avx2      : DAAL_KERNEL_AVX2_ONLY_CODE      (ptr = transposeCompressedSparseCpu<T, avx2      >); break;
+#endif
+#ifdef DAAL_KERNEL_AVX
+            case avx       : DAAL_KERNEL_AVX_ONLY_CODE       (ptr = transposeCompressedSparseCpu<T, avx       >); break;
+#endif
+#ifdef DAAL_KERNEL_SSE42
+            case sse42     : DAAL_KERNEL_SSE42_ONLY_CODE     (ptr = transposeCompressedSparseCpu<T, sse42     >); break;
+#endif
+#ifdef DAAL_KERNEL_SSSE3
+            case ssse3     : DAAL_KERNEL_SSSE3_ONLY_CODE     (ptr = transposeCompressedSparseCpu<T, ssse3     >); break;
+#endif
+            default        : ptr = transposeCompressedSparseCpu<T, sse2>; break;
+        };
+    }
+
+    return ptr(nRows, nCols, values, indices, offsets, tValues, tIndices, tOffsets);
+}
+
+template services::Status transposeCompressedSparse<float >(size_t, size_t, const float  *, const size_t *, const size_t *, float  *, size_t *, size_t *);
+template services::Status transposeCompressedSparse<double>(size_t, size_t, const double *, const size_t *, const size_t *, double *, size_t *, size_t *);
+template services::Status transposeCompressedSparse<int   >(size_t, size_t, const int    *, const size_t *, const size_t *, int    *, size_t *, size_t *);
+
+template<typename T>
+services::Status convertCSRToBSR(size_t nRows, size_t nCols, size_t blockRowSize, size_t blockColSize,
+                                 const T *values, const size_t *indices, const size_t *offsets,
+                                 size_t *bOffsets, size_t *bIndices, T *bValues)
+{
+    typedef services::Status (*funcType)(size_t nRows, size_t nCols, size_t blockRowSize, size_t blockColSize,
+                                         const T *values, const size_t *indices, const size_t *offsets,
+                                         size_t *bOffsets, size_t *bIndices, T *bValues);
+    static funcType ptr = 0;
+
+    if(!ptr)
+    {
+        int cpuid = (int)daal::services::Environment::getInstance()->getCpuId();
+
+        switch(cpuid)
+        {
+#ifdef DAAL_KERNEL_AVX512
+            case avx512    : DAAL_KERNEL_AVX512_ONLY_CODE    (ptr = convertCSRToBSRCpu<T, avx512    >); break;
+#endif
+#ifdef DAAL_KERNEL_AVX512_mic
+            case avx512_mic: DAAL_KERNEL_AVX512_mic_ONLY_CODE(ptr = convertCSRToBSRCpu<T, avx512_mic>); break;
+#endif
+#ifdef DAAL_KERNEL_AVX2
+            case avx2      : DAAL_KERNEL_AVX2_ONLY_CODE      (ptr = convertCSRToBSRCpu<T, avx2      >); break;
+#endif
+#ifdef DAAL_KERNEL_AVX
+            case avx       : DAAL_KERNEL_AVX_ONLY_CODE       (ptr = convertCSRToBSRCpu<T, avx       >); break;
+#endif
+#ifdef DAAL_KERNEL_SSE42
+            case sse42     : DAAL_KERNEL_SSE42_ONLY_CODE     (ptr = convertCSRToBSRCpu<T, sse42     >); break;
+#endif
+#ifdef DAAL_KERNEL_SSSE3
+            case ssse3     : DAAL_KERNEL_SSSE3_ONLY_CODE     (ptr = convertCSRToBSRCpu<T, ssse3     >); break;
+#endif
+            default        : ptr = convertCSRToBSRCpu<T, sse2>; break;
+        };
+    }
+
+    return ptr(nRows, nCols, blockRowSize, blockColSize, values, indices, offsets, bOffsets, bIndices, bValues);
+}
+
+template services::Status convertCSRToBSR<float >(size_t, size_t, size_t, size_t, const float  *, const size_t *, const size_t *, size_t *, size_t *, float  *);
+template services::Status convertCSRToBSR<double>(size_t, size_t, size_t, size_t, const double *, const size_t *, const size_t *, size_t *, size_t *, double *);
+template services::Status convertCSRToBSR<int   >(size_t, size_t, size_t, size_t, const int    *, const size_t *, const size_t *, size_t *, size_t *, int    *);
+
+}
+}
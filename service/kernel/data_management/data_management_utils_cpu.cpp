@@ -41,6 +41,7 @@
 
 #include "data_utils.h"
 #include "service_data_utils.h"
+#include "service_sparse_utils.h"
 
 namespace daal
 {
@@ -111,3 +112,30 @@ DAAL_CONVERT_DOWN_FUNCS(vectorStrideConvertFuncCpu,(size_t n, void *src, size_t
 }
 }
 }
+
+namespace daal
+{
+namespace internal
+{
+
+#undef  DAAL_INSTANTIATE_SPARSE_TRANSPOSE
+#define DAAL_INSTANTIATE_SPARSE_TRANSPOSE(T)                                                                                         \
+template services::Status transposeCompressedSparseCpu<T, DAAL_CPU>(size_t nRows, size_t nCols, const T *values, const size_t *indices, \
+                                                                    const size_t *offsets, T *tValues, size_t *tIndices, size_t *tOffsets);
+
+DAAL_INSTANTIATE_SPARSE_TRANSPOSE(float)
+DAAL_INSTANTIATE_SPARSE_TRANSPOSE(double)
+DAAL_INSTANTIATE_SPARSE_TRANSPOSE(int)
+
+#undef  DAAL_INSTANTIATE_SPARSE_TO_BSR
+#define DAAL_INSTANTIATE_SPARSE_TO_BSR(T)                                                                                            \
+template services::Status convertCSRToBSRCpu<T, DAAL_CPU>(size_t nRows, size_t nCols, size_t blockRowSize, size_t blockColSize,    \
+                                                          const T *values, const size_t *indices, const size_t *offsets,          \
+                                                          size_t *bOffsets, size_t *bIndices, T *bValues);
+
+DAAL_INSTANTIATE_SPARSE_TO_BSR(float)
+DAAL_INSTANTIATE_SPARSE_TO_BSR(double)
+DAAL_INSTANTIATE_SPARSE_TO_BSR(int)
+
+}
+}
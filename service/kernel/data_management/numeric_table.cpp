@@ -46,6 +46,8 @@
 #include "data_management/data/row_merged_numeric_table.h"
 #include "data_management/data/aos_numeric_table.h"
 #include "data_management/data/csr_numeric_table.h"
+#include "data_management/data/csc_numeric_table.h"
+#include "data_management/data/bsr_numeric_table.h"
 #include "data_management/data/soa_numeric_table.h"
 #include "data_management/data/data_collection.h"
 #include "data_management/data/memory_block.h"
@@ -236,6 +238,8 @@ DAAL_INSTANTIATE_SLOW(long          )
 
 IMPLEMENT_SERIALIZABLE_TAG(SOANumericTable,SERIALIZATION_SOA_NT_ID)
 IMPLEMENT_SERIALIZABLE_TAG(CSRNumericTable,SERIALIZATION_CSR_NT_ID)
+IMPLEMENT_SERIALIZABLE_TAG(CSCNumericTable,SERIALIZATION_CSC_NT_ID)
+IMPLEMENT_SERIALIZABLE_TAG(BSRNumericTable,SERIALIZATION_BSR_NT_ID)
 IMPLEMENT_SERIALIZABLE_TAG(AOSNumericTable,SERIALIZATION_AOS_NT_ID)
 IMPLEMENT_SERIALIZABLE_TAG(MergedNumericTable,SERIALIZATION_MERGE_NT_ID)
 IMPLEMENT_SERIALIZABLE_TAG(RowMergedNumericTable,SERIALIZATION_ROWMERGE_NT_ID)
@@ -0,0 +1,422 @@
+/* file: prefetching_data_source.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the data source that loads data blocks in the background.
+//--
+*/
+
+#include "data_management/data_source/prefetching_data_source.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "service_threading.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace interface1
+{
+
+/**
+ * Ring of numeric tables filled by a background task.
+ * The consumer holds at most one slot, the slots that follow it are filled by the producer.
+ * The producer runs while there are free slots, and it is restarted by the consumer after every taken block,
+ * so only one task reads from the wrapped data source at a time
+ */
+class PrefetchingDataSourceImpl
+{
+public:
+    DAAL_NEW_DELETE();
+
+    PrefetchingDataSourceImpl(DataSource &source, size_t blockSize, size_t nBuffers) :
+        _source(source), _blockSize(blockSize), _nBuffers(nBuffers), _tables(nBuffers), _nRows(nBuffers),
+        _first(0), _nFilled(0), _current(nBuffers), _isEndOfData(false), _isProducerRunning(false), _isAllocated(false),
+        _blockOffset(0), _nBlockRows(0), _rowsCapacity(0)
+    {}
+
+    ~PrefetchingDataSourceImpl()
+    {
+        stop();
+    }
+
+    services::Status allocate()
+    {
+        if(_isAllocated)
+            return services::Status();
+
+        if(!_source.getDictionarySharedPtr())
+            return services::Status(services::ErrorDictionaryNotAvailable);
+
+        DataSourceIface &source = _source;
+        services::Status s;
+        for(size_t i = 0; i < _nBuffers; i++)
+        {
+            source.freeNumericTable();
+            s |= source.allocateNumericTable();
+            if(!s)
+                break;
+            _tables[i] = source.getNumericTable();
+            if(!_tables[i])
+            {
+                s |= services::Status(services::ErrorNumericTableNotAllocated);
+                break;
+            }
+        }
+        source.freeNumericTable();
+        if(!s)
+            return s;
+
+        _isAllocated = true;
+        startProducer();
+        return s;
+    }
+
+    void stop()
+    {
+        {
+            AutoLock lock(_mutex);
+            _isEndOfData = true;
+        }
+        _tasks.wait();
+    }
+
+    size_t next(NumericTablePtr &table)
+    {
+        {
+            AutoLock lock(_mutex);
+            _current = _nBuffers;
+        }
+        table = NumericTablePtr();
+
+        for(;;)
+        {
+            bool isProducerStopped = false;
+            {
+                AutoLock lock(_mutex);
+                if(_nFilled)
+                {
+                    _current = _first;
+                    _first = (_first + 1) % _nBuffers;
+                    _nFilled--;
+                    table = _tables[_current];
+                    isProducerStopped = !_isProducerRunning;
+                }
+                else if(_isEndOfData && !_isProducerRunning)
+                {
+                    return 0;
+                }
+            }
+
+            if(table)
+            {
+                if(isProducerStopped)
+                    startProducer();
+                return _nRows[_current];
+            }
+
+            /* The next block is not loaded yet */
+            startProducer();
+            _tasks.wait();
+        }
+    }
+
+    /**
+     * Copies up to maxRows rows of the loaded blocks into a table of rows.
+     * Used by the reads that do not match the blocks, the rows left in the block are returned by the next reads
+     */
+    services::Status copyRows(size_t maxRows, NumericTablePtr &table, size_t &nRows)
+    {
+        services::Status s;
+        nRows = 0;
+        const size_t nColumns = _tables[0]->getNumberOfColumns();
+        if(!_rowsTable || maxRows > _rowsCapacity)
+        {
+            _rows = services::SharedPtr<DAAL_DATA_TYPE>((DAAL_DATA_TYPE *)services::daal_malloc(maxRows * nColumns * sizeof(DAAL_DATA_TYPE)),
+                                                        services::ServiceDeleter());
+            if(!_rows)
+                return services::Status(services::ErrorMemoryAllocationFailed);
+            _rowsTable = HomogenNumericTable<DAAL_DATA_TYPE>::create(_rows, nColumns, maxRows, &s);
+            if(!s)
+                return s;
+            _rowsCapacity = maxRows;
+        }
+
+        while(nRows < maxRows)
+        {
+            if(_blockOffset == _nBlockRows)
+            {
+                _blockOffset = 0;
+                _nBlockRows = next(_block);
+                if(!_nBlockRows)
+                    break;
+            }
+            const size_t nCopied = (maxRows - nRows < _nBlockRows - _blockOffset ? maxRows - nRows : _nBlockRows - _blockOffset);
+
+            BlockDescriptor<DAAL_DATA_TYPE> block;
+            s |= _block->getBlockOfRows(_blockOffset, nCopied, readOnly, block);
+            if(!s)
+                return s;
+            services::daal_memcpy_s(_rows.get() + nRows * nColumns, (maxRows - nRows) * nColumns * sizeof(DAAL_DATA_TYPE),
+                                    block.getBlockPtr(), nCopied * nColumns * sizeof(DAAL_DATA_TYPE));
+            s |= _block->releaseBlockOfRows(block);
+
+            nRows += nCopied;
+            _blockOffset += nCopied;
+        }
+
+        s |= _rowsTable->resize(nRows);
+        table = _rowsTable;
+        return s;
+    }
+
+    /* Number of rows of the current block not yet returned by the reads that do not match the blocks */
+    size_t getNumberOfRowsLeftInBlock() const { return _nBlockRows - _blockOffset; }
+
+    size_t getNumberOfLoadedRows()
+    {
+        AutoLock lock(_mutex);
+        size_t nRows = getNumberOfRowsLeftInBlock();
+        for(size_t i = 0; i < _nFilled; i++)
+        {
+            nRows += _nRows[(_first + i) % _nBuffers];
+        }
+        return nRows;
+    }
+
+    bool isEndOfData()
+    {
+        AutoLock lock(_mutex);
+        return _isEndOfData && !_nFilled && !_isProducerRunning && !getNumberOfRowsLeftInBlock();
+    }
+
+    bool isAllocated() const { return _isAllocated; }
+
+    void produce()
+    {
+        for(;;)
+        {
+            size_t slot;
+            {
+                AutoLock lock(_mutex);
+                const size_t nBusy = _nFilled + (_current < _nBuffers ? 1 : 0);
+                if(_isEndOfData || nBusy >= _nBuffers)
+                {
+                    _isProducerRunning = false;
+                    return;
+                }
+                slot = (_first + _nFilled) % _nBuffers;
+            }
+
+            /* The slot is neither held by the consumer nor filled, so it is accessed without the lock */
+            const size_t nRows = _source.loadDataBlock(_blockSize, _tables[slot].get());
+
+            AutoLock lock(_mutex);
+            _nRows[slot] = nRows;
+            if(nRows)
+                _nFilled++;
+            else
+                _isEndOfData = true;
+        }
+    }
+
+private:
+    struct Producer
+    {
+        Producer(PrefetchingDataSourceImpl &impl) : _impl(impl) {}
+        void operator()() { _impl.produce(); }
+        PrefetchingDataSourceImpl &_impl;
+    };
+
+    void startProducer()
+    {
+        {
+            AutoLock lock(_mutex);
+            if(_isProducerRunning || _isEndOfData)
+                return;
+            _isProducerRunning = true;
+        }
+        /* The task group runs the producer synchronously if the library is linked with the sequential threading layer */
+        Producer producer(*this);
+        _tasks.run(producer);
+    }
+
+    DataSource &_source;
+    const size_t _blockSize;
+    const size_t _nBuffers;
+    services::Collection<NumericTablePtr> _tables;
+    services::Collection<size_t> _nRows;
+
+    size_t _first;              /* Index of the oldest filled slot */
+    size_t _nFilled;            /* Number of filled slots not yet taken by the consumer */
+    size_t _current;            /* Slot held by the consumer, _nBuffers if none */
+    bool _isEndOfData;
+    bool _isProducerRunning;
+    bool _isAllocated;
+
+    /* Accessed by the consumer only */
+    NumericTablePtr _block;     /* Block the rows are copied from */
+    size_t _blockOffset;        /* Number of rows of the block already copied */
+    size_t _nBlockRows;
+    services::SharedPtr<DAAL_DATA_TYPE> _rows;
+    NumericTablePtr _rowsTable; /* Table of the copied rows, its memory is reused while the reads fit into it */
+    size_t _rowsCapacity;
+
+    Mutex _mutex;
+    task_group _tasks;
+};
+
+PrefetchingDataSource::PrefetchingDataSource(DataSource &source, size_t blockSize, size_t nBuffers) :
+    DataSource(), _source(source), _blockSize(blockSize), _impl(NULL)
+{
+    _impl = new PrefetchingDataSourceImpl(source, blockSize, (nBuffers < 2 ? 2 : nBuffers));
+    if(!blockSize)
+        this->_status.add(services::throwIfPossible(services::ErrorIncorrectParameter));
+}
+
+PrefetchingDataSource::~PrefetchingDataSource()
+{
+    delete _impl;
+}
+
+services::Status PrefetchingDataSource::allocateNumericTable()
+{
+    services::Status s = checkDictionary();
+    if(s)
+        s |= _impl->allocate();
+    return services::throwIfPossible(s);
+}
+
+void PrefetchingDataSource::freeNumericTable()
+{
+    _spnt = NumericTablePtr();
+}
+
+services::Status PrefetchingDataSource::createDictionaryFromContext()
+{
+    if(_dict)
+        return services::throwIfPossible(services::Status(services::ErrorDictionaryAlreadyAvailable));
+
+    _dict = _source.getDictionarySharedPtr();
+    if(!_dict)
+    {
+        services::Status s = _source.status();
+        return services::throwIfPossible(s ? services::Status(services::ErrorDictionaryNotAvailable) : s);
+    }
+    return services::Status();
+}
+
+DataSourceIface::DataSourceStatus PrefetchingDataSource::getStatus()
+{
+    if(!_blockSize)
+        return notReady;
+    if(!_impl->isAllocated())
+        return _source.getStatus();
+    return _impl->isEndOfData() ? endOfData : readyForLoad;
+}
+
+size_t PrefetchingDataSource::getNumberOfColumns()
+{
+    checkDictionary();
+    return _dict ? _dict->getNumberOfFeatures() : 0;
+}
+
+size_t PrefetchingDataSource::getNumericTableNumberOfColumns()
+{
+    return _source.getNumericTableNumberOfColumns();
+}
+
+size_t PrefetchingDataSource::getNumberOfAvailableRows()
+{
+    return _impl->getNumberOfLoadedRows();
+}
+
+size_t PrefetchingDataSource::loadDataBlock()
+{
+    return loadDataBlock(_blockSize);
+}
+
+size_t PrefetchingDataSource::loadDataBlock(size_t maxRows)
+{
+    if(!_blockSize || !maxRows)
+    {
+        this->_status.add(services::throwIfPossible(services::ErrorIncorrectParameter));
+        return 0;
+    }
+    if(!_impl->isAllocated())
+    {
+        services::Status s = allocateNumericTable();
+        if(!s)
+        {
+            this->_status.add(s);
+            return 0;
+        }
+    }
+
+    size_t nRows = 0;
+    if(maxRows == _blockSize && !_impl->getNumberOfRowsLeftInBlock())
+    {
+        /* The loaded block is returned without copying */
+        nRows = _impl->next(_spnt);
+    }
+    else
+    {
+        services::Status s = _impl->copyRows(maxRows, _spnt, nRows);
+        if(!s)
+        {
+            this->_status.add(services::throwIfPossible(s));
+            return 0;
+        }
+    }
+
+    if(!nRows)
+    {
+        /* The producer is stopped at the end of data, so the status of the wrapped data source is safe to read */
+        services::Status s = _source.status();
+        if(!s)
+            this->_status.add(s);
+    }
+    return nRows;
+}
+
+}
+}
+}
@@ -839,7 +839,7 @@ public:
 private:
     void alloc(size_t n)
     {
-        _data = (T*)(n ? daal::services::daal_malloc(n*sizeof(T)) : nullptr);
+        _data = (n ? services::internal::service_pooled_malloc<T, cpu>(n) : nullptr);
         if(_data)
         {
             for(size_t i = 0; i < n; ++i)
@@ -854,7 +854,7 @@ private:
         {
             for(size_t i = 0; i < _size; ++i)
                 _data[i].~T();
-            daal::services::daal_free(_data);
+            services::internal::service_pooled_free<T, cpu>(_data);
             _data = nullptr;
             _size = 0;
         }
@@ -898,14 +898,14 @@ public:
 private:
     void alloc(size_t n)
     {
-        _data = daal::services::internal::service_calloc<T, cpu>(n);
+        _data = daal::services::internal::service_pooled_calloc<T, cpu>(n);
     }
 
     void destroy()
     {
         if(_data)
         {
-            daal::services::daal_free(_data);
+            daal::services::internal::service_pooled_free<T, cpu>(_data);
             _data = nullptr;
             _size = 0;
         }
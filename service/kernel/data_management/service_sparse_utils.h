@@ -0,0 +1,392 @@
+/* file: service_sparse_utils.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Utilities for data in compressed sparse layouts
+//--
+*/
+
+#ifndef __SERVICE_SPARSE_UTILS_H__
+#define __SERVICE_SPARSE_UTILS_H__
+
+#include "services/daal_defines.h"
+#include "services/error_handling.h"
+#include "threading.h"
+#include "csc_numeric_table.h"
+#include "service_numeric_table.h"
+#include "service_error_handling.h"
+#include "service_sort.h"
+
+namespace daal
+{
+namespace internal
+{
+
+/**
+ * Transposes the matrix of nRows x nCols size stored in the compressed sparse layout with one-based indexing.
+ * The same routine converts CSR data into CSC data and CSC data into CSR data.
+ * Indices within every compressed vector of the result are sorted in ascending order.
+ *
+ * \param[in]  nRows        Number of compressed vectors in the source matrix
+ * \param[in]  nCols        Number of elements in every vector of the source matrix
+ * \param[in]  values       Array of non-zero values of the source matrix
+ * \param[in]  indices      Array of one-based indices of non-zero values within the vectors of the source matrix
+ * \param[in]  offsets      Array of nRows + 1 one-based offsets of the vectors of the source matrix
+ * \param[out] tValues      Array of non-zero values of the transposed matrix
+ * \param[out] tIndices     Array of one-based indices of non-zero values within the vectors of the transposed matrix
+ * \param[out] tOffsets     Array of nCols + 1 one-based offsets of the vectors of the transposed matrix
+ */
+template<typename T, CpuType cpu>
+services::Status transposeCompressedSparseCpu(size_t nRows, size_t nCols, const T *values, const size_t *indices, const size_t *offsets,
+                                              T *tValues, size_t *tIndices, size_t *tOffsets)
+{
+    const size_t dataSize = offsets[nRows] - offsets[0];
+
+    /* Rows are split into blocks processed in parallel. Every block keeps the counters of its non-zero values
+       in each column, so the number of blocks is limited to keep the counters not larger than the data itself */
+    size_t nBlocks = threader_get_threads_number();
+    if(nCols && nBlocks > 1 + dataSize / nCols) { nBlocks = 1 + dataSize / nCols; }
+    if(nBlocks > nRows) { nBlocks = nRows; }
+    if(!nBlocks) { nBlocks = 1; }
+    const size_t blockSize = nRows / nBlocks;
+
+    TArray<size_t, cpu> positionsPtr(nBlocks * nCols);
+    size_t *positions = positionsPtr.get();
+    DAAL_CHECK_MALLOC(positions || !nCols);
+
+    /* Count the non-zero values in every column of every block of rows */
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        const size_t iStart = iBlock * blockSize;
+        const size_t iEnd   = (iBlock + 1 == nBlocks ? nRows : iStart + blockSize);
+        size_t *blockPositions = positions + iBlock * nCols;
+
+        for(size_t j = 0; j < nCols; j++) { blockPositions[j] = 0; }
+        for(size_t k = offsets[iStart] - 1; k < offsets[iEnd] - 1; k++)
+        {
+            blockPositions[indices[k] - 1]++;
+        }
+    } );
+
+    /* Compute the sizes of the columns of the transposed matrix */
+    const size_t colBlockSize = 4096;
+    const size_t nColBlocks = (nCols + colBlockSize - 1) / colBlockSize;
+    daal::threader_for(nColBlocks, nColBlocks, [&](size_t iColBlock)
+    {
+        const size_t jEnd = (iColBlock + 1 == nColBlocks ? nCols : (iColBlock + 1) * colBlockSize);
+        for(size_t j = iColBlock * colBlockSize; j < jEnd; j++)
+        {
+            size_t colSize = 0;
+            for(size_t iBlock = 0; iBlock < nBlocks; iBlock++)
+            {
+                colSize += positions[iBlock * nCols + j];
+            }
+            tOffsets[j + 1] = colSize;
+        }
+    } );
+
+    tOffsets[0] = 1;
+    for(size_t j = 0; j < nCols; j++)
+    {
+        tOffsets[j + 1] += tOffsets[j];
+    }
+
+    /* Turn the counters into zero-based positions where every block writes its values */
+    daal::threader_for(nColBlocks, nColBlocks, [&](size_t iColBlock)
+    {
+        const size_t jEnd = (iColBlock + 1 == nColBlocks ? nCols : (iColBlock + 1) * colBlockSize);
+        for(size_t j = iColBlock * colBlockSize; j < jEnd; j++)
+        {
+            size_t position = tOffsets[j] - 1;
+            for(size_t iBlock = 0; iBlock < nBlocks; iBlock++)
+            {
+                const size_t count = positions[iBlock * nCols + j];
+                positions[iBlock * nCols + j] = position;
+                position += count;
+            }
+        }
+    } );
+
+    /* Scatter the values. Blocks are ordered by rows, so the row indices within each column are sorted */
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        const size_t iStart = iBlock * blockSize;
+        const size_t iEnd   = (iBlock + 1 == nBlocks ? nRows : iStart + blockSize);
+        size_t *blockPositions = positions + iBlock * nCols;
+
+        for(size_t i = iStart; i < iEnd; i++)
+        {
+            for(size_t k = offsets[i] - 1; k < offsets[i + 1] - 1; k++)
+            {
+                const size_t position = blockPositions[indices[k] - 1]++;
+                tValues[position]  = values[k];
+                tIndices[position] = i + 1;
+            }
+        }
+    } );
+
+    return services::Status();
+}
+
+/**
+ * Converts the matrix of nRows x nCols size stored in the CSR layout with one-based indexing into the blocked CSR (BSR) layout
+ * with blocks of blockRowSize x blockColSize values. The conversion runs in two calls: the first call with NULL bIndices
+ * computes the offsets of the rows of blocks, the second call with the same bOffsets fills the blocks.
+ * Blocks within every row of blocks are sorted by their columns.
+ *
+ * \param[in]     nRows         Number of rows in the matrix
+ * \param[in]     nCols         Number of columns in the matrix
+ * \param[in]     blockRowSize  Number of rows in a block
+ * \param[in]     blockColSize  Number of columns in a block
+ * \param[in]     values        Array of non-zero values of the matrix
+ * \param[in]     indices       Array of one-based column indices of the non-zero values
+ * \param[in]     offsets       Array of nRows + 1 one-based row offsets
+ * \param[in,out] bOffsets      Array of ceil(nRows / blockRowSize) + 1 one-based offsets of the rows of blocks
+ * \param[out]    bIndices      Array of one-based column indices of the blocks, NULL on the first call
+ * \param[out]    bValues       Array of values of the blocks, blockRowSize * blockColSize values per block
+ */
+template<typename T, CpuType cpu>
+services::Status convertCSRToBSRCpu(size_t nRows, size_t nCols, size_t blockRowSize, size_t blockColSize,
+                                    const T *values, const size_t *indices, const size_t *offsets,
+                                    size_t *bOffsets, size_t *bIndices, T *bValues)
+{
+    const size_t nBlockRows = (nRows + blockRowSize - 1) / blockRowSize;
+    const size_t nBlockCols = (nCols + blockColSize - 1) / blockColSize;
+    const size_t blockSize  = blockRowSize * blockColSize;
+    const bool isCountOnly  = (bIndices == NULL);
+
+    /* Each task owns the markers of the columns of blocks, so the number of tasks is limited by the number of threads */
+    size_t nTasks = threader_get_threads_number();
+    if(nTasks > nBlockRows) { nTasks = nBlockRows; }
+    if(!nTasks) { nTasks = 1; }
+    const size_t taskSize = nBlockRows / nTasks;
+
+    SafeStatus safeStat;
+    daal::threader_for(nTasks, nTasks, [&](size_t iTask)
+    {
+        const size_t biStart = iTask * taskSize;
+        const size_t biEnd   = (iTask + 1 == nTasks ? nBlockRows : biStart + taskSize);
+
+        /* marker[bj] is the last row of blocks that has the column of blocks bj, slot[bj] is the position of the block in it */
+        TArray<size_t, cpu> markerPtr(nBlockCols), slotPtr(nBlockCols), blockColsPtr(nBlockCols);
+        size_t *marker = markerPtr.get();
+        size_t *slot = slotPtr.get();
+        size_t *blockCols = blockColsPtr.get();
+        DAAL_CHECK_MALLOC_THR(!nBlockCols || (marker && slot && blockCols));
+        for(size_t bj = 0; bj < nBlockCols; bj++) { marker[bj] = nBlockRows; }
+
+        for(size_t bi = biStart; bi < biEnd; bi++)
+        {
+            const size_t iStart = bi * blockRowSize;
+            const size_t iEnd   = (iStart + blockRowSize < nRows ? iStart + blockRowSize : nRows);
+
+            size_t nBlocks = 0;
+            for(size_t k = offsets[iStart] - 1; k < offsets[iEnd] - 1; k++)
+            {
+                const size_t bj = (indices[k] - 1) / blockColSize;
+                if(marker[bj] != bi)
+                {
+                    marker[bj] = bi;
+                    blockCols[nBlocks++] = bj;
+                }
+            }
+
+            if(isCountOnly)
+            {
+                bOffsets[bi + 1] = nBlocks;
+                continue;
+            }
+
+            daal::algorithms::internal::qSort<size_t, cpu>(nBlocks, blockCols);
+            const size_t first = bOffsets[bi] - 1;
+            for(size_t b = 0; b < nBlocks; b++)
+            {
+                slot[blockCols[b]] = first + b;
+                bIndices[first + b] = blockCols[b] + 1;
+            }
+            for(size_t v = first * blockSize; v < (first + nBlocks) * blockSize; v++) { bValues[v] = (T)0; }
+
+            for(size_t i = iStart; i < iEnd; i++)
+            {
+                const size_t rowShift = (i - iStart) * blockColSize;
+                for(size_t k = offsets[i] - 1; k < offsets[i + 1] - 1; k++)
+                {
+                    const size_t j = indices[k] - 1;
+                    bValues[slot[j / blockColSize] * blockSize + rowShift + j % blockColSize] = values[k];
+                }
+            }
+        }
+    } );
+    DAAL_CHECK_SAFE_STATUS();
+
+    if(isCountOnly)
+    {
+        bOffsets[0] = 1;
+        for(size_t bi = 0; bi < nBlockRows; bi++)
+        {
+            bOffsets[bi + 1] += bOffsets[bi];
+        }
+    }
+    return services::Status();
+}
+
+/**
+ * Reads all vectors of a sparse numeric table in the compressed layout with one-based indexing:
+ * rows in the CSR layout if byColumns is false, columns in the CSC layout otherwise.
+ * A table that stores its data in the requested layout is read as is. Other sparse tables are read
+ * in their own layout and transposed once into buffers owned by the object
+ */
+template<typename algorithmFPType, CpuType cpu, bool byColumns>
+class ReadSparseVectors
+{
+public:
+    explicit ReadSparseVectors(NumericTable *data) :
+        _csrTable(nullptr), _cscTable(nullptr), _values(nullptr), _indices(nullptr), _offsets(nullptr)
+    {
+        const size_t nRows = data->getNumberOfRows();
+        const size_t nCols = data->getNumberOfColumns();
+
+        _csrTable = dynamic_cast<CSRNumericTableIface *>(data);
+        _cscTable = (_csrTable ? nullptr : dynamic_cast<CSCNumericTableIface *>(data));
+        if(!_csrTable && !_cscTable)
+        {
+            _status.add(services::ErrorIncorrectTypeOfInputNumericTable);
+            return;
+        }
+
+        _status = (_csrTable ? _csrTable->getSparseBlock(0, nRows, readOnly, _block) :
+                               _cscTable->getSparseColumnBlock(0, nCols, readOnly, _block));
+        if(!_status)
+        {
+            _csrTable = nullptr;
+            _cscTable = nullptr;
+            return;
+        }
+
+        const algorithmFPType *values = _block.getBlockValuesPtr();
+        const size_t *indices = _block.getBlockColumnIndicesPtr();
+        const size_t *offsets = _block.getBlockRowIndicesPtr();
+
+        if((_cscTable != nullptr) == byColumns)
+        {
+            _values  = values;
+            _indices = indices;
+            _offsets = offsets;
+            return;
+        }
+
+        const size_t nVectors    = (byColumns ? nCols : nRows);
+        const size_t nSrcVectors = (byColumns ? nRows : nCols);
+        const size_t dataSize    = offsets[nSrcVectors] - 1;
+
+        _tValues.reset(dataSize);
+        _tIndices.reset(dataSize);
+        _tOffsets.reset(nVectors + 1);
+        if((dataSize && (!_tValues.get() || !_tIndices.get())) || !_tOffsets.get())
+        {
+            _status.add(services::ErrorMemoryAllocationFailed);
+            release();
+            return;
+        }
+
+        _status = transposeCompressedSparseCpu<algorithmFPType, cpu>(nSrcVectors, nVectors, values, indices, offsets,
+                                                                     _tValues.get(), _tIndices.get(), _tOffsets.get());
+        release();
+
+        _values  = _tValues.get();
+        _indices = _tIndices.get();
+        _offsets = _tOffsets.get();
+    }
+
+    ~ReadSparseVectors() { release(); }
+
+    const algorithmFPType *values() const { return _values; }
+    const size_t *indices() const { return _indices; }
+    const size_t *offsets() const { return _offsets; }
+    const services::Status &status() const { return _status; }
+
+private:
+    void release()
+    {
+        if(_csrTable) { _csrTable->releaseSparseBlock(_block); }
+        if(_cscTable) { _cscTable->releaseSparseColumnBlock(_block); }
+        _csrTable = nullptr;
+        _cscTable = nullptr;
+    }
+
+    CSRNumericTableIface *_csrTable;
+    CSCNumericTableIface *_cscTable;
+    CSRBlockDescriptor<algorithmFPType> _block;
+    TArray<algorithmFPType, cpu> _tValues;
+    TArray<size_t, cpu> _tIndices;
+    TArray<size_t, cpu> _tOffsets;
+    const algorithmFPType *_values;
+    const size_t *_indices;
+    const size_t *_offsets;
+    services::Status _status;
+};
+
+template<typename algorithmFPType, CpuType cpu>
+using ReadRowsSparse = ReadSparseVectors<algorithmFPType, cpu, false>;
+
+template<typename algorithmFPType, CpuType cpu>
+using ReadColumnsSparse = ReadSparseVectors<algorithmFPType, cpu, true>;
+
+/**
+ * Calls transposeCompressedSparseCpu optimized for the CPU the library runs on
+ */
+template<typename T>
+services::Status transposeCompressedSparse(size_t nRows, size_t nCols, const T *values, const size_t *indices, const size_t *offsets,
+                                           T *tValues, size_t *tIndices, size_t *tOffsets);
+
+/**
+ * Calls convertCSRToBSRCpu optimized for the CPU the library runs on
+ */
+template<typename T>
+services::Status convertCSRToBSR(size_t nRows, size_t nCols, size_t blockRowSize, size_t blockColSize,
+                                 const T *values, const size_t *indices, const size_t *offsets,
+                                 size_t *bOffsets, size_t *bIndices, T *bValues);
+
+} // namespace internal
+} // namespace daal
+
+#endif
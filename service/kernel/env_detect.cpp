@@ -51,6 +51,7 @@
 #include "daal_defines.h"
 #include "service_defines.h"
 #include "service_service.h"
+#include "service_memory.h"
 #include "threading.h"
 
 #if defined(_MSC_VER) && !defined(__DAAL_IMPLEMENTATION)
@@ -172,6 +173,33 @@ DAAL_EXPORT int daal::services::Environment::setMemoryLimit(MemType type, size_t
 }
 
 
+DAAL_EXPORT void daal::services::Environment::enableMemoryPool(bool enableMemoryPoolFlag)
+{
+    daal::services::internal::enableMemoryPool(enableMemoryPoolFlag);
+}
+
+DAAL_EXPORT bool daal::services::Environment::isMemoryPoolEnabled() const
+{
+    return daal::services::internal::isMemoryPoolEnabled();
+}
+
+DAAL_EXPORT void daal::services::Environment::setMemoryPoolLimit(size_t limit)
+{
+    daal::services::internal::setMemoryPoolLimit(limit * 1024 * 1024);
+}
+
+DAAL_EXPORT void daal::services::Environment::releaseMemoryPool()
+{
+    daal::services::internal::releaseMemoryPool();
+}
+
+DAAL_EXPORT daal::services::Environment::MemoryPoolStatistics daal::services::Environment::getMemoryPoolStatistics() const
+{
+    MemoryPoolStatistics stat;
+    daal::services::internal::getMemoryPoolStatistics(stat.nAllocations, stat.nReuses, stat.nDeallocations, stat.nCachedBlocks, stat.cachedBytes);
+    return stat;
+}
+
 DAAL_EXPORT void daal::services::Environment::enableThreadPinning(const bool enableThreadPinningFlag)
 {
 #if !(defined DAAL_THREAD_PINNING_DISABLED)
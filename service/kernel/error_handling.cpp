@@ -1004,6 +1004,8 @@ void ErrorMessageCollection::parseResourceFile()
     add(ErrorSQLstmtHandle, "ErrorSQLstmtHandle");
     add(ErrorOnFileOpen, "Error on file open");
     add(ErrorOnFileRead, "Error on file read");
+    add(ErrorArrowFileFormat, "File does not conform to the Arrow IPC file format");
+    add(ErrorArrowTypeUnsupported, "Arrow file uses a data type or a feature that is not supported");
 
     add(ErrorKDBNoConnection, "ErrorKDBNoConnection");
     add(ErrorKDBWrongCredentials, "ErrorKDBWrongCredentials");
@@ -52,6 +52,7 @@
 #include "services/env_detect.h"
 
 int __daal_serv_cpu_detect(int );
+int __daal_serv_cpu_feature_avx512_vnni();
 
 #if defined(_MSC_VER) && !defined(__INTEL_COMPILER)
     #define PRAGMA_IVDEP